@@ -101,6 +101,37 @@ extern Void MQABUF_init () ;
 extern Void MQABUF_exit () ;
 
 
+/** ============================================================================
+ *  @func   MQABUF_addRef
+ *
+ *  @desc   Adds references to a message allocated from a buffer MQA, so that
+ *          the same message can be handed to several readers. Each additional
+ *          reference requires one more MSGQ_free () before the message is
+ *          returned to its buffer pool.
+ *          This function is reentrant.
+ *
+ *  @arg    msg
+ *              The message.
+ *  @arg    count
+ *              Number of references to be added.
+ *
+ *  @ret    MSGQ_SUCCESS
+ *              References successfully added.
+ *          MSGQ_ENOTIMPL
+ *              The message was not allocated by a buffer MQA.
+ *          MSGQ_EMEMORY
+ *              Too many messages are already shared.
+ *
+ *  @enter  The message must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    MQABUF_FXNS
+ *  ============================================================================
+ */
+extern MSGQ_Status MQABUF_addRef (MSGQ_Msg msg, Uint16 count) ;
+
+
 #ifdef __cplusplus
 }
 #endif /* extern "C" */
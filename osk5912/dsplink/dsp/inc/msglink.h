@@ -32,6 +32,33 @@ typedef enum MSGLINK_Mode {
 #define MSGLINK_SUCCESS  0
 #define MSGLINK_FAILURE -1
 
+/*
+ *  Alignment, in MADUs, of the messages and of their headers in a
+ *  zero-copy link's transfer buffers.
+ */
+#define MSGLINK_ALIGN   (sizeof(LgUns))
+
+/*
+ *  Message link attributes.
+ *
+ *  zeroCopy: FALSE for a copying link, where MSGLINK_send() and
+ *      MSGLINK_recv() copy one fixed-size message per channel transfer.
+ *      TRUE for a zero-copy link, where messages of any size up to the
+ *      transfer buffer size are allocated in the transfer buffers with
+ *      MSGLINK_alloc() and read in place with MSGLINK_get(), and as many
+ *      as fit are packed into one channel transfer.
+ *  segid: memory segment of the transfer buffers. For a zero-copy link
+ *      the messages live in these buffers, so the segment must be
+ *      visible to DSP/BIOS Link.
+ */
+typedef struct MSGLINK_Attrs {
+    Bool    zeroCopy;
+    Int     segid;
+} MSGLINK_Attrs;
+
+/* Default attributes: copying link, buffers in segment 0 */
+extern MSGLINK_Attrs MSGLINK_ATTRS;
+
 /*
  *  ======== MSGLINK_init ========
  *  
@@ -49,12 +76,14 @@ Void MSGLINK_exit( Void );
 /*
  *  ======== MSGLINK_create ========
  *  
- *  Create a new message link.
+ *  Create a new message link. msgSize is the size of the messages on a
+ *  copying link, and the size of the transfer buffers on a zero-copy link.
  */
 Int MSGLINK_create(
        MSGLINK_Mode msglinkMode, /* Whether to use input or output channel   */
        MdUns        msgSize,     /* Size of the msgs to send on the channel  */
-       Uns          timeout      /* Timeout for recv (input) or send (output)*/
+       Uns          timeout,     /* Timeout for recv (input) or send (output)*/
+       MSGLINK_Attrs *attrs      /* Link attributes, NULL for the defaults   */
        );
 
 /*
@@ -80,6 +109,37 @@ Int MSGLINK_send( Ptr msg ); /* Pointer to message to send */
  */
 Int MSGLINK_recv( Ptr msg ); /* Pointer to buffer to recv into */
 
+/*
+ *  ======== MSGLINK_alloc ========
+ *  
+ *  Allocate a message of size MADUs in the output link's current transfer
+ *  buffer (zero-copy links only). Returns NULL on failure.
+ */
+Ptr MSGLINK_alloc( MdUns size ); /* Size of the message */
+
+/*
+ *  ======== MSGLINK_put ========
+ *  
+ *  Hand over the message just allocated with MSGLINK_alloc(). It is sent
+ *  with the transfer buffer, when the buffer is full or flushed.
+ */
+Int MSGLINK_put( Ptr msg ); /* Message returned by MSGLINK_alloc() */
+
+/*
+ *  ======== MSGLINK_flush ========
+ *  
+ *  Send the messages put in the current transfer buffer.
+ */
+Int MSGLINK_flush( Void );
+
+/*
+ *  ======== MSGLINK_get ========
+ *  
+ *  Get the next message from the input link (zero-copy links only).
+ *  The message stays valid until the next call. Returns NULL on failure.
+ */
+Ptr MSGLINK_get( MdUns *size ); /* Returns the size of the message */
+
 #ifdef __cplusplus
 }
 #endif /* extern "C" */
@@ -29,6 +29,32 @@ extern "C" {
 #endif
 
 
+/** ----------------------------------------------------------------------------
+ *  @const  MQABUF_MAXSHARED
+ *
+ *  @desc   Maximum number of messages with additional references outstanding
+ *          at any time, per allocator.
+ *  ----------------------------------------------------------------------------
+ */
+#define MQABUF_MAXSHARED 8
+
+
+/** ----------------------------------------------------------------------------
+ *  @name   MQABUF_Ref
+ *
+ *  @desc   Additional references held on a shared message.
+ *
+ *  @field  msg
+ *              The shared message, or NULL if the entry is unused.
+ *  @field  count
+ *              Number of additional references held on the message.
+ *  ----------------------------------------------------------------------------
+ */
+typedef struct MQABUF_Ref_tag {
+    MSGQ_Msg    msg ;
+    Uint16      count ;
+} MQABUF_Ref ;
+
 /** ----------------------------------------------------------------------------
  *  @name   MQABUF_Obj
  *
@@ -54,11 +80,19 @@ typedef struct MQABUF_Obj_tag {
  *              Number of buffer pools configured in the MQA.
  *  @field  bufPools
  *              Array of buffer pools for various message sizes.
+ *  @field  numShared
+ *              Number of used entries in the shared array.
+ *  @field  shared
+ *              Messages with additional references outstanding. The BUF pools
+ *              do not expose their base address, so references are tracked per
+ *              message rather than per buffer index.
  *  ----------------------------------------------------------------------------
  */
 typedef struct MQABUF_State_tag {
     Uint16        numBufPools ;
     MQABUF_Handle bufPools ;
+    Uint16        numShared ;
+    MQABUF_Ref    shared [MQABUF_MAXSHARED] ;
 } MQABUF_State ;
 
 
@@ -19,6 +19,7 @@
 /*  ----------------------------------- DSP/BIOS Headers            */
 #include <std.h>
 #include <buf.h>
+#include <hwi.h>
 #include <mem.h>
 #include <msgq.h>
 
@@ -216,6 +217,7 @@ static MQABUF_Params MQABUF_PARAMS = {3,
 #pragma CODE_SECTION (MQABUF_close, ".text:MQABUF_close")
 #pragma CODE_SECTION (MQABUF_alloc, ".text:MQABUF_alloc")
 #pragma CODE_SECTION (MQABUF_free,  ".text:MQABUF_free")
+#pragma CODE_SECTION (MQABUF_addRef, ".text:MQABUF_addRef")
 
 
 /** ============================================================================
@@ -317,6 +319,11 @@ MQABUF_open (MSGQ_AllocatorHandle mqaHandle)
             if (bufPools != MEM_ILLEGAL) {
                 mqaState->numBufPools = count ;
                 mqaState->bufPools    = bufPools ;
+                mqaState->numShared   = 0 ;
+                for (i = 0 ; i < MQABUF_MAXSHARED ; i++) {
+                    mqaState->shared [i].msg   = NULL ;
+                    mqaState->shared [i].count = 0 ;
+                }
                 bufAttrs.segid = mqaParams->segId ;
 
                 for (i = 0 ; ((i < count) && (status == MSGQ_SUCCESS)) ; i++) {
@@ -484,9 +491,11 @@ static
 Void
 MQABUF_free (MSGQ_AllocatorHandle mqaHandle, MSGQ_MsgHeader * msg, Uint16 size)
 {
+    Bool           release = TRUE ;
     MQABUF_State * mqaState ;
     MQABUF_Handle  bufPools ;
     Uint16         i ;
+    Uns            key ;
 
     DBC_require (mqaHandle != NULL) ;
     DBC_require (msg != NULL) ;
@@ -494,13 +503,91 @@ MQABUF_free (MSGQ_AllocatorHandle mqaHandle, MSGQ_MsgHeader * msg, Uint16 size)
     mqaState = (MQABUF_State *) mqaHandle->mqaInfo ;
     DBC_assert (mqaState != NULL) ;
 
-    bufPools = mqaState->bufPools ;
-    for (i = 0 ; i < mqaState->numBufPools ; i++) {
-        if (bufPools [i].msgSize == size) {
-            BUF_free (bufPools [i].msgList, (Ptr) msg) ;
-            break ;
+    /*  A shared message only goes back to its pool on the last free. The
+     *  lookup is skipped entirely while no message is shared.
+     */
+    if (mqaState->numShared != 0) {
+        key = HWI_disable () ;
+        for (i = 0 ; i < MQABUF_MAXSHARED ; i++) {
+            if (mqaState->shared [i].msg == msg) {
+                release = FALSE ;
+                mqaState->shared [i].count-- ;
+                if (mqaState->shared [i].count == 0) {
+                    mqaState->shared [i].msg = NULL ;
+                    mqaState->numShared-- ;
+                }
+                break ;
+            }
+        }
+        HWI_restore (key) ;
+    }
+
+    if (release == TRUE) {
+        bufPools = mqaState->bufPools ;
+        for (i = 0 ; i < mqaState->numBufPools ; i++) {
+            if (bufPools [i].msgSize == size) {
+                BUF_free (bufPools [i].msgList, (Ptr) msg) ;
+                break ;
+            }
+        }
+    }
+}
+
+
+/** ============================================================================
+ *  @func   MQABUF_addRef
+ *
+ *  @desc   Adds references to a message allocated from a buffer MQA.
+ *          This function is reentrant.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+MSGQ_Status
+MQABUF_addRef (MSGQ_Msg msg, Uint16 count)
+{
+    MSGQ_Status     status   = MSGQ_EMEMORY ;
+    MQABUF_Ref *    freeRef  = NULL ;
+    MQABUF_State *  mqaState ;
+    Uint16          i ;
+    Uns             key ;
+
+    DBC_require (msg != NULL) ;
+    DBC_require (msg->mqaId < MSGQ->numAllocators) ;
+
+    if (MSGQ->allocators [msg->mqaId].mqaFxns != &MQABUF_FXNS) {
+        status = MSGQ_ENOTIMPL ;
+    }
+    else if (count == 0) {
+        status = MSGQ_SUCCESS ;
+    }
+    else {
+        mqaState = (MQABUF_State *) MSGQ->allocators [msg->mqaId].mqaInfo ;
+        DBC_assert (mqaState != NULL) ;
+
+        key = HWI_disable () ;
+        for (i = 0 ;
+             (i < MQABUF_MAXSHARED) && (status != MSGQ_SUCCESS) ;
+             i++) {
+            if (mqaState->shared [i].msg == msg) {
+                mqaState->shared [i].count += count ;
+                status = MSGQ_SUCCESS ;
+            }
+            else if (   (freeRef == NULL)
+                     && (mqaState->shared [i].msg == NULL)) {
+                freeRef = &(mqaState->shared [i]) ;
+            }
+        }
+        if ((status != MSGQ_SUCCESS) && (freeRef != NULL)) {
+            freeRef->msg   = msg ;
+            freeRef->count = count ;
+            mqaState->numShared++ ;
+            status = MSGQ_SUCCESS ;
         }
+        HWI_restore (key) ;
     }
+
+    return status ;
 }
 
 
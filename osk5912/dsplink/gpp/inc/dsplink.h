@@ -266,6 +266,53 @@ typedef struct ChannelIOInfo_tag {
     Uint32    size ;
     Uint32    arg ;
 } ChannelIOInfo ;
+
+/** ============================================================================
+ *  @const  MAX_CHNL_SEGMENTS
+ *
+ *  @desc   Maximum number of segments in a scatter-gather IO request.
+ *  ============================================================================
+ */
+#define MAX_CHNL_SEGMENTS      4
+
+/** ============================================================================
+ *  @name   ChannelIOSegment
+ *
+ *  @desc   One segment of a scatter-gather IO request.
+ *
+ *  @field  buffer
+ *              Buffer pointer. Must be allocated through CHNL_AllocateBuffer
+ *              on the same channel.
+ *  @field  size
+ *              Size of the segment.
+ *  ============================================================================
+ */
+typedef struct ChannelIOSegment_tag {
+    Char8 *   buffer ;
+    Uint32    size ;
+} ChannelIOSegment ;
+
+/** ============================================================================
+ *  @name   ChannelIOVecInfo
+ *
+ *  @desc   Information for adding a scatter-gather IO request. On an output
+ *          channel the segments are gathered into one transfer in order; on
+ *          an input channel the received data is scattered across them in
+ *          order.
+ *
+ *  @field  segments
+ *              Segments of the request.
+ *  @field  numSegs
+ *              Number of valid entries in segments.
+ *  @field  arg
+ *              Argument to receive or send.
+ *  ============================================================================
+ */
+typedef struct ChannelIOVecInfo_tag {
+    ChannelIOSegment  segments [MAX_CHNL_SEGMENTS] ;
+    Uint32            numSegs ;
+    Uint32            arg ;
+} ChannelIOVecInfo ;
 #endif /* if defined (CHNL_COMPONENT) */
 
 /** ============================================================================
@@ -61,6 +61,47 @@ EXTERN "C" {
  */
 #define IS_VALID_MSGQID(id)        (id < MAX_MSGQS)
 
+/** ============================================================================
+ *  @const  MAX_MSGQ_TOPICS
+ *
+ *  @desc   Maximum number of MSGQ topics that can be used on the GPP.
+ *  ============================================================================
+ */
+#define MAX_MSGQ_TOPICS    8
+
+/** ============================================================================
+ *  @const  MAX_TOPIC_SUBSCRIBERS
+ *
+ *  @desc   Maximum number of local MSGQs that can subscribe to a single topic.
+ *  ============================================================================
+ */
+#define MAX_TOPIC_SUBSCRIBERS    4
+
+/** ============================================================================
+ *  @const  MSGQ_TOPIC_DEPTH
+ *
+ *  @desc   Number of published messages that a topic can hold for its slowest
+ *          subscriber.
+ *  ============================================================================
+ */
+#define MSGQ_TOPIC_DEPTH    8
+
+/** ============================================================================
+ *  @macro  IS_VALID_TOPICID
+ *
+ *  @desc   Is the MSGQ topic id valid.
+ *  ============================================================================
+ */
+#define IS_VALID_TOPICID(id)       (id < MAX_MSGQ_TOPICS)
+
+/** ============================================================================
+ *  @const  MAX_ALLOC_CACHE_DEPTH
+ *
+ *  @desc   Maximum number of messages that a process can cache per allocator.
+ *  ============================================================================
+ */
+#define MAX_ALLOC_CACHE_DEPTH    16
+
 /** ============================================================================
  *  @const  ID_LOCAL_PROCESSOR
  *
@@ -26,6 +26,7 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <sys/mman.h>
+#include <pthread.h>
 
 /*  ----------------------------------- DSP/BIOS Link               */
 #include <gpptypes.h>
@@ -135,6 +136,155 @@ STATIC DrvAddrMapEntry (*mapTable) [MAX_CHANNELS] = NULL ;
  *  ============================================================================
  */
 STATIC DrvAddrMapEntry DRV_MsgqBufPoolEntry [MAX_ALLOCATORS] ;
+
+/** ============================================================================
+ *  @name   DrvMsgqCache
+ *
+ *  @desc   User side message cache of an allocator. Free messages are
+ *          obtained from the kernel in batches and messages freed by the
+ *          application are returned in batches, so that most calls to
+ *          MSGQ_Alloc and MSGQ_Free do not enter the kernel.
+ *          Freed messages are never handed out again from this cache, since
+ *          only the kernel knows whether a published message is still
+ *          referenced.
+ *
+ *  @field  depth
+ *              Number of messages moved in one batch. Zero disables the cache.
+ *  @field  size
+ *              Size of the messages held in allocMsgs.
+ *  @field  numAlloc
+ *              Number of messages available in allocMsgs.
+ *  @field  numFree
+ *              Number of messages in freeMsgs waiting to be returned.
+ *  @field  allocMsgs
+ *              Messages allocated from the kernel and not yet handed out.
+ *  @field  freeMsgs
+ *              Messages freed by the application and not yet returned.
+ *  ============================================================================
+ */
+typedef struct DrvMsgqCache_tag {
+    Uint16    depth    ;
+    Uint16    size     ;
+    Uint16    numAlloc ;
+    Uint16    numFree  ;
+    MsgqMsg   allocMsgs [MAX_ALLOC_CACHE_DEPTH] ;
+    MsgqMsg   freeMsgs  [MAX_ALLOC_CACHE_DEPTH] ;
+} DrvMsgqCache ;
+
+/** ============================================================================
+ *  @name   DRV_MsgqCache
+ *
+ *  @desc   User side message caches of the allocators.
+ *  ============================================================================
+ */
+STATIC DrvMsgqCache DRV_MsgqCache [MAX_ALLOCATORS] ;
+
+/** ============================================================================
+ *  @name   DRV_MsgqCacheLock
+ *
+ *  @desc   Lock serializing the threads of the process on the message caches.
+ *  ============================================================================
+ */
+STATIC pthread_mutex_t DRV_MsgqCacheLock = PTHREAD_MUTEX_INITIALIZER ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   DRV_MsgqCacheFill
+ *
+ *  @desc   Allocates a batch of messages of the given size from the kernel
+ *          into the cache of the allocator.
+ *
+ *  @arg    drvObj
+ *              Pointer to the driver object.
+ *  @arg    mqaId
+ *              Allocator identifier.
+ *  @arg    size
+ *              Size of the messages to allocate.
+ *
+ *  @ret    DSP_SOK
+ *              At least one message has been allocated.
+ *          DSP_EFAIL
+ *              The ioctl failed.
+ *          DSP_EMEMORY
+ *              No message is available in the allocator.
+ *
+ *  @enter  The cache lock must be held and the cache must be empty.
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_MsgqCacheReturn
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+DSP_STATUS
+DRV_MsgqCacheFill (IN DRV_Object * drvObj,
+                   IN AllocatorId  mqaId,
+                   IN Uint16       size) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   DRV_MsgqCacheReturn
+ *
+ *  @desc   Returns a batch of messages to the kernel.
+ *
+ *  @arg    drvObj
+ *              Pointer to the driver object.
+ *  @arg    mqaId
+ *              Allocator identifier.
+ *  @arg    msgArray
+ *              Array of messages to be freed.
+ *  @arg    numMsgs
+ *              Number of messages in msgArray.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              The ioctl failed.
+ *
+ *  @enter  The cache lock must be held.
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_MsgqCacheFill
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+DSP_STATUS
+DRV_MsgqCacheReturn (IN DRV_Object * drvObj,
+                     IN AllocatorId  mqaId,
+                     IN MsgqMsg *    msgArray,
+                     IN Uint16       numMsgs) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   DRV_MsgqCacheFlush
+ *
+ *  @desc   Returns all messages held in the cache of the allocator to the
+ *          kernel.
+ *
+ *  @arg    drvObj
+ *              Pointer to the driver object.
+ *  @arg    mqaId
+ *              Allocator identifier.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              The ioctl failed.
+ *
+ *  @enter  The cache lock must be held.
+ *
+ *  @leave  The cache is empty.
+ *
+ *  @see    DRV_MsgqCacheReturn
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+DSP_STATUS
+DRV_MsgqCacheFlush (IN DRV_Object * drvObj, IN AllocatorId mqaId) ;
 #endif /* if defined (MSGQ_COMPONENT) */
 
 
@@ -234,6 +384,9 @@ DRV_Initialize (OUT DRV_Object ** drvObj, OPT IN OUT Pvoid arg)
              */
             for (i = 0 ; i < MAX_ALLOCATORS ; i++) {
                 DRV_MsgqBufPoolEntry [i].valid = FALSE ;
+                DRV_MsgqCache [i].depth    = 0 ;
+                DRV_MsgqCache [i].numAlloc = 0 ;
+                DRV_MsgqCache [i].numFree  = 0 ;
             }
 #endif /* if defined (MSGQ_COMPONENT) */
 
@@ -382,6 +535,93 @@ DRV_Invoke (IN         DRV_Object * drvObj,
             }
             break ;
 
+        case CMD_MSGQ_PUBLISH:
+            {
+                args->apiArgs.msgqPublishArgs.mqaId =
+                             args->apiArgs.msgqPublishArgs.msg->mqaId ;
+                osStatus = ioctl (drvObj->driverHandle,
+                                  cmdId,
+                                  args) ;
+                if (osStatus < 0) {
+                    status = DSP_EFAIL ;
+                    SET_FAILURE_REASON ;
+                }
+            }
+            break ;
+
+        case CMD_MSGQ_ALLOC:
+            {
+                AllocatorId    mqaId ;
+                Uint16         size  ;
+                DrvMsgqCache * cache ;
+
+                mqaId = args->apiArgs.msgqAllocArgs.mqaId ;
+                size  = args->apiArgs.msgqAllocArgs.size  ;
+                cache = &(DRV_MsgqCache [mqaId]) ;
+
+                pthread_mutex_lock (&DRV_MsgqCacheLock) ;
+                if (   (cache->depth == 0)
+                    || ((cache->numAlloc != 0) && (cache->size != size))) {
+                    osStatus = ioctl (drvObj->driverHandle, cmdId, args) ;
+                    if (osStatus < 0) {
+                        status = DSP_EFAIL ;
+                        SET_FAILURE_REASON ;
+                    }
+                }
+                else {
+                    if (cache->numAlloc == 0) {
+                        status = DRV_MsgqCacheFill (drvObj, mqaId, size) ;
+                        if (DSP_FAILED (status) && (cache->numFree != 0)) {
+                            /* The messages waiting to be returned may be the
+                             * only free ones in the allocator.
+                             */
+                            status = DRV_MsgqCacheReturn (drvObj,
+                                                          mqaId,
+                                                          cache->freeMsgs,
+                                                          cache->numFree) ;
+                            cache->numFree = 0 ;
+                            if (DSP_SUCCEEDED (status)) {
+                                status = DRV_MsgqCacheFill (drvObj,
+                                                            mqaId,
+                                                            size) ;
+                            }
+                        }
+                    }
+
+                    if (DSP_SUCCEEDED (status)) {
+                        cache->numAlloc-- ;
+                        *(args->apiArgs.msgqAllocArgs.msg) =
+                                        cache->allocMsgs [cache->numAlloc] ;
+                    }
+                    args->apiStatus = status ;
+                }
+                pthread_mutex_unlock (&DRV_MsgqCacheLock) ;
+            }
+            break ;
+
+        case CMD_MSGQ_SETALLOCCACHE:
+            {
+                AllocatorId    mqaId   ;
+                Uint16         numMsgs ;
+
+                mqaId   = args->apiArgs.msgqSetAllocCacheArgs.mqaId   ;
+                numMsgs = args->apiArgs.msgqSetAllocCacheArgs.numMsgs ;
+
+                if (   (numMsgs > MAX_ALLOC_CACHE_DEPTH)
+                    || (DRV_MsgqBufPoolEntry [mqaId].valid == FALSE)) {
+                    status = DSP_EINVALIDARG ;
+                    SET_FAILURE_REASON ;
+                }
+                else {
+                    pthread_mutex_lock (&DRV_MsgqCacheLock) ;
+                    status = DRV_MsgqCacheFlush (drvObj, mqaId) ;
+                    DRV_MsgqCache [mqaId].depth = numMsgs ;
+                    pthread_mutex_unlock (&DRV_MsgqCacheLock) ;
+                }
+                args->apiStatus = status ;
+            }
+            break ;
+
         case CMD_MSGQ_GET:
             {
                 osStatus = ioctl (drvObj->driverHandle, cmdId, args) ;
@@ -500,6 +740,17 @@ DRV_Invoke (IN         DRV_Object * drvObj,
             break ;
 #endif /* if defined (CHNL_COMPONENT) */
 
+        case CMD_DRV_GETPOLLHANDLE:
+            {
+                /*  The driver handle itself is the pollable object, so no
+                 *  call into the kernel is required.
+                 */
+                *(args->apiArgs.drvPollHandleArgs.handle) =
+                                                (Int32) drvObj->driverHandle ;
+                args->apiStatus = DSP_SOK ;
+            }
+            break ;
+
         case CMD_PROC_ATTACH:
             {
                 status = DRV_Initialize (&DRV_Handle, NULL) ;
@@ -660,6 +911,11 @@ DRV_Invoke (IN         DRV_Object * drvObj,
                 if (DSP_SUCCEEDED (status)) {
                     mqaId = args->apiArgs.msgqAllocatorCloseArgs.mqaId ;
                     if (DRV_MsgqBufPoolEntry [mqaId].valid == TRUE) {
+                        pthread_mutex_lock (&DRV_MsgqCacheLock) ;
+                        DRV_MsgqCacheFlush (drvObj, mqaId) ;
+                        DRV_MsgqCache [mqaId].depth = 0 ;
+                        pthread_mutex_unlock (&DRV_MsgqCacheLock) ;
+
                         osStatus = munmap (
                                        DRV_MsgqBufPoolEntry [mqaId].userAddress,
                                        DRV_MsgqBufPoolEntry [mqaId].length) ;
@@ -698,15 +954,37 @@ DRV_Invoke (IN         DRV_Object * drvObj,
 
         case CMD_MSGQ_FREE:
             {
-                args->apiArgs.msgqFreeArgs.mqaId =
-                             args->apiArgs.msgqFreeArgs.msg->mqaId ;
-                osStatus = ioctl (drvObj->driverHandle,
-                                  cmdId,
-                                  args) ;
-                if (osStatus < 0) {
-                    status = DSP_EFAIL ;
-                    SET_FAILURE_REASON ;
+                AllocatorId    mqaId ;
+                DrvMsgqCache * cache ;
+
+                mqaId = args->apiArgs.msgqFreeArgs.msg->mqaId ;
+                cache = &(DRV_MsgqCache [mqaId]) ;
+                args->apiArgs.msgqFreeArgs.mqaId = mqaId ;
+
+                pthread_mutex_lock (&DRV_MsgqCacheLock) ;
+                if (cache->depth == 0) {
+                    osStatus = ioctl (drvObj->driverHandle,
+                                      cmdId,
+                                      args) ;
+                    if (osStatus < 0) {
+                        status = DSP_EFAIL ;
+                        SET_FAILURE_REASON ;
+                    }
+                }
+                else {
+                    cache->freeMsgs [cache->numFree] =
+                                        args->apiArgs.msgqFreeArgs.msg ;
+                    cache->numFree++ ;
+                    if (cache->numFree >= cache->depth) {
+                        status = DRV_MsgqCacheReturn (drvObj,
+                                                      mqaId,
+                                                      cache->freeMsgs,
+                                                      cache->numFree) ;
+                        cache->numFree = 0 ;
+                    }
+                    args->apiStatus = status ;
                 }
+                pthread_mutex_unlock (&DRV_MsgqCacheLock) ;
             }
             break ;
 
@@ -754,6 +1032,140 @@ DRV_Invoke (IN         DRV_Object * drvObj,
 }
 
 
+#if defined (MSGQ_COMPONENT)
+/** ----------------------------------------------------------------------------
+ *  @func   DRV_MsgqCacheFill
+ *
+ *  @desc   Allocates a batch of messages from the kernel into the cache.
+ *
+ *  @modif  DRV_MsgqCache [mqaId]
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+DSP_STATUS
+DRV_MsgqCacheFill (IN DRV_Object * drvObj,
+                   IN AllocatorId  mqaId,
+                   IN Uint16       size)
+{
+    DSP_STATUS     status = DSP_SOK                  ;
+    DrvMsgqCache * cache  = &(DRV_MsgqCache [mqaId]) ;
+    CMD_Args       args                              ;
+    int            osStatus                          ;
+
+    TRC_3ENTER ("DRV_MsgqCacheFill", drvObj, mqaId, size) ;
+
+    DBC_Require (cache->numAlloc == 0) ;
+
+    args.apiArgs.msgqBatchArgs.mqaId    = mqaId            ;
+    args.apiArgs.msgqBatchArgs.size     = size             ;
+    args.apiArgs.msgqBatchArgs.numMsgs  = cache->depth     ;
+    args.apiArgs.msgqBatchArgs.msgArray = cache->allocMsgs ;
+
+    osStatus = ioctl (drvObj->driverHandle, CMD_MSGQ_ALLOCBATCH, &args) ;
+    if (osStatus < 0) {
+        status = DSP_EFAIL ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = args.apiStatus ;
+        if (DSP_SUCCEEDED (status)) {
+            cache->numAlloc = args.apiArgs.msgqBatchArgs.numMsgs ;
+            cache->size     = size ;
+        }
+    }
+
+    TRC_1LEAVE ("DRV_MsgqCacheFill", status) ;
+
+    return status ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   DRV_MsgqCacheReturn
+ *
+ *  @desc   Returns a batch of messages to the kernel.
+ *
+ *  @modif  None.
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+DSP_STATUS
+DRV_MsgqCacheReturn (IN DRV_Object * drvObj,
+                     IN AllocatorId  mqaId,
+                     IN MsgqMsg *    msgArray,
+                     IN Uint16       numMsgs)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args             ;
+    int        osStatus         ;
+
+    TRC_4ENTER ("DRV_MsgqCacheReturn", drvObj, mqaId, msgArray, numMsgs) ;
+
+    if (numMsgs != 0) {
+        args.apiArgs.msgqBatchArgs.mqaId    = mqaId    ;
+        args.apiArgs.msgqBatchArgs.numMsgs  = numMsgs  ;
+        args.apiArgs.msgqBatchArgs.msgArray = msgArray ;
+
+        osStatus = ioctl (drvObj->driverHandle, CMD_MSGQ_FREEBATCH, &args) ;
+        if (osStatus < 0) {
+            status = DSP_EFAIL ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            status = args.apiStatus ;
+        }
+    }
+
+    TRC_1LEAVE ("DRV_MsgqCacheReturn", status) ;
+
+    return status ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   DRV_MsgqCacheFlush
+ *
+ *  @desc   Returns all messages held in the cache to the kernel.
+ *
+ *  @modif  DRV_MsgqCache [mqaId]
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+DSP_STATUS
+DRV_MsgqCacheFlush (IN DRV_Object * drvObj, IN AllocatorId mqaId)
+{
+    DSP_STATUS     status    = DSP_SOK                  ;
+    DSP_STATUS     tmpStatus = DSP_SOK                  ;
+    DrvMsgqCache * cache     = &(DRV_MsgqCache [mqaId]) ;
+
+    TRC_2ENTER ("DRV_MsgqCacheFlush", drvObj, mqaId) ;
+
+    status = DRV_MsgqCacheReturn (drvObj,
+                                  mqaId,
+                                  cache->allocMsgs,
+                                  cache->numAlloc) ;
+    cache->numAlloc = 0 ;
+
+    tmpStatus = DRV_MsgqCacheReturn (drvObj,
+                                     mqaId,
+                                     cache->freeMsgs,
+                                     cache->numFree) ;
+    cache->numFree = 0 ;
+    if (DSP_FAILED (tmpStatus) && DSP_SUCCEEDED (status)) {
+        status = tmpStatus ;
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("DRV_MsgqCacheFlush", status) ;
+
+    return status ;
+}
+#endif /* if defined (MSGQ_COMPONENT) */
+
+
 #if defined (__cplusplus)
 }
 #endif /* defined (__cplusplus) */
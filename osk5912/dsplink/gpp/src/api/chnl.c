@@ -340,6 +340,67 @@ CHNL_Issue (IN ProcessorId     procId,
 }
 
 
+/** ============================================================================
+ *  @func   CHNL_IssueV
+ *
+ *  @desc   Issues a scatter-gather input or output request on a specified
+ *          channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_IssueV (IN ProcessorId         procId,
+             IN ChannelId           chnlId,
+             IN ChannelIOVecInfo *  ioReq)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args             ;
+    Uint32     i                ;
+
+    TRC_3ENTER ("CHNL_IssueV", procId, chnlId, ioReq) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (IS_VALID_CHNLID (procId, chnlId)) ;
+    DBC_Require (ioReq != NULL) ;
+
+    if (   (!IS_VALID_PROCID (procId))
+        || (!IS_VALID_CHNLID (procId, chnlId))
+        || (ioReq == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else if ((ioReq->numSegs == 0) || (ioReq->numSegs > MAX_CHNL_SEGMENTS)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        for (i = 0 ; i < ioReq->numSegs ; i++) {
+            if (ioReq->segments [i].buffer == NULL) {
+                status = DSP_EINVALIDARG ;
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (status)) {
+            args.apiArgs.chnlIssueVArgs.procId = procId ;
+            args.apiArgs.chnlIssueVArgs.chnlId = chnlId ;
+            args.apiArgs.chnlIssueVArgs.ioReq  = ioReq  ;
+
+            status = DRV_INVOKE (DRV_Handle, CMD_CHNL_ISSUEV, &args) ;
+            if (DSP_FAILED (status)) {
+                SET_FAILURE_REASON ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_IssueV", status) ;
+
+    return status ;
+}
+
+
 /** ============================================================================
  *  @func   CHNL_Reclaim
  *
@@ -527,6 +588,53 @@ CHNL_Control (IN  ProcessorId  procId,
 }
 
 
+/** ============================================================================
+ *  @func   CHNL_SetPollInterest
+ *
+ *  @desc   Adds or removes the channel from the poll set of the process.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_SetPollInterest (IN  ProcessorId  procId,
+                      IN  ChannelId    chnlId,
+                      IN  Bool         enable)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args             ;
+
+    TRC_3ENTER ("CHNL_SetPollInterest", procId, chnlId, enable) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (IS_VALID_CHNLID (procId, chnlId)) ;
+
+    if (   (!IS_VALID_PROCID (procId))
+        || (!IS_VALID_CHNLID (procId, chnlId))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.drvPollArgs.type   = DRV_POLL_CHNL ;
+        args.apiArgs.drvPollArgs.procId = procId ;
+        args.apiArgs.drvPollArgs.id     = chnlId ;
+
+        status = DRV_INVOKE (DRV_Handle,
+                             (enable ? CMD_DRV_POLLREGISTER
+                                     : CMD_DRV_POLLUNREGISTER),
+                             &args) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("CHNL_SetPollInterest", status) ;
+
+    return status ;
+}
+
+
 #if defined (DDSP_PROFILE)
 /** ============================================================================
  *  @func   CHNL_Instrument
@@ -219,6 +219,48 @@ CHNL_Issue (IN ProcessorId      procId,
             IN ChannelIOInfo *  ioReq) ;
 
 
+/** ============================================================================
+ *  @func   CHNL_IssueV
+ *
+ *  @desc   Issues a scatter-gather input or output request on a specified
+ *          channel. On an output channel the segments are sent as one buffer;
+ *          on an input channel the received buffer is split across the
+ *          segments in order. All segments must be allocated through
+ *          CHNL_AllocateBuffer on this channel, and all segments except the
+ *          last must be a multiple of the DSP word size.
+ *          The request is reclaimed through CHNL_Reclaim, which returns the
+ *          first segment as buffer and the total number of bytes transferred
+ *          as size.
+ *
+ *  @arg    procId
+ *              Processor Identifier.
+ *  @arg    chnlId
+ *              Channel Identifier.
+ *  @arg    ioReq
+ *              Segments and argument of the request.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              General failure.
+ *          DSP_EINVALIDARG
+ *              Invalid parameter passed.
+ *
+ *  @enter  Channels for specified processors must be initialized.
+ *          Processor and  channel ids must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    CHNL_Issue, CHNL_Reclaim
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_IssueV (IN ProcessorId         procId,
+             IN ChannelId           chnlId,
+             IN ChannelIOVecInfo *  ioReq) ;
+
+
 /** ============================================================================
  *  @func   CHNL_Reclaim
  *
@@ -380,6 +422,42 @@ CHNL_Control (IN  ProcessorId    procId,
               OPT Pvoid          arg) ;
 
 
+/** ============================================================================
+ *  @func   CHNL_SetPollInterest
+ *
+ *  @desc   Adds or removes the channel from the set of objects reported by
+ *          poll ()/select () on the handle returned by PROC_GetPollHandle.
+ *          An input channel is reported readable and an output channel
+ *          writable when CHNL_Reclaim on it would not block.
+ *
+ *  @arg    procId
+ *              Processor Identifier.
+ *  @arg    chnlId
+ *              Channel Identifier.
+ *  @arg    enable
+ *              TRUE to add the channel to the poll set, FALSE to remove it.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              General failure.
+ *          DSP_EINVALIDARG
+ *              Invalid parameter passed.
+ *
+ *  @enter  Processor and  channel ids must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    PROC_GetPollHandle, CHNL_Reclaim
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+CHNL_SetPollInterest (IN  ProcessorId    procId,
+                      IN  ChannelId      chnlId,
+                      IN  Bool           enable) ;
+
+
 #if defined (DDSP_PROFILE)
 /** ============================================================================
  *  @func   CHNL_Instrument
@@ -479,6 +479,46 @@ MSGQ_Free (IN  MsgqMsg msg)
 }
 
 
+/** ============================================================================
+ *  @func   MSGQ_SetAllocCache
+ *
+ *  @desc   Sets the depth of the allocation cache of the calling process.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_SetAllocCache (IN  AllocatorId mqaId, IN  Uint16 numMsgs)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    CMD_Args    args             ;
+
+    TRC_2ENTER ("MSGQ_SetAllocCache", mqaId, numMsgs) ;
+
+    DBC_Require (mqaId < MAX_ALLOCATORS) ;
+    DBC_Require (numMsgs <= MAX_ALLOC_CACHE_DEPTH) ;
+
+    if ((mqaId >= MAX_ALLOCATORS) || (numMsgs > MAX_ALLOC_CACHE_DEPTH)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqSetAllocCacheArgs.mqaId   = mqaId   ;
+        args.apiArgs.msgqSetAllocCacheArgs.numMsgs = numMsgs ;
+
+        status = DRV_INVOKE (DRV_Handle, CMD_MSGQ_SETALLOCCACHE, &args) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_SetAllocCache", status) ;
+
+    return status ;
+}
+
+
 /** ============================================================================
  *  @func   MSGQ_Put
  *
@@ -658,6 +698,223 @@ MSGQ_SetErrorHandler (IN  MsgQueueId msgqId, IN  Uint16 mqaId)
 }
 
 
+/** ============================================================================
+ *  @func   MSGQ_SetPollInterest
+ *
+ *  @desc   Adds or removes the local MSGQ from the poll set of the process.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_SetPollInterest (IN  MsgQueueId msgqId, IN  Bool enable)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    CMD_Args    args             ;
+
+    TRC_2ENTER ("MSGQ_SetPollInterest", msgqId, enable) ;
+
+    DBC_Require (IS_VALID_MSGQID (msgqId)) ;
+
+    if (!IS_VALID_MSGQID (msgqId)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.drvPollArgs.type   = DRV_POLL_MSGQ ;
+        args.apiArgs.drvPollArgs.procId = ID_LOCAL_PROCESSOR ;
+        args.apiArgs.drvPollArgs.id     = msgqId ;
+
+        status = DRV_INVOKE (DRV_Handle,
+                             (enable ? CMD_DRV_POLLREGISTER
+                                     : CMD_DRV_POLLUNREGISTER),
+                             &args) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_SetPollInterest", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_Subscribe
+ *
+ *  @desc   Subscribes a local MSGQ to a topic.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_Subscribe (IN  Uint16 topicId, IN  MsgQueueId msgqId)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    CMD_Args    args             ;
+
+    TRC_2ENTER ("MSGQ_Subscribe", topicId, msgqId) ;
+
+    DBC_Require (IS_VALID_TOPICID (topicId)) ;
+    DBC_Require (IS_VALID_MSGQID (msgqId)) ;
+
+    if ((!IS_VALID_TOPICID (topicId)) || (!IS_VALID_MSGQID (msgqId))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqSubscribeArgs.topicId = topicId ;
+        args.apiArgs.msgqSubscribeArgs.msgqId  = msgqId ;
+
+        status = DRV_INVOKE (DRV_Handle, CMD_MSGQ_SUBSCRIBE, &args) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_Subscribe", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_Unsubscribe
+ *
+ *  @desc   Removes a local MSGQ from the subscribers of a topic.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_Unsubscribe (IN  Uint16 topicId, IN  MsgQueueId msgqId)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    CMD_Args    args             ;
+
+    TRC_2ENTER ("MSGQ_Unsubscribe", topicId, msgqId) ;
+
+    DBC_Require (IS_VALID_TOPICID (topicId)) ;
+    DBC_Require (IS_VALID_MSGQID (msgqId)) ;
+
+    if ((!IS_VALID_TOPICID (topicId)) || (!IS_VALID_MSGQID (msgqId))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqSubscribeArgs.topicId = topicId ;
+        args.apiArgs.msgqSubscribeArgs.msgqId  = msgqId ;
+
+        status = DRV_INVOKE (DRV_Handle, CMD_MSGQ_UNSUBSCRIBE, &args) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_Unsubscribe", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_Publish
+ *
+ *  @desc   Publishes a message to every subscriber of a topic.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_Publish (IN     Uint16      topicId,
+              IN     MsgqMsg     msg,
+              IN OPT Uint16      msgId,
+              IN OPT MsgQueueId  srcMsgqId)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    CMD_Args    args             ;
+
+    TRC_4ENTER ("MSGQ_Publish", topicId, msg, msgId, srcMsgqId) ;
+
+    DBC_Require (IS_VALID_TOPICID (topicId)) ;
+    DBC_Require (msg != NULL) ;
+
+    if ((!IS_VALID_TOPICID (topicId)) || (msg == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqPublishArgs.topicId   = topicId ;
+        args.apiArgs.msgqPublishArgs.msg       = msg ;
+        args.apiArgs.msgqPublishArgs.msgId     = msgId ;
+        args.apiArgs.msgqPublishArgs.srcMsgqId = srcMsgqId ;
+
+        status = DRV_INVOKE (DRV_Handle, CMD_MSGQ_PUBLISH, &args) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_Publish", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   MSGQ_Receive
+ *
+ *  @desc   Receives the next message published on a topic for a subscribed
+ *          local MSGQ.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_Receive (IN  Uint16      topicId,
+              IN  MsgQueueId  msgqId,
+              IN  Uint32      timeout,
+              OUT MsgqMsg *   msg)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    CMD_Args    args             ;
+
+    TRC_4ENTER ("MSGQ_Receive", topicId, msgqId, timeout, msg) ;
+
+    DBC_Require (IS_VALID_TOPICID (topicId)) ;
+    DBC_Require (IS_VALID_MSGQID (msgqId)) ;
+    DBC_Require (msg != NULL) ;
+
+    if (   (!IS_VALID_TOPICID (topicId))
+        || (!IS_VALID_MSGQID (msgqId))
+        || (msg == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.msgqReceiveArgs.topicId = topicId ;
+        args.apiArgs.msgqReceiveArgs.msgqId  = msgqId ;
+        args.apiArgs.msgqReceiveArgs.timeout = timeout ;
+        args.apiArgs.msgqReceiveArgs.msg     = msg ;
+
+        status = DRV_INVOKE (DRV_Handle, CMD_MSGQ_RECEIVE, &args) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("MSGQ_Receive", status) ;
+
+    return status ;
+}
+
+
 #if defined (DDSP_PROFILE)
 /** ============================================================================
  *  @func   MSGQ_Instrument
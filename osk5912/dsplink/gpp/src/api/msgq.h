@@ -378,6 +378,44 @@ DSP_STATUS
 MSGQ_Free (IN  MsgqMsg msg) ;
 
 
+/** ============================================================================
+ *  @func   MSGQ_SetAllocCache
+ *
+ *  @desc   Sets the number of messages that the calling process obtains from
+ *          and returns to the allocator in one call to the kernel. Once set,
+ *          most calls to MSGQ_Alloc and MSGQ_Free on the allocator complete in
+ *          user space. The process may then hold up to twice numMsgs messages
+ *          of the allocator that are not in use, so the pools of the
+ *          allocator should be sized accordingly.
+ *          Messages freed by the process are always returned to the allocator
+ *          and never handed out again directly by the cache.
+ *
+ *  @arg    mqaId
+ *              ID of the allocator opened by the calling process.
+ *  @arg    numMsgs
+ *              Number of messages moved in one batch. Zero disables the cache
+ *              and returns all messages held by it to the allocator.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid Parameter passed.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  The allocator must have been opened by the calling process.
+ *          numMsgs must not exceed MAX_ALLOC_CACHE_DEPTH.
+ *
+ *  @leave  None
+ *
+ *  @see    MSGQ_Alloc, MSGQ_Free, MSGQ_AllocatorClose
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_SetAllocCache (IN  AllocatorId mqaId, IN  Uint16 numMsgs) ;
+
+
 /** ============================================================================
  *  @func   MSGQ_Put
  *
@@ -529,6 +567,197 @@ DSP_STATUS
 MSGQ_SetErrorHandler (IN  MsgQueueId msgqId, IN  Uint16 mqaId) ;
 
 
+/** ============================================================================
+ *  @func   MSGQ_SetPollInterest
+ *
+ *  @desc   Adds or removes the local MSGQ from the set of objects reported by
+ *          poll ()/select () on the handle returned by PROC_GetPollHandle.
+ *          The MSGQ is reported readable when MSGQ_Get on it would not block.
+ *
+ *  @arg    msgqId
+ *              ID of the local MSGQ.
+ *  @arg    enable
+ *              TRUE to add the MSGQ to the poll set, FALSE to remove it.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid Parameter passed.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  msgqId must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    PROC_GetPollHandle, MSGQ_Get
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_SetPollInterest (IN  MsgQueueId msgqId, IN  Bool enable) ;
+
+
+/** ============================================================================
+ *  @func   MSGQ_Subscribe
+ *
+ *  @desc   Subscribes a local MSGQ to a topic. The MSGQ receives, through
+ *          MSGQ_Receive, every message published on the topic after this call.
+ *
+ *  @arg    topicId
+ *              ID of the topic.
+ *  @arg    msgqId
+ *              ID of the local MSGQ. It must have been created by the caller.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid Parameter passed.
+ *          DSP_EALREADYEXISTS
+ *              The MSGQ is already subscribed to the topic.
+ *          DSP_ERESOURCE
+ *              The topic already has MAX_TOPIC_SUBSCRIBERS subscribers.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  topicId must be valid.
+ *          msgqId must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    MSGQ_Unsubscribe, MSGQ_Publish, MSGQ_Receive
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_Subscribe (IN  Uint16 topicId, IN  MsgQueueId msgqId) ;
+
+
+/** ============================================================================
+ *  @func   MSGQ_Unsubscribe
+ *
+ *  @desc   Removes a local MSGQ from the subscribers of a topic. Messages
+ *          published on the topic and not yet received by the MSGQ are released
+ *          on its behalf.
+ *
+ *  @arg    topicId
+ *              ID of the topic.
+ *  @arg    msgqId
+ *              ID of the subscribed local MSGQ.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid Parameter passed.
+ *          DSP_ENOTFOUND
+ *              The MSGQ is not subscribed to the topic.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  topicId must be valid.
+ *          msgqId must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    MSGQ_Subscribe
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_Unsubscribe (IN  Uint16 topicId, IN  MsgQueueId msgqId) ;
+
+
+/** ============================================================================
+ *  @func   MSGQ_Publish
+ *
+ *  @desc   Publishes a message to every subscriber of a topic. The message is
+ *          not copied: each subscriber receives the same message and must free
+ *          it with MSGQ_Free. The message returns to its allocator when the
+ *          last subscriber frees it.
+ *
+ *  @arg    topicId
+ *              ID of the topic.
+ *  @arg    msg
+ *              Pointer to the message to be published.
+ *  @arg    msgId
+ *              Optional message ID to be associated with the message.
+ *  @arg    srcMsgqId
+ *              Optional ID of the source MSGQ to receive reply messages.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid Parameter passed.
+ *          DSP_ENOTFOUND
+ *              The topic has no subscribers.
+ *          DSP_ERESOURCE
+ *              A subscriber already has MSGQ_TOPIC_DEPTH messages pending on
+ *              the topic.
+ *          DSP_ENOTIMPL
+ *              The allocator of the message does not support shared messages.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  topicId must be valid.
+ *          msg must be valid.
+ *
+ *  @leave  On success, the caller must no longer access the message.
+ *
+ *  @see    MSGQ_Subscribe, MSGQ_Receive
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_Publish (IN     Uint16      topicId,
+              IN     MsgqMsg     msg,
+              IN OPT Uint16      msgId,
+              IN OPT MsgQueueId  srcMsgqId) ;
+
+
+/** ============================================================================
+ *  @func   MSGQ_Receive
+ *
+ *  @desc   Receives the next message published on a topic for a subscribed
+ *          local MSGQ. The message is shared with the other subscribers and
+ *          must be treated as read-only.
+ *
+ *  @arg    topicId
+ *              ID of the topic.
+ *  @arg    msgqId
+ *              ID of the subscribed local MSGQ.
+ *  @arg    timeout
+ *              Timeout value to wait for the message (in milliseconds).
+ *  @arg    msg
+ *              Location to receive the message.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid Parameter passed.
+ *          DSP_ENOTFOUND
+ *              The MSGQ is not subscribed to the topic.
+ *          DSP_ETIMEOUT
+ *              Timeout occurred while receiving the message.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  topicId must be valid.
+ *          msgqId must be valid.
+ *          msg must be a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    MSGQ_Publish, MSGQ_Free
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+MSGQ_Receive (IN  Uint16      topicId,
+              IN  MsgQueueId  msgqId,
+              IN  Uint32      timeout,
+              OUT MsgqMsg *   msg) ;
+
+
 #if defined (DDSP_PROFILE)
 /** ============================================================================
  *  @func   MSGQ_Instrument
@@ -446,6 +446,57 @@ PROC_Stop (IN  ProcessorId  procId)
 }
 
 
+/** ============================================================================
+ *  @func   PROC_Reload
+ *
+ *  @desc   Reloads the DSP with the specified executable and starts it,
+ *          retaining the channels and message queues on the GPP.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_Reload (IN ProcessorId  procId,
+             IN Char8 *      imagePath,
+             IN Uint32       argc,
+             IN Char8 **     argv)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args             ;
+
+    TRC_4ENTER ("PROC_Reload", procId, imagePath, argc, argv) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (imagePath != NULL ) ;
+    DBC_Require (   ((argc != 0) && (argv != NULL))
+                 || ((argc == 0) && (argv == NULL))) ;
+
+    if (   (IS_VALID_PROCID (procId) == FALSE)
+        || (imagePath == NULL)
+        || (((argc == 0) && (argv != NULL)))
+        || (((argc != 0) && (argv == NULL)))) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.procLoadArgs.procId    = procId    ;
+        args.apiArgs.procLoadArgs.imagePath = imagePath ;
+        args.apiArgs.procLoadArgs.argc      = argc      ;
+        args.apiArgs.procLoadArgs.argv      = argv      ;
+
+        status = DRV_INVOKE (DRV_Handle, CMD_PROC_RELOAD, &args) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_Reload", status) ;
+
+    return status ;
+}
+
+
 /** ============================================================================
  *  @func   PROC_Control
  *
@@ -489,6 +540,44 @@ PROC_Control (IN  ProcessorId procId,
 }
 
 
+/** ============================================================================
+ *  @func   PROC_GetPollHandle
+ *
+ *  @desc   Returns the OS handle to be used with poll ()/select ().
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_GetPollHandle (OUT Int32 * handle)
+{
+    DSP_STATUS status = DSP_SOK ;
+    CMD_Args   args             ;
+
+    TRC_1ENTER ("PROC_GetPollHandle", handle) ;
+
+    DBC_Require (handle != NULL) ;
+
+    if (handle == NULL) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        args.apiArgs.drvPollHandleArgs.handle = handle ;
+
+        status = DRV_INVOKE (DRV_Handle, CMD_DRV_GETPOLLHANDLE, &args) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("PROC_GetPollHandle", status) ;
+
+    return status ;
+}
+
+
 #if defined (DDSP_PROFILE)
 /** ============================================================================
  *  @func   PROC_Instrument
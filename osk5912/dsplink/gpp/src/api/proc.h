@@ -339,6 +339,56 @@ DSP_STATUS
 PROC_Stop (IN ProcessorId procId) ;
 
 
+/** ============================================================================
+ *  @func   PROC_Reload
+ *
+ *  @desc   Reloads the DSP with the specified executable and starts it. The
+ *          channels and message queues created on the GPP, along with their
+ *          buffers, are retained across the reload. IO requests pending on
+ *          them are handed to the new image once the handshake completes.
+ *          This is the fast alternative to PROC_Stop (), PROC_Load () and
+ *          PROC_Start () after deleting and recreating all channels.
+ *
+ *  @arg    procId
+ *              DSP Identifier.
+ *  @arg    imagePath
+ *              Full path to the image file to load on DSP.
+ *  @arg    argc
+ *              Number of argument to be passed to the base image upon start.
+ *  @arg    argv
+ *              Arguments to be passed to DSP main application.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid argument.
+ *          DSP_EACCESSDENIED
+ *              Not allowed to access the DSP.
+ *          DSP_EFILE
+ *              Invalid base image.
+ *          DSP_EFAIL
+ *              General failure, unable to reload the DSP.
+ *          DSP_EWRONGSTATE
+ *              Incorrect state for completing the requested operation.
+ *
+ *  @enter  procId must be valid.
+ *          imagePath must be valid.
+ *          If argc is 0 then argv must be NULL pointer.
+ *          If argc is non-zero then argv must be a valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    PROC_Stop, PROC_Load, PROC_Start
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_Reload (IN ProcessorId  procId,
+             IN Char8 *      imagePath,
+             IN Uint32       argc,
+             IN Char8 **     argv) ;
+
+
 /** ============================================================================
  *  @func   PROC_Control
  *
@@ -371,6 +421,36 @@ PROC_Control (IN  ProcessorId procId,
               OPT Pvoid       arg) ;
 
 
+/** ============================================================================
+ *  @func   PROC_GetPollHandle
+ *
+ *  @desc   Returns the OS handle which can be passed to poll ()/select () to
+ *          wait for the channels and MSGQs registered through
+ *          CHNL_SetPollInterest and MSGQ_SetPollInterest. The handle is
+ *          owned by DSPLink and must not be closed by the caller.
+ *
+ *  @arg    handle
+ *              Location to receive the handle.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid parameter passed.
+ *          DSP_EATTACHED
+ *              The process is not attached to DSPLink.
+ *
+ *  @enter  handle must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    PROC_Attach, CHNL_SetPollInterest, MSGQ_SetPollInterest
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PROC_GetPollHandle (OUT Int32 * handle) ;
+
+
 #if defined (DDSP_PROFILE)
 /** ============================================================================
  *  @func   PROC_Instrument
@@ -904,6 +904,85 @@ HPI_DspWrite (IN     ProcessorId  dspId,
               OUT    Uint8 *      buffer) ;
 
 
+/** ----------------------------------------------------------------------------
+ *  @func   HPI_DspReadChirp
+ *
+ *  @desc   Reads data from DSP into the buffer described by a chirp,
+ *          scattering it across the segments of a scatter-gather request.
+ *
+ *  @arg    dspId
+ *              Processor ID.
+ *  @arg    dspObj
+ *              Pointer to object containing context information for DSP.
+ *  @arg    dspAddr
+ *              DSP address to read from.
+ *  @arg    numBytes
+ *              On input, number of bytes to read. On output, number of bytes
+ *              actually read.
+ *  @arg    chirp
+ *              Chirp to be filled.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              General Failure.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    HPI_DspRead
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+DSP_STATUS
+HPI_DspReadChirp (IN     ProcessorId    dspId,
+                  IN     DspObject *    dspObj,
+                  IN     Uint32         dspAddr,
+                  IN OUT Uint32 *       numBytes,
+                  IN     LDRVChnlIRP *  chirp) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   HPI_DspWriteChirp
+ *
+ *  @desc   Writes the buffer described by a chirp to DSP, gathering the
+ *          segments of a scatter-gather request.
+ *
+ *  @arg    dspId
+ *              Processor ID.
+ *  @arg    dspObj
+ *              Pointer to object containing context information for DSP.
+ *  @arg    dspAddr
+ *              DSP address to write to.
+ *  @arg    numBytes
+ *              Number of bytes to write.
+ *  @arg    chirp
+ *              Chirp containing the data to be written.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              General Failure.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    HPI_DspWrite
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+DSP_STATUS
+HPI_DspWriteChirp (IN     ProcessorId    dspId,
+                   IN     DspObject *    dspObj,
+                   IN     Uint32         dspAddr,
+                   IN     Uint32         numBytes,
+                   IN     LDRVChnlIRP *  chirp) ;
+
+
 /** ============================================================================
  *  @func   HPI_Initialize
  *
@@ -2122,12 +2201,12 @@ HPI_DoChnlProcessing (IN     ProcessorId   dspId,
                                                        chnlState) ;
                         }
                         else {
-                            status = HPI_DspRead (dspId,
+                            status = HPI_DspReadChirp (
+                                                  dspId,
                                                   dspObj,
                                                   chnlInfo->sharedBufPtr,
-                                                  Endianism_Default,
                                                   &size,
-                                                  chirp->buffer) ;
+                                                  chirp) ;
                             if (DSP_SUCCEEDED (status)) {
                                 chnlInfo->sharedBufSize = size / DM642_MAUSIZE ;
                                 chirp->size       = size ;
@@ -2159,12 +2238,11 @@ HPI_DoChnlProcessing (IN     ProcessorId   dspId,
                          */
                         size = MIN (chnlInfo->sharedBufSize * DM642_MAUSIZE,
                                     chirp->size) ;
-                        status = HPI_DspWrite (dspId,
-                                               dspObj,
-                                               chnlInfo->sharedBufPtr,
-                                               Endianism_Default,
-                                               size,
-                                               chirp->buffer) ;
+                        status = HPI_DspWriteChirp (dspId,
+                                                    dspObj,
+                                                    chnlInfo->sharedBufPtr,
+                                                    size,
+                                                    chirp) ;
                         if (DSP_SUCCEEDED (status)) {
                             fUpdateChnl = TRUE ;
                             chnlInfo->isValid       = FALSE                ;
@@ -2685,6 +2763,116 @@ HPI_DspWrite (IN     ProcessorId  dspId,
 }
 
 
+/** ----------------------------------------------------------------------------
+ *  @func   HPI_DspReadChirp
+ *
+ *  @desc   Reads data from DSP into the buffer described by a chirp.
+ *
+ *  @modif  None.
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+DSP_STATUS
+HPI_DspReadChirp (IN     ProcessorId    dspId,
+                  IN     DspObject *    dspObj,
+                  IN     Uint32         dspAddr,
+                  IN OUT Uint32 *       numBytes,
+                  IN     LDRVChnlIRP *  chirp)
+{
+    DSP_STATUS  status    = DSP_SOK   ;
+    Uint32      remaining = *numBytes ;
+    Uint32      i         = 0         ;
+    Uint32      len                   ;
+
+    if (chirp->numSegs == 0) {
+        status = HPI_DspRead (dspId,
+                              dspObj,
+                              dspAddr,
+                              Endianism_Default,
+                              numBytes,
+                              chirp->buffer) ;
+    }
+    else {
+        *numBytes = 0 ;
+        while (   (remaining != 0)
+               && (i < chirp->numSegs)
+               && DSP_SUCCEEDED (status)) {
+            len    = MIN (remaining, chirp->segments [i].size) ;
+            status = HPI_DspRead (dspId,
+                                  dspObj,
+                                  dspAddr + (*numBytes / DM642_MAUSIZE),
+                                  Endianism_Default,
+                                  &len,
+                                  (Uint8 *) chirp->segments [i].buffer) ;
+            *numBytes += len ;
+            remaining -= MIN (remaining, len) ;
+            i++ ;
+        }
+    }
+
+    if (DSP_FAILED (status)) {
+        SET_FAILURE_REASON ;
+    }
+
+    return status ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   HPI_DspWriteChirp
+ *
+ *  @desc   Writes the buffer described by a chirp to DSP.
+ *
+ *  @modif  None.
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+DSP_STATUS
+HPI_DspWriteChirp (IN     ProcessorId    dspId,
+                   IN     DspObject *    dspObj,
+                   IN     Uint32         dspAddr,
+                   IN     Uint32         numBytes,
+                   IN     LDRVChnlIRP *  chirp)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    Uint32      offset = 0       ;
+    Uint32      i      = 0       ;
+    Uint32      len              ;
+
+    if (chirp->numSegs == 0) {
+        status = HPI_DspWrite (dspId,
+                               dspObj,
+                               dspAddr,
+                               Endianism_Default,
+                               numBytes,
+                               chirp->buffer) ;
+    }
+    else {
+        while (   (offset < numBytes)
+               && (i < chirp->numSegs)
+               && DSP_SUCCEEDED (status)) {
+            len    = MIN (numBytes - offset, chirp->segments [i].size) ;
+            status = HPI_DspWrite (dspId,
+                                   dspObj,
+                                   dspAddr + (offset / DM642_MAUSIZE),
+                                   Endianism_Default,
+                                   len,
+                                   (Uint8 *) chirp->segments [i].buffer) ;
+            offset += len ;
+            i++ ;
+        }
+    }
+
+    if (DSP_FAILED (status)) {
+        SET_FAILURE_REASON ;
+    }
+
+    return status ;
+}
+
+
 #if defined (__cplusplus)
 }
 #endif /* if defined (__cplusplus) */
@@ -93,6 +93,16 @@ EXTERN "C" {
  */
 LDRV_Object LDRV_Obj ;
 
+/** ----------------------------------------------------------------------------
+ *  @name   LDRV_NotifyFxn
+ *
+ *  @desc   Function called when a channel or a local MSGQ becomes ready.
+ *          It is kept outside LDRV_Obj since it is registered once by the
+ *          OS driver and must survive PROC_Setup () / PROC_Destroy ().
+ *  ----------------------------------------------------------------------------
+ */
+STATIC FnLdrvNotify LDRV_NotifyFxn = NULL ;
+
 
 /** ----------------------------------------------------------------------------
  *  @func   LDRV_InitializeDspObj
@@ -600,6 +610,49 @@ LDRV_Finalize ()
 }
 
 
+/** ============================================================================
+ *  @func   LDRV_SetNotify
+ *
+ *  @desc   Registers the function to be called when a channel or a local MSGQ
+ *          becomes ready.
+ *
+ *  @modif  LDRV_NotifyFxn
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+LDRV_SetNotify (IN FnLdrvNotify fxn)
+{
+    TRC_1ENTER ("LDRV_SetNotify", fxn) ;
+
+    LDRV_NotifyFxn = fxn ;
+
+    TRC_0LEAVE ("LDRV_SetNotify") ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_Notify
+ *
+ *  @desc   Invokes the registered notification function, if any.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_Notify (IN LdrvNotifyType type, IN ProcessorId procId, IN Uint32 id)
+{
+    TRC_3ENTER ("LDRV_Notify", type, procId, id) ;
+
+    if (LDRV_NotifyFxn != NULL) {
+        (*LDRV_NotifyFxn) (type, procId, id) ;
+    }
+
+    TRC_0LEAVE ("LDRV_Notify") ;
+}
+
+
 /*  ----------------------------------------------------------------------------
  *  @func   LDRV_InitializeDspObj
  *
@@ -98,6 +98,44 @@ typedef struct LDRV_Object_tag {
 } LDRV_Object ;
 
 
+/** ============================================================================
+ *  @name   LdrvNotifyType
+ *
+ *  @desc   Kind of object for which a readiness notification is generated.
+ *
+ *  @field  LdrvNotifyType_Chnl
+ *              An IO completion has been queued on a channel.
+ *  @field  LdrvNotifyType_Msgq
+ *              A message has been queued on a local MSGQ.
+ *  ============================================================================
+ */
+typedef enum {
+    LdrvNotifyType_Chnl = 0,
+    LdrvNotifyType_Msgq = 1
+} LdrvNotifyType ;
+
+/** ============================================================================
+ *  @name   FnLdrvNotify
+ *
+ *  @desc   Signature of the function invoked by the link driver whenever a
+ *          channel or a local MSGQ becomes ready. It may be called in DPC
+ *          context and must not block.
+ *
+ *  @arg    type
+ *              Kind of object that became ready.
+ *  @arg    procId
+ *              Processor identifier (channels only).
+ *  @arg    id
+ *              Channel identifier or MSGQ identifier.
+ *
+ *  @ret    None
+ *  ============================================================================
+ */
+typedef Void (*FnLdrvNotify) (IN LdrvNotifyType type,
+                              IN ProcessorId    procId,
+                              IN Uint32         id) ;
+
+
 /** ============================================================================
  *  @func   LDRV_Initialize
  *
@@ -150,6 +188,57 @@ DSP_STATUS
 LDRV_Finalize () ;
 
 
+/** ============================================================================
+ *  @func   LDRV_SetNotify
+ *
+ *  @desc   Registers the function to be called when a channel or a local MSGQ
+ *          becomes ready. The OS driver uses this to wake up threads waiting
+ *          for readiness on the driver handle. Passing NULL removes the
+ *          registered function.
+ *
+ *  @arg    fxn
+ *              Notification function.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_Notify
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+LDRV_SetNotify (IN FnLdrvNotify fxn) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_Notify
+ *
+ *  @desc   Invokes the registered notification function, if any.
+ *
+ *  @arg    type
+ *              Kind of object that became ready.
+ *  @arg    procId
+ *              Processor identifier.
+ *  @arg    id
+ *              Channel identifier or MSGQ identifier.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_SetNotify
+ *  ============================================================================
+ */
+NORMAL_API
+Void
+LDRV_Notify (IN LdrvNotifyType type, IN ProcessorId procId, IN Uint32 id) ;
+
+
 #if defined (__cplusplus)
 }
 #endif /* defined (__cplusplus) */
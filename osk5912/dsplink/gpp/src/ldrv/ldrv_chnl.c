@@ -603,10 +603,12 @@ LDRV_CHNL_AddIORequest (IN ProcessorId      procId,
     LDRVChnlIRP *     chirp       = NULL     ;
     LDRVChnlObject *  chnlObj     = NULL     ;
     Bool              isListEmpty = FALSE    ;
+    Uint32            totalSize   = 0        ;
+    Uint32            wordSize               ;
+    Uint32            i                      ;
     Bool              isEOS                  ;
 #if defined (DDSP_PROFILE_DETAILED)
     ChnlInstrument *  chnlInst ;
-    Uint32            i        ;
 #endif
 
     TRC_3ENTER ("LDRV_CHNL_AddIORequest", procId, chnlId, ioInfo) ;
@@ -615,6 +617,39 @@ LDRV_CHNL_AddIORequest (IN ProcessorId      procId,
     DBC_Require (   (IS_VALID_CHNLID (procId, chnlId))
                  || (IS_VALID_MSGCHNLID (chnlId))) ;
     DBC_Require (ioInfo != NULL) ;
+    DBC_Require (   (ioInfo->numSegs == 0)
+                 || (   (ioInfo->numSegs <= MAX_CHNL_SEGMENTS)
+                     && (ioInfo->segments != NULL))) ;
+
+    /*  ------------------------------------------------------------------------
+     *  For a scatter-gather request, all segments except the last one must
+     *  be a multiple of the DSP word size, so that the link driver can move
+     *  them as one contiguous transfer.
+     *  ------------------------------------------------------------------------
+     */
+    if (ioInfo->numSegs != 0) {
+        wordSize = LDRV_Obj.dspObjects [procId].wordSize ;
+        if (   (ioInfo->numSegs > MAX_CHNL_SEGMENTS)
+            || (ioInfo->segments == NULL)) {
+            status = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            for (i = 0 ; i < ioInfo->numSegs ; i++) {
+                if (   (ioInfo->segments [i].buffer == NULL)
+                    || (   (i < (ioInfo->numSegs - 1))
+                        && ((ioInfo->segments [i].size % wordSize) != 0))) {
+                    status = DSP_EINVALIDARG ;
+                    SET_FAILURE_REASON ;
+                    break ;
+                }
+                totalSize += ioInfo->segments [i].size ;
+            }
+        }
+    }
+    else {
+        totalSize = ioInfo->size ;
+    }
 
     /*  ------------------------------------------------------------------------
      *  Start the protection in non-DPC context to ensure that DPC does not
@@ -625,17 +660,19 @@ LDRV_CHNL_AddIORequest (IN ProcessorId      procId,
         SYNC_ProtectionStart () ;
     }
 
-    isEOS = (Bool) ((ioInfo->size == 0) ? TRUE : FALSE) ;
+    isEOS = (Bool) ((totalSize == 0) ? TRUE : FALSE) ;
 
     DBC_Assert (LDRV_CHNL_Object [procId][chnlId] != NULL) ;
 
-    if (IS_CHNL_EOS (LDRV_CHNL_Object [procId][chnlId])) {
-        status = CHNL_E_EOS ;
-        SET_FAILURE_REASON ;
-    }
-    else if (LIST_IsEmpty (LDRV_CHNL_Object [procId][chnlId]->freeList)) {
-        status = CHNL_E_NOIORPS ;
-        SET_FAILURE_REASON ;
+    if (DSP_SUCCEEDED (status)) {
+        if (IS_CHNL_EOS (LDRV_CHNL_Object [procId][chnlId])) {
+            status = CHNL_E_EOS ;
+            SET_FAILURE_REASON ;
+        }
+        else if (LIST_IsEmpty (LDRV_CHNL_Object [procId][chnlId]->freeList)) {
+            status = CHNL_E_NOIORPS ;
+            SET_FAILURE_REASON ;
+        }
     }
 
     if (DSP_SUCCEEDED (status)) {
@@ -654,8 +691,17 @@ LDRV_CHNL_AddIORequest (IN ProcessorId      procId,
                 chnlObj->chnlState = ChannelState_EOS ;
             }
 
-            chirp->buffer    = ioInfo->buffer   ;
-            chirp->size      = ioInfo->size     ;
+            if (ioInfo->numSegs == 0) {
+                chirp->buffer  = ioInfo->buffer ;
+            }
+            else {
+                chirp->buffer  = (Uint8 *) ioInfo->segments [0].buffer ;
+                for (i = 0 ; i < ioInfo->numSegs ; i++) {
+                    chirp->segments [i] = ioInfo->segments [i] ;
+                }
+            }
+            chirp->numSegs   = ioInfo->numSegs  ;
+            chirp->size      = totalSize        ;
             chirp->arg       = ioInfo->arg      ; /*  This field is used as
                                                    *  an argument for callback
                                                    *  function.
@@ -922,6 +968,8 @@ LDRV_CHNL_AddIOCompletion (IN ProcessorId   procId,
         if (DSP_FAILED (status)) {
             SET_FAILURE_REASON ;
         }
+        LDRV_Notify (LdrvNotifyType_Chnl, procId, chnlId) ;
+
         if (LIST_IsEmpty (chnlObj->requestList)) {
             tmpStatus = SYNC_SetEvent (chnlObj->chnlIdleSync) ;
             if (DSP_FAILED (tmpStatus) && (DSP_SUCCEEDED (status))) {
@@ -1025,6 +1073,7 @@ LDRV_CHNL_Idle (IN ProcessorId procId,
                             SET_FAILURE_REASON ;
                             done = TRUE ;
                         }
+                        LDRV_Notify (LdrvNotifyType_Chnl, procId, chnlId) ;
                     }
                 }
                 else {
@@ -1263,6 +1312,150 @@ LDRV_CHNL_ChannelHasMoreChirps  (IN ProcessorId   procId,
 }
 
 
+/** ============================================================================
+ *  @func   LDRV_CHNL_HasIOCompletion
+ *
+ *  @desc   Returns TRUE if the channel has at least one buffer in its IO
+ *          completion queue.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_CHNL_HasIOCompletion (IN  ProcessorId   procId,
+                           IN  ChannelId     chnlId,
+                           OUT ChannelMode * mode)
+{
+    Bool             hasIOCompletion = FALSE ;
+    LDRVChnlObject * chnlObj         = NULL  ;
+
+    TRC_3ENTER ("LDRV_CHNL_HasIOCompletion", procId, chnlId, mode) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (   (IS_VALID_CHNLID (procId, chnlId))
+                 || (IS_VALID_MSGCHNLID (chnlId))) ;
+    DBC_Require (mode != NULL) ;
+
+    SYNC_ProtectionStart () ;
+    chnlObj = LDRV_CHNL_Object [procId][chnlId] ;
+    if (chnlObj != NULL) {
+        hasIOCompletion = !LIST_IsEmpty (chnlObj->completedList) ;
+        if (hasIOCompletion) {
+            *mode = chnlObj->attrs.mode ;
+        }
+    }
+    SYNC_ProtectionEnd () ;
+
+    TRC_1LEAVE ("LDRV_CHNL_HasIOCompletion", hasIOCompletion) ;
+
+    return hasIOCompletion ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_GatherChirp
+ *
+ *  @desc   Copies the data described by a chirp into a contiguous buffer.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_GatherChirp (IN LDRVChnlIRP * chirp,
+                       IN Uint8 *       dst,
+                       IN Uint32        bytes,
+                       IN Endianism     endianism)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    Uint32      i      = 0       ;
+    Uint32      len              ;
+
+    TRC_4ENTER ("LDRV_CHNL_GatherChirp", chirp, dst, bytes, endianism) ;
+
+    DBC_Require (chirp != NULL) ;
+    DBC_Require (dst != NULL) ;
+    DBC_Require (bytes <= chirp->size) ;
+
+    if (chirp->numSegs == 0) {
+        status = MEM_Copy (dst, chirp->buffer, bytes, endianism) ;
+    }
+    else {
+        while ((bytes != 0) && (i < chirp->numSegs) && DSP_SUCCEEDED (status)) {
+            len    = MIN (bytes, chirp->segments [i].size) ;
+            status = MEM_Copy (dst,
+                               (Uint8 *) chirp->segments [i].buffer,
+                               len,
+                               endianism) ;
+            dst   += len ;
+            bytes -= len ;
+            i++ ;
+        }
+    }
+
+    if (DSP_FAILED (status)) {
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_GatherChirp", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_ScatterChirp
+ *
+ *  @desc   Copies data from a contiguous buffer into the buffer described by
+ *          a chirp.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_ScatterChirp (IN LDRVChnlIRP * chirp,
+                        IN Uint8 *       src,
+                        IN Uint32        bytes,
+                        IN Endianism     endianism)
+{
+    DSP_STATUS  status = DSP_SOK ;
+    Uint32      i      = 0       ;
+    Uint32      len              ;
+
+    TRC_4ENTER ("LDRV_CHNL_ScatterChirp", chirp, src, bytes, endianism) ;
+
+    DBC_Require (chirp != NULL) ;
+    DBC_Require (src != NULL) ;
+    DBC_Require (bytes <= chirp->size) ;
+
+    if (chirp->numSegs == 0) {
+        status = MEM_Copy (chirp->buffer, src, bytes, endianism) ;
+    }
+    else {
+        while ((bytes != 0) && (i < chirp->numSegs) && DSP_SUCCEEDED (status)) {
+            len    = MIN (bytes, chirp->segments [i].size) ;
+            status = MEM_Copy ((Uint8 *) chirp->segments [i].buffer,
+                               src,
+                               len,
+                               endianism) ;
+            src   += len ;
+            bytes -= len ;
+            i++ ;
+        }
+    }
+
+    if (DSP_FAILED (status)) {
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("LDRV_CHNL_ScatterChirp", status) ;
+
+    return status ;
+}
+
+
 /** ============================================================================
  *  @func   LDRV_CHNL_GetRequestChirp
  *
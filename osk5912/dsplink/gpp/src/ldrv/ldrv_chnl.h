@@ -124,6 +124,12 @@ typedef DSP_STATUS (*FnLdrvChnlCallback) (ProcessorId   procId,
  *              Optional callback function pointer.
  *  @field  dpcContext
  *              Indicates whether the execution is in DPC context.
+ *  @field  numSegs
+ *              Number of segments for a scatter-gather request. Zero for a
+ *              request on the single buffer described by buffer and size.
+ *  @field  segments
+ *              Segments of a scatter-gather request. Only used when numSegs
+ *              is non-zero. buffer and size are ignored in this case.
  *  ============================================================================
  */
 typedef struct LDRVChnlIOInfo_tag {
@@ -133,6 +139,8 @@ typedef struct LDRVChnlIOInfo_tag {
     IOState             completionStatus  ;
     FnLdrvChnlCallback  callback          ;
     Bool                dpcContext        ;
+    Uint32              numSegs           ;
+    ChannelIOSegment *  segments          ;
 } LDRVChnlIOInfo ;
 
 /** ============================================================================
@@ -187,6 +195,12 @@ typedef struct LDRVChnlObject_tag {
  *              Status of IO Completion.
  *  @field  callback
  *              Optional callback function.
+ *  @field  numSegs
+ *              Number of segments of a scatter-gather request, zero otherwise.
+ *              For a scatter-gather request buffer is the first segment and
+ *              size is the total size of all segments.
+ *  @field  segments
+ *              Segments of a scatter-gather request.
  *  ============================================================================
  */
 typedef struct LDRVChnlIRP_tag {
@@ -196,6 +210,8 @@ typedef struct LDRVChnlIRP_tag {
     Uint32              size          ;
     Uint32              iocStatus     ;
     FnLdrvChnlCallback  callback      ;
+    Uint32              numSegs       ;
+    ChannelIOSegment    segments [MAX_CHNL_SEGMENTS] ;
 } LDRVChnlIRP ;
 
 
@@ -667,6 +683,114 @@ LDRV_CHNL_ChannelHasMoreChirps (IN ProcessorId   procId,
                                 IN ChannelId     chnlId) ;
 
 
+/** ============================================================================
+ *  @func   LDRV_CHNL_HasIOCompletion
+ *
+ *  @desc   Returns TRUE if the channel has at least one buffer in its IO
+ *          completion queue, i.e. a reclaim would not block.
+ *
+ *  @arg    procId
+ *              Processor Identifier.
+ *  @arg    chnlId
+ *              Channel Identifier.
+ *  @arg    mode
+ *              Location to receive the mode of the channel. Only updated when
+ *              TRUE is returned.
+ *
+ *  @ret    TRUE
+ *              Channel is open and has a completed IO request.
+ *          FALSE
+ *              Channel is not open or has no completed IO request.
+ *
+ *  @enter  procId must be valid.
+ *          chnlId must be valid.
+ *          mode must be valid.
+ *
+ *  @leave  None.
+ *
+ *  @see    LDRV_CHNL_GetIOCompletion
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LDRV_CHNL_HasIOCompletion (IN  ProcessorId   procId,
+                           IN  ChannelId     chnlId,
+                           OUT ChannelMode * mode) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_GatherChirp
+ *
+ *  @desc   Copies the data described by a chirp into a contiguous buffer,
+ *          gathering the segments of a scatter-gather request in order.
+ *
+ *  @arg    chirp
+ *              Chirp to be gathered.
+ *  @arg    dst
+ *              Destination buffer.
+ *  @arg    bytes
+ *              Number of bytes to copy. Must not exceed chirp->size.
+ *  @arg    endianism
+ *              Endianism conversion to be applied while copying.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  chirp must be valid.
+ *          dst must be valid.
+ *
+ *  @leave  None.
+ *
+ *  @see    LDRV_CHNL_ScatterChirp
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_GatherChirp (IN LDRVChnlIRP * chirp,
+                       IN Uint8 *       dst,
+                       IN Uint32        bytes,
+                       IN Endianism     endianism) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_CHNL_ScatterChirp
+ *
+ *  @desc   Copies data from a contiguous buffer into the buffer described by
+ *          a chirp, scattering it across the segments of a scatter-gather
+ *          request in order.
+ *
+ *  @arg    chirp
+ *              Chirp to be filled.
+ *  @arg    src
+ *              Source buffer.
+ *  @arg    bytes
+ *              Number of bytes to copy. Must not exceed chirp->size.
+ *  @arg    endianism
+ *              Endianism conversion to be applied while copying.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  chirp must be valid.
+ *          src must be valid.
+ *
+ *  @leave  None.
+ *
+ *  @see    LDRV_CHNL_GatherChirp
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+LDRV_CHNL_ScatterChirp (IN LDRVChnlIRP * chirp,
+                        IN Uint8 *       src,
+                        IN Uint32        bytes,
+                        IN Endianism     endianism) ;
+
+
 /** ============================================================================
  *  @func   LDRV_CHNL_GetRequestChirp
  *
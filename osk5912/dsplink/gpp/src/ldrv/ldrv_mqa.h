@@ -171,6 +171,35 @@ typedef DSP_STATUS (*FnMqaFree) (LdrvMsgqAllocatorHandle mqaHandle,
                                  MsgqMsg                 addr,
                                  Uint16                  size) ;
 
+/** ============================================================================
+ *  @name   FnMqaAddRef
+ *
+ *  @desc   Signature of the function that adds references to an allocated
+ *          message, so that it is returned to the allocator only when the
+ *          last reference is freed.
+ *
+ *  @arg    mqaHandle
+ *              Handle to the MSGQ allocator object.
+ *  @arg    addr
+ *              Address of the message.
+ *  @arg    size
+ *              Size of the message.
+ *  @arg    count
+ *              Number of references to be added.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid argument.
+ *          DSP_EFAIL
+ *              General failure.
+ *  ============================================================================
+ */
+typedef DSP_STATUS (*FnMqaAddRef) (LdrvMsgqAllocatorHandle mqaHandle,
+                                   MsgqMsg                 addr,
+                                   Uint16                  size,
+                                   Uint16                  count) ;
+
 
 /** ============================================================================
  *  @name   MqaInterface
@@ -190,6 +219,10 @@ typedef DSP_STATUS (*FnMqaFree) (LdrvMsgqAllocatorHandle mqaHandle,
  *              Pointer to MQA function for allocating a message.
  *  @field  mqaFree
  *              Pointer to MQA function for freeing a message.
+ *  @field  mqaAddRef
+ *              Pointer to MQA function for adding references to a message.
+ *              This is optional, and is NULL for allocators that do not support
+ *              shared messages.
  *  ============================================================================
  */
 struct MqaInterface_tag {
@@ -199,6 +232,7 @@ struct MqaInterface_tag {
     FnMqaClose      mqaClose      ;
     FnMqaAlloc      mqaAlloc      ;
     FnMqaFree       mqaFree       ;
+    FnMqaAddRef     mqaAddRef     ;
 } ;
 
 /** ============================================================================
@@ -47,6 +47,7 @@
 #include <ldrv_mqa.h>
 #include <ldrv_msgq.h>
 #include <ldrv.h>
+#include <lmqt.h>
 
 
 #if defined (__cplusplus)
@@ -97,6 +98,34 @@ EXTERN LDRV_Object LDRV_Obj ;
 STATIC Bool   LDRV_MSGQ_IsInitialized = FALSE ;
 
 
+/** ----------------------------------------------------------------------------
+ *  @func   LDRV_MSGQ_FindSubscriber
+ *
+ *  @desc   This function returns the index of the subscriber entry used by the
+ *          specified MSGQ within a topic.
+ *
+ *  @arg    topic
+ *              Pointer to the topic object.
+ *  @arg    msgqId
+ *              ID of the subscribed MSGQ.
+ *
+ *  @ret    Index of the subscriber entry, or MAX_TOPIC_SUBSCRIBERS if the MSGQ
+ *          is not subscribed to the topic.
+ *
+ *  @enter  topic must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+Uint16
+LDRV_MSGQ_FindSubscriber (IN  LdrvMsgqTopicObj * topic,
+                          IN  MsgQueueId         msgqId) ;
+
+
 #if defined (DDSP_PROFILE)
 /** ----------------------------------------------------------------------------
  *  @func   LDRV_MSGQ_ResetProfile
@@ -188,6 +217,15 @@ LDRV_MSGQ_Setup ()
     LdrvMsgqStateObj.errorHandlerMsgq = MSGQ_INVALID_ID ;
     LdrvMsgqStateObj.errorMqaId       = MSGQ_INVALID_ID ;
 
+    for (i = 0 ; i < MAX_MSGQ_TOPICS ; i++) {
+        LdrvMsgqStateObj.topics [i].writeIndex = 0 ;
+        for (j = 0 ; j < MAX_TOPIC_SUBSCRIBERS ; j++) {
+            LdrvMsgqStateObj.topics [i].subscribers [j] = MSGQ_INVALID_ID ;
+            LdrvMsgqStateObj.topics [i].recvSem [j]     = NULL ;
+            LdrvMsgqStateObj.topics [i].readIndex [j]   = 0 ;
+        }
+    }
+
     /*  --------------------------------------------------------------------
      *  For each dsp get the id of the MQT being used.
      *  --------------------------------------------------------------------
@@ -345,15 +383,27 @@ LDRV_MSGQ_Destroy ()
     Uint16         i             = 0       ;
     MqaInterface * mqaInterface  = NULL    ;
     MqtInterface * mqtInterface  = NULL    ;
-
-#if defined (DDSP_PROFILE)
-    Uint16 j = 0 ;
-#endif /* defined (DDSP_PROFILE) */
+    Uint16         j             = 0       ;
 
     TRC_0ENTER ("LDRV_MSGQ_Destroy") ;
 
     DBC_Require (LDRV_MSGQ_IsInitialized == TRUE) ;
 
+    /*  ------------------------------------------------------------------------
+     *  Remove any subscribers left on the topics. The messages still held in
+     *  the rings belong to allocator memory that has already been released.
+     *  ------------------------------------------------------------------------
+     */
+    for (i = 0 ; i < MAX_MSGQ_TOPICS ; i++) {
+        for (j = 0 ; j < MAX_TOPIC_SUBSCRIBERS ; j++) {
+            if (LdrvMsgqStateObj.topics [i].recvSem [j] != NULL) {
+                SYNC_DeleteSEM (LdrvMsgqStateObj.topics [i].recvSem [j]) ;
+                LdrvMsgqStateObj.topics [i].recvSem [j] = NULL ;
+            }
+            LdrvMsgqStateObj.topics [i].subscribers [j] = MSGQ_INVALID_ID ;
+        }
+    }
+
 #if defined (DDSP_PROFILE)
     if (DSP_SUCCEEDED (status)) {
         /*  Finalize local message instrumentation data  */
@@ -999,6 +1049,60 @@ LDRV_MSGQ_Free (IN  MsgqMsg msg)
 }
 
 
+/** ============================================================================
+ *  @func   LDRV_MSGQ_AddRef
+ *
+ *  @desc   This function adds references to a message.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+LDRV_MSGQ_AddRef (IN  MsgqMsg msg, IN  Uint16 count)
+{
+    DSP_STATUS                status        = DSP_SOK ;
+    MqaInterface *            mqaInterface  = NULL    ;
+    LdrvMsgqAllocatorHandle   mqaHandle     = NULL    ;
+    AllocatorId               mqaId         = 0       ;
+
+    TRC_2ENTER ("LDRV_MSGQ_AddRef", msg, count) ;
+
+    DBC_Require (msg != NULL) ;
+    DBC_Require (LDRV_MSGQ_IsInitialized == TRUE) ;
+
+    mqaId = msg->mqaId ;
+
+    mqaHandle = &(LdrvMsgqStateObj.allocators[mqaId]) ;
+    mqaInterface = mqaHandle->mqaInterface ;
+
+    /*  The MQA component must be opened.  */
+    DBC_Assert (mqaHandle->mqaInfo != NULL) ;
+    DBC_Assert (mqaInterface != NULL) ;
+    DBC_Assert (mqaId < LdrvMsgqStateObj.numAllocators) ;
+
+    if (count != 0) {
+        if (mqaInterface->mqaAddRef == NULL) {
+            status = DSP_ENOTIMPL ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            status = mqaInterface->mqaAddRef (mqaHandle,
+                                              msg,
+                                              msg->size,
+                                              count) ;
+            if (DSP_FAILED (status)) {
+                SET_FAILURE_REASON ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_AddRef", status) ;
+
+    return status ;
+}
+
+
 /** ============================================================================
  *  @func   LDRV_MSGQ_Put
  *
@@ -1124,6 +1228,405 @@ LDRV_MSGQ_Get (IN  MsgQueueId msgqId, IN  Uint32 timeout, OUT MsgqMsg * msg)
 }
 
 
+/** ============================================================================
+ *  @func   LDRV_MSGQ_HasMessage
+ *
+ *  @desc   This function checks whether a message is pending on the specified
+ *          local MSGQ, or on a topic it subscribes to, without removing it.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+Bool
+LDRV_MSGQ_HasMessage (IN  MsgQueueId msgqId)
+{
+    Bool                      hasMessage = FALSE ;
+    LdrvMsgqTransportHandle   mqtHandle  = NULL  ;
+    LdrvMsgqTopicObj *        topic      = NULL  ;
+    Uint16                    i          = 0     ;
+    Uint16                    sub        = 0     ;
+
+    TRC_1ENTER ("LDRV_MSGQ_HasMessage", msgqId) ;
+
+    DBC_Require (LDRV_MSGQ_IsInitialized == TRUE) ;
+    DBC_Require (IS_VALID_MSGQID (msgqId)) ;
+
+    mqtHandle = &(LdrvMsgqStateObj.transports
+                    [LdrvMsgqStateObj.localTransportId]) ;
+
+    /*  Local MSGQs are always served by the local MQT, so its repository can
+     *  be inspected directly.
+     */
+    if (mqtHandle->mqtInfo != NULL) {
+        hasMessage = LMQT_HasMessage (mqtHandle, msgqId) ;
+    }
+
+    /*  Messages published on topics subscribed by this MSGQ also count.  */
+    for (i = 0 ; (i < MAX_MSGQ_TOPICS) && (hasMessage == FALSE) ; i++) {
+        topic = &(LdrvMsgqStateObj.topics [i]) ;
+        sub   = LDRV_MSGQ_FindSubscriber (topic, msgqId) ;
+        if (   (sub < MAX_TOPIC_SUBSCRIBERS)
+            && (topic->readIndex [sub] != topic->writeIndex)) {
+            hasMessage = TRUE ;
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_HasMessage", hasMessage) ;
+
+    return hasMessage ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_IsLocalId
+ *
+ *  @desc   This function checks whether the specified ID can name a local
+ *          MSGQ, i.e. falls within the MSGQs configured for the local MQT.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+Bool
+LDRV_MSGQ_IsLocalId (IN  MsgQueueId msgqId)
+{
+    Bool                      isLocal   = FALSE ;
+    LdrvMsgqTransportHandle   mqtHandle = NULL  ;
+
+    TRC_1ENTER ("LDRV_MSGQ_IsLocalId", msgqId) ;
+
+    DBC_Require (LDRV_MSGQ_IsInitialized == TRUE) ;
+
+    mqtHandle = &(LdrvMsgqStateObj.transports
+                    [LdrvMsgqStateObj.localTransportId]) ;
+
+    if ((IS_VALID_MSGQID (msgqId)) && (mqtHandle->mqtInfo != NULL)) {
+        isLocal = LMQT_IsValidId (mqtHandle, msgqId) ;
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_IsLocalId", isLocal) ;
+
+    return isLocal ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_Subscribe
+ *
+ *  @desc   This function subscribes a local MSGQ to the specified topic.
+ *
+ *  @modif  LdrvMsgqStateObj.topics
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+LDRV_MSGQ_Subscribe (IN  Uint16 topicId, IN  MsgQueueId msgqId)
+{
+    DSP_STATUS          status  = DSP_SOK               ;
+    LdrvMsgqTopicObj *  topic   = NULL                  ;
+    SyncSemObject *     recvSem = NULL                  ;
+    Uint16              sub     = MAX_TOPIC_SUBSCRIBERS ;
+    Uint16              i       = 0                     ;
+    SyncAttrs           attr                            ;
+
+    TRC_2ENTER ("LDRV_MSGQ_Subscribe", topicId, msgqId) ;
+
+    DBC_Require (LDRV_MSGQ_IsInitialized == TRUE) ;
+    DBC_Require (IS_VALID_TOPICID (topicId)) ;
+    DBC_Require (IS_VALID_MSGQID (msgqId)) ;
+
+    topic = &(LdrvMsgqStateObj.topics [topicId]) ;
+
+    attr.flag = SyncSemType_Binary ;
+    status = SYNC_CreateSEM (&recvSem, &attr) ;
+    if (DSP_FAILED (status)) {
+        SET_FAILURE_REASON ;
+    }
+    else {
+        SYNC_ProtectionStart () ;
+        if (LDRV_MSGQ_FindSubscriber (topic, msgqId) < MAX_TOPIC_SUBSCRIBERS) {
+            status = DSP_EALREADYEXISTS ;
+            SET_FAILURE_REASON ;
+        }
+        else {
+            for (i = 0 ;
+                 (i < MAX_TOPIC_SUBSCRIBERS) && (sub == MAX_TOPIC_SUBSCRIBERS) ;
+                 i++) {
+                if (topic->subscribers [i] == MSGQ_INVALID_ID) {
+                    sub = i ;
+                }
+            }
+
+            if (sub == MAX_TOPIC_SUBSCRIBERS) {
+                status = DSP_ERESOURCE ;
+                SET_FAILURE_REASON ;
+            }
+            else {
+                /*  The new subscriber only sees messages published from now
+                 *  on.
+                 */
+                topic->recvSem [sub]     = recvSem ;
+                topic->readIndex [sub]   = topic->writeIndex ;
+                topic->subscribers [sub] = msgqId ;
+            }
+        }
+        SYNC_ProtectionEnd () ;
+
+        if (DSP_FAILED (status)) {
+            SYNC_DeleteSEM (recvSem) ;
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_Subscribe", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_Unsubscribe
+ *
+ *  @desc   This function removes a local MSGQ from the subscribers of the
+ *          specified topic.
+ *
+ *  @modif  LdrvMsgqStateObj.topics
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+LDRV_MSGQ_Unsubscribe (IN  Uint16 topicId, IN  MsgQueueId msgqId)
+{
+    DSP_STATUS          status    = DSP_SOK ;
+    DSP_STATUS          tmpStatus = DSP_SOK ;
+    LdrvMsgqTopicObj *  topic     = NULL    ;
+    SyncSemObject *     recvSem   = NULL    ;
+    Uint16              sub       = 0       ;
+    Uint16              numMsgs   = 0       ;
+    Uint16              i         = 0       ;
+    MsgqMsg             pending [MSGQ_TOPIC_DEPTH] ;
+
+    TRC_2ENTER ("LDRV_MSGQ_Unsubscribe", topicId, msgqId) ;
+
+    DBC_Require (LDRV_MSGQ_IsInitialized == TRUE) ;
+    DBC_Require (IS_VALID_TOPICID (topicId)) ;
+    DBC_Require (IS_VALID_MSGQID (msgqId)) ;
+
+    topic = &(LdrvMsgqStateObj.topics [topicId]) ;
+
+    SYNC_ProtectionStart () ;
+    sub = LDRV_MSGQ_FindSubscriber (topic, msgqId) ;
+    if (sub == MAX_TOPIC_SUBSCRIBERS) {
+        status = DSP_ENOTFOUND ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        /*  Collect the messages this subscriber has not yet received, so that
+         *  its references on them can be dropped.
+         */
+        while (topic->readIndex [sub] != topic->writeIndex) {
+            pending [numMsgs++] =
+                    topic->ring [topic->readIndex [sub] % MSGQ_TOPIC_DEPTH] ;
+            topic->readIndex [sub]++ ;
+        }
+        recvSem = topic->recvSem [sub] ;
+        topic->recvSem [sub]     = NULL ;
+        topic->subscribers [sub] = MSGQ_INVALID_ID ;
+    }
+    SYNC_ProtectionEnd () ;
+
+    if (DSP_SUCCEEDED (status)) {
+        for (i = 0 ; i < numMsgs ; i++) {
+            tmpStatus = LDRV_MSGQ_Free (pending [i]) ;
+            if ((DSP_SUCCEEDED (status)) && (DSP_FAILED (tmpStatus))) {
+                status = tmpStatus ;
+                SET_FAILURE_REASON ;
+            }
+        }
+
+        tmpStatus = SYNC_DeleteSEM (recvSem) ;
+        if ((DSP_SUCCEEDED (status)) && (DSP_FAILED (tmpStatus))) {
+            status = tmpStatus ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_Unsubscribe", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_Publish
+ *
+ *  @desc   This function publishes a message on the specified topic.
+ *
+ *  @modif  LdrvMsgqStateObj.topics
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+LDRV_MSGQ_Publish (IN     Uint16      topicId,
+                   IN     MsgqMsg     msg,
+                   IN OPT Uint16      msgId,
+                   IN OPT MsgQueueId  srcMsgqId)
+{
+    DSP_STATUS          status     = DSP_SOK ;
+    DSP_STATUS          tmpStatus  = DSP_SOK ;
+    LdrvMsgqTopicObj *  topic      = NULL    ;
+    Uint16              numSubs    = 0       ;
+    Uint16              i          = 0       ;
+
+    TRC_4ENTER ("LDRV_MSGQ_Publish", topicId, msg, msgId, srcMsgqId) ;
+
+    DBC_Require (LDRV_MSGQ_IsInitialized == TRUE) ;
+    DBC_Require (IS_VALID_TOPICID (topicId)) ;
+    DBC_Require (msg != NULL) ;
+
+    topic = &(LdrvMsgqStateObj.topics [topicId]) ;
+
+    msg->msgId = msgId ;
+    msg->srcId = srcMsgqId ;
+    msg->dstId = MSGQ_INVALID_ID ;
+
+    SYNC_ProtectionStart () ;
+    for (i = 0 ;
+         (i < MAX_TOPIC_SUBSCRIBERS) && (DSP_SUCCEEDED (status)) ;
+         i++) {
+        if (topic->subscribers [i] != MSGQ_INVALID_ID) {
+            numSubs++ ;
+            /*  The ring slot to be written must have been received by every
+             *  subscriber.
+             */
+            if (   (topic->writeIndex - topic->readIndex [i])
+                >= MSGQ_TOPIC_DEPTH) {
+                status = DSP_ERESOURCE ;
+                SET_FAILURE_REASON ;
+            }
+        }
+    }
+
+    if ((DSP_SUCCEEDED (status)) && (numSubs == 0)) {
+        status = DSP_ENOTFOUND ;
+        SET_FAILURE_REASON ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        /*  The caller's reference goes to the first subscriber, one more is
+         *  added for each of the others.
+         */
+        status = LDRV_MSGQ_AddRef (msg, (Uint16) (numSubs - 1)) ;
+        if (DSP_SUCCEEDED (status)) {
+            topic->ring [topic->writeIndex % MSGQ_TOPIC_DEPTH] = msg ;
+            topic->writeIndex++ ;
+        }
+        else {
+            SET_FAILURE_REASON ;
+        }
+    }
+    SYNC_ProtectionEnd () ;
+
+    if (DSP_SUCCEEDED (status)) {
+        for (i = 0 ; i < MAX_TOPIC_SUBSCRIBERS ; i++) {
+            if (topic->subscribers [i] != MSGQ_INVALID_ID) {
+                tmpStatus = SYNC_SignalSEM (topic->recvSem [i]) ;
+                if ((DSP_SUCCEEDED (status)) && (DSP_FAILED (tmpStatus))) {
+                    status = tmpStatus ;
+                    SET_FAILURE_REASON ;
+                }
+                LDRV_Notify (LdrvNotifyType_Msgq,
+                             ID_LOCAL_PROCESSOR,
+                             topic->subscribers [i]) ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("LDRV_MSGQ_Publish", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_Receive
+ *
+ *  @desc   This function receives the next message published on the specified
+ *          topic for a subscriber.
+ *
+ *  @modif  LdrvMsgqStateObj.topics
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+LDRV_MSGQ_Receive (IN  Uint16      topicId,
+                   IN  MsgQueueId  msgqId,
+                   IN  Uint32      timeout,
+                   OUT MsgqMsg *   msg)
+{
+    DSP_STATUS          status  = DSP_SOK ;
+    LdrvMsgqTopicObj *  topic   = NULL    ;
+    SyncSemObject *     recvSem = NULL    ;
+    Uint16              sub     = 0       ;
+
+    TRC_4ENTER ("LDRV_MSGQ_Receive", topicId, msgqId, timeout, msg) ;
+
+    DBC_Require (LDRV_MSGQ_IsInitialized == TRUE) ;
+    DBC_Require (IS_VALID_TOPICID (topicId)) ;
+    DBC_Require (IS_VALID_MSGQID (msgqId)) ;
+    DBC_Require (msg != NULL) ;
+
+    topic = &(LdrvMsgqStateObj.topics [topicId]) ;
+
+    *msg = NULL ;
+    while ((DSP_SUCCEEDED (status)) && (*msg == NULL)) {
+        SYNC_ProtectionStart () ;
+        sub = LDRV_MSGQ_FindSubscriber (topic, msgqId) ;
+        if (sub == MAX_TOPIC_SUBSCRIBERS) {
+            status = DSP_ENOTFOUND ;
+        }
+        else if (topic->readIndex [sub] != topic->writeIndex) {
+            *msg = topic->ring [topic->readIndex [sub] % MSGQ_TOPIC_DEPTH] ;
+            topic->readIndex [sub]++ ;
+        }
+        else {
+            recvSem = topic->recvSem [sub] ;
+        }
+        SYNC_ProtectionEnd () ;
+
+        /*  --------------------------------------------------------------------
+         *  As with local MSGQs, the semaphore may have been posted for a
+         *  message that was already received, so check the ring again after
+         *  waking up.
+         *  --------------------------------------------------------------------
+         */
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+        else if (*msg == NULL) {
+            status = SYNC_WaitSEM (recvSem, timeout) ;
+            if ((timeout == SYNC_NOWAIT) && (status == SYNC_E_FAIL)) {
+                status = DSP_ENOTCOMPLETE ;
+                SET_FAILURE_REASON ;
+            }
+            else if (DSP_FAILED (status)) {
+                SET_FAILURE_REASON ;
+            }
+        }
+    }
+
+#if defined (DDSP_PROFILE)
+    if (DSP_SUCCEEDED (status)) {
+        LDRV_Obj.msgqStats.localMsgqData [msgqId].transferred++ ;
+    }
+#endif /* defined (DDSP_PROFILE) */
+
+    TRC_1LEAVE ("LDRV_MSGQ_Receive", status) ;
+
+    return status ;
+}
+
+
 /** ============================================================================
  *  @func   LDRV_MSGQ_GetReplyId
  *
@@ -1356,6 +1859,38 @@ LDRV_MSGQ_NotImpl ()
 }
 
 
+/** ----------------------------------------------------------------------------
+ *  @func   LDRV_MSGQ_FindSubscriber
+ *
+ *  @desc   This function returns the index of the subscriber entry used by the
+ *          specified MSGQ within a topic.
+ *
+ *  @modif  None.
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+Uint16
+LDRV_MSGQ_FindSubscriber (IN  LdrvMsgqTopicObj * topic,
+                          IN  MsgQueueId         msgqId)
+{
+    Uint16 sub = MAX_TOPIC_SUBSCRIBERS ;
+    Uint16 i   = 0 ;
+
+    DBC_Require (topic != NULL) ;
+
+    for (i = 0 ;
+         (i < MAX_TOPIC_SUBSCRIBERS) && (sub == MAX_TOPIC_SUBSCRIBERS) ;
+         i++) {
+        if (topic->subscribers [i] == msgqId) {
+            sub = i ;
+        }
+    }
+
+    return sub ;
+}
+
+
 #if defined (DDSP_PROFILE)
 /** ============================================================================
  *  @func   LDRV_MSGQ_Instrument
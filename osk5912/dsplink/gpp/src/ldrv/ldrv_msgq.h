@@ -140,6 +140,37 @@ struct LdrvMsgqObject_tag {
     LdrvMsgqStatus   msgqStatus ;
 } ;
 
+/** ============================================================================
+ *  @name   LdrvMsgqTopicObj
+ *
+ *  @desc   This structure defines a MSGQ topic. A message published on the
+ *          topic is held once in its ring, and is received by every subscriber
+ *          through its own read index. The message carries one reference per
+ *          subscriber, and returns to its allocator when the last subscriber
+ *          frees it.
+ *
+ *  @field  subscribers
+ *              IDs of the local MSGQs subscribed to the topic. Unused entries
+ *              are set to MSGQ_INVALID_ID.
+ *  @field  recvSem
+ *              Semaphores on which the subscribers wait for published messages.
+ *  @field  readIndex
+ *              Index of the next message in the ring for each subscriber.
+ *  @field  writeIndex
+ *              Index at which the next published message is placed in the
+ *              ring.
+ *  @field  ring
+ *              Ring of published messages.
+ *  ============================================================================
+ */
+typedef struct LdrvMsgqTopicObj_tag {
+    MsgQueueId       subscribers [MAX_TOPIC_SUBSCRIBERS] ;
+    SyncSemObject *  recvSem     [MAX_TOPIC_SUBSCRIBERS] ;
+    Uint32           readIndex   [MAX_TOPIC_SUBSCRIBERS] ;
+    Uint32           writeIndex ;
+    MsgqMsg          ring [MSGQ_TOPIC_DEPTH] ;
+} LdrvMsgqTopicObj ;
+
 /** ============================================================================
  *  @name   LdrvMsgqState
  *
@@ -173,6 +204,8 @@ struct LdrvMsgqObject_tag {
  *              error messages, if the user has registered an error handler
  *              MSGQ. If no error handler MSGQ has been registered by the user,
  *              the value of this field is MSGQ_INVALID_ID.
+ *  @field  topics
+ *              Array of MSGQ topics.
  *  ============================================================================
  */
 typedef struct LdrvMsgqState_tag {
@@ -184,6 +217,7 @@ typedef struct LdrvMsgqState_tag {
     Uint16                 mqtMap [MAX_PROCESSORS] ;
     MsgQueueId             errorHandlerMsgq ;
     AllocatorId            errorMqaId ;
+    LdrvMsgqTopicObj       topics [MAX_MSGQ_TOPICS] ;
 } LdrvMsgqState ;
 
 
@@ -550,6 +584,40 @@ DSP_STATUS
 LDRV_MSGQ_Free (IN  MsgqMsg msg) ;
 
 
+/** ============================================================================
+ *  @func   LDRV_MSGQ_AddRef
+ *
+ *  @desc   This function adds references to a message. Each additional
+ *          reference requires one more call to LDRV_MSGQ_Free () before the
+ *          message is returned to its allocator.
+ *
+ *  @arg    msg
+ *              Pointer to the message.
+ *  @arg    count
+ *              Number of references to be added.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTIMPL
+ *              The allocator of the message does not support shared messages.
+ *          DSP_EINVALIDARG
+ *              The message was not allocated by its allocator.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  The component must be initialized.
+ *          msg must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_Free
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+LDRV_MSGQ_AddRef (IN  MsgqMsg msg, IN  Uint16 count) ;
+
+
 /** ============================================================================
  *  @func   LDRV_MSGQ_Put
  *
@@ -625,6 +693,211 @@ DSP_STATUS
 LDRV_MSGQ_Get (IN  MsgQueueId msgqId, IN  Uint32 timeout, OUT MsgqMsg * msg) ;
 
 
+/** ============================================================================
+ *  @func   LDRV_MSGQ_HasMessage
+ *
+ *  @desc   This function checks whether a message is pending on the specified
+ *          local MSGQ, or on a topic it subscribes to, without removing it.
+ *
+ *  @arg    msgqId
+ *              ID of the MSGQ to be checked.
+ *
+ *  @ret    TRUE
+ *              At least one message is pending on the MSGQ.
+ *          FALSE
+ *              The MSGQ does not exist or is empty.
+ *
+ *  @enter  The component must be initialized.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_Get
+ *  ============================================================================
+ */
+EXPORT_API
+Bool
+LDRV_MSGQ_HasMessage (IN  MsgQueueId msgqId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_IsLocalId
+ *
+ *  @desc   This function checks whether the specified ID can name a local
+ *          MSGQ, i.e. falls within the MSGQs configured for the local MQT.
+ *
+ *  @arg    msgqId
+ *              ID to be checked.
+ *
+ *  @ret    TRUE
+ *              The ID is within the local MSGQs.
+ *          FALSE
+ *              The ID is out of range, or the local MQT is not open.
+ *
+ *  @enter  The component must be initialized.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_HasMessage
+ *  ============================================================================
+ */
+EXPORT_API
+Bool
+LDRV_MSGQ_IsLocalId (IN  MsgQueueId msgqId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_Subscribe
+ *
+ *  @desc   This function subscribes a local MSGQ to the specified topic. The
+ *          subscriber receives all messages published on the topic after this
+ *          call.
+ *
+ *  @arg    topicId
+ *              ID of the topic.
+ *  @arg    msgqId
+ *              ID of the subscribing local MSGQ.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EALREADYEXISTS
+ *              The MSGQ is already subscribed to the topic.
+ *          DSP_ERESOURCE
+ *              The topic has no free subscriber entries.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  The component must be initialized.
+ *          topicId and msgqId must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_Unsubscribe, LDRV_MSGQ_Publish
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+LDRV_MSGQ_Subscribe (IN  Uint16 topicId, IN  MsgQueueId msgqId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_Unsubscribe
+ *
+ *  @desc   This function removes a local MSGQ from the subscribers of the
+ *          specified topic. References held on messages not yet received by
+ *          the subscriber are freed.
+ *
+ *  @arg    topicId
+ *              ID of the topic.
+ *  @arg    msgqId
+ *              ID of the subscribed local MSGQ.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The MSGQ is not subscribed to the topic.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  The component must be initialized.
+ *          topicId and msgqId must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_Subscribe
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+LDRV_MSGQ_Unsubscribe (IN  Uint16 topicId, IN  MsgQueueId msgqId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_Publish
+ *
+ *  @desc   This function publishes a message on the specified topic. The
+ *          message is delivered to every subscriber without being copied, and
+ *          each subscriber must free it after receiving it.
+ *
+ *  @arg    topicId
+ *              ID of the topic.
+ *  @arg    msg
+ *              Pointer to the message to be published.
+ *  @arg    msgId
+ *              Optional message ID to be associated with the message.
+ *  @arg    srcMsgqId
+ *              ID of the source MSGQ to receive reply messages (if any).
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The topic has no subscribers.
+ *          DSP_ERESOURCE
+ *              The ring of the topic is full for at least one subscriber.
+ *          DSP_ENOTIMPL
+ *              The allocator of the message does not support shared messages.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  The component must be initialized.
+ *          topicId must be valid.
+ *          msg must be valid.
+ *
+ *  @leave  On success, ownership of the message passes to the subscribers.
+ *
+ *  @see    LDRV_MSGQ_Receive, LDRV_MSGQ_AddRef
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+LDRV_MSGQ_Publish (IN     Uint16      topicId,
+                   IN     MsgqMsg     msg,
+                   IN OPT Uint16      msgId,
+                   IN OPT MsgQueueId  srcMsgqId) ;
+
+
+/** ============================================================================
+ *  @func   LDRV_MSGQ_Receive
+ *
+ *  @desc   This function receives the next message published on the specified
+ *          topic for a subscriber.
+ *
+ *  @arg    topicId
+ *              ID of the topic.
+ *  @arg    msgqId
+ *              ID of the subscribed local MSGQ.
+ *  @arg    timeout
+ *              Timeout value to wait for the message (in milliseconds).
+ *  @arg    msg
+ *              Location to receive the message.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_ENOTFOUND
+ *              The MSGQ is not subscribed to the topic.
+ *          DSP_ENOTCOMPLETE
+ *              No message was available and timeout was SYNC_NOWAIT.
+ *          DSP_ETIMEOUT
+ *              Timeout occurred while receiving the message.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  The component must be initialized.
+ *          topicId and msgqId must be valid.
+ *          msg must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LDRV_MSGQ_Publish
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+LDRV_MSGQ_Receive (IN  Uint16      topicId,
+                   IN  MsgQueueId  msgqId,
+                   IN  Uint32      timeout,
+                   OUT MsgqMsg *   msg) ;
+
+
 /** ============================================================================
  *  @func   LDRV_MSGQ_GetReplyId
  *
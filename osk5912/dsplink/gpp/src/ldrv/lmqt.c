@@ -807,6 +807,7 @@ LMQT_Put (IN  LdrvMsgqTransportHandle mqtHandle,
                 if (DSP_FAILED (status)) {
                     SET_FAILURE_REASON ;
                 }
+                LDRV_Notify (LdrvNotifyType_Msgq, ID_LOCAL_PROCESSOR, msgqId) ;
             }
             else {
                 SET_FAILURE_REASON ;
@@ -824,6 +825,81 @@ LMQT_Put (IN  LdrvMsgqTransportHandle mqtHandle,
 }
 
 
+/** ============================================================================
+ *  @func   LMQT_HasMessage
+ *
+ *  @desc   This function checks whether a message is pending on the specified
+ *          local MSGQ, without removing it.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LMQT_HasMessage (IN  LdrvMsgqTransportHandle mqtHandle,
+                 IN  MsgQueueId              msgqId)
+{
+    Bool        hasMessage = FALSE ;
+    LmqtState * mqtState   = NULL  ;
+    LmqtObj *   ptrMsgq    = NULL  ;
+
+    TRC_2ENTER ("LMQT_HasMessage", mqtHandle, msgqId) ;
+
+    DBC_Require (mqtHandle != NULL) ;
+
+    mqtState = (LmqtState *) (mqtHandle->mqtInfo) ;
+
+    /*  The ID may come from user space through the poll interest masks, so it
+     *  is checked against the size of the handle table at run time.
+     */
+    SYNC_ProtectionStart () ;
+    if (   (mqtState != NULL)
+        && (msgqId < mqtState->maxNumMsgq)
+        && (mqtState->msgqHandles [msgqId] != NULL)) {
+        ptrMsgq = (LmqtObj *)
+                            (mqtState->msgqHandles [msgqId]->mqtRepository) ;
+        hasMessage = !LIST_IsEmpty (ptrMsgq->msgQueue) ;
+    }
+    SYNC_ProtectionEnd () ;
+
+    TRC_1LEAVE ("LMQT_HasMessage", hasMessage) ;
+
+    return hasMessage ;
+}
+
+
+/** ============================================================================
+ *  @func   LMQT_IsValidId
+ *
+ *  @desc   This function checks whether the specified ID falls within the
+ *          local MSGQs configured for this MQT.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LMQT_IsValidId (IN  LdrvMsgqTransportHandle mqtHandle,
+                IN  MsgQueueId              msgqId)
+{
+    Bool        isValid  = FALSE ;
+    LmqtState * mqtState = NULL  ;
+
+    TRC_2ENTER ("LMQT_IsValidId", mqtHandle, msgqId) ;
+
+    DBC_Require (mqtHandle != NULL) ;
+
+    mqtState = (LmqtState *) (mqtHandle->mqtInfo) ;
+    if ((mqtState != NULL) && (msgqId < mqtState->maxNumMsgq)) {
+        isValid = TRUE ;
+    }
+
+    TRC_1LEAVE ("LMQT_IsValidId", isValid) ;
+
+    return isValid ;
+}
+
+
 /** ============================================================================
  *  @func   LMQT_GetReplyId
  *
@@ -388,6 +388,64 @@ LMQT_Put (IN  LdrvMsgqTransportHandle mqtHandle,
           IN  MsgqMsg                 msg) ;
 
 
+/** ============================================================================
+ *  @func   LMQT_HasMessage
+ *
+ *  @desc   This function checks whether a message is pending on the specified
+ *          local MSGQ, without removing it.
+ *
+ *  @arg    mqtHandle
+ *              This is the handle to LDRV MSGQ transport object.
+ *  @arg    msgqId
+ *              ID of the MSGQ to be checked.
+ *
+ *  @ret    TRUE
+ *              At least one message is pending on the MSGQ.
+ *          FALSE
+ *              The MSGQ does not exist or is empty.
+ *
+ *  @enter  mqtHandle must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LMQT_Get
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LMQT_HasMessage (IN  LdrvMsgqTransportHandle mqtHandle,
+                 IN  MsgQueueId              msgqId) ;
+
+
+/** ============================================================================
+ *  @func   LMQT_IsValidId
+ *
+ *  @desc   This function checks whether the specified ID falls within the
+ *          local MSGQs configured for this MQT.
+ *
+ *  @arg    mqtHandle
+ *              This is the handle to LDRV MSGQ transport object.
+ *  @arg    msgqId
+ *              ID of the MSGQ to be checked.
+ *
+ *  @ret    TRUE
+ *              The ID is below the maximum number of local MSGQs.
+ *          FALSE
+ *              The MQT is not open, or the ID is out of range.
+ *
+ *  @enter  mqtHandle must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    LMQT_HasMessage
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+LMQT_IsValidId (IN  LdrvMsgqTransportHandle mqtHandle,
+                IN  MsgQueueId              msgqId) ;
+
+
 /** ============================================================================
  *  @func   LMQT_GetReplyId
  *
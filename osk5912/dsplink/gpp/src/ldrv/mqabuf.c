@@ -34,6 +34,7 @@
 /*  ----------------------------------- OSAL Header                   */
 #include <mem.h>
 #include <mem_os.h>
+#include <sync.h>
 #include <print.h>
 
 /*  ----------------------------------- Generic Function              */
@@ -90,10 +91,52 @@ MqaInterface MQABUF_Interface = {
     &MQABUF_Open,
     &MQABUF_Close,
     &MQABUF_Alloc,
-    &MQABUF_Free
+    &MQABUF_Free,
+    &MQABUF_AddRef
 } ;
 
 
+/** ----------------------------------------------------------------------------
+ *  @func   MQABUF_FindBuffer
+ *
+ *  @desc   Locates the buffer pool of the specified message size, and the index
+ *          of the message within it.
+ *
+ *  @arg    mqaState
+ *              State object of the MQA.
+ *  @arg    addr
+ *              Address of the message.
+ *  @arg    size
+ *              Size of the message.
+ *  @arg    bufPool
+ *              Location to receive the buffer pool of the message.
+ *  @arg    index
+ *              Location to receive the index of the message within the pool.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              No pool of the specified size exists, or the message does not
+ *              belong to it.
+ *
+ *  @enter  mqaState must be valid.
+ *          bufPool and index must be valid pointers.
+ *
+ *  @leave  None
+ *
+ *  @see    MQABUF_Free, MQABUF_AddRef
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+DSP_STATUS
+MQABUF_FindBuffer (IN  MqaBufState *  mqaState,
+                   IN  MsgqMsg        addr,
+                   IN  Uint16         size,
+                   OUT MqaBufObj **   bufPool,
+                   OUT Uint16 *       index) ;
+
+
 /** ============================================================================
  *  @func   MQABUF_Initialize
  *
@@ -303,11 +346,19 @@ MQABUF_Open (IN  LdrvMsgqAllocatorHandle mqaHandle, IN  Pvoid mqaAttrs)
                     /*  Create BUF pools for the arguments specified by
                      *  the user
                      */
-                    bufPools [i].msgSize = msgSize [i] ;
+                    bufPools [i].msgSize  = msgSize [i] ;
+                    bufPools [i].numMsg   = numMsg  [i] ;
+                    bufPools [i].baseAddr = startAddr ;
                     status = BUF_Create (numMsg  [i],
                                          msgSize [i],
                                          &(bufPools [i].msgList),
                                          startAddr) ;
+                    if (DSP_SUCCEEDED (status)) {
+                        status = MEM_Calloc (
+                                        (Void **) &(bufPools [i].refCount),
+                                        (numMsg [i] * sizeof (Uint16)),
+                                        MEM_DEFAULT) ;
+                    }
                     startAddr +=   (numMsg  [i])
                                  * (msgSize [i]) ;
                 }
@@ -395,6 +446,13 @@ MQABUF_Close (IN  LdrvMsgqAllocatorHandle mqaHandle)
                     status = tmpStatus ;
                     SET_FAILURE_REASON ;
                 }
+                if (bufPools [i].refCount != NULL) {
+                    tmpStatus = FREE_PTR (bufPools [i].refCount) ;
+                    if ((DSP_SUCCEEDED (status)) && (DSP_FAILED (tmpStatus))) {
+                        status = tmpStatus ;
+                        SET_FAILURE_REASON ;
+                    }
+                }
             }
             /* Free memory for the buffer pool objects */
             tmpStatus = FREE_PTR (bufPools) ;
@@ -528,9 +586,10 @@ MQABUF_Free (IN  LdrvMsgqAllocatorHandle mqaHandle,
 {
     DSP_STATUS       status      = DSP_SOK ;
     MqaBufState *    mqaState    = NULL    ;
-    MqaBufObj *      bufPools    = NULL    ;
-    Bool             found       = FALSE   ;
-    Uint16           i           = 0       ;
+    MqaBufObj *      bufPool     = NULL    ;
+    Bool             release     = TRUE    ;
+    Uint16           index       = 0       ;
+    Uint32           irqFlags    = 0       ;
 
     TRC_3ENTER ("MQABUF_Free", mqaHandle, addr, size) ;
 
@@ -546,21 +605,30 @@ MQABUF_Free (IN  LdrvMsgqAllocatorHandle mqaHandle,
         mqaState = (MqaBufState *) (mqaHandle->mqaInfo) ;
         DBC_Assert (mqaState != NULL) ;
         if (mqaState != NULL) {
-            bufPools = mqaState->bufPools ;
+            status = MQABUF_FindBuffer (mqaState,
+                                        addr,
+                                        size,
+                                        &bufPool,
+                                        &index) ;
+            if (DSP_SUCCEEDED (status)) {
+                /*  A shared message only goes back to its pool when the last
+                 *  reference to it is freed.
+                 */
+                irqFlags = SYNC_SpinLockStart () ;
+                if (bufPool->refCount [index] != 0) {
+                    bufPool->refCount [index]-- ;
+                    release = FALSE ;
+                }
+                SYNC_SpinLockEnd (irqFlags) ;
 
-            for (i = 0 ; ((i < mqaState->numBufPools) && (found != TRUE)) ;
-                 i++) {
-                if (bufPools [i].msgSize == size) {
-                    found = TRUE ;
-                    status = BUF_Free (bufPools [i].msgList, addr) ;
+                if (release == TRUE) {
+                    status = BUF_Free (bufPool->msgList, addr) ;
                     if (DSP_FAILED (status)) {
                         SET_FAILURE_REASON ;
                     }
                 }
             }
-            /* Invalid size requested by user */
-            if (found == FALSE) {
-                status = DSP_EINVALIDARG ;
+            else {
                 SET_FAILURE_REASON ;
             }
         }
@@ -576,6 +644,123 @@ MQABUF_Free (IN  LdrvMsgqAllocatorHandle mqaHandle,
 }
 
 
+/** ============================================================================
+ *  @func   MQABUF_AddRef
+ *
+ *  @desc   This function adds references to a message buffer allocated from
+ *          the MQA.
+ *
+ *  @modif  bufPools [].refCount
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+MQABUF_AddRef (IN  LdrvMsgqAllocatorHandle mqaHandle,
+               IN  MsgqMsg                 addr,
+               IN  Uint16                  size,
+               IN  Uint16                  count)
+{
+    DSP_STATUS       status      = DSP_SOK ;
+    MqaBufState *    mqaState    = NULL    ;
+    MqaBufObj *      bufPool     = NULL    ;
+    Uint16           index       = 0       ;
+    Uint32           irqFlags    = 0       ;
+
+    TRC_4ENTER ("MQABUF_AddRef", mqaHandle, addr, size, count) ;
+
+    DBC_Require (MQABUF_IsInitialized == TRUE) ;
+    DBC_Require (mqaHandle != NULL) ;
+    DBC_Require (addr != NULL) ;
+
+    if ((mqaHandle == NULL) || (addr == NULL)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        mqaState = (MqaBufState *) (mqaHandle->mqaInfo) ;
+        DBC_Assert (mqaState != NULL) ;
+        if (mqaState != NULL) {
+            status = MQABUF_FindBuffer (mqaState,
+                                        addr,
+                                        size,
+                                        &bufPool,
+                                        &index) ;
+            if (DSP_SUCCEEDED (status)) {
+                irqFlags = SYNC_SpinLockStart () ;
+                bufPool->refCount [index] += count ;
+                SYNC_SpinLockEnd (irqFlags) ;
+            }
+            else {
+                SET_FAILURE_REASON ;
+            }
+        }
+        else {
+            status = DSP_EFAIL ;
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("MQABUF_AddRef", status) ;
+
+    return status ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   MQABUF_FindBuffer
+ *
+ *  @desc   Locates the buffer pool of the specified message size, and the index
+ *          of the message within it.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+DSP_STATUS
+MQABUF_FindBuffer (IN  MqaBufState *  mqaState,
+                   IN  MsgqMsg        addr,
+                   IN  Uint16         size,
+                   OUT MqaBufObj **   bufPool,
+                   OUT Uint16 *       index)
+{
+    DSP_STATUS       status      = DSP_EINVALIDARG ;
+    MqaBufObj *      bufPools    = NULL    ;
+    Bool             found       = FALSE   ;
+    Uint32           offset      = 0       ;
+    Uint16           i           = 0       ;
+
+    TRC_5ENTER ("MQABUF_FindBuffer", mqaState, addr, size, bufPool, index) ;
+
+    DBC_Require (mqaState != NULL) ;
+    DBC_Require (bufPool != NULL) ;
+    DBC_Require (index != NULL) ;
+
+    bufPools = mqaState->bufPools ;
+
+    for (i = 0 ; ((i < mqaState->numBufPools) && (found != TRUE)) ; i++) {
+        if (bufPools [i].msgSize == size) {
+            found = TRUE ;
+            /*  Pools are carved out of one contiguous chunk, so the index of
+             *  the message follows directly from its address.
+             */
+            offset = (Uint32) addr - bufPools [i].baseAddr ;
+            if (   ((Uint32) addr >= bufPools [i].baseAddr)
+                && ((offset % size) == 0)
+                && ((offset / size) < bufPools [i].numMsg)) {
+                *bufPool = &(bufPools [i]) ;
+                *index   = (Uint16) (offset / size) ;
+                status   = DSP_SOK ;
+            }
+        }
+    }
+
+    TRC_1LEAVE ("MQABUF_FindBuffer", status) ;
+
+    return status ;
+}
+
+
 #if defined (__cplusplus)
 }
 #endif /* defined (__cplusplus) */
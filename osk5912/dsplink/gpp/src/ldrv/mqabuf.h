@@ -39,11 +39,22 @@ EXTERN "C" {
  *              Size of the messages in the buffer pool.
  *  @field  msgList
  *              List of messages in the buffer pool.
+ *  @field  numMsg
+ *              Number of messages in the buffer pool.
+ *  @field  baseAddr
+ *              Address of the first message in the buffer pool.
+ *  @field  refCount
+ *              Array of additional references held on each message in the
+ *              buffer pool. A message is returned to the pool only when it is
+ *              freed with no additional references outstanding.
  *  ============================================================================
  */
 typedef struct MqaBufObj_tag {
     Uint16      msgSize ;
     BufHandle   msgList ;
+    Uint16      numMsg ;
+    Uint32      baseAddr ;
+    Uint16 *    refCount ;
 } MqaBufObj ;
 
 
@@ -261,6 +272,46 @@ MQABUF_Free (IN  LdrvMsgqAllocatorHandle mqaHandle,
              IN  Uint16                  size) ;
 
 
+/** ============================================================================
+ *  @func   MQABUF_AddRef
+ *
+ *  @desc   This function adds references to a message buffer allocated from
+ *          the MQA. Each additional reference requires one more call to
+ *          MQABUF_Free () before the buffer is returned to its pool.
+ *
+ *  @arg    mqaHandle
+ *              Handle to the MSGQ allocator object.
+ *  @arg    addr
+ *              Address of the message.
+ *  @arg    size
+ *              Size of the message.
+ *  @arg    count
+ *              Number of references to be added.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid argument.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  mqaHandle must be valid.
+ *          addr must be valid.
+ *          The component must be intialized.
+ *
+ *  @leave  None
+ *
+ *  @see    MqaBufObj, MQABUF_Free
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+MQABUF_AddRef (IN  LdrvMsgqAllocatorHandle mqaHandle,
+               IN  MsgqMsg                 addr,
+               IN  Uint16                  size,
+               IN  Uint16                  count) ;
+
+
 #if defined (__cplusplus)
 }
 #endif /* defined (__cplusplus) */
@@ -440,6 +440,7 @@ RMQT_Open (IN  LdrvMsgqTransportHandle mqtHandle, IN  Pvoid mqtAttrs)
                     ioInfo.size       = rmqtAttrs->maxMsgSize ;
                     ioInfo.arg        = (Uint32) mqtHandle ;
                     ioInfo.callback   = RMQT_GetCallback ;
+                    ioInfo.numSegs    = 0 ;
                     ioInfo.dpcContext = FALSE ;
 
                     /* Set the mqtState here, since the callback will be
@@ -544,6 +545,7 @@ RMQT_Close (IN  LdrvMsgqTransportHandle mqtHandle)
                 ioInfo.size       = mqtState->maxMsgSize ;
                 ioInfo.arg        = (Uint32) NULL ;
                 ioInfo.callback   = NULL ;
+                ioInfo.numSegs    = 0 ;
                 ioInfo.dpcContext = FALSE ;
                 tmpStatus = LDRV_CHNL_AddIORequest (mqtState->procId,
                                                     ID_MSGCHNL_TO_DSP,
@@ -1017,6 +1019,7 @@ RMQT_PutCallback (IN  ProcessorId   procId,
                         ioInfo.size       = msgHeader->size * wordSize ;
                         ioInfo.arg        = (Uint32) mqtHandle ;
                         ioInfo.callback   = RMQT_PutCallback ;
+                        ioInfo.numSegs    = 0 ;
                         ioInfo.dpcContext = TRUE ;
                         status = LDRV_CHNL_AddIORequest (mqtState->procId,
                                                          ID_MSGCHNL_TO_DSP,
@@ -1178,6 +1181,7 @@ RMQT_GetCallback (IN  ProcessorId   procId,
             ioInfo.size       = mqtState->maxMsgSize ;
             ioInfo.arg        = (Uint32) mqtHandle ;
             ioInfo.callback   = RMQT_GetCallback ;
+            ioInfo.numSegs    = 0 ;
             ioInfo.dpcContext = TRUE ;
             status = LDRV_CHNL_AddIORequest (procId,
                                              ID_MSGCHNL_FM_DSP,
@@ -1622,6 +1626,7 @@ SendMessage (IN  LdrvMsgqTransportHandle mqtHandle,
             ioInfo.size       = msgSize ;
             ioInfo.arg        = (Uint32) mqtHandle ;
             ioInfo.callback   = RMQT_PutCallback ;
+            ioInfo.numSegs    = 0 ;
             ioInfo.dpcContext = dpcContext ;
             status = LDRV_CHNL_AddIORequest (mqtState->procId,
                                              ID_MSGCHNL_TO_DSP,
@@ -979,8 +979,11 @@ SHM_IO_Request (IN ProcessorId dspId, IN ChannelId chnlId)
  *  @func   SHM_HandshakeSetup
  *
  *  @desc   Does initialization of handshake fields in shared memory.
+ *          The fields written by a previously running DSP image are cleared
+ *          and the IO requests still pending on open channels are advertised
+ *          again, so that channels survive a reload of the DSP.
  *
- *  @modif  None.
+ *  @modif  shmInfo->outputMask, shmInfo->outputMsg
  *  ============================================================================
  */
 NORMAL_API
@@ -988,17 +991,58 @@ DSP_STATUS
 SHM_HandshakeSetup (IN ProcessorId dspId)
 {
     DSP_STATUS           status     = DSP_SOK ;
+    SHM_DriverInfo *     shmInfo    = NULL    ;
     SHM_Control *        shmCtrl    = NULL    ;
+    ChannelId            chnlId               ;
 
     TRC_1ENTER ("SHM_IO_HandshakeSetup", dspId) ;
 
     DBC_Require (IS_VALID_PROCID (dspId)) ;
 
-    shmCtrl  = SHM_DrvInfo [dspId].ptrControl ;
+    shmInfo  = &(SHM_DrvInfo [dspId]) ;
+    shmCtrl  = shmInfo->ptrControl ;
+
+    SYNC_ProtectionStart () ;
 
     shmCtrl->handshakeDsp = 0x0 ;
     shmCtrl->handshakeGpp = 0x0 ;
 
+    /*  ------------------------------------------------------------------------
+     *  Discard the transfer state of the previous DSP image. No transfer is
+     *  attempted until the new image indicates that it has free buffers.
+     *  ------------------------------------------------------------------------
+     */
+    shmCtrl->dspFreeMask  = (Uint16) 0x0 ;
+    shmCtrl->gppFreeMask  = (Uint16) 0x0 ;
+    shmCtrl->inputFull    = (Uint16) 0x0 ;
+    shmCtrl->outputFull   = (Uint16) 0x0 ;
+    shmInfo->outputMask   = 0x0 ;
+#if defined (MSGQ_COMPONENT)
+    shmCtrl->dspFreeMsg   = (Uint16) 0x0 ;
+    shmCtrl->gppFreeMsg   = (Uint16) 0x0 ;
+    shmInfo->outputMsg    = 0x0 ;
+#endif /* if defined (MSGQ_COMPONENT) */
+
+    /*  ------------------------------------------------------------------------
+     *  Requeue the IO requests pending on the channels that are still open.
+     *  ------------------------------------------------------------------------
+     */
+    for (chnlId = 0 ; chnlId < (MAX_CHANNELS + NUM_MSGQ_CHANNELS) ; chnlId++) {
+        if (   (LDRV_CHNL_GetChannelState (dspId, chnlId)
+                                                    != ChannelState_Closed)
+            && (LDRV_CHNL_ChannelHasMoreChirps (dspId, chnlId) == TRUE)) {
+            if (   LDRV_CHNL_GetChannelMode (dspId, chnlId)
+                == ChannelMode_Input) {
+                SET_GPPFREEMASKBIT (shmCtrl, chnlId) ;
+            }
+            else {
+                SET_GPPINFO (shmInfo, chnlId) ;
+            }
+        }
+    }
+
+    SYNC_ProtectionEnd () ;
+
     TRC_1LEAVE ("SHM_IO_HandshakeSetup", status) ;
 
     return status ;
@@ -1234,10 +1278,11 @@ SHM_GetData (IN ProcessorId dspId)
                         endianism = LDRV_CHNL_GetChannelEndianism (dspId,
                                                                    chnlId) ;
 
-                        status    = MEM_Copy (chirp->buffer,
-                                              shmInfo->ptrInpData,
-                                              bytes,
-                                              endianism) ;
+                        status    = LDRV_CHNL_ScatterChirp (
+                                                      chirp,
+                                                      shmInfo->ptrInpData,
+                                                      bytes,
+                                                      endianism) ;
 
                         if (DSP_SUCCEEDED (status)) {
                             chirp->size = bytes ;
@@ -1429,10 +1474,10 @@ SHM_PutData (IN ProcessorId dspId)
                     endianism = LDRV_CHNL_GetChannelEndianism (dspId, chnlId) ;
                     bytes = MIN (chirp->size, shmInfo->maxBufSize) ;
 
-                    status = MEM_Copy (shmInfo->ptrOutData,
-                                       chirp->buffer,
-                                       bytes,
-                                       endianism) ;
+                    status = LDRV_CHNL_GatherChirp (chirp,
+                                                    shmInfo->ptrOutData,
+                                                    bytes,
+                                                    endianism) ;
 
                     if (DSP_SUCCEEDED (status)) {
                         /*  ----------------------------------------------------
@@ -353,7 +353,9 @@ SHM_ScheduleDPC (IN ProcessorId dspId, IN ChannelId chnlId) ;
 /** ============================================================================
  *  @func   SHM_HandshakeSetup
  *
- *  @desc   Does initialization of handshake fields in shared memory.
+ *  @desc   Does initialization of handshake fields in shared memory. Clears
+ *          the state left by a previous DSP image and advertises the IO
+ *          requests pending on open channels again.
  *
  *  @arg    dspId
  *              Processor Identifier.
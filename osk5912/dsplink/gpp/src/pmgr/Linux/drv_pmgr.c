@@ -20,6 +20,8 @@
 #include <linux/init.h>
 #include <linux/fs.h>
 #include <linux/mm.h>
+#include <linux/sched.h>
+#include <linux/poll.h>
 #include <asm/uaccess.h>
 #include <asm/io.h>
 
@@ -30,6 +32,8 @@
 #include <safe.h>
 
 #include <cfgdefs.h>
+#include <dspdefs.h>
+#include <linkdefs.h>
 #if defined (MSGQ_COMPONENT)
 #include <msgqdefs.h>
 #endif /* if defined (MSGQ_COMPONENT) */
@@ -47,6 +51,8 @@
 #include <print.h>
 #include <mem.h>
 #include <mem_os.h>
+#include <cfg.h>
+#include <sync.h>
 #include <prcs.h>
 #include <drv_pmgr.h>
 #include <drv_api.h>
@@ -66,6 +72,7 @@
 #endif /* if defined (MSGQ_COMPONENT) */
 
 /*  ----------------------------------- Link Driver                   */
+#include <ldrv.h>
 #if defined (MSGQ_COMPONENT)
 #include <ldrv_mqa.h>
 #include <mqabuf.h>
@@ -192,6 +199,35 @@ STATIC Int32 major = 230 ;
 STATIC Bool DRV_IsInitialized = FALSE ;
 
 
+/** ----------------------------------------------------------------------------
+ *  @name   DrvPollObject
+ *
+ *  @desc   Per-open poll interest of a process. Stored in the private data of
+ *          the file structure.
+ *
+ *  @field  chnlMask
+ *              Bit mask of channels registered for poll, per processor.
+ *  @field  msgqMask
+ *              Bit mask of local MSGQs registered for poll.
+ *  ----------------------------------------------------------------------------
+ */
+typedef struct DrvPollObject_tag {
+    Uint32      chnlMask [MAX_PROCESSORS] ;
+    Uint32      msgqMask                  ;
+} DrvPollObject ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @name   DRV_PollWaitQueue
+ *
+ *  @desc   Wait queue on which poll ()/select () callers sleep. Woken up by
+ *          LDRV whenever a channel buffer completes or a local message is
+ *          queued.
+ *  ----------------------------------------------------------------------------
+ */
+STATIC DECLARE_WAIT_QUEUE_HEAD (DRV_PollWaitQueue) ;
+
+
 /** ----------------------------------------------------------------------------
  *  @name   DRV_CallAPI
  *
@@ -309,6 +345,59 @@ DRV_Ioctl (struct inode * inode, struct file * filp,
            unsigned int cmd, unsigned long args) ;
 
 
+/** ----------------------------------------------------------------------------
+ *  @func   DRV_Poll
+ *
+ *  @desc   poll function for Linux LINK driver. Reports the channels and MSGQs
+ *          registered on this file as readable/writable when a reclaim or get
+ *          on them would not block.
+ *
+ *  @arg    filp
+ *              file pointer.
+ *  @arg    wait
+ *              Poll table of the caller.
+ *
+ *  @ret    Mask of the poll events which are currently signaled.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_PollNotify
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+unsigned int
+DRV_Poll (struct file * filp, poll_table * wait) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   DRV_PollNotify
+ *
+ *  @desc   Notification function registered with LDRV. Wakes up all callers
+ *          sleeping in DRV_Poll.
+ *
+ *  @arg    type
+ *              Type of the object which became ready.
+ *  @arg    procId
+ *              Processor Identifier.
+ *  @arg    id
+ *              Channel or MSGQ identifier.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    DRV_Poll, LDRV_SetNotify
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+Void
+DRV_PollNotify (IN LdrvNotifyType type, IN ProcessorId procId, IN Uint32 id) ;
+
+
 #if defined (CHNL_COMPONENT)
 /** ----------------------------------------------------------------------------
  *  @func   DRV_Mmap
@@ -524,6 +613,7 @@ STATIC struct file_operations driverOps = {
     open:    DRV_Open,
     release: DRV_Release,
     ioctl:   DRV_Ioctl,
+    poll:    DRV_Poll,
 #if defined (CHNL_COMPONENT)
     mmap:    DRV_Mmap,
 #endif /* if defined (CHNL_COMPONENT) */
@@ -658,6 +748,7 @@ int __init DRV_InitializeModule (void)
 #endif /* if defined (CHNL_COMPONENT) */
 
         if (DSP_SUCCEEDED (status)) {
+            LDRV_SetNotify (DRV_PollNotify) ;
             DRV_IsInitialized = TRUE ;
         }
     }
@@ -690,6 +781,8 @@ void __exit DRV_FinalizeModule (void)
 
     TRC_0ENTER ("DRV_FinalizeModule") ;
 
+    LDRV_SetNotify (NULL) ;
+
 #if defined (CHNL_COMPONENT)
     freeAttrs.physicalAddress = DRV_MemAllocAttrs.physicalAddress ;
     freeAttrs.size = sizeof (DrvAddrMapEntry) * MAX_PROCESSORS * MAX_CHANNELS ;
@@ -723,7 +816,22 @@ void __exit DRV_FinalizeModule (void)
  */
 int DRV_Open (struct inode * inode, struct file * filp)
 {
-    return 0 ;
+    int             osStatus = 0       ;
+    DSP_STATUS      status   = DSP_SOK ;
+    DrvPollObject * pollObj  = NULL    ;
+
+    status = MEM_Calloc ((Void **) &pollObj,
+                         sizeof (DrvPollObject),
+                         MEM_DEFAULT) ;
+    if (DSP_SUCCEEDED (status)) {
+        filp->private_data = pollObj ;
+    }
+    else {
+        osStatus = -ENOMEM ;
+        SET_FAILURE_REASON ;
+    }
+
+    return osStatus ;
 }
 
 /** ============================================================================
@@ -737,6 +845,17 @@ NORMAL_API
 int
 DRV_Release (struct inode * inode, struct file * filp)
 {
+    DSP_STATUS      status  = DSP_SOK ;
+    DrvPollObject * pollObj = (DrvPollObject *) filp->private_data ;
+
+    if (pollObj != NULL) {
+        filp->private_data = NULL ;
+        status = FREE_PTR (pollObj) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
     return 0 ;
 }
 
@@ -756,7 +875,51 @@ int DRV_Ioctl (struct inode * inode, struct file * filp,
 
     TRC_4ENTER ("DRV_Ioctl", inode, filp, cmd, args) ;
 
-    status = DRV_CallAPI (cmd, (CMD_Args *) args) ;
+    if ((cmd == CMD_DRV_POLLREGISTER) || (cmd == CMD_DRV_POLLUNREGISTER)) {
+        /*  Poll interest is kept per open file, so these commands are handled
+         *  here rather than in DRV_CallAPI.
+         */
+        CMD_Args *      cmdArgs = (CMD_Args *) args ;
+        DrvPollObject * pollObj = (DrvPollObject *) filp->private_data ;
+        ProcessorId     procId  = cmdArgs->apiArgs.drvPollArgs.procId ;
+        Uint32          id      = cmdArgs->apiArgs.drvPollArgs.id ;
+        Uint32 *        mask    = NULL ;
+
+        cmdArgs->apiStatus = DSP_SOK ;
+
+        if (   (cmdArgs->apiArgs.drvPollArgs.type == DRV_POLL_CHNL)
+            && (IS_VALID_PROCID (procId))
+            && (id < MAX_CHANNELS)) {
+            mask = &(pollObj->chnlMask [procId]) ;
+        }
+#if defined (MSGQ_COMPONENT)
+        else if (   (cmdArgs->apiArgs.drvPollArgs.type == DRV_POLL_MSGQ)
+                 && (IS_VALID_MSGQID (id))
+                 && (   (cmd == CMD_DRV_POLLUNREGISTER)
+                     || (PMGR_MSGQ_IsLocalId ((MsgQueueId) id)))) {
+            mask = &(pollObj->msgqMask) ;
+        }
+#endif /* if defined (MSGQ_COMPONENT) */
+        else {
+            cmdArgs->apiStatus = DSP_EINVALIDARG ;
+            SET_FAILURE_REASON ;
+        }
+
+        if (mask != NULL) {
+            SYNC_ProtectionStart () ;
+            if (cmd == CMD_DRV_POLLREGISTER) {
+                *mask |= (1u << id) ;
+            }
+            else {
+                *mask &= ~(1u << id) ;
+            }
+            SYNC_ProtectionEnd () ;
+        }
+    }
+    else {
+        status = DRV_CallAPI (cmd, (CMD_Args *) args) ;
+    }
+
     if (DSP_SUCCEEDED (status)) {
         osStatus = 0 ;
     }
@@ -767,6 +930,84 @@ int DRV_Ioctl (struct inode * inode, struct file * filp,
 }
 
 
+/** ----------------------------------------------------------------------------
+ *  @name   DRV_Poll
+ *
+ *  @desc   Linux specific function to poll the driver for readiness of the
+ *          registered channels and MSGQs.
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+unsigned int
+DRV_Poll (struct file * filp, poll_table * wait)
+{
+    unsigned int    mask     = 0 ;
+    DrvPollObject * pollObj  = (DrvPollObject *) filp->private_data ;
+    Uint32          interest = 0 ;
+    Uint32          i              ;
+#if defined (CHNL_COMPONENT)
+    ProcessorId     procId         ;
+    ChannelMode     chnlMode       ;
+#endif /* if defined (CHNL_COMPONENT) */
+
+    TRC_2ENTER ("DRV_Poll", filp, wait) ;
+
+    poll_wait (filp, &DRV_PollWaitQueue, wait) ;
+
+#if defined (CHNL_COMPONENT)
+    for (procId = 0 ; procId < MAX_PROCESSORS ; procId++) {
+        interest = pollObj->chnlMask [procId] ;
+        for (i = 0 ; (i < MAX_CHANNELS) && (interest != 0) ; i++) {
+            if (   ((interest & (1u << i)) != 0)
+                && (PMGR_CHNL_HasIOCompletion (procId, i, &chnlMode))) {
+                if (chnlMode == ChannelMode_Input) {
+                    mask |= (POLLIN | POLLRDNORM) ;
+                }
+                else {
+                    mask |= (POLLOUT | POLLWRNORM) ;
+                }
+            }
+            interest &= ~(1u << i) ;
+        }
+    }
+#endif /* if defined (CHNL_COMPONENT) */
+
+#if defined (MSGQ_COMPONENT)
+    interest = pollObj->msgqMask ;
+    for (i = 0 ; (i < MAX_MSGQS) && (interest != 0) ; i++) {
+        if (   ((interest & (1u << i)) != 0)
+            && (PMGR_MSGQ_HasMessage ((MsgQueueId) i))) {
+            mask |= (POLLIN | POLLRDNORM) ;
+        }
+        interest &= ~(1u << i) ;
+    }
+#endif /* if defined (MSGQ_COMPONENT) */
+
+    TRC_1LEAVE ("DRV_Poll", mask) ;
+
+    return mask ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @name   DRV_PollNotify
+ *
+ *  @desc   Wakes up the callers sleeping in DRV_Poll.
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+NORMAL_API
+Void
+DRV_PollNotify (IN LdrvNotifyType type, IN ProcessorId procId, IN Uint32 id)
+{
+    /*  The waiters re-evaluate their own interest masks in DRV_Poll, so a
+     *  single wake-up is enough irrespective of the object that became ready.
+     */
+    wake_up_interruptible (&DRV_PollWaitQueue) ;
+}
+
+
 /** ============================================================================
  *  @name   module_init/module_exit
  *
@@ -851,6 +1092,55 @@ DRV_CallAPI (Uint32 cmd, CMD_Args * args)
             args->apiStatus = retStatus ;
         }
         break ;
+
+    case CMD_MSGQ_PUBLISH:
+        {
+            AllocatorId mqaId ;
+
+            mqaId = args->apiArgs.msgqPublishArgs.mqaId ;
+            if (DRV_MsgqBufPoolEntry [mqaId].valid == TRUE) {
+                args->apiArgs.msgqPublishArgs.msg =
+                     MAP_MSGQ_BUFFER_TO_KERN (args->apiArgs.msgqPublishArgs.msg,
+                                              mqaId) ;
+                retStatus = PMGR_MSGQ_Publish (
+                                 args->apiArgs.msgqPublishArgs.topicId,
+                                 args->apiArgs.msgqPublishArgs.msg,
+                                 args->apiArgs.msgqPublishArgs.msgId,
+                                 args->apiArgs.msgqPublishArgs.srcMsgqId) ;
+            }
+            else {
+                status = DSP_EFAIL ;
+                SET_FAILURE_REASON ;
+            }
+            args->apiStatus = retStatus ;
+        }
+        break ;
+
+    case CMD_MSGQ_RECEIVE:
+        {
+            AllocatorId mqaId ;
+
+            retStatus = PMGR_MSGQ_Receive (
+                            args->apiArgs.msgqReceiveArgs.topicId,
+                            args->apiArgs.msgqReceiveArgs.msgqId,
+                            args->apiArgs.msgqReceiveArgs.timeout,
+                            args->apiArgs.msgqReceiveArgs.msg) ;
+
+            if (DSP_SUCCEEDED (retStatus)) {
+                mqaId = (*(args->apiArgs.msgqReceiveArgs.msg))->mqaId ;
+                if (DRV_MsgqBufPoolEntry [mqaId].valid == TRUE) {
+                    *(args->apiArgs.msgqReceiveArgs.msg) =
+                     MAP_MSGQ_BUFFER_TO_USER (
+                        *(args->apiArgs.msgqReceiveArgs.msg), mqaId) ;
+                }
+                else {
+                    status = DSP_EFAIL ;
+                    SET_FAILURE_REASON ;
+                }
+            }
+            args->apiStatus = retStatus ;
+        }
+        break ;
 #endif /* if defined (MSGQ_COMPONENT) */
 
 #if defined (CHNL_COMPONENT)
@@ -889,6 +1179,44 @@ DRV_CallAPI (Uint32 cmd, CMD_Args * args)
         }
         break ;
 
+    case CMD_CHNL_ISSUEV:
+        {
+            ProcessorId        procId = args->apiArgs.chnlIssueVArgs.procId ;
+            ChannelId          chnlId = args->apiArgs.chnlIssueVArgs.chnlId ;
+            ChannelIOVecInfo * ioReq  = args->apiArgs.chnlIssueVArgs.ioReq  ;
+            ChannelIOVecInfo   kernReq ;
+            Uint32             i       ;
+
+            /*  Translate every segment into a private copy, so that the
+             *  request of the user is left untouched.
+             */
+            kernReq = *ioReq ;
+            if (kernReq.numSegs > MAX_CHNL_SEGMENTS) {
+                args->apiStatus = DSP_EINVALIDARG ;
+            }
+            else {
+                for (i = 0 ;
+                     (i < kernReq.numSegs) && DSP_SUCCEEDED (status) ;
+                     i++) {
+                    status = DRV_Translate (
+                                 (Void **) &(kernReq.segments [i].buffer),
+                                 ioReq->segments [i].buffer,
+                                 DRV_USER_TO_KERN,
+                                 procId,
+                                 chnlId) ;
+                }
+
+                if (DSP_SUCCEEDED (status)) {
+                    retStatus = PMGR_CHNL_IssueV (procId, chnlId, &kernReq) ;
+                    args->apiStatus = retStatus ;
+                }
+                else {
+                    SET_FAILURE_REASON ;
+                }
+            }
+        }
+        break ;
+
     case CMD_CHNL_RECLAIM:
         {
             ProcessorId procId = args->apiArgs.chnlReclaimArgs.procId ;
@@ -1026,6 +1354,14 @@ DRV_CallAPI (Uint32 cmd, CMD_Args * args)
         args->apiStatus = retStatus ;
         break ;
 
+    case CMD_PROC_RELOAD:
+        retStatus = PMGR_PROC_Reload (args->apiArgs.procLoadArgs.procId,
+                                      args->apiArgs.procLoadArgs.imagePath,
+                                      args->apiArgs.procLoadArgs.argc,
+                                      args->apiArgs.procLoadArgs.argv) ;
+        args->apiStatus = retStatus ;
+        break ;
+
     case CMD_PROC_LOADSECTION:
         retStatus = PMGR_PROC_LoadSection (
                 args->apiArgs.procLoadSectionArgs.procId,
@@ -1348,6 +1684,81 @@ DRV_CallAPI (Uint32 cmd, CMD_Args * args)
         }
         break ;
 
+    case CMD_MSGQ_ALLOCBATCH:
+        {
+            AllocatorId mqaId ;
+            MsgqMsg *   msgArray ;
+            Uint16      i ;
+
+            mqaId    = args->apiArgs.msgqBatchArgs.mqaId ;
+            msgArray = args->apiArgs.msgqBatchArgs.msgArray ;
+            if (args->apiArgs.msgqBatchArgs.numMsgs > MAX_ALLOC_CACHE_DEPTH) {
+                /* The batch size comes from user space: bound it as the
+                 * user-side API bounds its own callers.
+                 */
+                retStatus = DSP_EINVALIDARG ;
+                SET_FAILURE_REASON ;
+            }
+            else if (DRV_MsgqBufPoolEntry [mqaId].valid == TRUE) {
+                /* Allocate as many messages as are available, up to the
+                 * requested number.
+                 */
+                for (i = 0 ; i < args->apiArgs.msgqBatchArgs.numMsgs ; i++) {
+                    retStatus = PMGR_MSGQ_Alloc (
+                                        mqaId,
+                                        args->apiArgs.msgqBatchArgs.size,
+                                        &(msgArray [i])) ;
+                    if (DSP_FAILED (retStatus)) {
+                        break ;
+                    }
+                    msgArray [i] = MAP_MSGQ_BUFFER_TO_USER (msgArray [i],
+                                                            mqaId) ;
+                }
+
+                args->apiArgs.msgqBatchArgs.numMsgs = i ;
+                if (i != 0) {
+                    retStatus = DSP_SOK ;
+                }
+            }
+            else {
+                status = DSP_EFAIL ;
+                SET_FAILURE_REASON ;
+            }
+            args->apiStatus = retStatus ;
+        }
+        break ;
+
+    case CMD_MSGQ_FREEBATCH:
+        {
+            DSP_STATUS  tmpStatus ;
+            AllocatorId mqaId ;
+            MsgqMsg *   msgArray ;
+            Uint16      i ;
+
+            mqaId    = args->apiArgs.msgqBatchArgs.mqaId ;
+            msgArray = args->apiArgs.msgqBatchArgs.msgArray ;
+            if (args->apiArgs.msgqBatchArgs.numMsgs > MAX_ALLOC_CACHE_DEPTH) {
+                retStatus = DSP_EINVALIDARG ;
+                SET_FAILURE_REASON ;
+            }
+            else if (DRV_MsgqBufPoolEntry [mqaId].valid == TRUE) {
+                /* Free all messages, returning the first failure if any. */
+                for (i = 0 ; i < args->apiArgs.msgqBatchArgs.numMsgs ; i++) {
+                    tmpStatus = PMGR_MSGQ_Free (
+                               MAP_MSGQ_BUFFER_TO_KERN (msgArray [i], mqaId)) ;
+                    if (DSP_FAILED (tmpStatus) && DSP_SUCCEEDED (retStatus)) {
+                        retStatus = tmpStatus ;
+                    }
+                }
+            }
+            else {
+                status = DSP_EFAIL ;
+                SET_FAILURE_REASON ;
+            }
+            args->apiStatus = retStatus ;
+        }
+        break ;
+
     case CMD_MSGQ_GETREPLYID:
         {
             AllocatorId mqaId ;
@@ -1379,6 +1790,20 @@ DRV_CallAPI (Uint32 cmd, CMD_Args * args)
         args->apiStatus = retStatus ;
         break ;
 
+    case CMD_MSGQ_SUBSCRIBE:
+        retStatus = PMGR_MSGQ_Subscribe (
+                       args->apiArgs.msgqSubscribeArgs.topicId,
+                       args->apiArgs.msgqSubscribeArgs.msgqId) ;
+        args->apiStatus = retStatus ;
+        break ;
+
+    case CMD_MSGQ_UNSUBSCRIBE:
+        retStatus = PMGR_MSGQ_Unsubscribe (
+                       args->apiArgs.msgqSubscribeArgs.topicId,
+                       args->apiArgs.msgqSubscribeArgs.msgqId) ;
+        args->apiStatus = retStatus ;
+        break ;
+
     case CMD_DRV_ADDUSER_ADDRESS:
         {
             AllocatorId mqaId ;
@@ -63,6 +63,8 @@ USES (drv_api.h)
 #define CMD_PROC_DEBUG                     (PROC_BASE_CMD + 12)
 #endif
 
+#define CMD_PROC_RELOAD                    (PROC_BASE_CMD + 13)
+
 
 #if defined (CHNL_COMPONENT)
 /*  ============================================================================
@@ -91,6 +93,8 @@ USES (drv_api.h)
 #if defined (DDSP_DEBUG)
 #define CMD_CHNL_DEBUG                     (CHNL_BASE_CMD + 11)
 #endif /* if defined (DDSP_DEBUG) */
+
+#define CMD_CHNL_ISSUEV                    (CHNL_BASE_CMD + 12)
 #endif /* if defined (CHNL_COMPONENT) */
 
 
@@ -107,6 +111,21 @@ USES (drv_api.h)
 #define CMD_DRV_ADDUSER_ADDRESS        (DRV_BASE_CMD + 2)
 #endif /* if defined (MSGQ_COMPONENT) */
 
+#define CMD_DRV_POLLREGISTER               (DRV_BASE_CMD + 3)
+#define CMD_DRV_POLLUNREGISTER             (DRV_BASE_CMD + 4)
+#define CMD_DRV_GETPOLLHANDLE              (DRV_BASE_CMD + 5)
+
+
+/*  ============================================================================
+ *  @const  DRV_POLL_CHNL, DRV_POLL_MSGQ
+ *
+ *  @desc   Object types which can be registered for poll notification
+ *          through CMD_DRV_POLLREGISTER.
+ *  ============================================================================
+ */
+#define DRV_POLL_CHNL                      0u
+#define DRV_POLL_MSGQ                      1u
+
 
 #if defined (MSGQ_COMPONENT)
 /*  ============================================================================
@@ -141,6 +160,14 @@ USES (drv_api.h)
 #define CMD_MSGQ_DEBUG                     (MSGQ_BASE_CMD + 16)
 #endif /* if defined (DDSP_DEBUG) */
 
+#define CMD_MSGQ_SUBSCRIBE                 (MSGQ_BASE_CMD + 17)
+#define CMD_MSGQ_UNSUBSCRIBE               (MSGQ_BASE_CMD + 18)
+#define CMD_MSGQ_PUBLISH                   (MSGQ_BASE_CMD + 19)
+#define CMD_MSGQ_RECEIVE                   (MSGQ_BASE_CMD + 20)
+#define CMD_MSGQ_ALLOCBATCH                (MSGQ_BASE_CMD + 21)
+#define CMD_MSGQ_FREEBATCH                 (MSGQ_BASE_CMD + 22)
+#define CMD_MSGQ_SETALLOCCACHE             (MSGQ_BASE_CMD + 23)
+
 
 #endif /* if defined (MSGQ_COMPONENT) */
 
@@ -263,6 +290,12 @@ typedef struct CMD_Args_tag {
             ChannelIOInfo * ioReq  ;
         } chnlIssueArgs ;
 
+        struct {
+            ProcessorId        procId ;
+            ChannelId          chnlId ;
+            ChannelIOVecInfo * ioReq  ;
+        } chnlIssueVArgs ;
+
         struct {
             ProcessorId     procId  ;
             ChannelId       chnlId  ;
@@ -323,6 +356,16 @@ typedef struct CMD_Args_tag {
             Void * phyAddr ;
         } drvPhyAddrArgs ;
 
+        struct {
+            Uint32          type   ;
+            ProcessorId     procId ;
+            Uint32          id     ;
+        } drvPollArgs ;
+
+        struct {
+            Int32 *         handle ;
+        } drvPollHandleArgs ;
+
 #if defined (MSGQ_COMPONENT)
         struct {
             AllocatorId mqaId    ;
@@ -402,6 +445,38 @@ typedef struct CMD_Args_tag {
             Uint16     mqaId  ;
         } msgqSetErrorHandlerArgs ;
 
+        struct {
+            Uint16      topicId ;
+            MsgQueueId  msgqId  ;
+        } msgqSubscribeArgs ;
+
+        struct {
+            Uint16      topicId   ;
+            MsgqMsg     msg       ;
+            Uint16      msgId     ;
+            MsgQueueId  srcMsgqId ;
+            AllocatorId mqaId     ;
+        } msgqPublishArgs ;
+
+        struct {
+            Uint16      topicId ;
+            MsgQueueId  msgqId  ;
+            Uint32      timeout ;
+            MsgqMsg  *  msg     ;
+        } msgqReceiveArgs ;
+
+        struct {
+            AllocatorId mqaId    ;
+            Uint16      size     ;
+            Uint16      numMsgs  ;
+            MsgqMsg *   msgArray ;
+        } msgqBatchArgs ;
+
+        struct {
+            AllocatorId mqaId   ;
+            Uint16      numMsgs ;
+        } msgqSetAllocCacheArgs ;
+
         struct {
             Void *        usrAddr ;
             AllocatorId   mqaId   ;
@@ -448,6 +448,7 @@ PMGR_CHNL_Issue (IN ProcessorId     procId,
     ioInfo.arg         = ioReq->arg    ;
     ioInfo.callback    = NULL          ;
     ioInfo.dpcContext  = FALSE         ;
+    ioInfo.numSegs     = 0             ;
 
     status =  LDRV_CHNL_AddIORequest (procId, chnlId, &ioInfo) ;
     if (DSP_FAILED (status)) {
@@ -460,6 +461,57 @@ PMGR_CHNL_Issue (IN ProcessorId     procId,
 }
 
 
+/** ============================================================================
+ *  @func   PMGR_CHNL_IssueV
+ *
+ *  @desc   Issues a scatter-gather input or output request on a specified
+ *          channel.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+PMGR_CHNL_IssueV (IN ProcessorId         procId,
+                  IN ChannelId           chnlId,
+                  IN ChannelIOVecInfo *  ioReq)
+{
+    DSP_STATUS     status  = DSP_SOK ;
+    LDRVChnlIOInfo ioInfo            ;
+
+    TRC_3ENTER ("PMGR_CHNL_IssueV", procId, chnlId, ioReq) ;
+
+    DBC_Require (PMGR_CHNL_IsInitialized [procId]) ;
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (IS_VALID_CHNLID (procId, chnlId)) ;
+    DBC_Require (ioReq != NULL) ;
+    DBC_Require (PMGR_CHNL_IsOwner (procId, chnlId)) ;
+
+    if ((ioReq->numSegs == 0) || (ioReq->numSegs > MAX_CHNL_SEGMENTS)) {
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        ioInfo.buffer      = NULL              ;
+        ioInfo.size        = 0                 ;
+        ioInfo.arg         = ioReq->arg        ;
+        ioInfo.callback    = NULL              ;
+        ioInfo.dpcContext  = FALSE             ;
+        ioInfo.numSegs     = ioReq->numSegs    ;
+        ioInfo.segments    = ioReq->segments   ;
+
+        status =  LDRV_CHNL_AddIORequest (procId, chnlId, &ioInfo) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("PMGR_CHNL_IssueV", status) ;
+
+    return status ;
+}
+
+
 /** ============================================================================
  *  @func   PMGR_CHNL_Reclaim
  *
@@ -625,6 +677,39 @@ PMGR_CHNL_Control (IN  ProcessorId  procId,
 }
 
 
+/** ============================================================================
+ *  @func   PMGR_CHNL_HasIOCompletion
+ *
+ *  @desc   Checks whether a reclaim on the specified channel can complete
+ *          without blocking.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+PMGR_CHNL_HasIOCompletion (IN  ProcessorId    procId,
+                           IN  ChannelId      chnlId,
+                           OUT ChannelMode *  mode)
+{
+    Bool    hasIOCompletion = FALSE ;
+
+    TRC_3ENTER ("PMGR_CHNL_HasIOCompletion", procId, chnlId, mode) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (IS_VALID_CHNLID (procId, chnlId)) ;
+    DBC_Require (mode != NULL) ;
+
+    if (PMGR_CHNL_IsInitialized [procId]) {
+        hasIOCompletion = LDRV_CHNL_HasIOCompletion (procId, chnlId, mode) ;
+    }
+
+    TRC_1LEAVE ("PMGR_CHNL_HasIOCompletion", hasIOCompletion) ;
+
+    return hasIOCompletion ;
+}
+
+
 #if defined (DDSP_PROFILE)
 /** ============================================================================
  *  @func   PMGR_CHNL_Instrument
@@ -269,6 +269,42 @@ PMGR_CHNL_Issue (IN ProcessorId      procId,
                  IN ChannelIOInfo *  ioReq) ;
 
 
+/** ============================================================================
+ *  @func   PMGR_CHNL_IssueV
+ *
+ *  @desc   Issues a scatter-gather input or output request on a specified
+ *          channel.
+ *
+ *  @arg    procId
+ *              Processor Identifier.
+ *  @arg    chnlId
+ *              Channel Identifier.
+ *  @arg    ioReq
+ *              Segments and argument of the request.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EFAIL
+ *              General failure.
+ *          DSP_EINVALIDARG
+ *              Invalid segment list.
+ *
+ *  @enter  Channels for specified processors must be initialized.
+ *          Processor and  channel ids must be valid.
+ *          ioReq must be valid pointer.
+ *
+ *  @leave  None
+ *
+ *  @see    PMGR_CHNL_Issue, PMGR_CHNL_Reclaim
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+PMGR_CHNL_IssueV (IN ProcessorId         procId,
+                  IN ChannelId           chnlId,
+                  IN ChannelIOVecInfo *  ioReq) ;
+
+
 /** ============================================================================
  *  @func   PMGR_CHNL_Reclaim
  *
@@ -418,6 +454,42 @@ PMGR_CHNL_Control (IN  ProcessorId    procId,
                    OPT Pvoid          arg) ;
 
 
+/** ============================================================================
+ *  @func   PMGR_CHNL_HasIOCompletion
+ *
+ *  @desc   Checks whether a reclaim on the specified channel can complete
+ *          without blocking. Used by the driver to report channel readiness
+ *          to poll ()/select ().
+ *
+ *  @arg    procId
+ *              Processor Identifier.
+ *  @arg    chnlId
+ *              Channel Identifier.
+ *  @arg    mode
+ *              Location to receive the mode of the channel. Only updated when
+ *              TRUE is returned.
+ *
+ *  @ret    TRUE
+ *              The channel has at least one completed buffer.
+ *          FALSE
+ *              The channel is not open or has no completed buffers.
+ *
+ *  @enter  Channels for specified processor must be initialized.
+ *          Processor and  channel ids must be valid.
+ *          mode must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    PMGR_CHNL_GetIOCompletion
+ *  ============================================================================
+ */
+NORMAL_API
+Bool
+PMGR_CHNL_HasIOCompletion (IN  ProcessorId    procId,
+                           IN  ChannelId      chnlId,
+                           OUT ChannelMode *  mode) ;
+
+
 #if defined (DDSP_PROFILE)
 /** ============================================================================
  *  @func   PMGR_CHNL_Instrument
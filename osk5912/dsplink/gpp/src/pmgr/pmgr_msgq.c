@@ -803,6 +803,224 @@ PMGR_MSGQ_Get (IN  MsgQueueId msgqId, IN  Uint32 timeout, OUT MsgqMsg * msg)
 }
 
 
+/** ============================================================================
+ *  @func   PMGR_MSGQ_HasMessage
+ *
+ *  @desc   This function checks whether a message is pending on the specified
+ *          MSGQ.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+Bool
+PMGR_MSGQ_HasMessage (IN  MsgQueueId msgqId)
+{
+    Bool    hasMessage = FALSE ;
+
+    TRC_1ENTER ("PMGR_MSGQ_HasMessage", msgqId) ;
+
+    DBC_Require (IS_VALID_MSGQID (msgqId)) ;
+
+    if (PMGR_MSGQ_IsInitialized == TRUE) {
+        hasMessage = LDRV_MSGQ_HasMessage (msgqId) ;
+    }
+
+    TRC_1LEAVE ("PMGR_MSGQ_HasMessage", hasMessage) ;
+
+    return hasMessage ;
+}
+
+
+/** ============================================================================
+ *  @func   PMGR_MSGQ_IsLocalId
+ *
+ *  @desc   This function checks whether the specified ID can name a local
+ *          MSGQ.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+Bool
+PMGR_MSGQ_IsLocalId (IN  MsgQueueId msgqId)
+{
+    Bool    isLocal = FALSE ;
+
+    TRC_1ENTER ("PMGR_MSGQ_IsLocalId", msgqId) ;
+
+    if (PMGR_MSGQ_IsInitialized == TRUE) {
+        isLocal = LDRV_MSGQ_IsLocalId (msgqId) ;
+    }
+
+    TRC_1LEAVE ("PMGR_MSGQ_IsLocalId", isLocal) ;
+
+    return isLocal ;
+}
+
+
+/** ============================================================================
+ *  @func   PMGR_MSGQ_Subscribe
+ *
+ *  @desc   This function subscribes a local MSGQ to the specified topic.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PMGR_MSGQ_Subscribe (IN  Uint16 topicId, IN  MsgQueueId msgqId)
+{
+    DSP_STATUS  status = DSP_SOK ;
+
+    TRC_2ENTER ("PMGR_MSGQ_Subscribe", topicId, msgqId) ;
+
+    DBC_Require (PMGR_MSGQ_IsInitialized == TRUE) ;
+    DBC_Require (IS_VALID_TOPICID (topicId)) ;
+    DBC_Require (IS_VALID_MSGQID (msgqId)) ;
+
+    if (PMGR_MSGQ_OwnerArray [msgqId] != NULL) {
+        if (PMGR_MSGQ_IsOwner (PMGR_MSGQ_OwnerArray [msgqId])) {
+            status = LDRV_MSGQ_Subscribe (topicId, msgqId) ;
+            if (DSP_FAILED (status)) {
+                SET_FAILURE_REASON ;
+            }
+        }
+        else {
+            status = DSP_EACCESSDENIED ;
+            SET_FAILURE_REASON ;
+        }
+    }
+    else {
+        /* Message queue not created */
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("PMGR_MSGQ_Subscribe", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PMGR_MSGQ_Unsubscribe
+ *
+ *  @desc   This function removes a local MSGQ from the subscribers of the
+ *          specified topic.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PMGR_MSGQ_Unsubscribe (IN  Uint16 topicId, IN  MsgQueueId msgqId)
+{
+    DSP_STATUS  status = DSP_SOK ;
+
+    TRC_2ENTER ("PMGR_MSGQ_Unsubscribe", topicId, msgqId) ;
+
+    DBC_Require (PMGR_MSGQ_IsInitialized == TRUE) ;
+    DBC_Require (IS_VALID_TOPICID (topicId)) ;
+    DBC_Require (IS_VALID_MSGQID (msgqId)) ;
+
+    if (PMGR_MSGQ_OwnerArray [msgqId] != NULL) {
+        if (PMGR_MSGQ_IsOwner (PMGR_MSGQ_OwnerArray [msgqId])) {
+            status = LDRV_MSGQ_Unsubscribe (topicId, msgqId) ;
+            if (DSP_FAILED (status)) {
+                SET_FAILURE_REASON ;
+            }
+        }
+        else {
+            status = DSP_EACCESSDENIED ;
+            SET_FAILURE_REASON ;
+        }
+    }
+    else {
+        /* Message queue not created */
+        status = DSP_EINVALIDARG ;
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("PMGR_MSGQ_Unsubscribe", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PMGR_MSGQ_Publish
+ *
+ *  @desc   This function publishes a message to all subscribers of the
+ *          specified topic.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PMGR_MSGQ_Publish (IN     Uint16      topicId,
+                   IN     MsgqMsg     msg,
+                   IN OPT Uint16      msgId,
+                   IN OPT MsgQueueId  srcMsgqId)
+{
+    DSP_STATUS  status = DSP_SOK ;
+
+    TRC_4ENTER ("PMGR_MSGQ_Publish", topicId, msg, msgId, srcMsgqId) ;
+
+    DBC_Require (PMGR_MSGQ_IsInitialized == TRUE) ;
+    DBC_Require (IS_VALID_TOPICID (topicId)) ;
+    DBC_Require (msg != NULL) ;
+
+    status = LDRV_MSGQ_Publish (topicId, msg, msgId, srcMsgqId) ;
+    if (DSP_FAILED (status)) {
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("PMGR_MSGQ_Publish", status) ;
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   PMGR_MSGQ_Receive
+ *
+ *  @desc   This function receives the next message published on the specified
+ *          topic for a subscribed MSGQ.
+ *
+ *  @modif  None.
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PMGR_MSGQ_Receive (IN  Uint16      topicId,
+                   IN  MsgQueueId  msgqId,
+                   IN  Uint32      timeout,
+                   OUT MsgqMsg *   msg)
+{
+    DSP_STATUS  status = DSP_SOK ;
+
+    TRC_4ENTER ("PMGR_MSGQ_Receive", topicId, msgqId, timeout, msg) ;
+
+    DBC_Require (PMGR_MSGQ_IsInitialized == TRUE) ;
+    DBC_Require (msg != NULL) ;
+    DBC_Require (IS_VALID_TOPICID (topicId)) ;
+    DBC_Require (IS_VALID_MSGQID (msgqId)) ;
+    DBC_Require (PMGR_MSGQ_IsOwner (PMGR_MSGQ_OwnerArray [msgqId])) ;
+
+    /* Ownership validation is not being done here for efficiency */
+    status = LDRV_MSGQ_Receive (topicId, msgqId, timeout, msg) ;
+    if (DSP_FAILED (status)) {
+        SET_FAILURE_REASON ;
+    }
+
+    TRC_1LEAVE ("PMGR_MSGQ_Receive", status) ;
+
+    return status ;
+}
+
+
 /** ============================================================================
  *  @func   PMGR_MSGQ_GetReplyId
  *
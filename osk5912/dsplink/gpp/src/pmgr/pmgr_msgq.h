@@ -493,6 +493,218 @@ DSP_STATUS
 PMGR_MSGQ_Get (IN  MsgQueueId msgqId, IN  Uint32 timeout, OUT MsgqMsg * msg) ;
 
 
+/** ============================================================================
+ *  @func   PMGR_MSGQ_HasMessage
+ *
+ *  @desc   This function checks whether a PMGR_MSGQ_Get on the specified MSGQ
+ *          would return a message without blocking. Used by the driver to
+ *          report MSGQ readiness to poll ()/select ().
+ *
+ *  @arg    msgqId
+ *              ID of the MSGQ to be checked.
+ *
+ *  @ret    TRUE
+ *              At least one message is pending on the MSGQ.
+ *          FALSE
+ *              The MSGQ does not exist or is empty.
+ *
+ *  @enter  msgqId must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    PMGR_MSGQ_Get
+ *  ============================================================================
+ */
+EXPORT_API
+Bool
+PMGR_MSGQ_HasMessage (IN  MsgQueueId msgqId) ;
+
+
+/** ============================================================================
+ *  @func   PMGR_MSGQ_IsLocalId
+ *
+ *  @desc   This function checks whether the specified ID can name a local
+ *          MSGQ, i.e. falls within the MSGQs configured for the local MQT.
+ *          Used by the driver to validate MSGQ IDs coming from user space.
+ *
+ *  @arg    msgqId
+ *              ID to be checked.
+ *
+ *  @ret    TRUE
+ *              The ID is within the local MSGQs.
+ *          FALSE
+ *              The ID is out of range, or MSGQ is not set up.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    PMGR_MSGQ_HasMessage
+ *  ============================================================================
+ */
+EXPORT_API
+Bool
+PMGR_MSGQ_IsLocalId (IN  MsgQueueId msgqId) ;
+
+
+/** ============================================================================
+ *  @func   PMGR_MSGQ_Subscribe
+ *
+ *  @desc   This function subscribes a local MSGQ to the specified topic.
+ *
+ *  @arg    topicId
+ *              ID of the topic.
+ *  @arg    msgqId
+ *              ID of the subscribing MSGQ.
+ *
+ *  @ret    DSP_SOK
+ *              The MSGQ has been successfully subscribed.
+ *          DSP_EACCESSDENIED
+ *              The client is not the owner of the MSGQ.
+ *          DSP_EINVALIDARG
+ *              The MSGQ has not been created.
+ *          DSP_EALREADYEXISTS
+ *              The MSGQ is already subscribed to the topic.
+ *          DSP_ERESOURCE
+ *              The topic has no free subscriber entries.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  PMGR MSGQ component must be initialized before calling this
+ *          function.
+ *          topicId and msgqId must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    PMGR_MSGQ_Unsubscribe, PMGR_MSGQ_Receive
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PMGR_MSGQ_Subscribe (IN  Uint16 topicId, IN  MsgQueueId msgqId) ;
+
+
+/** ============================================================================
+ *  @func   PMGR_MSGQ_Unsubscribe
+ *
+ *  @desc   This function removes a local MSGQ from the subscribers of the
+ *          specified topic.
+ *
+ *  @arg    topicId
+ *              ID of the topic.
+ *  @arg    msgqId
+ *              ID of the subscribed MSGQ.
+ *
+ *  @ret    DSP_SOK
+ *              The MSGQ has been successfully unsubscribed.
+ *          DSP_EACCESSDENIED
+ *              The client is not the owner of the MSGQ.
+ *          DSP_EINVALIDARG
+ *              The MSGQ has not been created.
+ *          DSP_ENOTFOUND
+ *              The MSGQ is not subscribed to the topic.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  PMGR MSGQ component must be initialized before calling this
+ *          function.
+ *          topicId and msgqId must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    PMGR_MSGQ_Subscribe
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PMGR_MSGQ_Unsubscribe (IN  Uint16 topicId, IN  MsgQueueId msgqId) ;
+
+
+/** ============================================================================
+ *  @func   PMGR_MSGQ_Publish
+ *
+ *  @desc   This function publishes a message to all subscribers of the
+ *          specified topic.
+ *
+ *  @arg    topicId
+ *              ID of the topic.
+ *  @arg    msg
+ *              Pointer to the message to be published.
+ *  @arg    msgId
+ *              Optional message ID to be associated with the message.
+ *  @arg    srcMsgqId
+ *              Optional ID of the source MSGQ to receive reply messages.
+ *
+ *  @ret    DSP_SOK
+ *              The message has been successfully published.
+ *          DSP_ENOTFOUND
+ *              The topic has no subscribers.
+ *          DSP_ERESOURCE
+ *              The topic is full for at least one subscriber.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  PMGR MSGQ component must be initialized before calling this
+ *          function.
+ *          topicId must be valid.
+ *          msg must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    PMGR_MSGQ_Receive
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PMGR_MSGQ_Publish (IN     Uint16      topicId,
+                   IN     MsgqMsg     msg,
+                   IN OPT Uint16      msgId,
+                   IN OPT MsgQueueId  srcMsgqId) ;
+
+
+/** ============================================================================
+ *  @func   PMGR_MSGQ_Receive
+ *
+ *  @desc   This function receives the next message published on the specified
+ *          topic for a subscribed MSGQ.
+ *
+ *  @arg    topicId
+ *              ID of the topic.
+ *  @arg    msgqId
+ *              ID of the subscribed MSGQ.
+ *  @arg    timeout
+ *              Timeout value to wait for the message (in milliseconds).
+ *  @arg    msg
+ *              Location to receive the message.
+ *
+ *  @ret    DSP_SOK
+ *              The message has been successfully received.
+ *          DSP_ENOTFOUND
+ *              The MSGQ is not subscribed to the topic.
+ *          DSP_ETIMEOUT
+ *              Timeout occurred while receiving the message.
+ *          DSP_EFAIL
+ *              General failure.
+ *
+ *  @enter  PMGR MSGQ component must be initialized before calling this
+ *          function.
+ *          topicId and msgqId must be valid.
+ *          msg must be valid.
+ *          Client should be the owner of msgqId MSGQ.
+ *
+ *  @leave  None
+ *
+ *  @see    PMGR_MSGQ_Publish
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+PMGR_MSGQ_Receive (IN  Uint16      topicId,
+                   IN  MsgQueueId  msgqId,
+                   IN  Uint32      timeout,
+                   OUT MsgqMsg *   msg) ;
+
+
 /** ============================================================================
  *  @func   PMGR_MSGQ_GetReplyId
  *
@@ -65,6 +65,9 @@
 /*  ----------------------------------- Link Driver                 */
 #include <ldrv.h>
 #include <ldrv_proc.h>
+#if defined (CHNL_COMPONENT)
+#include <ldrv_chnl.h>
+#endif /* if defined (CHNL_COMPONENT) */
 
 
 #if defined (__cplusplus)
@@ -1076,6 +1079,114 @@ PMGR_PROC_Stop (IN  ProcessorId  procId)
 }
 
 
+/** ============================================================================
+ *  @func   PMGR_PROC_Reload
+ *
+ *  @desc   Reloads the DSP with the specified executable and starts it,
+ *          keeping the channels and message queues on the GPP alive.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+PMGR_PROC_Reload (IN   ProcessorId  procId,
+                  IN   Char8 *      imagePath,
+                  IN   Uint32       argc,
+                  IN   Char8 **     argv)
+{
+    DSP_STATUS   status    = DSP_SOK ;
+    DSP_STATUS   tmpStatus = DSP_SOK ;
+    Bool         isOwner   = FALSE   ;
+    PrcsObject * client    = NULL    ;
+    ProcState    procState           ;
+
+    TRC_4ENTER ("PMGR_PROC_Reload", procId, imagePath, argc, argv) ;
+
+    DBC_Require (IS_VALID_PROCID (procId)) ;
+    DBC_Require (imagePath != NULL ) ;
+    DBC_Require (   ((argc != 0) && (argv != NULL))
+                 || ((argc == 0) && (argv == NULL))) ;
+
+    if (PMGR_ProcObj [procId].owner == NULL) {
+        status = DSP_EATTACHED ;
+        SET_FAILURE_REASON ;
+    }
+    else {
+        status = PRCS_Create (&client) ;
+
+        if (DSP_SUCCEEDED (status)) {
+            status = PRCS_IsEqual (client,
+                                   PMGR_ProcObj [procId].owner,
+                                   &isOwner) ;
+
+            if (DSP_FAILED (status)) {
+                SET_FAILURE_REASON ;
+            }
+            else if (isOwner == FALSE) {
+                status = DSP_EACCESSDENIED ;
+                SET_FAILURE_REASON ;
+            }
+
+            tmpStatus = PRCS_Delete (client) ;
+            client = NULL ;
+            if (DSP_FAILED (tmpStatus) && DSP_SUCCEEDED (status)) {
+                status = tmpStatus ;
+                SET_FAILURE_REASON ;
+            }
+        }
+        else {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_PROC_GetState (procId, &procState) ;
+        if (   DSP_SUCCEEDED (status)
+            && (   (procState == ProcState_Started)
+                || (procState == ProcState_Idle))) {
+            status = LDRV_PROC_Stop (procId) ;
+        }
+
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+#if defined (CHNL_COMPONENT)
+    /*  ------------------------------------------------------------------------
+     *  Hold back the pending IO requests while the new image is loaded, so
+     *  that no buffer is handed to the stopped DSP.
+     *  ------------------------------------------------------------------------
+     */
+    if (DSP_SUCCEEDED (status)) {
+        status = LDRV_CHNL_HandshakeSetup (procId) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+#endif  /* if defined (CHNL_COMPONENT) */
+
+    if (DSP_SUCCEEDED (status)) {
+        status = PMGR_PROC_Load (procId, imagePath, argc, argv) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        status = PMGR_PROC_Start (procId) ;
+        if (DSP_FAILED (status)) {
+            SET_FAILURE_REASON ;
+        }
+    }
+
+    TRC_1LEAVE ("PMGR_PROC_Reload", status) ;
+
+    return status ;
+}
+
+
 /** ============================================================================
  *  @func   PMGR_PROC_Control
  *
@@ -338,6 +338,53 @@ DSP_STATUS
 PMGR_PROC_Stop (IN   ProcessorId  procId) ;
 
 
+/** ============================================================================
+ *  @func   PMGR_PROC_Reload
+ *
+ *  @desc   Stops the DSP if it is running, loads the specified executable and
+ *          starts it again. Channels, message queues and their buffers on the
+ *          GPP are retained, and the IO requests pending on them are handed
+ *          to the new image once the handshake completes.
+ *
+ *  @arg    procId
+ *              DSP Identifier.
+ *  @arg    imagePath
+ *              Full path to the image file.
+ *  @arg    argc
+ *              Number of arguments to be passed to the DSP executable.
+ *  @arg    argv
+ *              Arguments to be passed to DSP executable.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EACCESSDENIED
+ *              Access denied. Only the owner client is allowed
+ *              to reload the DSP.
+ *          DSP_EATTACHED
+ *              Not attached to the target processor.
+ *          DSP_EFILE
+ *              Invalid ImagePath parameter.
+ *          DSP_EFAIL
+ *              General failure, unable to reload DSP.
+ *          DSP_EWRONGSTATE
+ *              Incorrect state to complete the requested operation.
+ *
+ *  @enter  procId must be valid.
+ *          Base image path must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    PMGR_PROC_Stop, PMGR_PROC_Load, PMGR_PROC_Start
+ *  ============================================================================
+ */
+NORMAL_API
+DSP_STATUS
+PMGR_PROC_Reload (IN   ProcessorId  procId,
+                  IN   Char8 *      imagePath,
+                  IN   Uint32       argc,
+                  IN   Char8 **     argv) ;
+
+
 /** ============================================================================
  *  @func   PMGR_PROC_Control
  *
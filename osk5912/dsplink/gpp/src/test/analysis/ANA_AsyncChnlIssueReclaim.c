@@ -76,6 +76,7 @@ ANA_AsyncChnlIssueReclaim (IN Uint32 argc, IN Char8 ** argv)
     ChannelIOInfo ioReqInput                      ;
     Uint32        noOfArguments                   ;
     Char8       * arrayOfArguments [10]           ;
+    TST_LatencyObj * latObj             = NULL    ;
 
     DBC_Require (argc != 7) ;
     DBC_Require (argv != NULL) ;
@@ -143,11 +144,21 @@ ANA_AsyncChnlIssueReclaim (IN Uint32 argc, IN Char8 ** argv)
         ioReqInput.size = bufSize ;
         timeOut =  WAIT_FOREVER ;
     }
+    if (DSP_SUCCEEDED (status)) {
+        status = TST_LatencyCreate (iterations, TST_WARMUP_SAMPLES, &latObj) ;
+    }
+
     if (DSP_SUCCEEDED (status)) {
         TST_ZeroTime () ;
     }
 
-    for (i = 0 ; i < iterations ; i++) {
+    /*  ------------------------------------------------------------------------
+     *  The latency of one iteration covers the issue and reclaim of all
+     *  buffers queued on the channel.
+     *  ------------------------------------------------------------------------
+     */
+    for (i = 0 ; (i < iterations) && (DSP_SUCCEEDED (status)) ; i++) {
+        TST_LatencyStart (latObj) ;
         for (count = 0 ;   (count < noOfIssueReclaim)
                        && (DSP_SUCCEEDED (status)); count++) {
             ioReqInput.buffer = bufInput [count] ;
@@ -168,6 +179,7 @@ ANA_AsyncChnlIssueReclaim (IN Uint32 argc, IN Char8 ** argv)
                 TST_PrnError ("Reclaim Failed. Status = [0x%x]", status) ;
             }
         }
+        TST_LatencyStop (latObj) ;
     }
 
     if (DSP_SUCCEEDED (status)) {
@@ -181,6 +193,16 @@ ANA_AsyncChnlIssueReclaim (IN Uint32 argc, IN Char8 ** argv)
                                  bufSize) ;
     }
 
+    if (DSP_SUCCEEDED (status)) {
+        status = TST_LatencyReport (latObj,
+                                    (channelId == 0) ? "chnl_async_out"
+                                                     : "chnl_async_in",
+                                    bufSize,
+                                    noOfIssueReclaim) ;
+    }
+
+    TST_LatencyDelete (latObj) ;
+
     CHNL_FreeBuffer (processorId, channelId, bufInput, noOfIssueReclaim) ;
     CHNL_Delete (processorId, channelId) ;
     PROC_Stop (processorId) ;
@@ -78,6 +78,7 @@ ANA_Loop (IN Uint32 argc, IN Char8 ** argv)
     ChannelIOInfo ioReqOutput              ;
     Uint32        noOfArguments            ;
     Char8       * arrayOfArguments [10]    ;
+    TST_LatencyObj * latObj      = NULL    ;
 
     DBC_Require (argc == 7) ;
     DBC_Require (argv != NULL) ;
@@ -138,6 +139,10 @@ ANA_Loop (IN Uint32 argc, IN Char8 ** argv)
                      bufSize ,1) ;
     }
 
+    if (DSP_SUCCEEDED (status)) {
+        status = TST_LatencyCreate (iterations, TST_WARMUP_SAMPLES, &latObj) ;
+    }
+
     if (DSP_SUCCEEDED (status)) {
         ioReqInput.size = bufSize ;
         ioReqOutput.size = bufSize ;
@@ -147,6 +152,7 @@ ANA_Loop (IN Uint32 argc, IN Char8 ** argv)
 
         for (count = 0 ;   (count < iterations)
                        && (DSP_SUCCEEDED (status)) ; count++) {
+            TST_LatencyStart (latObj) ;
 
             if (DSP_SUCCEEDED (status)) {
                 ioReqOutput.buffer = bufOutput [0] ;
@@ -185,6 +191,7 @@ ANA_Loop (IN Uint32 argc, IN Char8 ** argv)
             if (DSP_FAILED (status)) {
                 TST_PrnError ("Reclaim Failed. Status = [0x%x]", status) ;
             }
+            TST_LatencyStop (latObj) ;
         }
         stopTime = TST_GetTime () ;
     }
@@ -193,6 +200,12 @@ ANA_Loop (IN Uint32 argc, IN Char8 ** argv)
         status = TST_DoAnalysis (0, stopTime, (iterations * 2), bufSize) ;
     }
 
+    if (DSP_SUCCEEDED (status)) {
+        status = TST_LatencyReport (latObj, "chnl_loop", bufSize, 1) ;
+    }
+
+    TST_LatencyDelete (latObj) ;
+
     CHNL_FreeBuffer (processorId,
                      channelInput,
                      (Char8 **) &bufInput,
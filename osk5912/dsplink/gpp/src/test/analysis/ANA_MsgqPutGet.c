@@ -72,6 +72,15 @@ EXTERN "C" {
  */
 #define BATCH_SIZE 25
 
+/** ============================================================================
+ *  @name   ALLOC_CACHE_DEPTH
+ *
+ *  @desc   The number of messages moved between the process and the allocator
+ *          in one call to the kernel.
+ *  ============================================================================
+ */
+#define ALLOC_CACHE_DEPTH 4
+
 /** ============================================================================
  *  @name   NUM_DSP_ARGS
  *
@@ -116,6 +125,8 @@ ANA_MsgqPutGet (IN Uint32 argc, IN Char8 ** argv)
     Uint16           maxMsgSize      = sizeof (TestMsg) ;
     Uint16           msgId           = 0                ;
     Char8 **         dspArgs         = NULL             ;
+    TST_LatencyObj * latObj          = NULL             ;
+    Char8 *          latName         = NULL             ;
 
     DBC_Require (argc == NUM_ARGS) ;
     DBC_Require (argv != NULL) ;
@@ -145,7 +156,12 @@ ANA_MsgqPutGet (IN Uint32 argc, IN Char8 ** argv)
         maxMsgSize =  msgSize ;
 
         maxLocalQueues = msgqInId + 1 ;
-        numMsgPerPool =  BATCH_SIZE + 1 ;
+        /*  --------------------------------------------------------------------
+         *  The allocation cache of this process can hold up to twice its
+         *  depth of messages, which must not starve the remote MQT.
+         *  --------------------------------------------------------------------
+         */
+        numMsgPerPool =  BATCH_SIZE + 1 + (2 * ALLOC_CACHE_DEPTH) ;
 
         /*  --------------------------------------------------------------------
          *  Setup phase of the application.
@@ -170,6 +186,14 @@ ANA_MsgqPutGet (IN Uint32 argc, IN Char8 ** argv)
 
         ANA_FreeDspArgumentList (NUM_DSP_ARGS, dspArgs) ;
 
+        if (DSP_SUCCEEDED (status)) {
+            status = MSGQ_SetAllocCache (TST_MQA_ID, ALLOC_CACHE_DEPTH) ;
+            if (DSP_FAILED (status)) {
+                TST_PrnError ("MSGQ_SetAllocCache failed. Status = [0x%x]",
+                              status) ;
+            }
+        }
+
         if (DSP_SUCCEEDED (status)) {
             status = MSGQ_Create (msgqInId, NULL) ;
             if (DSP_FAILED (status)) {
@@ -227,6 +251,12 @@ ANA_MsgqPutGet (IN Uint32 argc, IN Char8 ** argv)
          *  to DSP side.
          *  --------------------------------------------------------------------
          */
+        if (DSP_SUCCEEDED (status)) {
+            status = TST_LatencyCreate (iterations,
+                                        TST_WARMUP_SAMPLES,
+                                        &latObj) ;
+        }
+
         if (DSP_SUCCEEDED (status)) {
             TST_ZeroTime () ;
         }
@@ -238,6 +268,7 @@ ANA_MsgqPutGet (IN Uint32 argc, IN Char8 ** argv)
         for (count = 0 ; (DSP_SUCCEEDED (status)) && (count < iterations) ;
              count += BATCH_SIZE) {
             for (i = 0 ; (DSP_SUCCEEDED (status)) && (i < BATCH_SIZE) ; i++) {
+                TST_LatencyStart (latObj) ;
                 if (modeOfOperation == 2 || modeOfOperation == 3) {
                     status = MSGQ_Alloc (TST_MQA_ID, msgSize, &msg) ;
                     if (DSP_FAILED (status)) {
@@ -273,6 +304,7 @@ ANA_MsgqPutGet (IN Uint32 argc, IN Char8 ** argv)
                         }
                     }
                 }
+                TST_LatencyStop (latObj) ;
             }
             /*  ----------------------------------------------------------------
              *  Synchronize with the DSP side.
@@ -329,6 +361,20 @@ ANA_MsgqPutGet (IN Uint32 argc, IN Char8 ** argv)
             status = TST_DoAnalysis (0, stopTime, iterations , msgSize) ;
         }
 
+        if (DSP_SUCCEEDED (status)) {
+            if (modeOfOperation == 1) {
+                latName = "msgq_get" ;
+            }
+            else if (modeOfOperation == 2) {
+                latName = "msgq_put" ;
+            }
+            else {
+                latName = "msgq_putget" ;
+            }
+            status = TST_LatencyReport (latObj, latName, msgSize, 1) ;
+        }
+        TST_LatencyDelete (latObj) ;
+
         /*  --------------------------------------------------------------------
          *  Synchronizing with the DSP side for cleanup.
          *  --------------------------------------------------------------------
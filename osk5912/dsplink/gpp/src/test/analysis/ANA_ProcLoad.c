@@ -104,12 +104,14 @@ ANA_ProcLoad (IN Uint32 argc, IN Char8 ** argv)
 
     if (DSP_SUCCEEDED (status)) {
         sizeOfFile = TST_GetFileSize (argv [1], &sizeOfFile) ;
-        timeToLoad = (stopTime / TICS_PER_SEC) ;
+        timeToLoad = ((Real32) stopTime / TICS_PER_SEC) ;
         TST_PrnInfo ("Time taken to load file = %.2f sec(s)", timeToLoad) ;
 
         if (stopTime != 0) {
-            throughput =    (Real32) (sizeOfFile * TICS_PER_SEC * iterations)
-                          / stopTime ;
+            throughput =  (  (Real32) sizeOfFile
+                           * (Real32) TICS_PER_SEC
+                           * (Real32) iterations)
+                        / stopTime ;
             TST_PrnInfo ("Throughput = %.2f Bytes/Sec", throughput) ;
         }
         else {
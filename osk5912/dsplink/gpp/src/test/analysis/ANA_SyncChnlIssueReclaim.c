@@ -73,6 +73,7 @@ ANA_SyncChnlIssueReclaim (IN Uint32 argc, IN Char8 ** argv)
     ChannelIOInfo ioReqInput                      ;
     Uint32        noOfArguments                   ;
     Char8       * arrayOfArguments [10]           ;
+    TST_LatencyObj * latObj             = NULL    ;
 
     DBC_Require (argc != 6) ;
     DBC_Require (argv != NULL) ;
@@ -135,6 +136,10 @@ ANA_SyncChnlIssueReclaim (IN Uint32 argc, IN Char8 ** argv)
                                       1) ;
     }
 
+    if (DSP_SUCCEEDED (status)) {
+        status = TST_LatencyCreate (iterations, TST_WARMUP_SAMPLES, &latObj) ;
+    }
+
     if (DSP_SUCCEEDED (status)) {
         ioReqInput.size = bufSize ;
         timeOut =  WAIT_FOREVER ;
@@ -144,6 +149,7 @@ ANA_SyncChnlIssueReclaim (IN Uint32 argc, IN Char8 ** argv)
         ioReqInput.buffer = bufInput [0] ;
         for (count= 0 ;   (count < iterations)
                        && (DSP_SUCCEEDED (status)); count++) {
+            TST_LatencyStart (latObj) ;
             status = CHNL_Issue (processorId, channelId, &ioReqInput) ;
             if (DSP_FAILED (status)) {
                 TST_PrnError ("ISSUE Failed. Status = [0x%x]", status) ;
@@ -158,6 +164,7 @@ ANA_SyncChnlIssueReclaim (IN Uint32 argc, IN Char8 ** argv)
                     TST_PrnError ("Reclaim Failed. Status = [0x%x]", status) ;
                 }
             }
+            TST_LatencyStop (latObj) ;
         }
         stopTime = TST_GetTime () ;
     }
@@ -166,6 +173,16 @@ ANA_SyncChnlIssueReclaim (IN Uint32 argc, IN Char8 ** argv)
         status = TST_DoAnalysis (0, stopTime, iterations, bufSize) ;
     }
 
+    if (DSP_SUCCEEDED (status)) {
+        status = TST_LatencyReport (latObj,
+                                    (channelId == 0) ? "chnl_sync_out"
+                                                     : "chnl_sync_in",
+                                    bufSize,
+                                    1) ;
+    }
+
+    TST_LatencyDelete (latObj) ;
+
     CHNL_FreeBuffer (processorId, channelId, bufInput, 1) ;
     CHNL_Delete (processorId, channelId) ;
     PROC_Stop (processorId) ;
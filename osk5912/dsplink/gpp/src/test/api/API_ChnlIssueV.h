@@ -0,0 +1,64 @@
+/** ============================================================================
+ *  @file   API_ChnlIssueV.h
+ *
+ *  @path   $(DSPLINK)\gpp\src\test\api
+ *
+ *  @desc   Defines the interface of Chnl_IssueV API test case.
+ *
+ *  @ver    01.10.01
+ *  ============================================================================
+ *  Copyright (c) Texas Instruments Incorporated 2002-2004
+ *
+ *  Use of this software is controlled by the terms and conditions found in the
+ *  license agreement under which this software has been supplied or provided.
+ *  ============================================================================
+ */
+
+
+#if !defined (API_CHNLISSUEV_H)
+#define API_CHNLISSUEV_H
+
+
+USES (gpptypes.h)
+USES (errbase.h)
+
+
+#if defined (__cplusplus)
+EXTERN "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @func   API_ChnlIssueV
+ *
+ *  @desc   Tests the Chnl_IssueV API.
+ *
+ *  @arg    argc
+ *              Count of the no. of arguments passed.
+ *  @arg    argv
+ *              List of arguments.
+ *
+ *  @ret    DSP_SOK
+ *              Operation Successfully completed.
+ *          DSP_INVALIDARG
+ *              Wrong no of arguments passed.
+ *
+ *  @enter  argc should be 14.
+ *          argv should not be null.
+ *
+ *  @leave  None
+ *
+ *  @see    None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+API_ChnlIssueV (IN Uint32 argc, IN Char8 ** argv) ;
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
+
+
+#endif /* !defined (API_CHNLISSUEV_H) */
@@ -0,0 +1,340 @@
+/** ============================================================================
+ *  @file   API_MsgqPublish.c
+ *
+ *  @path   $(DSPLINK)\gpp\src\test\api
+ *
+ *  @desc   Implemetation of MSGQ_Publish API test case.
+ *
+ *  @ver    01.10.01
+ *  ============================================================================
+ *  Copyright (c) Texas Instruments Incorporated 2002-2004
+ *
+ *  Use of this software is controlled by the terms and conditions found in the
+ *  license agreement under which this software has been supplied or provided.
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- DSP/BIOS Link                 */
+#include <gpptypes.h>
+#include <errbase.h>
+#include <dsplink.h>
+#include <platform.h>
+
+#if defined (MSGQ_COMPONENT)
+#include <msgqdefs.h>
+#endif /* if defined (MSGQ_COMPONENT) */
+
+/*  ----------------------------------- Trace & Debug                 */
+#include <TST_Dbc.h>
+
+/*  ----------------------------------- Profiling                     */
+#include <profile.h>
+
+/*  ----------------------------------- Processor Manager             */
+#include <proc.h>
+
+/*  ----------------------------------- MSGQ Component                */
+#include <msgqdefs.h>
+#include <msgq.h>
+
+/*  ----------------------------------- Test framework                */
+#include <TST_Framework.h>
+#include <TST_Helper.h>
+#include <TST_PrintFuncs.h>
+#include <API_PostProcess.h>
+#include <API_MsgqUtils.h>
+#include <API_MsgqPublish.h>
+
+
+#if defined (__cplusplus)
+EXTERN "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @name   NUM_ARGS
+ *
+ *  @desc   The number of arguments expected by this test.
+ *  ============================================================================
+ */
+#define NUM_ARGS 7
+
+/** ============================================================================
+ *  @name   NUM_DSP_ARGS
+ *
+ *  @desc   The number of arguments expected by DSP.
+ *  ============================================================================
+ */
+#define NUM_DSP_ARGS 6
+
+/** ============================================================================
+ *  @const  MAX_GPP_MSGQS
+ *
+ *  @desc   Maximum number of MSGQs created on the GPP.
+ *  ============================================================================
+ */
+#define MAX_GPP_MSGQS MAX_TOPIC_SUBSCRIBERS
+
+/** ============================================================================
+ *  @const  NUM_MSG
+ *
+ *  @desc   Number of messages to be exchanged.
+ *  ============================================================================
+ */
+#define NUM_MSG 0
+
+/** ============================================================================
+ *  @const  NUM_MSG_PER_POOL
+ *
+ *  @desc   Number of messages in each buffer pool.
+ *  ============================================================================
+ */
+#define NUM_MSG_PER_POOL 1
+
+/** ============================================================================
+ *  @const  SUB_TOPIC_ID
+ *
+ *  @desc   Topic to which the GPP MSGQs are subscribed.
+ *  ============================================================================
+ */
+#define SUB_TOPIC_ID 0
+
+/** ============================================================================
+ *  @const  RECEIVE_TIMEOUT
+ *
+ *  @desc   Timeout (in milliseconds) for receiving the published message.
+ *  ============================================================================
+ */
+#define RECEIVE_TIMEOUT 1000
+
+
+/** ============================================================================
+ *  @func   API_MsgqPublish
+ *
+ *  @desc   Tests the MSGQ_Publish API.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+API_MsgqPublish (IN Uint32 argc, IN Char8 ** argv)
+{
+    DSP_STATUS  statusOfSetup   = DSP_SOK ;
+    DSP_STATUS  statusOfCleanup = DSP_SOK ;
+    DSP_STATUS  status          = DSP_SOK ;
+    DSP_STATUS  tmpStatus       = DSP_SOK ;
+    ProcessorId procId          = 0       ;
+    AllocatorId mqaId           = 0       ;
+    TransportId mqtId           = 0       ;
+    Uint16      topicId         = 0       ;
+    Uint16      numSubs         = 0       ;
+    Uint16      numCreated      = 0       ;
+    Uint16      maxMsgSize      = 0       ;
+    MsgqMsg     msg             = NULL    ;
+    MsgqMsg     rcvMsg          = NULL    ;
+    Char8 **    dspArgs         = NULL    ;
+    Uint16      i               = 0       ;
+    Uint32      temp                      ;
+
+    DBC_Require (argc == NUM_ARGS) ;
+    DBC_Require (argv != NULL) ;
+
+    if ((argc != NUM_ARGS) || (argv == NULL)) {
+        status = DSP_EINVALIDARG ;
+        TST_PrnError ("Incorrect usage of API_MsgqPublish. Status = [0x%x]",
+                      status) ;
+    }
+    else {
+        /*  --------------------------------------------------------------------
+         *  Get arguments.
+         *  --------------------------------------------------------------------
+         */
+        procId  = TST_StringToInt (argv [2]) ;
+        mqtId   = TST_StringToInt (argv [3]) ;
+
+        statusOfSetup = TST_MacroToIntValue (&temp,
+                                             MAX_MSGQ_TOPICS,
+                                             argv [4],
+                                             "MAX_MSGQ_TOPICS") ;
+        if (DSP_SUCCEEDED (statusOfSetup)) {
+            topicId = (Uint16) temp ;
+        }
+        else if (statusOfSetup == DSP_ENOTFOUND) { /* Not a macro value */
+            topicId       = TST_StringToInt (argv [4]) ;
+            statusOfSetup = DSP_SOK ;
+        }
+
+        numSubs = TST_StringToInt (argv [5]) ;
+
+        maxMsgSize = ALIGN (sizeof (TestMsg)) ;
+
+        /*  --------------------------------------------------------------------
+         *  Initialize.
+         *  --------------------------------------------------------------------
+         */
+        statusOfSetup = PROC_Setup () ;
+        if (DSP_FAILED (statusOfSetup)) {
+            TST_PrnError ("PROC_Setup Failed. Status = [0x%x]",
+                          statusOfSetup) ;
+        }
+        if (DSP_SUCCEEDED (statusOfSetup)) {
+            statusOfSetup = API_OpenAllocator (mqaId,
+                                               NUM_MSG_PER_POOL,
+                                               maxMsgSize) ;
+        }
+
+        if (DSP_SUCCEEDED (statusOfSetup)) {
+            statusOfSetup = PROC_Attach (procId, NULL) ;
+            if (DSP_FAILED (statusOfSetup)) {
+                TST_PrnError ("PROC_Attach Failed. Status = [0x%x]",
+                              statusOfSetup) ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (statusOfSetup)) {
+            dspArgs = API_CreateDspArgumentList (NUM_DSP_ARGS,
+                                                 NUM_MSG_PER_POOL,
+                                                 maxMsgSize,
+                                                 MAX_GPP_MSGQS,
+                                                 0, /* DSP MSGQ */
+                                                 0, /* dummy argument */
+                                                 NUM_MSG) ;
+            statusOfSetup = PROC_Load (procId, argv [6],
+                                       NUM_DSP_ARGS, dspArgs) ;
+            if (DSP_FAILED (statusOfSetup)) {
+                TST_PrnError ("PROC_Load Failed. Status = [0x%x]",
+                              statusOfSetup) ;
+            }
+
+            API_FreeDspArgumentList (NUM_DSP_ARGS, dspArgs) ;
+        }
+
+        if (DSP_SUCCEEDED (statusOfSetup)) {
+            statusOfSetup = PROC_Start (procId) ;
+            if (DSP_FAILED (statusOfSetup)) {
+                TST_PrnError ("PROC_Start Failed. Status = [0x%x]",
+                              statusOfSetup) ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (statusOfSetup)) {
+            statusOfSetup = API_OpenTransport (mqtId,
+                                               mqaId,
+                                               maxMsgSize,
+                                               MAX_GPP_MSGQS) ;
+        }
+
+        for (i = 0 ; (i < numSubs) && DSP_SUCCEEDED (statusOfSetup) ; i++) {
+            statusOfSetup = MSGQ_Create (i, NULL) ;
+            if (DSP_SUCCEEDED (statusOfSetup)) {
+                numCreated++ ;
+                statusOfSetup = MSGQ_Subscribe (SUB_TOPIC_ID, i) ;
+                if (DSP_FAILED (statusOfSetup)) {
+                    TST_PrnError ("MSGQ_Subscribe Failed. Status = [0x%x]",
+                                  statusOfSetup) ;
+                }
+            }
+            else {
+                TST_PrnError ("MSGQ_Create Failed. Status = [0x%x]",
+                              statusOfSetup) ;
+            }
+        }
+
+        if (DSP_SUCCEEDED (statusOfSetup)) {
+            statusOfSetup = MSGQ_Alloc (mqaId, maxMsgSize, &msg) ;
+            if (DSP_FAILED (statusOfSetup)) {
+                TST_PrnError ("MSGQ_Alloc Failed. Status = [0x%x]",
+                              statusOfSetup) ;
+            }
+        }
+
+        /*  --------------------------------------------------------------------
+         *  Tests MSGQ_Publish.
+         *  --------------------------------------------------------------------
+         */
+        status = MSGQ_Publish (topicId, msg, 0, MSGQ_INVALID_ID) ;
+        tmpStatus = status ;
+
+        /*  --------------------------------------------------------------------
+         *  Every subscriber must receive the same message. Each subscriber
+         *  frees its reference once.
+         *  --------------------------------------------------------------------
+         */
+        if (DSP_SUCCEEDED (tmpStatus)) {
+            for (i = 0 ; (i < numSubs) && DSP_SUCCEEDED (status) ; i++) {
+                status = MSGQ_Receive (SUB_TOPIC_ID, i, RECEIVE_TIMEOUT,
+                                       &rcvMsg) ;
+                if (DSP_SUCCEEDED (status)) {
+                    if (rcvMsg != msg) {
+                        status = DSP_EFAIL ;
+                        TST_PrnError ("MSGQ_Receive returned a different "
+                                      "message. Status = [0x%x]", status) ;
+                    }
+                    MSGQ_Free (rcvMsg) ;
+                }
+                else {
+                    TST_PrnError ("MSGQ_Receive Failed. Status = [0x%x]",
+                                  status) ;
+                }
+            }
+
+            if (DSP_FAILED (status)) {
+                status = DSP_EFAIL ;
+            }
+        }
+
+        status = API_PostProcess (status, argv [1], statusOfSetup, argv [0]) ;
+
+        /*  --------------------------------------------------------------------
+         *  Cleanup.
+         *  --------------------------------------------------------------------
+         */
+        if ((msg != NULL) && (DSP_FAILED (tmpStatus))) {
+            /* Free the message if it was not published */
+            statusOfCleanup = MSGQ_Free (msg) ;
+            if (DSP_FAILED (statusOfCleanup)) {
+                TST_PrnError ("MSGQ_Free Failed. Status = [0x%x]",
+                              statusOfCleanup) ;
+            }
+        }
+
+        for (i = 0 ; i < numCreated ; i++) {
+            MSGQ_Unsubscribe (SUB_TOPIC_ID, i) ;
+            statusOfCleanup = MSGQ_Delete (i) ;
+            if (DSP_FAILED (statusOfCleanup)) {
+                TST_PrnError ("MSGQ_Delete Failed. Status = [0x%x]",
+                              statusOfCleanup) ;
+            }
+        }
+
+        statusOfCleanup = API_CloseTransport (mqtId) ;
+
+        statusOfCleanup = PROC_Stop (procId) ;
+        if (DSP_FAILED (statusOfCleanup)) {
+            TST_PrnError ("PROC_Stop Failed. Status = [0x%x]",
+                          statusOfCleanup) ;
+        }
+        statusOfCleanup = PROC_Detach (procId) ;
+        if (DSP_FAILED (statusOfCleanup)) {
+            TST_PrnError ("PROC_Detach Failed. Status = [0x%x]",
+                          statusOfCleanup) ;
+        }
+
+        statusOfCleanup = API_CloseAllocator (mqaId) ;
+
+        statusOfCleanup = PROC_Destroy () ;
+        if (DSP_FAILED (statusOfCleanup)) {
+            TST_PrnError ("PROC_Destroy Failed. Status = [0x%x]",
+                          statusOfCleanup) ;
+        }
+    }
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
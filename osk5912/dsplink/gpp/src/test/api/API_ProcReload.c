@@ -0,0 +1,130 @@
+/** ============================================================================
+ *  @file   API_ProcReload.c
+ *
+ *  @path   $(DSPLINK)\gpp\src\test\api
+ *
+ *  @desc   Implemetation of PROC_Reload API test case.
+ *
+ *  @ver    01.10.01
+ *  ============================================================================
+ *  Copyright (c) Texas Instruments Incorporated 2002-2004
+ *
+ *  Use of this software is controlled by the terms and conditions found in the
+ *  license agreement under which this software has been supplied or provided.
+ *  ============================================================================
+ */
+
+
+/*  ----------------------------------- DSP/BIOS Link                 */
+#include <gpptypes.h>
+#include <errbase.h>
+#include <dsplink.h>
+
+#if defined (MSGQ_COMPONENT)
+#include <msgqdefs.h>
+#endif /* if defined (MSGQ_COMPONENT) */
+
+/*  ----------------------------------- Trace & Debug                 */
+#include <TST_Dbc.h>
+
+/*  ----------------------------------- Profiling                     */
+#include <profile.h>
+
+/*  ----------------------------------- Processor Manager             */
+#include <proc.h>
+
+/*  ----------------------------------- Test framework                */
+#include <TST_Framework.h>
+#include <TST_Helper.h>
+#include <TST_PrintFuncs.h>
+#include <API_PostProcess.h>
+#include <API_ProcReload.h>
+
+
+#if defined (__cplusplus)
+EXTERN "C" {
+#endif /* defined (__cplusplus) */
+
+
+/** ============================================================================
+ *  @func   API_ProcReload
+ *
+ *  @desc   Tests the PROC_Reload API.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+API_ProcReload (IN Uint32 argc, IN Char8 ** argv)
+{
+    DSP_STATUS statusOfSetup    = DSP_SOK   ;
+    DSP_STATUS status           = DSP_SOK   ;
+    Uint32     processorId      = 0         ;
+    ProcState  procState                    ;
+
+    DBC_Require (argc == 5) ;
+    DBC_Require (argv != NULL) ;
+
+    if ((argc != 5) || (argv == NULL)) {
+        status = DSP_EINVALIDARG ;
+        TST_PrnError ("Incorrect usage of API_ProcReload. Status = [0x%x]",
+                      status) ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        /*  --------------------------------------------------------------------
+         *  Get arguments.
+         *  --------------------------------------------------------------------
+         */
+        processorId = TST_StringToInt (argv [2]) ;
+
+        /*  --------------------------------------------------------------------
+         *  Initialize.
+         *  --------------------------------------------------------------------
+         */
+        statusOfSetup = PROC_Setup () ;
+
+        if (DSP_SUCCEEDED (statusOfSetup)) {
+            statusOfSetup = PROC_Attach (processorId, NULL) ;
+        }
+
+        if (DSP_SUCCEEDED (statusOfSetup)) {
+            statusOfSetup = PROC_Load (processorId, argv [3], 0, NULL) ;
+        }
+
+        if (DSP_SUCCEEDED (statusOfSetup)) {
+            statusOfSetup = PROC_Start (processorId) ;
+        }
+    }
+
+    /*  --------------------------------------------------------------------
+     *  Tests PROC_Reload. The DSP must be running again on success.
+     *  --------------------------------------------------------------------
+     */
+    if (DSP_SUCCEEDED (status)) {
+        status = PROC_Reload (processorId, argv [4], 0, NULL) ;
+
+        if (DSP_SUCCEEDED (status)) {
+            status = PROC_GetState (processorId, &procState) ;
+            if (DSP_SUCCEEDED (status) && (procState != ProcState_Started)) {
+                status = DSP_EFAIL ;
+                TST_PrnError ("DSP not started after PROC_Reload. "
+                              "Status = [0x%x]", status) ;
+            }
+        }
+    }
+
+    status = API_PostProcess (status, argv [1], statusOfSetup, argv [0]) ;
+
+    PROC_Stop (processorId) ;
+    PROC_Detach (processorId) ;
+    PROC_Destroy () ;
+
+    return status ;
+}
+
+
+#if defined (__cplusplus)
+}
+#endif /* defined (__cplusplus) */
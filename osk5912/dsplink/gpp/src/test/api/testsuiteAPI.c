@@ -34,6 +34,7 @@
 #include <API_ProcLoad.h>
 #include <API_ProcStart.h>
 #include <API_ProcStop.h>
+#include <API_ProcReload.h>
 #include <API_ProcDetach.h>
 #include <API_ProcGetstate.h>
 #include <API_ProcInstrument.h>
@@ -44,6 +45,7 @@
 #include <API_ChnlFreeBuffer.h>
 #include <API_ChnlDelete.h>
 #include <API_ChnlIssue.h>
+#include <API_ChnlIssueV.h>
 #include <API_ChnlReclaim.h>
 #include <API_ChnlIdle.h>
 #include <API_MsgqAllocatorOpen.h>
@@ -59,6 +61,7 @@
 #include <API_MsgqPut.h>
 #include <API_MsgqGet.h>
 #include <API_MsgqGetReplyId.h>
+#include <API_MsgqPublish.h>
 
 
 #if defined (__cplusplus)
@@ -93,6 +96,7 @@ STATIC TestcaseObj TestList [] = {
     {"API_CHNLIDLE",           API_ChnlIdle          },
     {"API_CHNLRECLAIM",        API_ChnlReclaim       },
     {"API_CHNLISSUE",          API_ChnlIssue         },
+    {"API_CHNLISSUEV",         API_ChnlIssueV        },
     {"API_CHNLDELETE",         API_ChnlDelete        },
     {"API_CHNLFREEBUFFER",     API_ChnlFreeBuffer    },
     {"API_CHNLCONTROL",        API_ChnlControl       },
@@ -101,6 +105,7 @@ STATIC TestcaseObj TestList [] = {
     {"API_PROCGETSTATE",       API_ProcGetstate      },
     {"API_PROCDETACH",         API_ProcDetach        },
     {"API_PROCSTOP",           API_ProcStop          },
+    {"API_PROCRELOAD",         API_ProcReload        },
     {"API_PROCSTART",          API_ProcStart         },
     {"API_PROCLOAD",           API_ProcLoad          },
     {"API_PROCCONTROL",        API_ProcControl       },
@@ -121,6 +126,7 @@ STATIC TestcaseObj TestList [] = {
     {"API_MSGQPUT",            API_MsgqPut           },
     {"API_MSGQGET",            API_MsgqGet           },
     {"API_MSGQGETREPLYID",     API_MsgqGetReplyId    },
+    {"API_MSGQPUBLISH",        API_MsgqPublish       },
 #endif /* if defined (MSGQ_COMPONENT) */
     {NULL,                     NULL                  }
     /* NULL to mark end of list */
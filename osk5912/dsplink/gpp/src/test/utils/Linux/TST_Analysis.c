@@ -17,6 +17,7 @@
 
 /*  ----------------------------------- OS Specific Headers           */
 #include <time.h>
+#include <stdlib.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -33,6 +34,8 @@
 #include <TST_Analysis.h>
 #include <TST_PrintFuncs.h>
 #include <TST_FileOperation.h>
+#include <TST_Print.h>
+#include <TST_Mem.h>
 
 
 #if defined (__cplusplus)
@@ -46,7 +49,56 @@ EXTERN "C" {
  *  @desc   This variable stores the value of zero time.
  *  ============================================================================
  */
-STATIC time_t initialTime = 0 ;
+STATIC struct timespec initialTime = {0, 0} ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   TST_CompareSamples
+ *
+ *  @desc   Comparison function used to sort latency samples.
+ *
+ *  @arg    a
+ *              First sample.
+ *  @arg    b
+ *              Second sample.
+ *
+ *  @ret    Negative, zero or positive if a is less than, equal to or greater
+ *          than b.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TST_LatencyReport
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+int
+TST_CompareSamples (const void * a, const void * b) ;
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   TST_Percentile
+ *
+ *  @desc   Returns the given percentile of sorted samples.
+ *
+ *  @arg    latObj
+ *              Latency object with sorted samples.
+ *  @arg    perMille
+ *              Percentile in tenths of a percent.
+ *
+ *  @ret    Sample at the percentile.
+ *
+ *  @enter  latObj must hold at least one sample.
+ *
+ *  @leave  None
+ *
+ *  @see    TST_LatencyReport
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+Uint32
+TST_Percentile (IN TST_LatencyObj * latObj, IN Uint32 perMille) ;
 
 
 /** ============================================================================
@@ -61,7 +113,7 @@ EXPORT_API
 Void
 TST_ZeroTime ()
 {
-    time (&initialTime) ;
+    clock_gettime (CLOCK_MONOTONIC, &initialTime) ;
 }
 
 
@@ -77,16 +129,42 @@ EXPORT_API
 Uint32
 TST_GetTime ()
 {
-    Uint32 clock_value ;
-    time_t currentTime ;
+    Uint32          clock_value ;
+    struct timespec currentTime ;
 
-    time (&currentTime) ;
-    clock_value = (Uint32) (currentTime - initialTime) ;
+    clock_gettime (CLOCK_MONOTONIC, &currentTime) ;
+    clock_value = (Uint32) (  (  (Real64) (currentTime.tv_sec
+                                           - initialTime.tv_sec)
+                               * TICS_PER_SEC)
+                            + (  (Real64) (currentTime.tv_nsec
+                                           - initialTime.tv_nsec)
+                               * TICS_PER_SEC / 1000000000.0)) ;
 
     return clock_value ;
 }
 
 
+/** ============================================================================
+ *  @func   TST_GetTimeNs
+ *
+ *  @desc   This function gives the value of a monotonic clock in nanoseconds.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Uint32
+TST_GetTimeNs ()
+{
+    struct timespec currentTime ;
+
+    clock_gettime (CLOCK_MONOTONIC, &currentTime) ;
+
+    return (Uint32) (  ((Uint32) currentTime.tv_sec * 1000000000u)
+                     + (Uint32) currentTime.tv_nsec) ;
+}
+
+
 /** ============================================================================
  *  @func   TST_DoAnalysis
  *
@@ -162,6 +240,226 @@ TST_GetFileSize (IN Char8 * fileName, OUT Uint32 * size)
 }
 
 
+/** ============================================================================
+ *  @func   TST_LatencyCreate
+ *
+ *  @desc   This function creates an object to collect latency samples.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+TST_LatencyCreate (IN  Uint32            maxSamples,
+                   IN  Uint32            warmup,
+                   OUT TST_LatencyObj ** latObj)
+{
+    DSP_STATUS       status = DSP_SOK ;
+    TST_LatencyObj * obj    = NULL    ;
+
+    DBC_Require (maxSamples != 0) ;
+    DBC_Require (latObj != NULL) ;
+
+    if ((maxSamples == 0) || (latObj == NULL)) {
+        status = DSP_EINVALIDARG ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        status = TST_Alloc ((Void **) &obj, sizeof (TST_LatencyObj)) ;
+    }
+
+    if (DSP_SUCCEEDED (status)) {
+        obj->maxSamples = maxSamples ;
+        obj->numSamples = 0 ;
+        obj->warmup     = warmup ;
+        obj->numOps     = 0 ;
+        obj->maxLatency = 0 ;
+        obj->startTime  = 0 ;
+        obj->samples    = NULL ;
+        status = TST_Alloc ((Void **) &(obj->samples),
+                            maxSamples * sizeof (Uint32)) ;
+        if (DSP_FAILED (status)) {
+            TST_Free ((Void **) &obj) ;
+        }
+    }
+
+    if (latObj != NULL) {
+        *latObj = obj ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   TST_LatencyStart
+ *
+ *  @desc   This function marks the start of an operation to be measured.
+ *
+ *  @modif  latObj->startTime
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+TST_LatencyStart (IN TST_LatencyObj * latObj)
+{
+    DBC_Require (latObj != NULL) ;
+
+    latObj->startTime = TST_GetTimeNs () ;
+}
+
+
+/** ============================================================================
+ *  @func   TST_LatencyStop
+ *
+ *  @desc   This function records the latency of the current operation.
+ *
+ *  @modif  latObj
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+TST_LatencyStop (IN TST_LatencyObj * latObj)
+{
+    Uint32 latency ;
+
+    DBC_Require (latObj != NULL) ;
+
+    latency = TST_GetTimeNs () - latObj->startTime ;
+
+    if (latObj->numOps >= latObj->warmup) {
+        if (latObj->numSamples < latObj->maxSamples) {
+            latObj->samples [latObj->numSamples] = latency ;
+            latObj->numSamples++ ;
+        }
+        if (latency > latObj->maxLatency) {
+            latObj->maxLatency = latency ;
+        }
+    }
+    latObj->numOps++ ;
+}
+
+
+/** ============================================================================
+ *  @func   TST_LatencyReport
+ *
+ *  @desc   This function prints the percentiles of the recorded latencies.
+ *
+ *  @modif  latObj->samples
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+TST_LatencyReport (IN TST_LatencyObj * latObj,
+                   IN Char8 *          name,
+                   IN Uint32           bufSize,
+                   IN Uint32           depth)
+{
+    DSP_STATUS status = DSP_SOK ;
+    Uint32     p50              ;
+    Uint32     p99              ;
+    Uint32     p999             ;
+
+    DBC_Require (latObj != NULL) ;
+    DBC_Require (name != NULL) ;
+
+    if ((latObj == NULL) || (name == NULL)) {
+        status = DSP_EINVALIDARG ;
+    }
+    else if (latObj->numSamples == 0) {
+        TST_PrnInfo ("No latency samples recorded.") ;
+    }
+    else {
+        qsort (latObj->samples,
+               latObj->numSamples,
+               sizeof (Uint32),
+               TST_CompareSamples) ;
+
+        p50  = TST_Percentile (latObj, 500) ;
+        p99  = TST_Percentile (latObj, 990) ;
+        p999 = TST_Percentile (latObj, 999) ;
+
+        TST_PrnInfo ("Samples    = %u", latObj->numSamples) ;
+        TST_PrnInfo ("Latency    = %u ns (p50)", p50) ;
+        TST_PrnInfo ("             %u ns (p99)", p99) ;
+        TST_PrnInfo ("             %u ns (p99.9)", p999) ;
+        TST_PrnInfo ("             %u ns (max)", latObj->maxLatency) ;
+
+        TST_PRINT ("\nBENCH %s size=%lu depth=%lu samples=%lu p50=%lu"
+                   " p99=%lu p999=%lu max=%lu\n",
+                   name,
+                   bufSize,
+                   depth,
+                   latObj->numSamples,
+                   p50,
+                   p99,
+                   p999,
+                   latObj->maxLatency) ;
+    }
+
+    return status ;
+}
+
+
+/** ============================================================================
+ *  @func   TST_LatencyDelete
+ *
+ *  @desc   This function deletes a latency object.
+ *
+ *  @modif  None
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+TST_LatencyDelete (IN TST_LatencyObj * latObj)
+{
+    if (latObj != NULL) {
+        TST_Free ((Void **) &(latObj->samples)) ;
+        TST_Free ((Void **) &latObj) ;
+    }
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   TST_CompareSamples
+ *
+ *  @desc   Comparison function used to sort latency samples.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+int
+TST_CompareSamples (const void * a, const void * b)
+{
+    Uint32 sampleA = *((const Uint32 *) a) ;
+    Uint32 sampleB = *((const Uint32 *) b) ;
+
+    return (sampleA > sampleB) - (sampleA < sampleB) ;
+}
+
+
+/** ----------------------------------------------------------------------------
+ *  @func   TST_Percentile
+ *
+ *  @desc   Returns the given percentile of sorted samples.
+ *
+ *  @modif  None
+ *  ----------------------------------------------------------------------------
+ */
+STATIC
+Uint32
+TST_Percentile (IN TST_LatencyObj * latObj, IN Uint32 perMille)
+{
+    Uint32 index ;
+
+    index = (Uint32) (  ((Real64) (latObj->numSamples - 1) * perMille)
+                      / 1000) ;
+
+    return latObj->samples [index] ;
+}
+
+
 #if defined (__cplusplus)
 }
 #endif /* defined (__cplusplus) */
@@ -34,7 +34,51 @@ EXTERN "C" {
  *  @desc   This is the no. of ticks that occur per second.
  *  ============================================================================
  */
-#define TICS_PER_SEC 1
+#define TICS_PER_SEC 1000
+
+/** ============================================================================
+ *  @name   TST_WARMUP_SAMPLES
+ *
+ *  @desc   Number of initial operations of a test whose latency is not
+ *          recorded, so that cold caches and first-time allocations do not
+ *          skew the reported percentiles.
+ *  ============================================================================
+ */
+#define TST_WARMUP_SAMPLES 16
+
+
+/** ============================================================================
+ *  @name   TST_LatencyObj
+ *
+ *  @desc   Collects per-operation latency samples of a test.
+ *
+ *  @field  maxSamples
+ *              Number of samples that can be held in the samples array.
+ *  @field  numSamples
+ *              Number of samples recorded.
+ *  @field  warmup
+ *              Number of operations to be measured before samples are
+ *              recorded.
+ *  @field  numOps
+ *              Number of operations measured so far.
+ *  @field  maxLatency
+ *              Largest latency seen, including operations that did not fit in
+ *              the samples array.
+ *  @field  startTime
+ *              Time at which the current operation started, in nanoseconds.
+ *  @field  samples
+ *              Recorded latencies in nanoseconds.
+ *  ============================================================================
+ */
+typedef struct TST_LatencyObj_tag {
+    Uint32     maxSamples ;
+    Uint32     numSamples ;
+    Uint32     warmup     ;
+    Uint32     numOps     ;
+    Uint32     maxLatency ;
+    Uint32     startTime  ;
+    Uint32 *   samples    ;
+} TST_LatencyObj ;
 
 
 /** ============================================================================
@@ -79,6 +123,29 @@ Uint32
 TST_GetTime () ;
 
 
+/** ============================================================================
+ *  @func   TST_GetTimeNs
+ *
+ *  @desc   This function gives the value of a monotonic clock in nanoseconds.
+ *          The value wraps around every 4.29 seconds, so only the difference
+ *          between two values taken less than that apart is meaningful.
+ *
+ *  @arg    None
+ *
+ *  @ret    Current value of the clock.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TST_LatencyStart, TST_LatencyStop
+ *  ============================================================================
+ */
+EXPORT_API
+Uint32
+TST_GetTimeNs () ;
+
+
 /** ============================================================================
  *  @func   TST_DoAnalysis
  *
@@ -141,6 +208,145 @@ DSP_STATUS
 TST_GetFileSize (IN Char8 * fileName, OUT Uint32 * size) ;
 
 
+/** ============================================================================
+ *  @func   TST_LatencyCreate
+ *
+ *  @desc   This function creates an object to collect latency samples.
+ *
+ *  @arg    maxSamples
+ *              Maximum number of samples to be recorded.
+ *  @arg    warmup
+ *              Number of initial operations that are not recorded.
+ *  @arg    latObj
+ *              Location to receive the created object.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid arguments.
+ *          DSP_EMEMORY
+ *              Out of memory.
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TST_LatencyDelete
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+TST_LatencyCreate (IN  Uint32            maxSamples,
+                   IN  Uint32            warmup,
+                   OUT TST_LatencyObj ** latObj) ;
+
+
+/** ============================================================================
+ *  @func   TST_LatencyStart
+ *
+ *  @desc   This function marks the start of an operation to be measured.
+ *
+ *  @arg    latObj
+ *              Latency object.
+ *
+ *  @ret    None
+ *
+ *  @enter  latObj must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    TST_LatencyStop
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+TST_LatencyStart (IN TST_LatencyObj * latObj) ;
+
+
+/** ============================================================================
+ *  @func   TST_LatencyStop
+ *
+ *  @desc   This function marks the end of the operation started by the last
+ *          call to TST_LatencyStart and records its latency.
+ *
+ *  @arg    latObj
+ *              Latency object.
+ *
+ *  @ret    None
+ *
+ *  @enter  latObj must be valid.
+ *
+ *  @leave  None
+ *
+ *  @see    TST_LatencyStart
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+TST_LatencyStop (IN TST_LatencyObj * latObj) ;
+
+
+/** ============================================================================
+ *  @func   TST_LatencyReport
+ *
+ *  @desc   This function prints the median, 99th, 99.9th percentile and
+ *          maximum of the recorded latencies. It also prints them on a single
+ *          line starting with "BENCH", which can be extracted from the output
+ *          of two builds and compared.
+ *
+ *  @arg    latObj
+ *              Latency object.
+ *  @arg    name
+ *              Name of the measured operation.
+ *  @arg    bufSize
+ *              Size of the buffer transferred by each operation.
+ *  @arg    depth
+ *              Number of requests queued in each measured operation, 1 if
+ *              it is a single request. Part of the key of the BENCH line,
+ *              so that the rows of a queue-depth sweep can be told apart.
+ *
+ *  @ret    DSP_SOK
+ *              Operation successfully completed.
+ *          DSP_EINVALIDARG
+ *              Invalid arguments.
+ *
+ *  @enter  None
+ *
+ *  @leave  The samples of latObj are sorted.
+ *
+ *  @see    TST_DoAnalysis
+ *  ============================================================================
+ */
+EXPORT_API
+DSP_STATUS
+TST_LatencyReport (IN TST_LatencyObj * latObj,
+                   IN Char8 *          name,
+                   IN Uint32           bufSize,
+                   IN Uint32           depth) ;
+
+
+/** ============================================================================
+ *  @func   TST_LatencyDelete
+ *
+ *  @desc   This function deletes a latency object.
+ *
+ *  @arg    latObj
+ *              Latency object. May be NULL.
+ *
+ *  @ret    None
+ *
+ *  @enter  None
+ *
+ *  @leave  None
+ *
+ *  @see    TST_LatencyCreate
+ *  ============================================================================
+ */
+EXPORT_API
+Void
+TST_LatencyDelete (IN TST_LatencyObj * latObj) ;
+
+
 #if defined (__cplusplus)
 }
 #endif /* defined (__cplusplus) */
@@ -20,5 +20,6 @@
 IVOL_Params IVOL_PARAMS = {
     sizeof(IVOL_Params),
     0,          /* Int frameSize; */
-    100         /* Int gainPercentage; */
+    100,        /* Int gainPercentage; */
+    IVOL_RAMPLINEAR /* Int rampMode; */
 };
@@ -254,6 +254,7 @@ Void thrAudioprocSetOutputVolume( Int chan, Int volume )
      *  a percentage, a number from 0 to 200, 100 being the normal
      *  volume (100%).
      */
+    status.size = sizeof( status );
     VOL_control( thrAudioproc[ chan ].algVOL, IVOL_GETSTATUS, &status );
     status.gainPercentage = volume;
     VOL_control( thrAudioproc[ chan ].algVOL, IVOL_SETSTATUS, &status );
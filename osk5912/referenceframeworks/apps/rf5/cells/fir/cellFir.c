@@ -21,7 +21,8 @@ ICELL_Fxns FIR_CELLFXNS = {
     NULL,            // cellClose
     FIR_cellControl, // cellControl
     FIR_cellExecute, // cellExecute
-    NULL             // cellOpen
+    NULL,            // cellOpen
+    FIR_cellExecuteBlock // cellExecuteBlock
 };
 
 /*
@@ -33,15 +34,39 @@ Bool FIR_cellExecute( ICELL_Handle handle, Arg arg )
     IFIR_Fxns  *firFxns   = (IFIR_Fxns *)handle->algFxns;
     IFIR_Handle firHandle = (IFIR_Handle)handle->algHandle;
 
-    // activate instance object
-    ALGRF_activate( handle->algHandle );
+    // activate instance object, unless it is still active from last frame
+    ALGRF_activateLazy( handle->algHandle, handle->scrBucketIndex );
     
     firFxns->filter( firHandle,
                      (Short *)handle->inputIcc[0]->buffer,
                      (Short *)handle->outputIcc[0]->buffer );
         
-    // deactivate instance object
-    ALGRF_deactivate( handle->algHandle );
+    // the instance is left active until another algorithm needs the scratch
+
+    return ( TRUE );
+}
+
+/*
+ *  ======== FIR_cellExecuteBlock ========
+ *
+ *  Filters part of a frame. The instance is not activated: filterBlock()
+ *  works on its persistent state, so no scratch memory is touched.
+ */
+Bool FIR_cellExecuteBlock( ICELL_Handle handle, Arg arg, Ptr in, Ptr out, 
+                           Uns nmaus )
+{
+    IFIR_Fxns  *firFxns   = (IFIR_Fxns *)handle->algFxns;
+    IFIR_Handle firHandle = (IFIR_Handle)handle->algHandle;
+
+    if (firFxns->filterBlock == NULL) {
+        return ( FALSE );
+    }
+
+    // bring the persistent state up to date if the instance was left active
+    ALGRF_deactivateLazy( handle->algHandle, handle->scrBucketIndex );
+
+    firFxns->filterBlock( firHandle, (Short *)in, (Short *)out, 
+                          nmaus / sizeof( Short ) );
 
     return ( TRUE );
 }
@@ -34,6 +34,8 @@ extern IFIR_Fxns FIR_IFIR;
  */
 Int  FIR_cellControl( ICELL_Handle handle, IALG_Cmd cmd, IALG_Status *status);
 Bool FIR_cellExecute( ICELL_Handle handle, Arg arg );
+Bool FIR_cellExecuteBlock( ICELL_Handle handle, Arg arg, Ptr in, Ptr out, 
+                           Uns nmaus );
 
 #ifdef __cplusplus
 }
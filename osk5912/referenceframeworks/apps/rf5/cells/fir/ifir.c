@@ -23,5 +23,7 @@ IFIR_Params IFIR_PARAMS = {
     NULL,                   /* coefficient array */
     0,                      /* filter length */
     0,                      /* frame length */
+    IFIR_ACCUM32,           /* accumulation mode */
+    IFIR_FFTAUTO,           /* fft length */
 };
 
@@ -22,7 +22,8 @@ ICELL_Fxns VOL_CELLFXNS = {
     NULL,            // cellClose
     VOL_cellControl, // cellControl
     VOL_cellExecute, // cellExecute
-    NULL             // cellOpen
+    NULL,            // cellOpen
+    VOL_cellExecuteBlock // cellExecuteBlock
 };
 
 /*
@@ -34,19 +35,40 @@ Bool VOL_cellExecute( ICELL_Handle handle, Arg arg )
     IVOL_Fxns  *volFxns   = (IVOL_Fxns *)handle->algFxns;
     IVOL_Handle volHandle = (IVOL_Handle)handle->algHandle;
     
-    // activate instance object
-    ALGRF_activate( handle->algHandle );
+    // activate instance object, unless it is still active from last frame
+    ALGRF_activateLazy( handle->algHandle, handle->scrBucketIndex );
     
     volFxns->amplify( volHandle,
                      (XDAS_Int16 *)handle->inputIcc[0]->buffer,
                      (XDAS_Int16 *)handle->outputIcc[0]->buffer );
         
-    // deactivate instance object
-    ALGRF_deactivate( handle->algHandle );
+    // the instance is left active until another algorithm needs the scratch
     
     return ( TRUE );
 }
 
+/*
+ *  ======== VOL_cellExecuteBlock ========
+ *
+ *  Amplifies part of a frame. VOL keeps no scratch state, so the
+ *  instance does not need to be activated.
+ */
+Bool VOL_cellExecuteBlock( ICELL_Handle handle, Arg arg, Ptr in, Ptr out, 
+                           Uns nmaus )
+{
+    IVOL_Fxns  *volFxns   = (IVOL_Fxns *)handle->algFxns;
+    IVOL_Handle volHandle = (IVOL_Handle)handle->algHandle;
+
+    if (volFxns->amplifyBlock == NULL) {
+        return ( FALSE );
+    }
+
+    volFxns->amplifyBlock( volHandle, (XDAS_Int16 *)in, (XDAS_Int16 *)out, 
+                           nmaus / sizeof( XDAS_Int16 ) );
+
+    return ( TRUE );
+}
+
 /*
  *  ======== VOL_cellControl ========
  *
@@ -34,6 +34,8 @@ extern IVOL_Fxns VOL_IVOL;
  */
 Int  VOL_cellControl( ICELL_Handle handle, IALG_Cmd cmd, IALG_Status *status);
 Bool VOL_cellExecute( ICELL_Handle handle, Arg arg );
+Bool VOL_cellExecuteBlock( ICELL_Handle handle, Arg arg, Ptr in, Ptr out, 
+                           Uns nmaus );
 
 #ifdef __cplusplus
 }
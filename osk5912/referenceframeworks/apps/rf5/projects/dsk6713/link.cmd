@@ -40,6 +40,8 @@
 -l algrf.l62        /* XDAIS algorithm instance manager module      */
 -l chan.l62         /* Channel Manager module                       */
 -l icc.l62          /* Inter-Cell Communication module              */
+-l ilv.l62          /* Interleave/deinterleave module               */
+-l prf.l62          /* Cycle-budget profiler module                 */
 -l scom.l62         /* Synchronized communication module            */
 -l sscr.l62         /* Shared Scratch Module                        */
 -l utl.l62          /* Utility module for debugging and diagnostics */
@@ -40,6 +40,8 @@
 -l algrf.l64        /* XDAIS algorithm instance manager module      */
 -l chan.l64         /* Channel Manager module                       */
 -l icc.l64          /* Inter-Cell Communication module              */
+-l ilv.l64          /* Interleave/deinterleave module               */
+-l prf.l64          /* Cycle-budget profiler module                 */
 -l scom.l64         /* Synchronized communication module            */
 -l sscr.l64         /* Shared Scratch Module                        */
 -l utl.l64          /* Utility module for debugging and diagnostics */
@@ -10,14 +10,21 @@
  *  ======== thrControl.c ========
  *  This file shows an example of sending messages from one thread to the
  *  other using mailbox. 
+ *
+ *  It also adds and removes the Process thread's channels at run time:
+ *  the algorithms of a channel are created and deleted here, in the 
+ *  background, while the Process thread only switches the channel on or
+ *  off between two frames, so the audio of the other channels never stops.
  */
 #include <std.h>
 
 // DSP/BIOS includes
 #include <mbx.h>
+#include <sys.h>
 #include <tsk.h>
 
 // RF5 library includes
+#include <scom.h>
 #include <utl.h>
 
 // application includes
@@ -31,11 +38,29 @@
 typedef struct ExternalControl {
     Int volGain [ NUMCHANNELS ];
     Int firCoeff[ NUMCHANNELS ];
+    Int chanActive[ NUMCHANNELS ];      // 0: channel removed, else added
 } ExternalControl;
 
 ExternalControl externalControl;        // GEL script writes here
 ExternalControl externalControlPrev;    // this is a local copy 
 
+// States of the Process thread's channels, as seen by this thread
+enum {
+    CHANCLOSED = 0,     // no algorithms
+    CHANOPEN,           // opened, and activated or about to be
+    CHANREMOVING        // being deactivated by the Process thread
+};
+
+static Uns chanState[ NUMCHANNELS ];
+
+// the Process thread acknowledges channel removals on this queue
+static SCOM_Handle scomReceiveFromProcess;
+
+// Local function prototypes
+static Void addChannel( Int chanNum );
+static Void removeChannel( Int chanNum );
+static Void closeChannels( Void );
+
 /*
  *  ======== thrControlInit ========
  *
@@ -43,15 +68,28 @@ ExternalControl externalControlPrev;    // this is a local copy
 Void thrControlInit()
 {
     Int chanNum;
+    SCOM_Attrs scomAttrs;
     
     // set the default gain to 100%
     for( chanNum = 0; chanNum < NUMCHANNELS; chanNum++ ) {
         externalControl.volGain[ chanNum ] = 100;
         externalControl.firCoeff[ chanNum ] = 0;
+
+        // the Process thread opens the first NUMINITCHANNELS channels
+        externalControl.chanActive[ chanNum ] = 
+            (chanNum < NUMINITCHANNELS) ? 1 : 0;
+        chanState[ chanNum ] = 
+            (chanNum < NUMINITCHANNELS) ? CHANOPEN : CHANCLOSED;
     }
     
     // Set the previous state to the initial values.
     externalControlPrev = externalControl;
+
+    // at most one removal per channel is acknowledged at a time
+    scomAttrs          = SCOM_ATTRS;
+    scomAttrs.ringSize = NUMCHANNELS;
+    scomReceiveFromProcess = SCOM_create( "scomControl", &scomAttrs );
+    UTL_assert( scomReceiveFromProcess != NULL );
 }
 
 /*
@@ -63,8 +101,8 @@ Void thrControlStartup()
     Int chanNum;
     CtrlMsg txMsg;
     
-    // send message to initialize the volume & fir for all channels
-    for( chanNum = 0; chanNum < NUMCHANNELS; chanNum++) {
+    // send message to initialize the volume & fir for all open channels
+    for( chanNum = 0; chanNum < NUMINITCHANNELS; chanNum++) {
         
         // Set-up initial values for Volume
         txMsg.cmd  = MSGNEWVOL;
@@ -97,9 +135,37 @@ Void thrControlRun()
     // Main loop
     while (TRUE) {
     
+        // delete the channels the Process thread no longer executes
+        closeChannels();
+
         // check for changes
         for (chanNum = 0; chanNum < NUMCHANNELS; chanNum++) {
 
+            /*
+             *  See if user requested adding or removing the channel. A
+             *  request is left pending while the channel is being removed.
+             */
+            if( (externalControl.chanActive[ chanNum ] != 
+                 externalControlPrev.chanActive[ chanNum ]) &&
+                (chanState[ chanNum ] != CHANREMOVING) ) {
+
+                // new value entered
+                externalControlPrev.chanActive[ chanNum ] = 
+                    externalControl.chanActive[ chanNum ];
+
+                if (externalControl.chanActive[ chanNum ] != 0) {
+                    addChannel( chanNum );
+                }
+                else {
+                    removeChannel( chanNum );
+                }
+            }
+
+            // a channel that is not open gets its settings when it is added
+            if (chanState[ chanNum ] != CHANOPEN) {
+                continue;
+            }
+
             // See if user requested a volume change.
             if( externalControl.volGain[ chanNum ] != 
                 externalControlPrev.volGain[ chanNum ] ) {
@@ -136,3 +202,86 @@ Void thrControlRun()
     }
 }
 
+/*
+ *  ======== addChannel ========
+ *
+ *  Opens channel chanNum, which creates its algorithms here, in the 
+ *  background, then has the Process thread activate it with the current
+ *  volume and filter. The messages must not be dropped, so this thread
+ *  waits for room in the mailbox.
+ */
+static Void addChannel( Int chanNum )
+{
+    CtrlMsg txMsg;
+
+    if (chanState[ chanNum ] != CHANCLOSED) {
+        return;
+    }
+    if (thrProcessOpenChannel( chanNum ) == FALSE) {
+        UTL_logDebug1("Cannot open channel %d", chanNum);
+        return;
+    }
+    chanState[ chanNum ] = CHANOPEN;
+
+    txMsg.cmd  = MSGADDCHAN;
+    txMsg.arg1 = chanNum;
+    txMsg.arg2 = 0;
+    MBX_post( mbxProcess, &txMsg, SYS_FOREVER );
+
+    externalControlPrev.volGain[ chanNum ] = 
+        externalControl.volGain[ chanNum ];
+    txMsg.cmd  = MSGNEWVOL;
+    txMsg.arg1 = chanNum;
+    txMsg.arg2 = externalControl.volGain[ chanNum ];
+    MBX_post( mbxProcess, &txMsg, SYS_FOREVER );
+
+    externalControlPrev.firCoeff[ chanNum ] = 
+        externalControl.firCoeff[ chanNum ];
+    txMsg.cmd  = MSGNEWCOEFF;
+    txMsg.arg1 = chanNum;
+    txMsg.arg2 = externalControl.firCoeff[ chanNum ];
+    MBX_post( mbxProcess, &txMsg, SYS_FOREVER );
+}
+
+/*
+ *  ======== removeChannel ========
+ *
+ *  Has the Process thread deactivate channel chanNum. The channel is 
+ *  closed when the Process thread acknowledges it (see closeChannels()).
+ */
+static Void removeChannel( Int chanNum )
+{
+    CtrlMsg txMsg;
+
+    if (chanState[ chanNum ] != CHANOPEN) {
+        return;
+    }
+    chanState[ chanNum ] = CHANREMOVING;
+
+    txMsg.cmd  = MSGREMOVECHAN;
+    txMsg.arg1 = chanNum;
+    txMsg.arg2 = 0;
+    MBX_post( mbxProcess, &txMsg, SYS_FOREVER );
+}
+
+/*
+ *  ======== closeChannels ========
+ *
+ *  Closes the channels whose removal the Process thread has acknowledged,
+ *  which deletes their algorithms. The Process thread no longer executes
+ *  them, and only executes them again once added with MSGADDCHAN.
+ */
+static Void closeChannels( Void )
+{
+    ScomChanClosed *scomMsg;
+    Bool rc;
+
+    while ((scomMsg = SCOM_getMsg( scomReceiveFromProcess, 0 )) != NULL) {
+        UTL_assert( chanState[ scomMsg->chanNum ] == CHANREMOVING );
+
+        rc = thrProcessCloseChannel( scomMsg->chanNum );
+        UTL_assert( rc == TRUE );
+        chanState[ scomMsg->chanNum ] = CHANCLOSED;
+    }
+}
+
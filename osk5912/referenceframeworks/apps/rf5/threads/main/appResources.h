@@ -21,6 +21,8 @@ extern "C" {
 #endif
 
 #define NUMCHANNELS 2
+#define NUMINITCHANNELS NUMCHANNELS // channels opened at startup; the others
+                                    // are added at run time (appControl.gel)
 #define FRAMELEN    80
 
 #define MEMALIGN 128
@@ -21,12 +21,27 @@
 extern "C" {
 #endif
 
+/*
+ *  SCOM queues are ring queues: each has one writer and one reader task, 
+ *  and at most one ScomBufChannels message is ever waiting on it.
+ */
+#define SCOMRINGSIZE    2
+
 // SCOM buffer descriptor: list of pointers to individual channel data buffers
 typedef struct ScomBufChannels {
     QUE_Elem queElem;                    // must be first field.
     Sample * bufChannel[ NUMCHANNELS ];
 } ScomBufChannels;
 
+/*
+ *  SCOM message the Process thread sends the Control thread once it no
+ *  longer executes a removed channel, so that its algorithms can be deleted
+ */
+typedef struct ScomChanClosed {
+    QUE_Elem queElem;                    // must be first field.
+    Int      chanNum;                    // channel removed
+} ScomChanClosed;
+
 /* control message format */
 typedef struct CtrlMsg {
     LgUns cmd;                       /* Message code */
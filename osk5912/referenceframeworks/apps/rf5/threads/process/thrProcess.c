@@ -16,15 +16,23 @@
  *  (since XDAIS algorithms have different processing functions with different
  *  signatures). An RF5 channel is a collection of cells, which execute in 
  *  series. 
+ *
+ *  Only the channels marked active are executed; the others output 
+ *  silence. The Control thread opens a channel in its own context before
+ *  this thread activates it, and closes it after this thread has 
+ *  deactivated it, so channels come and go at frame boundaries without
+ *  stopping the audio of the others.
  */
 
 #include <std.h>
+#include <string.h>
 
 // DSP/BIOS includes
 #include <mbx.h>
 #include <sys.h>
 
 // RF5 module includes
+#include <algrf.h>
 #include <chan.h>
 #include <icell.h>
 #include <scom.h>
@@ -55,10 +63,12 @@
  *   cell of each channel.  If there were more cells per channel
  *   or if there were more inputs/outputs per cell, additional 
  *   intermediate buffers are needed as appropriate.
+ *   The channels stream each frame through their cells BLOCKLEN samples
+ *   at a time, so the intermediate buffer only holds one block.
  */
 static Sample bufInput[ NUMCHANNELS ][ FRAMELEN ];
 static Sample bufOutput[ NUMCHANNELS ][ FRAMELEN ];
-static Sample bufIntermediate[ FRAMELEN ];
+static Sample bufIntermediate[ BLOCKLEN ];
 
 /*
  *  Thread process object which encapsulates the state information 
@@ -127,6 +137,7 @@ static Void setParamsAndStartChannels( Bool doChannelOpen );
 Void thrProcessInit()
 {
     Int i;
+    SCOM_Attrs  scomAttrs;
     SCOM_Handle scomReceiveFromRx;
     SCOM_Handle scomReceiveFromTx;
 
@@ -137,9 +148,15 @@ Void thrProcessInit()
     }
     thrProcess.bufIntermediate = bufIntermediate;
 
-    /* create named SCOM queues for receiving messages from other tasks */
-    scomReceiveFromRx = SCOM_create( "scomToProcessFromRx", NULL );
-    scomReceiveFromTx = SCOM_create( "scomToProcessFromTx", NULL );
+    /* 
+     *  create named SCOM queues for receiving messages from other tasks.
+     *  scomToProcessFromTx has two writers, this task and TxJoin, but this
+     *  task only puts the first message, before TxJoin has any to put.
+     */
+    scomAttrs          = SCOM_ATTRS;
+    scomAttrs.ringSize = SCOMRINGSIZE;
+    scomReceiveFromRx = SCOM_create( "scomToProcessFromRx", &scomAttrs );
+    scomReceiveFromTx = SCOM_create( "scomToProcessFromTx", &scomAttrs );
     UTL_assert( scomReceiveFromRx != NULL );
     UTL_assert( scomReceiveFromTx != NULL );    
     
@@ -171,7 +188,9 @@ Void thrProcessStartup()
  *  startup (with TRUE). Both times it has to create cell parameters
  *  and keep it on the stack -- but the first time it registers the cells,
  *  whereas the second time it opens the channel, which causes the XDAIS
- *  algorithms in the cells to be created.
+ *  algorithms in the cells to be created. Only the first NUMINITCHANNELS
+ *  channels are opened; the others are registered, so that the scratch
+ *  memory is sized for them, and opened if the Control thread adds them.
  */
 static Void setParamsAndStartChannels( Bool doChannelOpen ) 
 {
@@ -208,7 +227,8 @@ static Void setParamsAndStartChannels( Bool doChannelOpen )
              *  cell 0 - FIR: create an input linear ICC buffer that points to
              *  bufInput[ <channel number> ], and an output linear ICC buffer
              *  that points to the intermediate buffer, bufIntermediate;
-             *  the cell will always look for data in those buffers.
+             *  the cell will always look for data in those buffers. The
+             *  intermediate buffer holds one block of the frame.
              */
             cell = &thrProcess.cellList[ (chanNum * NUMCELLS) + CELLFIR ];
             *cell                = defaultCell;
@@ -225,7 +245,7 @@ static Void setParamsAndStartChannels( Bool doChannelOpen )
 
             outputIcc = (ICC_Handle)ICC_linearCreate( 
                                                 thrProcess.bufIntermediate,
-                                                FRAMELEN * sizeof( Sample ) );
+                                                BLOCKLEN * sizeof( Sample ) );
             UTL_assert( outputIcc != NULL);
 
             // Only one input and one output ICC are needed.
@@ -255,39 +275,87 @@ static Void setParamsAndStartChannels( Bool doChannelOpen )
             // Only one input and one output ICC are needed.
             rc = CHAN_regCell( cell, &inputIcc, 1, &outputIcc, 1 );
         }
+        else if (chanNum < NUMINITCHANNELS) {
+            rc = thrProcessOpenChannel( chanNum );
+            thrProcess.active[ chanNum ] = TRUE;
+        }
         else {
-
-            /*
-             *  Since firParams and volParams are local variables, they need to
-             *  be set-up again for proper creation of the algorithms.
-             */ 
-            thrProcess.cellList[ (chanNum * NUMCELLS) + CELLFIR ].algParams = 
-                (IALG_Params *)&firParams;
-            thrProcess.cellList[ (chanNum * NUMCELLS) + CELLVOL ].algParams = 
-                (IALG_Params *)&volParams;
-
-            UTL_logDebug1("Channel Number: %d", chanNum);
-
-            // open the channel: this causes the algorithms to be created
-            rc = CHAN_open( &thrProcess.chanList[ chanNum ], 
-                            &thrProcess.cellList[ chanNum * NUMCELLS ], 
-                            NUMCELLS,
-                            NULL );
+            // the Control thread opens the channel if it is added later
+            rc = TRUE;
         }
         UTL_assert( rc == TRUE );
     }
 }
 
+/*
+ *  ======== thrProcessOpenChannel ========
+ *
+ *  Opens channel chanNum, which creates its algorithms. Called at startup
+ *  for the initial channels, and by the Control thread, in its own 
+ *  context, for a channel added while this thread runs; the channel is
+ *  executed only once this thread has processed the MSGADDCHAN message.
+ *  The algorithms must not write scratch memory in algInit(), which
+ *  another channel may be using: FIR_TI and VOL_TI do not.
+ */
+Bool thrProcessOpenChannel( Int chanNum )
+{
+    IFIR_Params firParams;
+    IVOL_Params volParams;    
+    CHAN_Attrs  chanAttrs;
+
+    /*
+     *  Since firParams and volParams are local variables, they need to
+     *  be set-up again for proper creation of the algorithms.
+     */ 
+    firParams           = IFIR_PARAMS;
+    firParams.coeffPtr  = filterCoeffLowPass;
+    firParams.filterLen = NUMFIRTAPS;
+    firParams.frameLen  = FRAMELEN;
+
+    volParams           = IVOL_PARAMS;
+    volParams.frameSize = FRAMELEN;        
+
+    thrProcess.cellList[ (chanNum * NUMCELLS) + CELLFIR ].algParams = 
+        (IALG_Params *)&firParams;
+    thrProcess.cellList[ (chanNum * NUMCELLS) + CELLVOL ].algParams = 
+        (IALG_Params *)&volParams;
+
+    UTL_logDebug1("Channel Number: %d", chanNum);
+
+    // stream FIR and VOL over one block of the frame at a time
+    chanAttrs           = CHAN_ATTRS;
+    chanAttrs.blockSize = BLOCKLEN * sizeof( Sample );
+
+    // open the channel: this causes the algorithms to be created
+    return CHAN_open( &thrProcess.chanList[ chanNum ], 
+                      &thrProcess.cellList[ chanNum * NUMCELLS ], 
+                      NUMCELLS,
+                      &chanAttrs );
+}
+
+/*
+ *  ======== thrProcessCloseChannel ========
+ *
+ *  Closes channel chanNum, which deletes its algorithms. Called by the
+ *  Control thread once this thread has acknowledged the MSGREMOVECHAN 
+ *  message, and so no longer executes the channel.
+ */
+Bool thrProcessCloseChannel( Int chanNum )
+{
+    return CHAN_close( &thrProcess.chanList[ chanNum ] );
+}
+
 
 /*
  *  ======== checkMsg ========
  *
  *  Checks if there are any messages for the process and acts on them.
- *  Called from the thread's run() function.
+ *  Called from the thread's run() function, between frames.
  */
-static Void checkMsg()
+static Void checkMsg( SCOM_Handle scomSendToControl )
 {
     CtrlMsg rxMsg;
+    Bool rc;
 
     while( MBX_pend( mbxProcess, &rxMsg, 0) ) {
         Int chanNum;
@@ -298,10 +366,18 @@ static Void checkMsg()
          *  1. volume change message: { MSGNEWVOL,   channel #, volume value },
          *  2. filter change message: { MSGNEWCOEFF, channel #, filter type}
          *     where filter type is 0: low pass, 1: high pass, 2: passthrough.
+         *  3. channel add message: { MSGADDCHAN, channel #, 0 },
+         *  4. channel remove message: { MSGREMOVECHAN, channel #, 0 }.
          */
         chanNum = rxMsg.arg1;
         UTL_assert( (chanNum >= 0) && (chanNum < NUMCHANNELS) );
 
+        // a channel that is not active may have no algorithms to control
+        if ((thrProcess.active[ chanNum ] == FALSE) && 
+            (rxMsg.cmd != MSGADDCHAN)) {
+            continue;
+        }
+
         switch (rxMsg.cmd) {        
             case MSGNEWVOL:
                 {
@@ -315,6 +391,7 @@ static Void checkMsg()
                      *  get current contents of the control structure 
                      *  to avoid overriding non-modified ones 
                      */
+                    volStatus.size = sizeof( volStatus );
                     VOL_cellControl( hCell, IVOL_GETSTATUS, 
                                      (IALG_Status *)&volStatus );
                     volStatus.gainPercentage = rxMsg.arg2; 
@@ -348,6 +425,29 @@ static Void checkMsg()
                 }
                 break;
 
+            case MSGADDCHAN:
+                // the Control thread has opened the channel
+                thrProcess.active[ chanNum ] = TRUE;
+                UTL_logDebug1("Adding channel %d", chanNum);
+                break;
+
+            case MSGREMOVECHAN:
+                thrProcess.active[ chanNum ] = FALSE;
+
+                // the scratch bucket must not be left to a removed algorithm
+                hCell = &thrProcess.cellList[CELLFIR + chanNum * NUMCELLS];
+                ALGRF_deactivateLazy( hCell->algHandle, hCell->scrBucketIndex );
+                hCell = &thrProcess.cellList[CELLVOL + chanNum * NUMCELLS];
+                ALGRF_deactivateLazy( hCell->algHandle, hCell->scrBucketIndex );
+                UTL_logDebug1("Removing channel %d", chanNum);
+
+                // acknowledge, so that the Control thread closes the channel
+                thrProcess.scomMsgClosed[ chanNum ].chanNum = chanNum;
+                rc = SCOM_putMsg( scomSendToControl, 
+                                  &thrProcess.scomMsgClosed[ chanNum ] );
+                UTL_assert( rc == TRUE );
+                break;
+
             default:
                 break;
         }
@@ -370,11 +470,13 @@ Void thrProcessRun()
     SCOM_Handle scomReceiveFromTx = SCOM_open( "scomToProcessFromTx");
     SCOM_Handle scomSendToRx      = SCOM_open( "scomRxSplit" );
     SCOM_Handle scomSendToTx      = SCOM_open( "scomTxJoin"  );
+    SCOM_Handle scomSendToControl = SCOM_open( "scomControl" );
 
     UTL_assert( scomReceiveFromRx != NULL );
     UTL_assert( scomReceiveFromTx != NULL );
     UTL_assert( scomSendToRx      != NULL );
     UTL_assert( scomSendToTx      != NULL );
+    UTL_assert( scomSendToControl != NULL );
 
     // Fill in the SCOM messages
     for (i = 0; i < NUMCHANNELS; i++) {
@@ -383,17 +485,19 @@ Void thrProcessRun()
     }
 
     // put the Rx message on the SCOM queue for RxSplit thread
-    SCOM_putMsg( scomSendToRx, &(thrProcess.scomMsgRx) );
+    rc = SCOM_putMsg( scomSendToRx, &(thrProcess.scomMsgRx) );
+    UTL_assert( rc == TRUE );
 
     // put the Tx message on the queue to yourself, i.e. from TxJoin thread
-    SCOM_putMsg( scomReceiveFromTx, &(thrProcess.scomMsgTx) );
+    rc = SCOM_putMsg( scomReceiveFromTx, &(thrProcess.scomMsgTx) );
+    UTL_assert( rc == TRUE );
 
     // Main loop
     while (TRUE) {
         ScomBufChannels *scomMsgRx, *scomMsgTx;
 
         // check for control (MBX) messages (not to be confused with SCOM msgs)
-        checkMsg();
+        checkMsg( scomSendToControl );
 
         // get the message describing full input buffers from Rx
         scomMsgRx = (ScomBufChannels *)SCOM_getMsg( scomReceiveFromRx, 
@@ -411,6 +515,13 @@ Void thrProcessRun()
 
             CHAN_Handle chanHandle = &thrProcess.chanList[ chanNum ];
 
+            // a channel that is not active outputs silence
+            if (thrProcess.active[ chanNum ] == FALSE) {
+                memset( scomMsgTx->bufChannel[chanNum], 0,
+                    FRAMELEN * sizeof( Sample ) );
+                continue;
+            }
+
             // Set the input ICC buffer for FIR cell for each channel
             ICC_setBuf(chanHandle->cellSet[CELLFIR].inputIcc[0],
                        scomMsgRx->bufChannel[chanNum], 
@@ -429,10 +540,12 @@ Void thrProcessRun()
         }
         
         // send the message describing full output buffers to Tx
-        SCOM_putMsg( scomSendToTx, scomMsgTx );
+        rc = SCOM_putMsg( scomSendToTx, scomMsgTx );
+        UTL_assert( rc == TRUE );
         
         // send the message describing consumed input buffers to Rx
-        SCOM_putMsg( scomSendToRx, scomMsgRx );
+        rc = SCOM_putMsg( scomSendToRx, scomMsgRx );
+        UTL_assert( rc == TRUE );
     }
 }
 
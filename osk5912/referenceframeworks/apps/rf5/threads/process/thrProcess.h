@@ -32,12 +32,25 @@ enum { CELLFIR  = 0,
        NUMCELLS 
 };            
 
-// Types of messages from the control thread accepted by this thread.
+/*
+ *  Types of messages from the control thread accepted by this thread.
+ *  MSGADDCHAN and MSGREMOVECHAN carry { channel #, 0 }: the control thread
+ *  opens a channel before adding it, and closes it when this thread
+ *  acknowledges its removal on the "scomControl" SCOM queue.
+ */
 enum {
     MSGNEWVOL = 0,
-    MSGNEWCOEFF
+    MSGNEWCOEFF,
+    MSGADDCHAN,
+    MSGREMOVECHAN
 };
 
+/* 
+ *  Samples streamed through the FIR and VOL cells at a time. Kept well 
+ *  above the filter length so most FIR outputs come from the block itself.
+ */
+#define BLOCKLEN 40
+
 // Set the length of the mailbox for control messages
 #define THRPROCESS_MBXLENGTH 5
  
@@ -50,6 +63,8 @@ typedef struct ThrProcess {
     Sample          *bufIntermediate;
     ScomBufChannels  scomMsgRx;
     ScomBufChannels  scomMsgTx;
+    Bool             active[ NUMCHANNELS ];        // channels executed
+    ScomChanClosed   scomMsgClosed[ NUMCHANNELS ]; // removal acknowledgements
 } ThrProcess; 
 
 /* mailbox for control messages */
@@ -60,6 +75,10 @@ extern Void thrProcessInit( Void );
 extern Void thrProcessStartup( Void );
 extern Void thrProcessRun( Void );
 
+// called by the Control thread to add and remove channels at run time
+extern Bool thrProcessOpenChannel( Int chanNum );
+extern Bool thrProcessCloseChannel( Int chanNum );
+
 #ifdef __cplusplus
 }
 #endif // extern "C" 
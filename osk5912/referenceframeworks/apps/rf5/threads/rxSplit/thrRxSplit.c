@@ -17,6 +17,7 @@
 #include <sys.h>
 
 // RF5 module includes
+#include <ilv.h>
 #include <scom.h>
 #include <utl.h>
 
@@ -43,6 +44,7 @@ ThrRxSplit thrRxSplit;
 Void thrRxSplitInit() 
 {
     SIO_Attrs   attrs;
+    SCOM_Attrs  scomAttrs;
     SCOM_Handle scomReceive;
 
     attrs       = SIO_ATTRS;
@@ -55,7 +57,9 @@ Void thrRxSplitInit()
     UTL_assert( thrRxSplit.inStream != NULL );
 
     /* create your receiving SCOM queue */
-    scomReceive = SCOM_create( "scomRxSplit", NULL );
+    scomAttrs          = SCOM_ATTRS;
+    scomAttrs.ringSize = SCOMRINGSIZE;
+    scomReceive = SCOM_create( "scomRxSplit", &scomAttrs );
     UTL_assert( scomReceive != NULL );
 }
 
@@ -83,6 +87,7 @@ Void thrRxSplitStartup()
 Void thrRxSplitRun()
 {
     SCOM_Handle scomReceive, scomSend;    
+    Bool        rc;
 
     // open the SCOM queues (your own for receiving and another for sending)
     scomReceive = SCOM_open( "scomRxSplit"     );
@@ -94,8 +99,6 @@ Void thrRxSplitRun()
     while (TRUE) {
         ScomBufChannels *scombuf;
         Sample          *bufSrc;
-        Int              i, chanNum;
-        Int              codecChanNum = 0;
 
         // Reclaim full source buffer from the input stream
         SIO_reclaim( thrRxSplit.inStream, (Ptr *)&bufSrc, NULL );        
@@ -106,16 +109,12 @@ Void thrRxSplitRun()
         // split the input data: 
         // For stereo codec: LRLRLRLR -> LL..L,RR..R,LL..L,RR..R
         // For mono codec:   DDDD...D -> DD..D,DD..D,DD..D,DD..D
-        for (chanNum = 0; chanNum < NUMCHANNELS; chanNum++) {
-            Sample *bufDst = scombuf->bufChannel[ chanNum ];
-            for (i = 0; i < FRAMELEN; i++) {
-                bufDst[i] = bufSrc[ NUMCODECCHANS * i + codecChanNum ];
-            }
-            codecChanNum = (codecChanNum + 1) % NUMCODECCHANS;
-        }
+        ILV_split( bufSrc, NUMCODECCHANS, scombuf->bufChannel, NUMCHANNELS,
+                   FRAMELEN );
 
         // put the full buffer to the ToProc queue
-        SCOM_putMsg( scomSend, scombuf );
+        rc = SCOM_putMsg( scomSend, scombuf );
+        UTL_assert( rc == TRUE );
         
         // Issue an empty buffer to the input stream
         SIO_issue( thrRxSplit.inStream, bufSrc, 
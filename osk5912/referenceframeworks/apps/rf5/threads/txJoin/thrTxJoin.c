@@ -18,6 +18,7 @@
 #include <sys.h>
 
 // RF5 module includes
+#include <ilv.h>
 #include <scom.h>
 #include <utl.h>
 
@@ -48,6 +49,7 @@ ThrTxJoin thrTxJoin;
 Void thrTxJoinInit()
 {
     SIO_Attrs   attrs;
+    SCOM_Attrs  scomAttrs;
     SCOM_Handle scomReceive;
     Int         codecChanNum;
     
@@ -61,7 +63,9 @@ Void thrTxJoinInit()
     UTL_assert( thrTxJoin.outStream != NULL );
     
     /* create your receiving SCOM queue */
-    scomReceive = SCOM_create( "scomTxJoin", NULL );
+    scomAttrs          = SCOM_ATTRS;
+    scomAttrs.ringSize = SCOMRINGSIZE;
+    scomReceive = SCOM_create( "scomTxJoin", &scomAttrs );
     UTL_assert( scomReceive != NULL );
 
     /* Initialize which channels go to the codec */
@@ -96,6 +100,7 @@ Void thrTxJoinStartup()
 Void thrTxJoinRun()
 {
     SCOM_Handle scomReceive, scomSend;
+    Bool        rc;
 
     // open the SCOM queues (your own for receiving and another for sending)
     scomReceive = SCOM_open( "scomTxJoin"      );
@@ -106,8 +111,9 @@ Void thrTxJoinRun()
 
     while (TRUE) {
         ScomBufChannels *scombuf;
-        Sample          *bufDst, *bufSrc;        
-        Int              i, codecChanNum;
+        Sample          *bufDst;
+        Sample          *bufSrc[ NUMCODECCHANS ];
+        Int              codecChanNum;
         
         // Reclaim empty destination buffer from the output stream
         SIO_reclaim( thrTxJoin.outStream, (Ptr *)&bufDst, NULL );         
@@ -117,14 +123,14 @@ Void thrTxJoinRun()
 
         // join the input data based on the active channel(s).
         for (codecChanNum = 0; codecChanNum < NUMCODECCHANS; codecChanNum++) {
-            bufSrc = scombuf->bufChannel[ activeChannels[codecChanNum] ];
-            for (i = 0; i < FRAMELEN; i++) {
-                bufDst[ NUMCODECCHANS * i + codecChanNum ] = bufSrc[i];
-            }
+            bufSrc[ codecChanNum ] = 
+                scombuf->bufChannel[ activeChannels[codecChanNum] ];
         }
+        ILV_join( bufSrc, NUMCODECCHANS, bufDst, NUMCODECCHANS, FRAMELEN );
 
         // send back descriptors of now used up source channels to Process
-        SCOM_putMsg( scomSend, scombuf );
+        rc = SCOM_putMsg( scomSend, scombuf );
+        UTL_assert( rc == TRUE );
         
         // issue full destination buffer to the output stream
         SIO_issue( thrTxJoin.outStream, bufDst, 
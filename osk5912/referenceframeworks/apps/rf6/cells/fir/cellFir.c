@@ -16,6 +16,9 @@
 
 #include "cellFir.h"
 
+// maximum number of cells passed to the algorithm in one batch
+#define FIR_CELLMAXBATCH    8
+
 // v-table for this cell
 ICELL_Fxns FIR_CELLFXNS = { 
     NULL,            // cellClose
@@ -33,15 +36,74 @@ Bool FIR_cellExecute( ICELL_Handle handle, Arg arg )
     IFIR_Fxns  *firFxns   = (IFIR_Fxns *)handle->algFxns;
     IFIR_Handle firHandle = (IFIR_Handle)handle->algHandle;
 
-    // activate instance object
-    ALGRF_activate( handle->algHandle );
+    // activate instance object, unless it is still active from last frame
+    ALGRF_activateLazy( handle->algHandle, handle->scrBucketIndex );
     
     firFxns->filter( firHandle,
                      (Short *)handle->inputIcc[0]->buffer,
                      (Short *)handle->outputIcc[0]->buffer );
         
-    // deactivate instance object
-    ALGRF_deactivate( handle->algHandle );
+    // the instance is left active until another algorithm needs the scratch
+
+    return ( TRUE );
+}
+
+/*
+ *  ======== FIR_cellExecuteBatch ========
+ *
+ *  Executes the cellCnt FIR cells of cellList, one per channel, in as few 
+ *  calls to the algorithm as possible; the caller lists only the channels
+ *  it runs. The instances are not activated: filterMulti() works on their
+ *  persistent state, so no scratch memory is touched. Falls back to 
+ *  executing each cell in turn if the algorithm has no multi-channel 
+ *  filter.
+ */
+Bool FIR_cellExecuteBatch( ICELL_Handle cellList[], Uns cellCnt )
+{
+    IFIR_Fxns  *firFxns;
+    IFIR_Handle handles[ FIR_CELLMAXBATCH ];
+    Short      *in[ FIR_CELLMAXBATCH ];
+    Short      *out[ FIR_CELLMAXBATCH ];
+    Uns         start;
+    Uns         n;
+    Uns         i;
+
+    if (cellCnt == 0) {
+        return ( TRUE );
+    }
+    firFxns = (IFIR_Fxns *)cellList[0]->algFxns;
+
+    for (start = 0; start < cellCnt; start += n) {
+    
+        // gather the cells that share the algorithm implementation
+        for (n = 0; (n < FIR_CELLMAXBATCH) && (start + n < cellCnt) &&
+            (cellList[start + n]->algFxns == (IALG_Fxns *)firFxns); n++) {
+            handles[n] = (IFIR_Handle)cellList[start + n]->algHandle;
+            in[n]      = (Short *)cellList[start + n]->inputIcc[0]->buffer;
+            out[n]     = (Short *)cellList[start + n]->outputIcc[0]->buffer;
+        }
+        
+        if (firFxns->filterMulti != NULL) {
+        
+            // bring the persistent state up to date if left active
+            for (i = 0; i < n; i++) {
+                ALGRF_deactivateLazy( cellList[start + i]->algHandle,
+                                      cellList[start + i]->scrBucketIndex );
+            }
+            firFxns->filterMulti( handles, in, out, n );
+        }
+        else {
+            for (n = 0; (n < FIR_CELLMAXBATCH) && (start + n < cellCnt) &&
+                (cellList[start + n]->algFxns == (IALG_Fxns *)firFxns); n++) {
+                FIR_cellExecute( cellList[start + n], NULL );
+            }
+        }
+        
+        // the next cell uses another implementation
+        if (start + n < cellCnt) {
+            firFxns = (IFIR_Fxns *)cellList[start + n]->algFxns;
+        }
+    }
 
     return ( TRUE );
 }
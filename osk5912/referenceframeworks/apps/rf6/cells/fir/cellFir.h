@@ -34,6 +34,7 @@ extern IFIR_Fxns FIR_IFIR;
  */
 Int  FIR_cellControl( ICELL_Handle handle, IALG_Cmd cmd, IALG_Status *status);
 Bool FIR_cellExecute( ICELL_Handle handle, Arg arg );
+Bool FIR_cellExecuteBatch( ICELL_Handle cellList[], Uns cellCnt );
 
 #ifdef __cplusplus
 }
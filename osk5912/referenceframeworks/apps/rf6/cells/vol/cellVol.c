@@ -34,15 +34,14 @@ Bool VOL_cellExecute( ICELL_Handle handle, Arg arg )
     IVOL_Fxns  *volFxns   = (IVOL_Fxns *)handle->algFxns;
     IVOL_Handle volHandle = (IVOL_Handle)handle->algHandle;
     
-    // activate instance object
-    ALGRF_activate( handle->algHandle );
+    // activate instance object, unless it is still active from last frame
+    ALGRF_activateLazy( handle->algHandle, handle->scrBucketIndex );
     
     volFxns->amplify( volHandle,
                      (XDAS_Int16 *)handle->inputIcc[0]->buffer,
                      (XDAS_Int16 *)handle->outputIcc[0]->buffer );
         
-    // deactivate instance object
-    ALGRF_deactivate( handle->algHandle );
+    // the instance is left active until another algorithm needs the scratch
     
     return ( TRUE );
 }
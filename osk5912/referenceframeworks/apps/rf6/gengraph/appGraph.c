@@ -0,0 +1,97 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== appGraph.c ========
+ *
+ *  Description of the RF6 application's channels for the gengraph 
+ *  pre-program: the same cells, ICCs and scratch buckets that 
+ *  setParamsAndStartChannels() builds at run time in threads Process0 
+ *  and Process1. This file is linked both in gengraph and, with the file
+ *  gengraph generates, in the application, so that the algorithms are
+ *  created with the parameters they were sized for.
+ */
+
+#include <std.h>
+
+#include "appThreads.h"     // NUMCHANNELS, FRAMELEN, scratch buckets
+#include "gengraph.h"
+#include "appGraph.h"
+
+#if NUMCHANNELS != 2
+#error appGraph.c describes two channels per thread
+#endif
+
+// number of filter taps, as in thrProcess0.c
+#define NUMFIRTAPS  32
+
+IFIR_Params appGraphFirParams = {
+    sizeof(IFIR_Params),
+    NULL,               // coeffPtr: set by the application
+    NUMFIRTAPS,         // filterLen
+    FRAMELEN            // frameLen
+};
+
+IVOL_Params appGraphVolParams = {
+    sizeof(IVOL_Params),
+    FRAMELEN,           // frameSize
+    100,                // gainPercentage
+    IVOL_RAMPLINEAR     // rampMode
+};
+
+GRAPH_Icc GRAPH_iccs[APPGRAPH_NUMICCS] = {
+    GRAPH_ICC( p0In0,  0 ),
+    GRAPH_ICC( p0In1,  0 ),
+    GRAPH_ICC( p0Mid0, FRAMELEN * sizeof( Sample ) ),
+    GRAPH_ICC( p0Mid1, FRAMELEN * sizeof( Sample ) ),
+    GRAPH_ICC( p0Out0, 0 ),
+    GRAPH_ICC( p0Out1, 0 ),
+    GRAPH_ICC( p1In0,  0 ),
+    GRAPH_ICC( p1In1,  0 ),
+    GRAPH_ICC( p1Out0, 0 ),
+    GRAPH_ICC( p1Out1, 0 )
+};
+Uns GRAPH_iccCnt = APPGRAPH_NUMICCS;
+
+// Process0: the FIR cells of all channels run as a batch in one channel
+static GRAPH_Cell process0Fir[] = {
+    GRAPH_CELL( "FIR", FIR_CELLFXNS, FIR_IFIR, appGraphFirParams, 
+        THRPROCESS0SCRBUCKET, APPGRAPH_P0IN0, APPGRAPH_P0MID0 ),
+    GRAPH_CELL( "FIR", FIR_CELLFXNS, FIR_IFIR, appGraphFirParams, 
+        THRPROCESS0SCRBUCKET, APPGRAPH_P0IN1, APPGRAPH_P0MID1 )
+};
+
+// Process0: then each channel's VOL cell in its own channel
+static GRAPH_Cell process0Vol0[] = {
+    GRAPH_CELL( "VOL", VOL_CELLFXNS, VOL_IVOL, appGraphVolParams, 
+        THRPROCESS0SCRBUCKET, APPGRAPH_P0MID0, APPGRAPH_P0OUT0 )
+};
+static GRAPH_Cell process0Vol1[] = {
+    GRAPH_CELL( "VOL", VOL_CELLFXNS, VOL_IVOL, appGraphVolParams, 
+        THRPROCESS0SCRBUCKET, APPGRAPH_P0MID1, APPGRAPH_P0OUT1 )
+};
+
+// Process1: one VOL cell per channel
+static GRAPH_Cell process1Vol0[] = {
+    GRAPH_CELL( "VOL", VOL_CELLFXNS, VOL_IVOL, appGraphVolParams, 
+        THRPROCESS1SCRBUCKET, APPGRAPH_P1IN0, APPGRAPH_P1OUT0 )
+};
+static GRAPH_Cell process1Vol1[] = {
+    GRAPH_CELL( "VOL", VOL_CELLFXNS, VOL_IVOL, appGraphVolParams, 
+        THRPROCESS1SCRBUCKET, APPGRAPH_P1IN1, APPGRAPH_P1OUT1 )
+};
+
+GRAPH_Chan GRAPH_chans[] = {
+    GRAPH_CHAN( process0Fir,  process0Fir ),
+    GRAPH_CHAN( process0Vol0, process0Vol0 ),
+    GRAPH_CHAN( process0Vol1, process0Vol1 ),
+    GRAPH_CHAN( process1Vol0, process1Vol0 ),
+    GRAPH_CHAN( process1Vol1, process1Vol1 )
+};
+Uns GRAPH_chanCnt = sizeof( GRAPH_chans ) / sizeof( GRAPH_Chan );
+
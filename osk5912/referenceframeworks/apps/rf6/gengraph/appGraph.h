@@ -0,0 +1,68 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== appGraph.h ========
+ *
+ *  The RF6 application's graph of channels (see appGraph.c), and the 
+ *  objects gengraph generates for it in appGraphStatic.c.
+ */
+#ifndef APPGRAPH_
+#define APPGRAPH_
+
+#include <chan.h>
+#include <icell.h>
+
+#include "fir/cellFir.h"
+#include "vol/cellVol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 
+ *  Parameters of the graph's algorithms. The FIR coefficients do not
+ *  change algAlloc(), so coeffPtr is NULL in the graph: the application
+ *  sets it before opening the channels.
+ */
+extern IFIR_Params appGraphFirParams;
+extern IVOL_Params appGraphVolParams;
+
+/* Indexes of the ICCs in GRAPH_iccs[] */
+enum {
+    APPGRAPH_P0IN0 = 0,     // Process0 input, set to the message buffers
+    APPGRAPH_P0IN1,
+    APPGRAPH_P0MID0,        // Process0 FIR output, VOL input
+    APPGRAPH_P0MID1,
+    APPGRAPH_P0OUT0,        // Process0 output, set to the message buffers
+    APPGRAPH_P0OUT1,
+    APPGRAPH_P1IN0,         // Process1 input, set to the message buffers
+    APPGRAPH_P1IN1,
+    APPGRAPH_P1OUT0,        // Process1 output, set to the message buffers
+    APPGRAPH_P1OUT1,
+    APPGRAPH_NUMICCS
+};
+
+/* Generated by gengraph in appGraphStatic.c */
+extern ICELL_Obj    process0FirCells[];     // FIR cells of all channels
+extern CHAN_CellMem process0FirCellMem[];
+extern ICELL_Obj    process0Vol0Cells[];
+extern CHAN_CellMem process0Vol0CellMem[];
+extern ICELL_Obj    process0Vol1Cells[];
+extern CHAN_CellMem process0Vol1CellMem[];
+extern ICELL_Obj    process1Vol0Cells[];
+extern CHAN_CellMem process1Vol0CellMem[];
+extern ICELL_Obj    process1Vol1Cells[];
+extern CHAN_CellMem process1Vol1CellMem[];
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif  /* APPGRAPH_ */
+
@@ -0,0 +1,427 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== gengraph.c ========
+ *  
+ *  Generates the static objects of a graph of RF channels: the linear 
+ *  ICCs and their buffers, the cells, and the memory of each cell's 
+ *  XDAIS algorithm, with the size and alignment its algAlloc() requests.
+ *
+ *  Like genbufs (apps/rf1/genbufs), this is a pre-program: it runs on the
+ *  target, so that algAlloc() reports target sizes, and writes a C source
+ *  file to a LOG buffer which CCS saves to a file. The graph is described 
+ *  in appGraph.c. With the generated file, the application opens its 
+ *  channels with CHAN_openStatic() and no heap is used for them. The file
+ *  ends with the memory used in each memory space.
+ *
+ *  LOG_printf() takes at most two arguments, and each call makes one line
+ *  of the file, so the buffers are simply numbered gengraphMem<n>.
+ */
+
+#include <std.h>
+#include <log.h>
+
+#include <ialg.h>
+#include <algmin.h>
+
+#include <stdlib.h>                 // to support exit() function
+
+#include "gengraph.h"
+
+#define MAXBUCKETS          8       // shared scratch buckets supported
+
+/* Memory spaces, and the persistent memory generated in each */
+typedef struct Space {
+    IALG_MemSpace   space;
+    String          name;
+    LgUns           total;
+} Space;
+
+static Space spaces[] = {
+    {IALG_DARAM0,   "DARAM0",   0},
+    {IALG_DARAM1,   "DARAM1",   0},
+    {IALG_SARAM,    "SARAM",    0},     /* IALG_SARAM0 same as IALG_SARAM */
+    {IALG_SARAM1,   "SARAM1",   0},
+    {IALG_DARAM2,   "DARAM2",   0},
+    {IALG_SARAM2,   "SARAM2",   0},
+    {IALG_ESDATA,   "ESDATA",   0},
+    {IALG_EXTERNAL, "EXTERNAL", 0}      /* also used for any other space */
+};
+
+#define NUMSPACES           (sizeof(spaces) / sizeof(Space))
+
+/* Size and alignment of each shared scratch bucket */
+static Uns bucketSize[MAXBUCKETS];
+static Uns bucketAlign[MAXBUCKETS];
+
+static LgUns iccTotal = 0;
+
+/* Number of the next algorithm buffer declared, or listed */
+static Int memId;
+
+/* local function prototypes */
+static Void genAlgMem(Int cellId, GRAPH_Cell *cell, Bool doBufs);
+static Void genBuckets(Void);
+static Void genCells(Int firstCellId, GRAPH_Chan *chan);
+static Void genIccs(Void);
+static Void genReport(Void);
+static Bool isScratch(Int i);
+static Int memTabCreate(IALG_Fxns *fxns, IALG_Params *params);
+static Space *spaceOf(IALG_MemSpace space);
+
+/* data references and definitions */
+extern LOG_Obj  GRAPH_srcTrace;
+
+IALG_MemRec memTab[ALGMIN_MAXMEMRECS]; /* XDAIS Mem Tab structure declaration */
+
+/*
+ *  ======== main ========
+ */
+Void main()
+{
+    Int chan, i;
+    Int cellId;
+    
+    /* generate comments for the output C source program */
+    LOG_printf(&GRAPH_srcTrace, "/* \
+\n * This file is generated by the gengraph pre-program from appGraph.c. \
+\n * It creates the ICCs, cells and algorithm memory of the channels, to \
+\n * be opened with CHAN_openStatic(). Do not edit: regenerate instead. \
+\n */ \n");
+
+    LOG_printf(&GRAPH_srcTrace, "#include <std.h>");
+    LOG_printf(&GRAPH_srcTrace, "#include <chan.h>");
+    LOG_printf(&GRAPH_srcTrace, "#include <icc_linear.h>");
+    LOG_printf(&GRAPH_srcTrace, "#include \"appGraph.h\"" "\n");
+
+    genIccs();
+
+    /* persistent memory of every algorithm, and the scratch bucket sizes */
+    LOG_printf(&GRAPH_srcTrace, "/* Algorithm memory */");
+    cellId = 0;
+    memId  = 0;
+    for (chan = 0; chan < GRAPH_chanCnt; chan++) {
+        for (i = 0; i < GRAPH_chans[chan].cellCnt; i++) {
+            genAlgMem(cellId++, &GRAPH_chans[chan].cells[i], TRUE);
+        }
+    }
+
+    genBuckets();
+
+    /* the cells, now that all the memory they point to is declared */
+    cellId = 0;
+    memId  = 0;
+    for (chan = 0; chan < GRAPH_chanCnt; chan++) {
+        genCells(cellId, &GRAPH_chans[chan]);
+        cellId += GRAPH_chans[chan].cellCnt;
+    }
+
+    genReport();
+
+    /* 
+     *  Normal procedure is to call return; at end of main and fall into the 
+     *  DSP/BIOS IDL loop. However, we want to terminate the pre-program here
+     *  hence we simply call exit with a normal status code.
+     */
+    exit(0);
+}
+
+/*
+ *  ======== genIccs ========
+ *  Declares the linear ICC objects, and the buffers of those that have one.
+ */
+static Void genIccs(Void)
+{
+    Int i;
+
+    LOG_printf(&GRAPH_srcTrace, "/* ICC buffers and objects */");
+
+    for (i = 0; i < GRAPH_iccCnt; i++) {
+
+        if (GRAPH_iccs[i].nmaus != 0) {
+            LOG_printf(&GRAPH_srcTrace, "#pragma DATA_SECTION(%sBuf, " 
+                "\".bss:ICC\")", GRAPH_iccs[i].name);
+            LOG_printf(&GRAPH_srcTrace, "#pragma DATA_ALIGN(%sBuf, %d)",
+                GRAPH_iccs[i].name, GRAPH_ICCALIGN);
+            LOG_printf(&GRAPH_srcTrace, "Char %sBuf[%d];", 
+                GRAPH_iccs[i].name, GRAPH_iccs[i].nmaus);
+            LOG_printf(&GRAPH_srcTrace, "ICC_LinearObj %sIcc =", 
+                GRAPH_iccs[i].name);
+            LOG_printf(&GRAPH_srcTrace, "    ICC_LINEARSTATIC(%sBuf, %d);", 
+                GRAPH_iccs[i].name, GRAPH_iccs[i].nmaus);
+
+            iccTotal += GRAPH_iccs[i].nmaus;
+        }
+        else {
+            LOG_printf(&GRAPH_srcTrace, "ICC_LinearObj %sIcc =", 
+                GRAPH_iccs[i].name);
+            LOG_printf(&GRAPH_srcTrace, "    ICC_LINEARSTATIC(NULL, 0);");
+        }
+    }
+    LOG_printf(&GRAPH_srcTrace, "\n");
+}
+
+/*
+ *  ======== genAlgMem ========
+ *  With doBufs TRUE, declares the persistent (and off-chip) memory of the 
+ *  cell's algorithm and sizes its scratch bucket; with doBufs FALSE, 
+ *  declares the list of the algorithm's memory bases for CHAN_CellMem.
+ *  Scratch records are laid out in the bucket the way SSCR and 
+ *  ALGRF_createScratchSupport() do: each at the next address with its 
+ *  alignment, from the start of the bucket. Both passes must visit the
+ *  cells in the same order, so that they number the buffers alike.
+ */
+static Void genAlgMem(Int cellId, GRAPH_Cell *cell, Bool doBufs)
+{
+    Int numRecs;
+    Int i;
+    Uns align;
+    Uns offset = 0;
+    Space *space;
+
+    numRecs = memTabCreate(cell->algFxns, cell->algParams);
+
+    if (numRecs == IALG_EFAIL || cell->scrBucket >= MAXBUCKETS) {
+        /* Fail. Error flagged will prevent end-application compilation */
+        LOG_printf(&GRAPH_srcTrace, "#error : cannot create the memory of "
+            "cell %d (%s)", cellId, cell->name);
+        return;
+    }
+
+    if (doBufs == TRUE) {
+        LOG_printf(&GRAPH_srcTrace, "/* cell %d: %s */", cellId, cell->name);
+    }
+    else {
+        LOG_printf(&GRAPH_srcTrace, "static Char *gengraphCell%dMem[] = {", 
+            cellId);
+    }
+
+    for (i = 0; i < numRecs; i++) {
+
+        if (memTab[i].size == 0) {
+            if (doBufs == FALSE) {
+                LOG_printf(&GRAPH_srcTrace, "    NULL,");
+            }
+        }
+        else if (isScratch(i)) {
+
+            /* alignment of 0 means no alignment; must be a power of 2 */
+            align  = (memTab[i].alignment == 0) ? 1 : memTab[i].alignment;
+            offset = (offset + (align - 1)) & (~(align - 1));
+
+            if (doBufs == FALSE) {
+                LOG_printf(&GRAPH_srcTrace, "    gengraphScrBucket%d + %d,",
+                    cell->scrBucket, offset);
+            }
+            offset += memTab[i].size;
+
+            if (align > bucketAlign[cell->scrBucket]) {
+                bucketAlign[cell->scrBucket] = align;
+            }
+        }
+        else if (doBufs == TRUE) {
+
+            space = spaceOf(memTab[i].space);
+            space->total += memTab[i].size;
+
+            LOG_printf(&GRAPH_srcTrace, "#pragma DATA_SECTION"
+                "(gengraphMem%d, \".bss:%s\")", memId, space->name);
+            if (memTab[i].alignment > 1) {
+                LOG_printf(&GRAPH_srcTrace, "#pragma DATA_ALIGN"
+                    "(gengraphMem%d, %d)", memId, memTab[i].alignment);
+            }
+
+            /* memTab[0] is the instance object, which must start zeroed */
+            if (i == 0) {
+                LOG_printf(&GRAPH_srcTrace, "Char gengraphMem%d[%d] = {0};", 
+                    memId++, memTab[i].size);
+            }
+            else {
+                LOG_printf(&GRAPH_srcTrace, "Char gengraphMem%d[%d];", 
+                    memId++, memTab[i].size);
+            }
+        }
+        else {
+            LOG_printf(&GRAPH_srcTrace, "    gengraphMem%d,", memId++);
+        }
+    }
+
+    if (doBufs == TRUE) {
+        if (offset > bucketSize[cell->scrBucket]) {
+            bucketSize[cell->scrBucket] = offset;
+        }
+    }
+    else {
+        LOG_printf(&GRAPH_srcTrace, "};");
+    }
+}
+
+/*
+ *  ======== genBuckets ========
+ *  Declares the shared scratch buckets, each sized for the largest
+ *  scratch layout of the algorithms in it.
+ */
+static Void genBuckets(Void)
+{
+    Int i;
+
+    LOG_printf(&GRAPH_srcTrace, "\n" "/* Shared scratch buckets */");
+
+    for (i = 0; i < MAXBUCKETS; i++) {
+        if (bucketSize[i] != 0) {
+            LOG_printf(&GRAPH_srcTrace, "#pragma DATA_SECTION"
+                "(gengraphScrBucket%d, \".bss:scratch\")", i);
+            LOG_printf(&GRAPH_srcTrace, "#pragma DATA_ALIGN"
+                "(gengraphScrBucket%d, %d)", i, bucketAlign[i]);
+            LOG_printf(&GRAPH_srcTrace, "Char gengraphScrBucket%d[%d];", 
+                i, bucketSize[i]);
+        }
+    }
+    LOG_printf(&GRAPH_srcTrace, "\n");
+}
+
+/*
+ *  ======== genCells ========
+ *  Declares the ICC arrays and memory lists of the channel's cells, then
+ *  the channel's cellSet, <chan>Cells[], and its <chan>CellMem[].
+ */
+static Void genCells(Int firstCellId, GRAPH_Chan *chan)
+{
+    Int i;
+    Int cellId;
+    GRAPH_Cell *cell;
+
+    LOG_printf(&GRAPH_srcTrace, "/* Channel %s */", chan->name);
+
+    for (i = 0; i < chan->cellCnt; i++) {
+        cellId = firstCellId + i;
+        cell   = &chan->cells[i];
+
+        if (cell->inputIcc >= GRAPH_iccCnt || cell->outputIcc >= GRAPH_iccCnt) {
+            LOG_printf(&GRAPH_srcTrace, "#error : bad ICC in cell %d (%s)",
+                cellId, cell->name);
+            continue;
+        }
+
+        LOG_printf(&GRAPH_srcTrace, "static ICC_Handle gengraphCell%dIn[] ="
+            " {&%sIcc.obj};", cellId, GRAPH_iccs[cell->inputIcc].name);
+        LOG_printf(&GRAPH_srcTrace, "static ICC_Handle gengraphCell%dOut[] ="
+            " {&%sIcc.obj};", cellId, GRAPH_iccs[cell->outputIcc].name);
+
+        genAlgMem(cellId, cell, FALSE);
+    }
+
+    LOG_printf(&GRAPH_srcTrace, "ICELL_Obj %sCells[%d] = {", 
+        chan->name, chan->cellCnt);
+    for (i = 0; i < chan->cellCnt; i++) {
+        cellId = firstCellId + i;
+        cell   = &chan->cells[i];
+
+        LOG_printf(&GRAPH_srcTrace, "    {sizeof(ICELL_Obj), \"%s\", &%s,", 
+            cell->name, cell->cellFxns);
+        LOG_printf(&GRAPH_srcTrace, "     NULL, (IALG_Fxns *)&%s,", 
+            cell->algFxnsName);
+        LOG_printf(&GRAPH_srcTrace, "     (IALG_Params *)&%s, NULL, %d,", 
+            cell->algParamsName, cell->scrBucket);
+        LOG_printf(&GRAPH_srcTrace, "     gengraphCell%dIn, 1, "
+            "gengraphCell%dOut, 1},", cellId, cellId);
+    }
+    LOG_printf(&GRAPH_srcTrace, "};");
+
+    LOG_printf(&GRAPH_srcTrace, "CHAN_CellMem %sCellMem[%d] = {", 
+        chan->name, chan->cellCnt);
+    for (i = 0; i < chan->cellCnt; i++) {
+        cellId = firstCellId + i;
+
+        LOG_printf(&GRAPH_srcTrace, "    {gengraphCell%dMem, sizeof("
+            "gengraphCell%dMem) / sizeof(Char *)},", cellId, cellId);
+    }
+    LOG_printf(&GRAPH_srcTrace, "};" "\n");
+}
+
+/*
+ *  ======== genReport ========
+ *  Ends the file with the memory generated in each memory space.
+ */
+static Void genReport(Void)
+{
+    Int i;
+    LgUns scratchTotal = 0;
+
+    for (i = 0; i < MAXBUCKETS; i++) {
+        scratchTotal += bucketSize[i];
+    }
+
+    LOG_printf(&GRAPH_srcTrace, "/*");
+    LOG_printf(&GRAPH_srcTrace, " *  Memory generated, in MAUs, "
+        "excluding alignment padding:");
+    for (i = 0; i < NUMSPACES; i++) {
+        if (spaces[i].total != 0) {
+            LOG_printf(&GRAPH_srcTrace, " *  %s (persistent): %d", 
+                spaces[i].name, spaces[i].total);
+        }
+    }
+    LOG_printf(&GRAPH_srcTrace, " *  scratch buckets: %d", scratchTotal);
+    LOG_printf(&GRAPH_srcTrace, " *  ICC buffers: %d", iccTotal);
+    LOG_printf(&GRAPH_srcTrace, " */");
+}
+
+/*
+ *  ======== isScratch ========
+ *  Only internal scratch memory overlays the shared scratch buckets,
+ *  as in ALGRF_createScratchSupport(). memTab[0] is always persistent.
+ */
+static Bool isScratch(Int i)
+{
+    return ((i != 0) && (memTab[i].attrs == IALG_SCRATCH) && 
+        !(IALG_isOffChip(memTab[i].space)));
+}
+
+/*
+ *  ======== spaceOf ========
+ */
+static Space *spaceOf(IALG_MemSpace space)
+{
+    Int i;
+
+    for (i = 0; i < NUMSPACES - 1; i++) {
+        if (spaces[i].space == space) {
+            break;
+        }
+    }
+    return (&spaces[i]);
+}
+
+/*
+ *  ======== memTabCreate ========
+ */
+static Int memTabCreate(IALG_Fxns *fxns, IALG_Params *params)
+{
+    Int n;
+    IALG_Fxns *fxnsPtr;    
+
+    if (fxns == NULL) {
+        return (IALG_EFAIL);
+    }
+
+    n = (fxns->algNumAlloc != NULL) ? (fxns->algNumAlloc()) 
+                                    : IALG_DEFMEMRECS;
+    if (n > ALGMIN_MAXMEMRECS) {    /* invalid number of Memory Descriptors */
+        return (IALG_EFAIL);
+    }
+
+    /* get the buffer requirements e.g. size, alignment */
+    n = fxns->algAlloc(params, &fxnsPtr, memTab);
+    if (n <= 0) {
+        return (IALG_EFAIL);
+    }
+
+    return (n);
+}
+
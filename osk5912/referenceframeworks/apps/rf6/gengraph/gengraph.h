@@ -0,0 +1,97 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== gengraph.h ========
+ *
+ *  Types and macros with which appGraph.c describes a graph of channels
+ *  to the gengraph pre-program.
+ */
+#ifndef GENGRAPH_
+#define GENGRAPH_
+
+#include <std.h>
+
+#include <ialg.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Alignment of the generated ICC buffers, in MAUs */
+#define GRAPH_ICCALIGN      8
+
+/*
+ *  GRAPH_Icc
+ *  ---------
+ *  A linear ICC. name is a C identifier: gengraph declares the object 
+ *  <name>Icc and, if nmaus is not 0, its buffer <name>Buf[nmaus]. An ICC
+ *  with nmaus 0 gets no buffer; the application points it to one with 
+ *  ICC_setBuf() before executing the channel, e.g. to a message's buffer.
+ */
+typedef struct GRAPH_Icc {
+    String       name;
+    Uns          nmaus;
+} GRAPH_Icc;
+
+/*
+ *  GRAPH_Cell
+ *  ----------
+ *  A cell with one input and one output ICC, given as indexes in 
+ *  GRAPH_iccs[]. Cells share an ICC by naming the same index. The names
+ *  of the cell's function table, algorithm and parameters are written to
+ *  the generated file, so the parameters must be a global variable 
+ *  that the application also links. Every cell must have an algorithm.
+ */
+typedef struct GRAPH_Cell {
+    String       name;           /* ICELL_Obj name                      */
+    String       cellFxns;       /* name of the ICELL_Fxns table        */
+    IALG_Fxns   *algFxns;        /* algorithm queried with algAlloc()   */
+    String       algFxnsName;
+    IALG_Params *algParams;      /* parameters passed to algAlloc()     */
+    String       algParamsName;
+    Uns          scrBucket;      /* shared scratch bucket               */
+    Uns          inputIcc;       /* index of the input ICC              */
+    Uns          outputIcc;      /* index of the output ICC             */
+} GRAPH_Cell;
+
+/*
+ *  GRAPH_Chan
+ *  ----------
+ *  A channel. name is a C identifier: gengraph declares the cellSet
+ *  <name>Cells[] and the algorithm memory <name>CellMem[] for 
+ *  CHAN_openStatic().
+ */
+typedef struct GRAPH_Chan {
+    String       name;
+    GRAPH_Cell  *cells;
+    Uns          cellCnt;
+} GRAPH_Chan;
+
+/* Initializers for the above, which also take the names of the symbols */
+#define GRAPH_ICC(name, nmaus)  { #name, (nmaus) }
+
+#define GRAPH_CELL(name, cellFxns, algFxns, algParams, scrBucket, in, out) \
+    { (name), #cellFxns, (IALG_Fxns *)&algFxns, #algFxns,                   \
+      (IALG_Params *)&algParams, #algParams, (scrBucket), (in), (out) }
+
+#define GRAPH_CHAN(name, cells) \
+    { #name, (cells), sizeof(cells) / sizeof(GRAPH_Cell) }
+
+/* The graph, defined in appGraph.c */
+extern GRAPH_Icc  GRAPH_iccs[];
+extern Uns        GRAPH_iccCnt;
+extern GRAPH_Chan GRAPH_chans[];
+extern Uns        GRAPH_chanCnt;
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif  /* GENGRAPH_ */
+
@@ -0,0 +1,25 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ * ======== link.cmd ========
+ */
+
+/* BIOS automatically generated configuration */
+-l gengraphcfg.cmd
+
+/* 
+ *  Link in the XDAIS algorithms of the graph, whose buffer requirements 
+ *  will be interrogated, bound to the same implementations as in the
+ *  application's link.cmd.
+ */
+-l fir_ti.l55l
+_FIR_IFIR = _FIR_TI_IFIR;
+
+-l vol_ti.l55l
+_VOL_IVOL = _VOL_TI_IVOL;
@@ -18,6 +18,8 @@
 -l algrf.l55l       /* XDAIS algorithm instance manager module      */
 -l chan.l55l        /* Channel Manager module                       */
 -l icc.l55l         /* Inter-Cell Communication module              */
+-l ilv.l55l         /* Interleave/deinterleave module               */
+-l prf.l55l         /* Cycle-budget profiler module                 */
 -l sscr.l55l        /* Shared Scratch Module                        */
 -l utl.l55l         /* Utility module for debugging and diagnostics */
 
@@ -20,6 +20,12 @@ extern "C" {
 // The board has a stereo codec
 #define NUMCODECCHANS   2
 
+/* 
+ *  Codec sampling rate in Hz. The codec is set up by the GPP; this only
+ *  tells the processing threads' profilers how long a frame lasts.
+ */
+#define CODECSAMPLERATE 44100
+
 /*
  *  Prototypes of I/O functions invoked from the rest of the app
  */
@@ -11,12 +11,22 @@
  *
  *  This file shows an example of forwarding messages from the GPP
  *  to the appropriate thread using MSGQ. 
+ *
+ *  It also adds and removes the process threads' channels at run time:
+ *  the algorithms of a channel are created and deleted here, in the 
+ *  background, while the process thread only switches the channel on or
+ *  off between two frames, so the audio of the other channels never stops.
  */
 #include <std.h> 
 
+// DSP/BIOS includes
+#include <clk.h>
+#include <tsk.h>
+
 // Reference Framework includes
 #include <utl.h>
 #include <msgq.h>
+#include <prf.h>
 
 // application includes
 #include "appThreads.h"     // thread-wide common info 
@@ -40,6 +50,8 @@ ThrControl thrControl;
 Void thrControlInit()
 {
     MSGQ_Attrs msgqAttrs;
+    Int thread;
+    Int chanNum;
 
     /* 
      *  Create the receiving message queue. Each reader creates its own
@@ -56,6 +68,17 @@ Void thrControlInit()
          
     thrControl.msgQueue = MSGQ_create("DSPLINK_DSP00MSGQ00", &msgqAttrs);
     UTL_assert( thrControl.msgQueue != NULL );
+
+    // The GPP's profile report queue is located when the first report is due
+    thrControl.prfQueue = NULL;
+
+    // The process threads open the first NUMINITCHANNELS channels at startup
+    for (thread = 0; thread < NUMPROCESSTHREADS; thread++) {
+        for (chanNum = 0; chanNum < NUMCHANNELS; chanNum++) {
+            thrControl.chanState[ thread ][ chanNum ] = 
+                (chanNum < NUMINITCHANNELS) ? CHANOPEN : CHANCLOSED;
+        }
+    }
 }
 
 /*
@@ -70,6 +93,147 @@ Void thrControlStartup()
      */     
 }
 
+/*
+ *  ======== sendProfile ========
+ *
+ *  Sends one processing thread's profile to the GPP. Reports are dropped
+ *  while the GPP has not created its queue or has not freed earlier ones.
+ */
+static Void sendProfile( Uns thread, PRF_Handle prf )
+{
+    PrfMsg *msg;
+    MSGQ_LocateAttrs locateAttrs;
+    MSGQ_Status status;
+    Uns i;
+
+    if (thrControl.prfQueue == NULL) {
+        locateAttrs         = MSGQ_LOCATEATTRS;
+        locateAttrs.timeout = PRFLOCATETIMEOUT;
+        status = MSGQ_locate(PRFGPPMSGQNAME, &thrControl.prfQueue, 
+            &locateAttrs);
+        if (status != MSGQ_SUCCESS) {
+            thrControl.prfQueue = NULL;
+            return;
+        }
+    }
+
+    msg = (PrfMsg *)MSGQ_alloc(REMOTEMQABUFID, sizeof(PrfMsg));
+    if (msg == NULL) {
+        return;
+    }
+
+    // keep the processing thread from updating the profile while we copy it
+    TSK_disable();
+    msg->thread    = thread;
+    msg->cellCnt   = (prf->cellCnt < PRFMSGCELLS) ? prf->cellCnt : PRFMSGCELLS;
+    msg->load      = prf->load;
+    msg->maxLoad   = prf->maxLoad;
+    msg->frameCnt  = prf->frameCnt;
+    msg->missCnt   = prf->missCnt;
+    msg->deadline  = prf->deadline;
+    msg->maxTime   = prf->maxTime;
+    msg->maxJitter = prf->maxJitter;
+    for (i = 0; i < msg->cellCnt; i++) {
+        msg->cellMaxTime[i] = prf->cells[i].maxTime;
+    }
+    TSK_enable();
+
+    status = MSGQ_put(thrControl.prfQueue, (MSGQ_Msg)msg, PRFMSGID, NULL);
+    if (status != MSGQ_SUCCESS) {
+        MSGQ_free((MSGQ_Msg)msg);
+    }
+}
+
+/*
+ *  ======== changeChannel ========
+ *
+ *  Handles a channel add, remove or close message. A channel is added by
+ *  opening it here, which creates its algorithms, then having its process
+ *  thread activate it. It is removed by having its process thread
+ *  deactivate it, which returns the message as MSGCLOSECHAN, then closing
+ *  it here, which deletes its algorithms. Only a MSGCLOSECHAN with the ID
+ *  CLOSECHANMSGID comes from the process thread: any other could arrive 
+ *  while the thread still runs the channel's cells, and is dropped, as are
+ *  messages that do not change the channel's state.
+ */
+static Void changeChannel( CtrlMsg *msg, MSGQ_Handle processQueue[] )
+{
+    Uns chanNum = msg->arg1;
+    Uns thread  = msg->arg2;
+    Uns *state;
+    Bool rc;
+    MSGQ_Status status;
+
+    if ((chanNum >= NUMCHANNELS) || (thread >= NUMPROCESSTHREADS)) {
+        UTL_logDebug("Dropped invalid message.");
+        MSGQ_free((MSGQ_Msg)msg);
+        return;
+    }
+    state = &thrControl.chanState[ thread ][ chanNum ];
+
+    switch (msg->cmd) {
+        case MSGADDCHAN:
+            if (*state == CHANOPEN) {
+                break;
+            }
+            if (*state == CHANCLOSED) {
+                if (thread == PRFTHRPROCESS0) {
+                    rc = thrProcess0OpenChannel( chanNum );
+                }
+                else {
+                    rc = thrProcess1OpenChannel( chanNum );
+                }
+                if (rc == FALSE) {
+                    UTL_logDebug2("Cannot open channel %d of thread %d", 
+                        chanNum, thread);
+                    break;
+                }
+            }
+
+            /*
+             *  A channel being removed is still open: its process thread
+             *  just activates it again, and its MSGCLOSECHAN is ignored.
+             */
+            *state = CHANOPEN;
+            status = MSGQ_put(processQueue[ thread ], (MSGQ_Msg)msg, 
+                CTRLMSGID, NULL);
+            UTL_assert(status == MSGQ_SUCCESS);
+            return;
+
+        case MSGREMOVECHAN:
+            if (*state != CHANOPEN) {
+                break;
+            }
+
+            // the process thread returns the message to this thread's queue
+            *state = CHANREMOVING;
+            status = MSGQ_put(processQueue[ thread ], (MSGQ_Msg)msg, 
+                CTRLMSGID, thrControl.msgQueue);
+            UTL_assert(status == MSGQ_SUCCESS);
+            return;
+
+        case MSGCLOSECHAN:
+            if ((*state != CHANREMOVING) || 
+                (MSGQ_getMsgId((MSGQ_Msg)msg) != CLOSECHANMSGID)) {
+                break;
+            }
+            if (thread == PRFTHRPROCESS0) {
+                rc = thrProcess0CloseChannel( chanNum );
+            }
+            else {
+                rc = thrProcess1CloseChannel( chanNum );
+            }
+            UTL_assert(rc == TRUE);
+            *state = CHANCLOSED;
+            break;
+
+        default:
+            break;
+    }
+
+    MSGQ_free((MSGQ_Msg)msg);
+}
+
 /*
  *  ======== thrControlRun ========
  *
@@ -80,7 +244,9 @@ Void thrControlRun()
     CtrlMsg *msg;
     MSGQ_Status status;
     MSGQ_Handle thrProcess0Queue, thrProcess1Queue;
+    MSGQ_Handle processQueue[ NUMPROCESSTHREADS ];
     MSGQ_Handle dstMsgQueue;
+    LgUns lastReport;
      
     /* 
      * Locate the Processing Tasks' message queue handles 
@@ -92,11 +258,41 @@ Void thrControlRun()
     status = MSGQ_locate("msgqProcess1", &thrProcess1Queue, NULL);      
     UTL_assert(status == MSGQ_SUCCESS);
 
+    processQueue[ PRFTHRPROCESS0 ] = thrProcess0Queue;
+    processQueue[ PRFTHRPROCESS1 ] = thrProcess1Queue;
+
+    lastReport = CLK_getltime();
+
     // Main loop    
     while ( TRUE ) {
     
-        msg = (CtrlMsg *)MSGQ_get(thrControl.msgQueue, SYS_FOREVER );
-        UTL_assert(msg != NULL);  //MSGQ internal error
+        // wake up at least once per report period
+        msg = (CtrlMsg *)MSGQ_get(thrControl.msgQueue, PRFREPORTPERIOD );
+
+        if (CLK_getltime() - lastReport >= PRFREPORTPERIOD) {
+            lastReport = CLK_getltime();
+            sendProfile( PRFTHRPROCESS0, &thrProcess0.prf );
+            sendProfile( PRFTHRPROCESS1, &thrProcess1.prf );
+        }
+
+        if (msg == NULL) {
+            continue;             // timeout: no control message
+        }
+
+        // a channel is only closed by its process thread, not by the GPP
+        if ((msg->cmd == MSGCLOSECHAN) && 
+            (MSGQ_getMsgId((MSGQ_Msg)msg) != CLOSECHANMSGID)) {
+            UTL_logDebug("Dropped MSGCLOSECHAN from the GPP.");
+            MSGQ_free((MSGQ_Msg)msg);
+            continue;
+        }
+
+        // channel add and remove messages go through their own protocol
+        if ((msg->cmd == MSGADDCHAN) || (msg->cmd == MSGREMOVECHAN) ||
+            (msg->cmd == MSGCLOSECHAN)) {
+            changeChannel( msg, processQueue );
+            continue;
+        }
 
         /* 
          *  Forward coefficient change messages to thrProcess0,
@@ -104,9 +300,6 @@ Void thrControlRun()
          *  we do not change the volume on thrProcess0. The user may
          *  modify this code to act differently if so desired. 
          */
-        // Make sure command is valid
-        UTL_assert( (msg->cmd == MSGNEWCOEFF) || (msg->cmd == MSGNEWVOL) );
-
         // select which process thread's message queue to put the msg on
         if (msg->cmd == MSGNEWCOEFF) {
             dstMsgQueue = thrProcess0Queue;
@@ -116,6 +309,7 @@ Void thrControlRun()
         }
         else {
             UTL_logDebug("Dropped invalid message.");
+            MSGQ_free((MSGQ_Msg)msg);
             continue;
         }
 
@@ -22,16 +22,45 @@
 extern "C" {
 #endif
 
-// Types of messages from the control thread. Must match with the GPP side.
+/*
+ *  Types of messages from the control thread. Must match with the GPP side.
+ *  MSGADDCHAN and MSGREMOVECHAN carry { channel #, process thread # },
+ *  the thread being PRFTHRPROCESS0 or PRFTHRPROCESS1. MSGCLOSECHAN is only
+ *  used on the DSP, by a process thread returning a MSGREMOVECHAN message
+ *  with the message ID CLOSECHANMSGID; the control thread drops it with
+ *  any other ID, e.g. from the GPP.
+ */
 enum {
     MSGNEWVOL = 0,
-    MSGNEWCOEFF
+    MSGNEWCOEFF,
+    MSGADDCHAN,
+    MSGREMOVECHAN,
+    MSGCLOSECHAN
+};
+
+#define NUMPROCESSTHREADS   2
+
+// States of the process threads' channels, as seen by the control thread
+enum {
+    CHANCLOSED = 0,     // no algorithms
+    CHANOPEN,           // opened, and activated or about to be
+    CHANREMOVING        // being deactivated by its process thread
 };
 
+/* 
+ *  Profile reports (PrfMsg) go to this GPP message queue every 
+ *  PRFREPORTPERIOD system ticks, if the GPP application has created it.
+ */
+#define PRFGPPMSGQNAME      "DSPLINK_GPPMSGQ01"
+#define PRFREPORTPERIOD     1000
+#define PRFLOCATETIMEOUT    10      // ticks to wait for the GPP queue
+
 // Definition of the structure describing the state of the thread.
 typedef struct ThrControl {
     SEM_Obj        msgqSemObj;     // Semaphore used for MSGQ
     MSGQ_Handle    msgQueue;       // Receiving Message Queue
+    MSGQ_Handle    prfQueue;       // GPP queue for profile reports
+    Uns            chanState[ NUMPROCESSTHREADS ][ NUMCHANNELS ];
 } ThrControl; 
 
 /* prototypes for public functions */
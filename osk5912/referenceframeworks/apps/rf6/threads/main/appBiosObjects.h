@@ -23,6 +23,7 @@
 // DSP/BIOS module includes
 #include <log.h>
 #include <sts.h>
+#include <tsk.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -43,6 +44,10 @@ extern STS_Obj stsTime7;
 extern STS_Obj stsTime8;
 extern STS_Obj stsTime9;
 
+/* TSK objects */
+extern TSK_Obj tskProcess0;
+extern TSK_Obj tskProcess1;
+
 /* heaps in data segments */
 extern Int INTERNALHEAP;
 extern Int EXTERNALHEAP;
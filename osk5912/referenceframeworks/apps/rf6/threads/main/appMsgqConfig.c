@@ -29,11 +29,13 @@ static const Uint16 localMsgSizes[NUMLOCALMSGPOOLS] =
 
 static const Uint16 remoteMsgSizes[NUMREMOTEMSGPOOLS] = 
     {sizeof(CtrlMsg),               /* Size of control messages */
-     MQTDSPLINK_CTRLMSG_SIZE};      /* Required by dsplink transport */
+     MQTDSPLINK_CTRLMSG_SIZE,       /* Required by dsplink transport */
+     sizeof(PrfMsg)};               /* Size of profile reports */
           
 static const Uint16 numLocalMsgs[NUMLOCALMSGPOOLS] = {NUMDATAMSGS};
 static const Uint16 numRemoteMsgs[NUMREMOTEMSGPOOLS] = {NUMCTRLMSGS, 
-                                                            NUMMQTCTRLMSGS};
+                                                            NUMMQTCTRLMSGS,
+                                                            NUMPRFMSGS};
                                             
 static const MQABUF_Params localMqaBufParams = 
     {NUMLOCALMSGPOOLS,           /* Number of buffer pools       */
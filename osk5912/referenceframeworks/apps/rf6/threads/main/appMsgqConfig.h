@@ -17,6 +17,8 @@
 #ifndef appMsgqConfig_
 #define appMsgqConfig_
 
+#include "appThreads.h"     // pipeline depths
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -41,7 +43,7 @@ extern "C" {
  *  pool for internal use.
  */
 #define NUMLOCALMSGPOOLS     1
-#define NUMREMOTEMSGPOOLS    2  
+#define NUMREMOTEMSGPOOLS    3  
 
 /* 
  *  Number of messages in the different pools. These have been 
@@ -50,7 +52,10 @@ extern "C" {
  */
 #define NUMMQTCTRLMSGS 2    // # msgs Link internal use by allocator
 #define NUMCTRLMSGS    4    // # GPP->DSP ctrl messages potentially queued up
-#define NUMDATAMSGS    4    // # MSGQ_alloc()'ed data (intra-thread) messages 
+#define NUMPRFMSGS     2    // # DSP->GPP profile reports potentially queued up
+
+// # MSGQ_alloc()'ed data (intra-thread) messages: the pipelines of both paths
+#define NUMDATAMSGS    (2 * (PREPROCESSDEPTH + POSTPROCESSDEPTH))
 
 /* The allocator id and the number of allocators. */
 enum {
@@ -9,7 +9,7 @@
 /*
  *  ======== appResources.c ========
  *
- *  Definition of application-wide global variables.
+ *  Definition of application-wide global variables and helper functions.
  */
 
 #include <std.h>
@@ -22,6 +22,7 @@
 
 // App includes
 #include "appResources.h"
+#include "appThreads.h"
 
 /* 
  *  Definition of STS-based objects for use with UTL_sts*() functions.
@@ -79,3 +80,43 @@ Bool binarySemPend(SEM_Handle semHandle, Uns timeout)
     return(retVal);    
 }
 
+/*
+ *  ======== localDataRingInit ========
+ */
+Void localDataRingInit(LocalDataRing *ring)
+{
+    ring->head  = 0;
+    ring->count = 0;
+}
+
+/*
+ *  ======== localDataRingPut ========
+ *  Add msg as the newest message. A ring never needs to hold more than
+ *  the messages of one pipeline stage, so it cannot overflow.
+ */
+Void localDataRingPut(LocalDataRing *ring, LocalDataMsg *msg)
+{
+    UTL_assert( ring->count < LOCALDATARINGSIZE );
+
+    ring->msgs[ (ring->head + ring->count) % LOCALDATARINGSIZE ] = msg;
+    ring->count++;
+}
+
+/*
+ *  ======== localDataRingGet ========
+ *  Remove and return the oldest message, or NULL if the ring is empty.
+ */
+LocalDataMsg *localDataRingGet(LocalDataRing *ring)
+{
+    LocalDataMsg *msg;
+
+    if (ring->count == 0) {
+        return (NULL);
+    }
+
+    msg = ring->msgs[ ring->head ];
+    ring->head = (ring->head + 1) % LOCALDATARINGSIZE;
+    ring->count--;
+
+    return (msg);
+}
@@ -24,6 +24,8 @@ extern "C" {
 #endif
 
 #define NUMCHANNELS  2  // number of processing channels in processing threads
+#define NUMINITCHANNELS NUMCHANNELS // channels opened at startup; the others
+                                    // are added at run time by the GPP
 #define FRAMELEN    80  // number of samples in a frame
 
 typedef Short Sample;
@@ -24,6 +24,7 @@
 // RF module includes
 #include <chan.h>
 #include <icc.h>
+#include <sscr.h>
 #include <utl.h>
 
 // App includes
@@ -110,6 +111,8 @@ ThrPostProcess thrPostProcessCodec = {
 Void appThreadInit() 
 {
     Uns i;
+    Int bucketPri[ NUMSCRBUCKETS ];
+    SSCR_PlanReport scrReport;
 
     /* Initialize the allocator and transport */
     MQABUF_init();
@@ -165,6 +168,18 @@ Void appThreadInit()
 
     thrControlInit();
 
+    /*
+     *  All cells are registered: let the scratch buckets of threads with
+     *  the same priority share their buffer before the channels are opened.
+     */
+    bucketPri[ THRPROCESS0SCRBUCKET ] = TSK_getpri( &tskProcess0 );
+    bucketPri[ THRPROCESS1SCRBUCKET ] = TSK_getpri( &tskProcess1 );
+    
+    if (SSCR_plan( bucketPri, &scrReport ) == TRUE) {
+        UTL_logDebug2( "Scratch: %d MAUs planned, %d MAUs summed", 
+            scrReport.plannedSize, scrReport.summedSize );
+    }
+
     /*
      *  Set-up buffer pointers for the thread startups
      */    
@@ -30,6 +30,8 @@ enum {
     PROCESS1_DATAMSGID,
     PREPROCESS_DATAMSGID,
     POSTPROCESS_DATAMSGID,
+    PRFMSGID,
+    CLOSECHANMSGID,     // MSGCLOSECHAN from a process thread, DSP only
     NUMMSGIDS
 };
     
@@ -44,6 +46,32 @@ typedef struct CtrlMsg {
     Uint16 arg2;                      // Second message argument
 } CtrlMsg;
 
+/*
+ *  Profile report sent periodically by the control thread to the GPP, one 
+ *  per processing thread. Must match exactly with GPP-side. Times are in
+ *  DSP CLK_gethtime() units, load in tenths of a percent of the deadline.
+ */
+#define PRFMSGCELLS 3                 // Max profiled cell slots per thread
+
+enum {
+    PRFTHRPROCESS0 = 0,
+    PRFTHRPROCESS1
+};
+
+typedef struct PrfMsg {
+    MSGQ_MsgHeader header;    
+    Uint16 thread;                    // PRFTHRPROCESS0 or PRFTHRPROCESS1
+    Uint16 cellCnt;                   // Valid entries in cellMaxTime[]
+    Uint16 load;                      // Load of the last frame
+    Uint16 maxLoad;                   // Worst-case load
+    Uint32 frameCnt;                  // Frames processed
+    Uint32 missCnt;                   // Frames that missed the deadline
+    Uint32 deadline;                  // Time available for one frame
+    Uint32 maxTime;                   // Worst-case frame execution time
+    Uint32 maxJitter;                 // Worst-case frame period jitter
+    Uint32 cellMaxTime[PRFMSGCELLS];  // Worst-case time of each cell slot
+} PrfMsg;
+
 /*
  *  LocalDataMsg are data messages exchanged between tasks in the DSP
  *  application
@@ -53,30 +81,67 @@ typedef struct LocalDataMsg {
     Sample *bufChannel[NUMCHANNELS];  //pointers to channel data buffers
 } LocalDataMsg;
 
+/*
+ *  Pipeline depth: the number of data messages, each describing one frame,
+ *  that circulate between a PreProcess thread and its Process thread, and
+ *  between a Process thread and its PostProcess thread. The thread later 
+ *  in the data flow allocates the messages and their buffers before it 
+ *  enters its main loop, and primes the queue of the thread before it with
+ *  them. With a depth of 1 a thread must hand a frame back before the 
+ *  thread before it can fill the next one; with 2 (double buffering) or 
+ *  more, neighbouring threads work on different frames at the same time, 
+ *  which absorbs bursty scheduling at the cost of a frame of latency and 
+ *  of buffer memory per extra message.
+ */
+#define PREPROCESSDEPTH     2   // frames between PreProcess and Process
+#define POSTPROCESSDEPTH    2   // frames between Process and PostProcess
+
+/*
+ *  Most frames a Process thread runs per wake-up. When it has fallen behind
+ *  and several frames are ready, it runs up to this many before it looks 
+ *  for control messages again. Each frame is still processed on its own, 
+ *  exactly as when the thread keeps up.
+ */
+#define PROCESSMAXBATCH     4
+
+/*
+ *  LocalDataRing is a FIFO of the data messages a thread holds on to, e.g.
+ *  full input frames waiting for an empty output frame. It is large enough
+ *  for all the messages of the deepest pipeline stage.
+ */
+#define LOCALDATARINGSIZE   (PREPROCESSDEPTH > POSTPROCESSDEPTH ? \
+                             PREPROCESSDEPTH : POSTPROCESSDEPTH)
+
+typedef struct LocalDataRing {
+    LocalDataMsg *msgs[LOCALDATARINGSIZE];
+    Uns           head;               // index of the oldest message
+    Uns           count;              // number of messages held
+} LocalDataRing;
+
 /*
  *  Shared scratch memory buckets: most XDAIS algorithms need scratch memory,
  *  and it can be shared among more algorithms they can never be preempted
  *  by one another. By defining "buckets" of shared scratch memory we can
  *  minimize total scratch memory requirements. When defining a cell, we
  *  set its "shared scratch bucket" to one of the values defined here.
- *  Typically, cells belonging to threads running at same priorities would
- *  go into the same scratch bucket.
+ *  Each thread has a bucket of its own; appThreadInit() passes the thread
+ *  priorities to SSCR_plan(), which overlays the buckets of threads running
+ *  at the same priority.
  */
 enum SSCRBUCKETS {
-    /*
-     *  Both processing threads are set at same priority, hence we can use 
-     *  the same scratch bucket for all algorithms in both Process tasks.
-     *  NOTE: if you DO change the priority of the Process tasks to be 
-     *  different from each other, you MUST use different scratch buckets
-     *  for the different Process tasks.
-     */
-    THRPROCESSSCRBUCKET = 0, 
+    THRPROCESS0SCRBUCKET = 0,   // all algorithms in the Process0 task
+    THRPROCESS1SCRBUCKET,       // all algorithms in the Process1 task
     NUMSCRBUCKETS               // total number of shared scratch buckets
     };
     
 // prototypes for public functions
 extern Void appThreadInit( Void );
 
+// LocalDataRing functions, in appResources.c
+extern Void          localDataRingInit( LocalDataRing *ring );
+extern Void          localDataRingPut( LocalDataRing *ring, LocalDataMsg *msg );
+extern LocalDataMsg *localDataRingGet( LocalDataRing *ring );
+
 #ifdef __cplusplus
 }
 #endif // extern "C"
@@ -27,6 +27,7 @@
 
 // RF module includes
 #include <msgq.h>
+#include <ilv.h>
 #include <utl.h>
 
 // application includes
@@ -95,6 +96,7 @@ Void thrPostProcessStartup( ThrPostProcess *thr, Sample *bufTx[] )
 Void thrPostProcessRun(Arg thrArg)
 {
     Int i;
+    Int j;
     MSGQ_Handle  msgqSend;    
     MSGQ_Status  status;
     LocalDataMsg *msg;
@@ -109,25 +111,28 @@ Void thrPostProcessRun(Arg thrArg)
     status = MSGQ_locate(thr->txMsgqName, &msgqSend, NULL);     
     UTL_assert (status == MSGQ_SUCCESS);
 
-    // Fill in the priming message
-    msg = (LocalDataMsg *)MSGQ_alloc(LOCALMQABUFID, sizeof(LocalDataMsg));
-    UTL_assert( msg != NULL );
-    for (i = 0; i < NUMCHANNELS; i++) {
-        msg->bufChannel[i] = thr->bufInput[i];
-    }
-
     /*
-     *  Prime the MSGQ of the preceding task in the processing chain.
+     *  Prime the MSGQ of the preceding task in the processing chain, with
+     *  one message per frame in the pipeline.
      *  The convention here is for the task appearing later in the data flow
      *  to prime the MSGQ of the task(s) preceding it.
      */ 
-    status = MSGQ_put(msgqSend, (MSGQ_Msg)msg, POSTPROCESS_DATAMSGID, NULL);
-    UTL_assert( status == MSGQ_SUCCESS );
+    for (j = 0; j < POSTPROCESSDEPTH; j++) {
+
+        // Fill in the priming message
+        msg = (LocalDataMsg *)MSGQ_alloc(LOCALMQABUFID, sizeof(LocalDataMsg));
+        UTL_assert( msg != NULL );
+        for (i = 0; i < NUMCHANNELS; i++) {
+            msg->bufChannel[i] = thr->bufInput[j][i];
+        }
+
+        status = MSGQ_put(msgqSend, (MSGQ_Msg)msg, POSTPROCESS_DATAMSGID, 
+            NULL);
+        UTL_assert( status == MSGQ_SUCCESS );
+    }
             
     while (TRUE) {
-        Sample   *bufDst, *bufSrc;        
-        Int      i;
-        Int      deviceChanNum;         
+        Sample   *bufDst;
 
         // Reclaim empty destination buffer from the output link stream
         SIO_reclaim( thr->outStream, (Ptr *)&bufDst, NULL );         
@@ -139,31 +144,24 @@ Void thrPostProcessRun(Arg thrArg)
         msg = (LocalDataMsg *)MSGQ_get(thr->msgQueue, SYS_FOREVER);
         UTL_assert(msg != NULL);  //MSGQ internal error
         
-        // join the input data.
-        for ( deviceChanNum = 0; deviceChanNum < thr->numChansToDev; 
-              deviceChanNum++ ) {
-
-            /*
-             *  Select the appropriate processed buffer:
-             *  Examples:
-             *  Case 1 device channels < NUMCHANNELS
-             *     you processed stereo data and sending to a mono-codec,
-             *     only send the first channel of the stereo data. 
-             *
-             *  Case 2 device channels > NUMCHANNELS
-             *     you processed mono data and sending to a stereo-codec,
-             *     replicated the mono data into both stereo channels. 
-             *  
-             *  Case 3 device channels = NUMCHANNELS
-             *     the stereo processed data goes into the stereo channels.
-             */
-            bufSrc = msg->bufChannel[ deviceChanNum % NUMCHANNELS  ];
- 
-            // interleave the data.
-            for (i = 0; i < FRAMELEN; i++) {
-                bufDst[ thr->numChansToDev * i + deviceChanNum ] = bufSrc[i];
-            }
-        }
+        /*
+         *  join the input data. ILV_join() selects the appropriate processed
+         *  buffer for each device channel as bufChannel[ deviceChanNum % 
+         *  NUMCHANNELS ]:
+         *  Examples:
+         *  Case 1 device channels < NUMCHANNELS
+         *     you processed stereo data and sending to a mono-codec,
+         *     only send the first channel of the stereo data. 
+         *
+         *  Case 2 device channels > NUMCHANNELS
+         *     you processed mono data and sending to a stereo-codec,
+         *     replicated the mono data into both stereo channels. 
+         *  
+         *  Case 3 device channels = NUMCHANNELS
+         *     the stereo processed data goes into the stereo channels.
+         */
+        ILV_join( msg->bufChannel, NUMCHANNELS, bufDst, thr->numChansToDev,
+                  FRAMELEN );
 
         // send the message describing consumed input buffers to Process
         status = MSGQ_put( msgqSend, (MSGQ_Msg)msg, 
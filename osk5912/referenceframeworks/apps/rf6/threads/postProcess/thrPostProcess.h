@@ -38,9 +38,9 @@ typedef struct ThrPostProcess {
     
     /* 
      * Data buffers used for receiving data messages from preceding task in 
-     * processing chain 
+     * processing chain, one set per message in the pipeline
      */
-    Sample bufInput[ NUMCHANNELS ][ FRAMELEN ];
+    Sample bufInput[ POSTPROCESSDEPTH ][ NUMCHANNELS ][ FRAMELEN ];
 } ThrPostProcess;
 
 // prototypes for public functions
@@ -25,6 +25,7 @@
 
 // RF module includes
 #include <msgq.h>
+#include <ilv.h>
 #include <utl.h>
 
 // application includes
@@ -106,10 +107,7 @@ Void thrPreProcessRun(Arg thrArg)
     
     while (TRUE) {
         LocalDataMsg    *msg;
-        Sample          *bufDst, *bufSrc;
-        Int              i;
-        Uns              chanNum;
-        Uns              deviceChanNum = 0;
+        Sample          *bufSrc;
 
         // Reclaim full source buffer from the input stream
         SIO_reclaim( thr->inStream, (Ptr *)&bufSrc, NULL );        
@@ -126,13 +124,8 @@ Void thrPreProcessRun(Arg thrArg)
          * For stereo codec: LRLRLRLR -> LL..L,RR..R,LL..L,RR..R
          * For mono codec:   DDDD...D -> DD..D,DD..D,DD..D,DD..D
          */
-        for ( chanNum = 0; chanNum < NUMCHANNELS; chanNum++ ) {
-            bufDst = msg->bufChannel[ chanNum ];
-            for (i = 0; i < FRAMELEN; i++) {
-                bufDst[i] = bufSrc[ thr->numChansFromDev * i + deviceChanNum ];
-            }
-            deviceChanNum = (deviceChanNum + 1) % thr->numChansFromDev;
-        }
+        ILV_split( bufSrc, thr->numChansFromDev, msg->bufChannel, 
+                   NUMCHANNELS, FRAMELEN );
 
         // put the full buffer to the queue of processing task
         status = MSGQ_put(msgqSend, (MSGQ_Msg)msg, PREPROCESS_DATAMSGID, NULL);
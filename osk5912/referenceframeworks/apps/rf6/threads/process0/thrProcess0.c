@@ -12,21 +12,35 @@
  *  Implementation of the Process0 thread. It performs the processing done on 
  *  the first data path: Codec -> Processing -> Link.
  * 
- *  This thread is a typical data processing thread. It consists of 
- *  NUMCHANNELS channels, each consisting of two cells. A cell is a 
+ *  This thread is a typical data processing thread. A cell is a 
  *  wrapper around an XDAIS algorithm that gives it a uniform data processing 
  *  interface. (since XDAIS algorithms have different processing functions with 
  *  different signatures). A channel is a collection of cells, which execute in 
  *  series. 
+ *
+ *  Each of the NUMCHANNELS data channels goes through a FIR cell and then a
+ *  VOL cell. Each FIR cell is opened in a channel of its own, in 
+ *  firChanList, but the FIR cells of the active channels are executed 
+ *  together as a batch so that the FIR algorithm can share each 
+ *  coefficient load across channels; each VOL cell then runs in its own
+ *  channel, in chanList.
+ *
+ *  Only the channels marked active are executed; the others output 
+ *  silence. The Control thread opens a channel in the background before
+ *  this thread activates it, and closes it after this thread has 
+ *  deactivated it, so channels come and go at frame boundaries without
+ *  stopping the audio.
  */
 
 #include <std.h>
+#include <string.h>
 
 // DSP/BIOS includes
 #include <sem.h>
 #include <msgq.h>
 
 // RF module includes
+#include <algrf.h>
 #include <chan.h>
 #include <icell.h>
 #include <icc.h>
@@ -47,18 +61,15 @@
 #include "vol/cellVol.h"
 
 /*
- *   Incoming data goes into bufInputs.
+ *   Incoming data goes into bufInputs, one set of buffers per frame in
+ *   the pipeline from PreProcess.
  *   bufIntermediate is used in the intermediate processing.
  *
- *   The intermediate buffer is shared across all channels.
- *   In this appl., we need only one because there are only 2 cells
- *   per channel and there is only 1 output buffer for the first
- *   cell of each channel.  If there were more cells per channel
- *   or if there were more inputs/outputs per cell, additional 
- *   intermediate buffers are needed as appropriate.
+ *   Each channel needs its own intermediate buffer, since the FIR cells
+ *   of all channels execute before any of the VOL cells.
  */
-static Sample bufInput[ NUMCHANNELS ][ FRAMELEN ];
-static Sample bufIntermediate[ FRAMELEN ];
+static Sample bufInput[ PREPROCESSDEPTH ][ NUMCHANNELS ][ FRAMELEN ];
+static Sample bufIntermediate[ NUMCHANNELS ][ FRAMELEN ];
 
 /*
  *  Thread process0 object which encapsulates the state information 
@@ -126,9 +137,9 @@ Void thrProcess0Init()
     
     // Set-up the threads's buffer pointers. 
     for (i = 0; i < NUMCHANNELS; i++) {
-        thrProcess0.bufInput[i]  = bufInput[i];
+        thrProcess0.bufInput[i]        = bufInput[0][i];
+        thrProcess0.bufIntermediate[i] = bufIntermediate[i];
     }
-    thrProcess0.bufIntermediate = bufIntermediate;
 
     /* 
      *  Create the receiving message queue. Each reader creates its own
@@ -143,6 +154,13 @@ Void thrProcess0Init()
     
     thrProcess0.msgQueue = MSGQ_create("msgqProcess0", &msgqAttrs);
     UTL_assert( thrProcess0.msgQueue != NULL );
+
+    localDataRingInit( &thrProcess0.preRing );
+    localDataRingInit( &thrProcess0.postRing );
+
+    // The thread must finish each frame before the codec delivers the next
+    PRF_new( &thrProcess0.prf, PRF_deadline( FRAMELEN, CODECSAMPLERATE ),
+        thrProcess0.prfCells, THRPROCESS0_NUMPRFCELLS );
         
     setParamsAndStartChannels( FALSE );
 }
@@ -178,7 +196,6 @@ static Void setParamsAndStartChannels( Bool doChannelOpen )
     Bool        rc;    
     ICC_Handle  inputIcc;
     ICC_Handle  outputIcc;
-    
 
     for (chanNum = 0; chanNum < NUMCHANNELS; chanNum++) {
 
@@ -201,19 +218,18 @@ static Void setParamsAndStartChannels( Bool doChannelOpen )
             ICELL_Obj   defaultCell = ICELL_DEFAULT;
 
             /*
-             *  cell 0 - FIR: create an input linear ICC buffer that points to
+             *  FIR cell: create an input linear ICC buffer that points to
              *  bufInput[ <channel number> ], and an output linear ICC buffer
-             *  that points to the intermediate buffer, bufIntermediate;
+             *  that points to bufIntermediate[ <channel number> ];
              *  the cell will always look for data in those buffers.
              */
-            cell = &thrProcess0.cellList[ (chanNum * THRPROCESS0_NUMCELLS) +
-                THRPROCESS0_CELLFIR ];
+            cell = &thrProcess0.firCellList[ chanNum ];
             *cell                = defaultCell;
             cell->name           = "FIR";
             cell->cellFxns       = &FIR_CELLFXNS;            
             cell->algFxns        = (IALG_Fxns *)&FIR_IFIR;
             cell->algParams      = (IALG_Params *)&firParams;
-            cell->scrBucketIndex = THRPROCESSSCRBUCKET;
+            cell->scrBucketIndex = THRPROCESS0SCRBUCKET;
 
             inputIcc  = (ICC_Handle)ICC_linearCreate( 
                                    thrProcess0.bufInput[ chanNum ], 
@@ -221,16 +237,16 @@ static Void setParamsAndStartChannels( Bool doChannelOpen )
             UTL_assert( inputIcc != NULL);
 
             outputIcc = (ICC_Handle)ICC_linearCreate( 
-                                                thrProcess0.bufIntermediate,
-                                                FRAMELEN * sizeof( Sample ) );
+                                   thrProcess0.bufIntermediate[ chanNum ],
+                                   FRAMELEN * sizeof( Sample ) );
             UTL_assert( outputIcc != NULL);
 
             // Only one input and one output ICC are needed.
             rc = CHAN_regCell( cell, &inputIcc, 1, &outputIcc, 1 );
             
             /*
-             *  cell 1 - VOL: create an input linear ICC buffer that points to
-             *  the intermediate buffer, bufIntermediate, and an output linear 
+             *  cell 0 - VOL: the input ICC buffer is the FIR cell's output,
+             *  bufIntermediate[ <channel number> ], and an output linear 
              *  ICC buffer that points to bufOutput[ <channel number> ].
              *  the cell will always look for data in those buffers.
              */
@@ -241,7 +257,7 @@ static Void setParamsAndStartChannels( Bool doChannelOpen )
             cell->cellFxns       = &VOL_CELLFXNS;            
             cell->algFxns        = (IALG_Fxns *)&VOL_IVOL;
             cell->algParams      = (IALG_Params *)&volParams;
-            cell->scrBucketIndex = THRPROCESSSCRBUCKET;
+            cell->scrBucketIndex = THRPROCESS0SCRBUCKET;
 
             inputIcc  = outputIcc;
 
@@ -253,51 +269,121 @@ static Void setParamsAndStartChannels( Bool doChannelOpen )
             // Only one input and one output ICC are needed.
             rc = CHAN_regCell( cell, &inputIcc, 1, &outputIcc, 1 );
         }
+        else if (chanNum < NUMINITCHANNELS) {
+            rc = thrProcess0OpenChannel( chanNum );
+            thrProcess0.active[ chanNum ] = TRUE;
+        }
         else {
-
-            /*
-             *  Since firParams and volParams are local variables, they need to
-             *  be set-up again for proper creation of the algorithms.
-             */ 
-            thrProcess0.cellList[ (chanNum * THRPROCESS0_NUMCELLS) + 
-                THRPROCESS0_CELLFIR ].algParams = (IALG_Params *)&firParams;
-            thrProcess0.cellList[ (chanNum * THRPROCESS0_NUMCELLS) + 
-                THRPROCESS0_CELLVOL ].algParams = (IALG_Params *)&volParams;
-
-            UTL_logDebug1("Channel Number: %d", chanNum);
-
-            // open the channel: this causes the algorithms to be created
-            rc = CHAN_open( &thrProcess0.chanList[ chanNum ], 
-                &thrProcess0.cellList[ chanNum * THRPROCESS0_NUMCELLS ], 
-                THRPROCESS0_NUMCELLS,
-                NULL );
+            // the Control thread opens the channel if it is added later
+            rc = TRUE;
         }
         UTL_assert( rc == TRUE );
     }
 }
 
+/*
+ *  ======== thrProcess0OpenChannel ========
+ *
+ *  Opens channel chanNum, i.e. its FIR channel and its VOL channel, which
+ *  creates their algorithms. Called at startup for the initial channels,
+ *  and by the Control thread, in its own context, for a channel added 
+ *  while this thread runs; the channel is executed only once this thread
+ *  has processed the MSGADDCHAN message.
+ */
+Bool thrProcess0OpenChannel( Int chanNum )
+{
+    IFIR_Params firParams;
+    IVOL_Params volParams;    
+    CHAN_Attrs  chanAttrs;
+    
+    // the VOL cells of all channels are profiled in one slot
+    chanAttrs         = CHAN_ATTRS;
+    chanAttrs.prf     = &thrProcess0.prf;
+    chanAttrs.prfCell = THRPROCESS0_PRFVOL;
+
+    /*
+     *  Since firParams and volParams are local variables, they need to
+     *  be set-up again for proper creation of the algorithms.
+     */ 
+    firParams           = IFIR_PARAMS;
+    firParams.coeffPtr  = filterCoeffLowPass;
+    firParams.filterLen = NUMFIRTAPS;
+    firParams.frameLen  = FRAMELEN;
+    thrProcess0.firCellList[ chanNum ].algParams = (IALG_Params *)&firParams;
+
+    volParams           = IVOL_PARAMS;
+    volParams.frameSize = FRAMELEN;        
+    thrProcess0.cellList[ (chanNum * THRPROCESS0_NUMCELLS) + 
+        THRPROCESS0_CELLVOL ].algParams = (IALG_Params *)&volParams;
+
+    UTL_logDebug1("Channel Number: %d", chanNum);
+
+    // open the channels: this causes the algorithms to be created
+    if (CHAN_open( &thrProcess0.firChanList[ chanNum ], 
+        &thrProcess0.firCellList[ chanNum ], 1, NULL ) == FALSE) {
+        return (FALSE);
+    }
+    if (CHAN_open( &thrProcess0.chanList[ chanNum ], 
+        &thrProcess0.cellList[ chanNum * THRPROCESS0_NUMCELLS ], 
+        THRPROCESS0_NUMCELLS, &chanAttrs ) == FALSE) {
+        CHAN_close( &thrProcess0.firChanList[ chanNum ] );
+        return (FALSE);
+    }
+
+    return (TRUE);
+}
+
+/*
+ *  ======== thrProcess0CloseChannel ========
+ *
+ *  Closes channel chanNum, which deletes its algorithms. Called by the
+ *  Control thread once this thread has processed the MSGREMOVECHAN 
+ *  message, and so no longer executes the channel.
+ */
+Bool thrProcess0CloseChannel( Int chanNum )
+{
+    Bool rc;
+
+    rc = CHAN_close( &thrProcess0.chanList[ chanNum ] );
+    if (CHAN_close( &thrProcess0.firChanList[ chanNum ] ) == FALSE) {
+        rc = FALSE;
+    }
+
+    return (rc);
+}
+
 /*
  *  ======== processMsg ========
  *
  *  Processes messages for the task.
- *  Called from the thread's run() function.
+ *  Called from the thread's run() function, between frames. Returns 
+ *  TRUE if the caller is to free the message.
  */
-static Void processMsg(CtrlMsg *rxMsg)
+static Bool processMsg(CtrlMsg *rxMsg)
 {
     Int chanNum;
     ICELL_Handle hCell;
+    MSGQ_Status status;
 
     /* 
      *  The format we expect for a message, i.e. {cmd, arg1, arg2} is 
      *  1. volume change message: { MSGNEWVOL,   channel #, volume value },
      *  2. filter change message: { MSGNEWCOEFF, channel #, filter type}
      *     where filter type is 0: low pass, 1: high pass, 2: passthrough.
+     *  3. channel add message: { MSGADDCHAN, channel #, thread # },
+     *  4. channel remove message: { MSGREMOVECHAN, channel #, thread # }.
      */
     chanNum = rxMsg->arg1;
         
     // Process only messages with valid channel number
     if ( (chanNum >= 0) && (chanNum < NUMCHANNELS) ) {
 
+        // a channel that is not active may have no algorithms to control
+        if ((thrProcess0.active[ chanNum ] == FALSE) && 
+            (rxMsg->cmd != MSGADDCHAN)) {
+            return (TRUE);
+        }
+
         switch (rxMsg->cmd) {        
             case MSGNEWVOL:
                 {
@@ -312,6 +398,7 @@ static Void processMsg(CtrlMsg *rxMsg)
                      *  get current contents of the control structure 
                      *  to avoid overriding non-modified ones 
                      */
+                    volStatus.size = sizeof( volStatus );
                     VOL_cellControl( hCell, IVOL_GETSTATUS, 
                         (IALG_Status *)&volStatus );
                     volStatus.gainPercentage = rxMsg->arg2; 
@@ -335,28 +422,62 @@ static Void processMsg(CtrlMsg *rxMsg)
                     coeffPtr = filterCoeffList[ coeffIndex ];
 
                     // get handle for channel chanNum's FIR cell
-                    hCell = &thrProcess0.cellList[THRPROCESS0_CELLFIR +  
-                        chanNum * THRPROCESS0_NUMCELLS];
+                    hCell = &thrProcess0.firCellList[ chanNum ];
                     UTL_assert( hCell != NULL );
 
                     /* 
                      *  get current contents of the control structure 
                      *  to avoid overriding non-modified ones 
                      */
+                    firStatus.size = sizeof( firStatus );
                     FIR_cellControl( hCell, IFIR_GETSTATUS, 
                         (IALG_Status *)&firStatus );
+
+                    /*
+                     *  stage the new coefficients rather than set them:
+                     *  the filter swaps them in at its next frame, fading
+                     *  over that frame from the old ones, so the change
+                     *  does not click
+                     */
                     firStatus.coeffPtr  = coeffPtr; 
-                    FIR_cellControl( hCell, IFIR_SETSTATUS, 
+                    firStatus.crossfade = TRUE;
+                    FIR_cellControl( hCell, IFIR_STAGECOEFF, 
                         (IALG_Status *)&firStatus );
-                    UTL_logDebug2( "Changing coeffs on channel %d to %d", 
+                    UTL_logDebug2( "Staging coeffs on channel %d to %d", 
                         chanNum, coeffIndex);
                 }
                 break;
 
+            case MSGADDCHAN:
+                // the Control thread has opened the channel
+                thrProcess0.active[ chanNum ] = TRUE;
+                UTL_logDebug1( "Adding channel %d", chanNum );
+                break;
+
+            case MSGREMOVECHAN:
+                thrProcess0.active[ chanNum ] = FALSE;
+
+                // the scratch bucket must not be left to a removed algorithm
+                hCell = &thrProcess0.firCellList[ chanNum ];
+                ALGRF_deactivateLazy( hCell->algHandle, hCell->scrBucketIndex );
+                hCell = &thrProcess0.cellList[THRPROCESS0_CELLVOL +
+                    chanNum * THRPROCESS0_NUMCELLS];
+                ALGRF_deactivateLazy( hCell->algHandle, hCell->scrBucketIndex );
+                UTL_logDebug1( "Removing channel %d", chanNum );
+
+                // hand the message back to the Control thread, to close it
+                rxMsg->cmd = MSGCLOSECHAN;
+                status = MSGQ_put(MSGQ_getReplyHandle((MSGQ_Msg)rxMsg), 
+                    (MSGQ_Msg)rxMsg, CLOSECHANMSGID, NULL);
+                UTL_assert( status == MSGQ_SUCCESS );
+                return (FALSE);
+
             default:
                 break;
         }
     }
+
+    return (TRUE);
 }
 
 
@@ -370,7 +491,11 @@ Void thrProcess0Run()
     Int i;
     Int chanNum;
     Bool rc;    
+    Int batch;
     Uns msgId;
+    Uns timeout;
+    Uns firCnt;
+    ICELL_Handle firCells[ NUMCHANNELS ];
     MSGQ_Msg msg;
     LocalDataMsg * msgPreProcess, * msgPostProcess;
     MSGQ_Status status;
@@ -386,69 +511,118 @@ Void thrProcess0Run()
     status = MSGQ_locate("msgqPostProcessLink", &msgqToPostProcess, NULL);      
     UTL_assert( status == MSGQ_SUCCESS );
         
-    // Fill in the priming message
-    msgPreProcess = (LocalDataMsg *)MSGQ_alloc(LOCALMQABUFID, 
-        sizeof(LocalDataMsg));
-    UTL_assert( msgPreProcess != NULL );
-    for (i = 0; i < NUMCHANNELS; i++) {
-        msgPreProcess->bufChannel[i] = thrProcess0.bufInput[i];
-    }
-
     /*
-     *  Prime the MSGQ of the preceding task in the processing chain.
+     *  Prime the MSGQ of the preceding task in the processing chain, with
+     *  one message per frame in the pipeline.
      *  The convention here is for the task appearing later in the data flow
      *  to prime the MSGQ of the task(s) preceding it.
      */ 
-    status = MSGQ_put(msgqToPreProcess, (MSGQ_Msg)msgPreProcess,
-        PROCESS0_DATAMSGID, NULL);
-    UTL_assert( status == MSGQ_SUCCESS );
-    
-    /* Reset the message pointers */
-    msgPreProcess = NULL;
-    msgPostProcess = NULL;   
+    for (i = 0; i < PREPROCESSDEPTH; i++) {
+
+        // Fill in the priming message
+        msgPreProcess = (LocalDataMsg *)MSGQ_alloc(LOCALMQABUFID, 
+            sizeof(LocalDataMsg));
+        UTL_assert( msgPreProcess != NULL );
+        for (chanNum = 0; chanNum < NUMCHANNELS; chanNum++) {
+            msgPreProcess->bufChannel[chanNum] = bufInput[i][chanNum];
+        }
+
+        status = MSGQ_put(msgqToPreProcess, (MSGQ_Msg)msgPreProcess,
+            PROCESS0_DATAMSGID, NULL);
+        UTL_assert( status == MSGQ_SUCCESS );
+    }
      
     // Main loop
     while (TRUE) {
-        msg = MSGQ_get(thrProcess0.msgQueue, SYS_FOREVER);
-        UTL_assert(msg != NULL);  //MSGQ internal error
-        msgId = MSGQ_getMsgId(msg);
+
+        /*
+         *  Block only if there is no frame left to process; otherwise 
+         *  just collect the messages that have arrived in the meantime.
+         */
+        if ((thrProcess0.preRing.count > 0) && 
+            (thrProcess0.postRing.count > 0)) {
+            timeout = SYS_POLL;
+        }
+        else {
+            timeout = SYS_FOREVER;
+        }
+
+        for (msg = MSGQ_get(thrProcess0.msgQueue, timeout); msg != NULL; 
+             msg = MSGQ_get(thrProcess0.msgQueue, SYS_POLL)) {
+            msgId = MSGQ_getMsgId(msg);
         
-        switch (msgId) {
-            case CTRLMSGID:
-                // process control messages
-                processMsg((CtrlMsg *)msg);
-                MSGQ_free(msg);
-                break;
-            case PREPROCESS_DATAMSGID:
-                msgPreProcess = (LocalDataMsg *)msg;
-                break;
-            case POSTPROCESS_DATAMSGID:
-                msgPostProcess = (LocalDataMsg *)msg;
-                break;
-            default:
-                UTL_assert( msgId < NUMMSGIDS );  //Should never happen
-                break;
+            switch (msgId) {
+                case CTRLMSGID:
+                    // process control messages
+                    if (processMsg((CtrlMsg *)msg)) {
+                        MSGQ_free(msg);
+                    }
+                    break;
+                case PREPROCESS_DATAMSGID:
+                    localDataRingPut(&thrProcess0.preRing, 
+                        (LocalDataMsg *)msg);
+                    break;
+                case POSTPROCESS_DATAMSGID:
+                    localDataRingPut(&thrProcess0.postRing, 
+                        (LocalDataMsg *)msg);
+                    break;
+                default:
+                    UTL_assert( msgId < NUMMSGIDS );  //Should never happen
+                    break;
+            }
         }
 
-        if ((msgPostProcess != NULL) && (msgPreProcess != NULL)) {
+        /*
+         *  Process every frame that has both its input and its output
+         *  buffers, up to PROCESSMAXBATCH frames per wake-up, so that the 
+         *  thread catches up when it has fallen behind, without starving
+         *  the control messages.
+         */
+        for (batch = 0; (batch < PROCESSMAXBATCH) && 
+             (thrProcess0.preRing.count > 0) && 
+             (thrProcess0.postRing.count > 0);
+             batch++) {
+
+            msgPreProcess  = localDataRingGet(&thrProcess0.preRing);
+            msgPostProcess = localDataRingGet(&thrProcess0.postRing);
 
             // record the time period between two frames of data in stsTime0
             UTL_stsPeriod( stsTime0 );
+            PRF_frameStart( &thrProcess0.prf );
 
-            // process the data
+            /*
+             *  Set up the input ICC buffer of each active channel's FIR 
+             *  cell, then filter all active channels in one batch.
+             *  The intermediate buffers never change as the same ones
+             *      are re-used for each frame of data
+             */
+            firCnt = 0;
+            for( chanNum = 0; chanNum < NUMCHANNELS; chanNum++ ) {
+                if (thrProcess0.active[ chanNum ] == TRUE) {
+                    ICC_setBuf(thrProcess0.firCellList[ chanNum ].inputIcc[0],
+                        msgPreProcess->bufChannel[chanNum], 
+                        FRAMELEN * sizeof( Sample ) );
+                    firCells[ firCnt++ ] = &thrProcess0.firCellList[ chanNum ];
+                }
+            }
+
+            UTL_stsStart( stsTime1 );  // start the stopwatch
+            PRF_cellStart( &thrProcess0.prf, THRPROCESS0_PRFFIR );
+            rc = FIR_cellExecuteBatch( firCells, firCnt );
+            PRF_cellStop( &thrProcess0.prf, THRPROCESS0_PRFFIR );
+            UTL_assert( rc == TRUE );
+
+            // process the rest of each channel
             for( chanNum = 0; chanNum < NUMCHANNELS; chanNum++ ) {
 
                 CHAN_Handle chanHandle = &thrProcess0.chanList[ chanNum ];
 
-                /*
-                 *  Set up the input and output ICC buffers for each channel
-                 *  The intermediate buffers never change as the same ones
-                 *      are re-used for each frame of data
-                 */
-                // Set the input ICC buffer
-                ICC_setBuf(chanHandle->cellSet[THRPROCESS0_CELLFIR].inputIcc[0],
-                    msgPreProcess->bufChannel[chanNum], 
-                    FRAMELEN * sizeof( Sample ) );
+                // a channel that is not active outputs silence
+                if (thrProcess0.active[ chanNum ] == FALSE) {
+                    memset( msgPostProcess->bufChannel[chanNum], 0,
+                        FRAMELEN * sizeof( Sample ) );
+                    continue;
+                }
 
                 // Set the output ICC buffer
                 ICC_setBuf(chanHandle->cellSet[THRPROCESS0_CELLVOL].outputIcc[0],
@@ -456,11 +630,11 @@ Void thrProcess0Run()
                     FRAMELEN * sizeof( Sample ) );
 
                 // execute the channel 
-                UTL_stsStart( stsTime1 );  // start the stopwatch
                 rc = CHAN_execute( chanHandle, NULL );
                 UTL_assert( rc == TRUE );
-                UTL_stsStop( stsTime1 );   // elapsed time goes to this STS 
             }
+            UTL_stsStop( stsTime1 );   // elapsed time goes to this STS 
+            PRF_frameEnd( &thrProcess0.prf );
             
             // send the message describing full output buffers to PostProcess
             status = MSGQ_put(msgqToPostProcess, (MSGQ_Msg)msgPostProcess,
@@ -471,10 +645,6 @@ Void thrProcess0Run()
             status = MSGQ_put(msgqToPreProcess, (MSGQ_Msg)msgPreProcess, 
                 PROCESS0_DATAMSGID, NULL);
             UTL_assert( status == MSGQ_SUCCESS );
-            
-            //Reset the pointers so we are ready for next frame
-            msgPostProcess = NULL;
-            msgPreProcess = NULL;
         }
     }
 }
@@ -20,6 +20,7 @@
 // RF module includes
 #include <chan.h>
 #include <icell.h>
+#include <prf.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -27,27 +28,46 @@ extern "C" {
 
 // Enumeration of channel cells (so we use names instead of numbers for index)
 enum { 
-    THRPROCESS0_CELLFIR  = 0, 
-    THRPROCESS0_CELLVOL,
+    THRPROCESS0_CELLVOL  = 0,
     THRPROCESS0_NUMCELLS 
 }; 
 
+// Profiler cell slots: the cells of each kind share one slot for all channels
+enum {
+    THRPROCESS0_PRFFIR = 0,
+    THRPROCESS0_PRFVOL,
+    THRPROCESS0_NUMPRFCELLS
+};
+
 // Definition of the structure describing the state of the thread.
 typedef struct ThrProcess0 {
+    CHAN_Obj       firChanList[ NUMCHANNELS ]; // FIR cells, run as a batch
+    ICELL_Obj      firCellList[ NUMCHANNELS ];
     CHAN_Obj       chanList[ NUMCHANNELS ];              
     ICELL_Obj      cellList[ NUMCHANNELS * THRPROCESS0_NUMCELLS ];       
-    Sample         *bufInput[ NUMCHANNELS ];
+    Sample         *bufInput[ NUMCHANNELS ];   // first set of input buffers
     Sample         *bufOutput[ NUMCHANNELS ];
-    Sample         *bufIntermediate;
+    Sample         *bufIntermediate[ NUMCHANNELS ];
+    Bool           active[ NUMCHANNELS ];   // channels executed each frame
     SEM_Obj        msgqSemObj;     // Semaphore used for MSGQ
     MSGQ_Handle    msgQueue;       // Receiving Message Queue
+    LocalDataRing  preRing;        // full input frames from PreProcess
+    LocalDataRing  postRing;       // empty output frames from PostProcess
+    PRF_Obj        prf;            // Cycle-budget profiler, read by Control
+    PRF_Cell       prfCells[ THRPROCESS0_NUMPRFCELLS ];
 } ThrProcess0; 
 
+extern ThrProcess0 thrProcess0;
+
 // prototypes for public functions 
 extern Void thrProcess0Init( Void );
 extern Void thrProcess0Startup( Void );
 extern Void thrProcess0Run( Void );
 
+// called by the Control thread to add and remove channels at run time
+extern Bool thrProcess0OpenChannel( Int chanNum );
+extern Bool thrProcess0CloseChannel( Int chanNum );
+
 #ifdef __cplusplus
 }
 #endif // extern "C" 
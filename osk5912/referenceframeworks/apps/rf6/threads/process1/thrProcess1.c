@@ -18,14 +18,22 @@
  *  interface. (since XDAIS algorithms have different processing functions with 
  *  different signatures). A channel is a collection of cells, which execute in 
  *  series. 
+ *
+ *  Only the channels marked active are executed; the others output 
+ *  silence. The Control thread opens a channel in the background before
+ *  this thread activates it, and closes it after this thread has 
+ *  deactivated it, so channels come and go at frame boundaries without
+ *  stopping the audio.
  */
 
 #include <std.h>
+#include <string.h>
 
 // DSP/BIOS includes
 #include <sem.h>
 
 // RF module includes
+#include <algrf.h>
 #include <chan.h>
 #include <icell.h>
 #include <msgq.h>
@@ -46,9 +54,10 @@
 #include "vol/cellVol.h"
 
 /*
- *  Incoming data goes into bufInputs.
+ *  Incoming data goes into bufInputs, one set of buffers per frame in
+ *  the pipeline from PreProcess.
  */
-static Sample bufInput[ NUMCHANNELS ][ FRAMELEN ];
+static Sample bufInput[ PREPROCESSDEPTH ][ NUMCHANNELS ][ FRAMELEN ];
 
 /*
  *  Thread process1 object which encapsulates the state information 
@@ -73,7 +82,7 @@ Void thrProcess1Init()
     
     // Set-up the threads's buffer pointers.
     for (i = 0; i < NUMCHANNELS; i++) {
-        thrProcess1.bufInput[i]  = bufInput[i];
+        thrProcess1.bufInput[i]  = bufInput[0][i];
     }
 
     /* 
@@ -89,6 +98,13 @@ Void thrProcess1Init()
     
     thrProcess1.msgQueue = MSGQ_create("msgqProcess1", &msgqAttrs);
     UTL_assert( thrProcess1.msgQueue != NULL );
+
+    localDataRingInit( &thrProcess1.preRing );
+    localDataRingInit( &thrProcess1.postRing );
+
+    // The thread must finish each frame before the codec needs the next
+    PRF_new( &thrProcess1.prf, PRF_deadline( FRAMELEN, CODECSAMPLERATE ),
+        thrProcess1.prfCells, THRPROCESS1_NUMPRFCELLS );
         
     setParamsAndStartChannels( FALSE );
 }
@@ -124,7 +140,6 @@ static Void setParamsAndStartChannels( Bool doChannelOpen )
     Bool        rc;    
     ICC_Handle  inputIcc;
     ICC_Handle  outputIcc;
-    
 
     for (chanNum = 0; chanNum < NUMCHANNELS; chanNum++) {
 
@@ -154,7 +169,7 @@ static Void setParamsAndStartChannels( Bool doChannelOpen )
             cell->cellFxns       = &VOL_CELLFXNS;            
             cell->algFxns        = (IALG_Fxns *)&VOL_IVOL;
             cell->algParams      = (IALG_Params *)&volParams;
-            cell->scrBucketIndex = THRPROCESSSCRBUCKET;
+            cell->scrBucketIndex = THRPROCESS1SCRBUCKET;
 
             inputIcc  = (ICC_Handle)ICC_linearCreate( 
                                    thrProcess1.bufInput[ chanNum ], 
@@ -169,47 +184,97 @@ static Void setParamsAndStartChannels( Bool doChannelOpen )
             // Only one input and one output ICC are needed.
             rc = CHAN_regCell( cell, &inputIcc, 1, &outputIcc, 1 );
         }
+        else if (chanNum < NUMINITCHANNELS) {
+            rc = thrProcess1OpenChannel( chanNum );
+            thrProcess1.active[ chanNum ] = TRUE;
+        }
         else {
-
-            /*
-             *  Since volParams is a local variable, it needs to
-             *  be set-up again for proper creation of the algorithms.
-             */ 
-            thrProcess1.cellList[ (chanNum * THRPROCESS1_NUMCELLS) + 
-                THRPROCESS1_CELLVOL ].algParams = (IALG_Params *)&volParams;
-
-            UTL_logDebug1("Channel Number: %d", chanNum);
-
-            // open the channel: this causes the algorithms to be created
-            rc = CHAN_open( &thrProcess1.chanList[ chanNum ], 
-                &thrProcess1.cellList[ chanNum * THRPROCESS1_NUMCELLS ], 
-                THRPROCESS1_NUMCELLS,
-                NULL );
+            // the Control thread opens the channel if it is added later
+            rc = TRUE;
         }
         UTL_assert( rc == TRUE );
     }
 }
 
+/*
+ *  ======== thrProcess1OpenChannel ========
+ *
+ *  Opens channel chanNum, which creates its algorithms. Called at startup
+ *  for the initial channels, and by the Control thread, in its own 
+ *  context, for a channel added while this thread runs; the channel is
+ *  executed only once this thread has processed the MSGADDCHAN message.
+ */
+Bool thrProcess1OpenChannel( Int chanNum )
+{
+    IVOL_Params volParams;    
+    CHAN_Attrs  chanAttrs;
+    
+    // the VOL cells of all channels are profiled in one slot
+    chanAttrs         = CHAN_ATTRS;
+    chanAttrs.prf     = &thrProcess1.prf;
+    chanAttrs.prfCell = THRPROCESS1_PRFVOL;
+
+    /*
+     *  Since volParams is a local variable, it needs to
+     *  be set-up again for proper creation of the algorithms.
+     */ 
+    volParams           = IVOL_PARAMS;
+    volParams.frameSize = FRAMELEN;        
+    thrProcess1.cellList[ (chanNum * THRPROCESS1_NUMCELLS) + 
+        THRPROCESS1_CELLVOL ].algParams = (IALG_Params *)&volParams;
+
+    UTL_logDebug1("Channel Number: %d", chanNum);
+
+    // open the channel: this causes the algorithms to be created
+    return CHAN_open( &thrProcess1.chanList[ chanNum ], 
+        &thrProcess1.cellList[ chanNum * THRPROCESS1_NUMCELLS ], 
+        THRPROCESS1_NUMCELLS,
+        &chanAttrs );
+}
+
+/*
+ *  ======== thrProcess1CloseChannel ========
+ *
+ *  Closes channel chanNum, which deletes its algorithms. Called by the
+ *  Control thread once this thread has processed the MSGREMOVECHAN 
+ *  message, and so no longer executes the channel.
+ */
+Bool thrProcess1CloseChannel( Int chanNum )
+{
+    return CHAN_close( &thrProcess1.chanList[ chanNum ] );
+}
+
 
 /*
  *  ======== processMsg ========
  *
  *  Processes messages for the task.
- *  Called from the thread's run() function.
+ *  Called from the thread's run() function, between frames. Returns 
+ *  TRUE if the caller is to free the message.
  */
-static Void processMsg(CtrlMsg *rxMsg)
+static Bool processMsg(CtrlMsg *rxMsg)
 {
     Int chanNum;
     ICELL_Handle hCell;
+    MSGQ_Status status;
 
     /* 
      *  The format we expect for a message, i.e. {cmd, arg1, arg2} is: 
-     *  volume change message: { MSGNEWVOL, channel #, volume value },
+     *  1. volume change message: { MSGNEWVOL, channel #, volume value },
+     *  2. channel add message: { MSGADDCHAN, channel #, thread # },
+     *  3. channel remove message: { MSGREMOVECHAN, channel #, thread # }.
      */
     chanNum = rxMsg->arg1;
         
     // Process only messages with valid channel number
     if ( (chanNum >= 0) && (chanNum < NUMCHANNELS) ) {
+
+        // a channel that is not active may have no algorithms to control
+        if ((thrProcess1.active[ chanNum ] == FALSE) && 
+            (rxMsg->cmd != MSGADDCHAN)) {
+            return (TRUE);
+        }
+
         switch (rxMsg->cmd) {        
             case MSGNEWVOL:
                 {
@@ -224,6 +289,7 @@ static Void processMsg(CtrlMsg *rxMsg)
                      *  get current contents of the control structure 
                      *  to avoid overriding non-modified ones 
                      */
+                    volStatus.size = sizeof( volStatus );
                     VOL_cellControl( hCell, IVOL_GETSTATUS, 
                         (IALG_Status *)&volStatus );
                     volStatus.gainPercentage = rxMsg->arg2; 
@@ -235,10 +301,34 @@ static Void processMsg(CtrlMsg *rxMsg)
                 }
                 break;
 
+            case MSGADDCHAN:
+                // the Control thread has opened the channel
+                thrProcess1.active[ chanNum ] = TRUE;
+                UTL_logDebug1("Adding channel %d", chanNum);
+                break;
+
+            case MSGREMOVECHAN:
+                thrProcess1.active[ chanNum ] = FALSE;
+
+                // the scratch bucket must not be left to the VOL algorithm
+                hCell = &thrProcess1.cellList[THRPROCESS1_CELLVOL +  
+                    chanNum * THRPROCESS1_NUMCELLS];
+                ALGRF_deactivateLazy( hCell->algHandle, hCell->scrBucketIndex );
+                UTL_logDebug1("Removing channel %d", chanNum);
+
+                // hand the message back to the Control thread, to close it
+                rxMsg->cmd = MSGCLOSECHAN;
+                status = MSGQ_put(MSGQ_getReplyHandle((MSGQ_Msg)rxMsg), 
+                    (MSGQ_Msg)rxMsg, CLOSECHANMSGID, NULL);
+                UTL_assert( status == MSGQ_SUCCESS );
+                return (FALSE);
+
             default:
                 break;
         }
     }
+
+    return (TRUE);
 }
 
 /*
@@ -251,7 +341,9 @@ Void thrProcess1Run()
     Int i;
     Int chanNum;
     Bool rc; 
-    Uns msgId;   
+    Int batch;
+    Uns msgId;
+    Uns timeout;
     MSGQ_Msg msg;
     LocalDataMsg *msgPreProcess, *msgPostProcess;
     MSGQ_Status status;
@@ -267,60 +359,97 @@ Void thrProcess1Run()
     status = MSGQ_locate("msgqPostProcessCodec", &msgqToPostProcess, NULL);     
     UTL_assert( status == MSGQ_SUCCESS );
 
-    // Fill in the priming message
-    msgPreProcess = (LocalDataMsg *)MSGQ_alloc(LOCALMQABUFID,
-        sizeof(LocalDataMsg));
-    UTL_assert( msgPreProcess != NULL );
-    for (i = 0; i < NUMCHANNELS; i++) {
-        msgPreProcess->bufChannel[i] = thrProcess1.bufInput[i];
-    }
-
     /*
-     *  Prime the MSGQ of the preceding task in the processing chain.
+     *  Prime the MSGQ of the preceding task in the processing chain, with
+     *  one message per frame in the pipeline.
      *  The convention here is for the task appearing later in the data flow
-     *     to prime the MSGQ of the task(s) preceding it.
+     *  to prime the MSGQ of the task(s) preceding it.
      */ 
-    status = MSGQ_put(msgqToPreProcess, (MSGQ_Msg)msgPreProcess,
-        PROCESS1_DATAMSGID, NULL);
-    UTL_assert( status == MSGQ_SUCCESS );
-    
-    /* Reset the message pointers */    
-    msgPreProcess = NULL;
-    msgPostProcess = NULL;
+    for (i = 0; i < PREPROCESSDEPTH; i++) {
+
+        // Fill in the priming message
+        msgPreProcess = (LocalDataMsg *)MSGQ_alloc(LOCALMQABUFID, 
+            sizeof(LocalDataMsg));
+        UTL_assert( msgPreProcess != NULL );
+        for (chanNum = 0; chanNum < NUMCHANNELS; chanNum++) {
+            msgPreProcess->bufChannel[chanNum] = bufInput[i][chanNum];
+        }
+
+        status = MSGQ_put(msgqToPreProcess, (MSGQ_Msg)msgPreProcess,
+            PROCESS1_DATAMSGID, NULL);
+        UTL_assert( status == MSGQ_SUCCESS );
+    }
      
     // Main loop
     while (TRUE) {
-        msg = MSGQ_get(thrProcess1.msgQueue, SYS_FOREVER);
-        UTL_assert(msg != NULL);  //MSGQ internal error
-        msgId = MSGQ_getMsgId(msg);
-        
-        switch (msgId) {
-            case CTRLMSGID:
-                // process control messages 
-                processMsg((CtrlMsg *)msg);             
-                MSGQ_free(msg);
-                break;
-            case PREPROCESS_DATAMSGID:
-                msgPreProcess = (LocalDataMsg *)msg;
-                break;
-            case POSTPROCESS_DATAMSGID:
-                msgPostProcess = (LocalDataMsg *)msg;
-                break;
-            default:
-                UTL_assert( msgId < NUMMSGIDS );  //Should never happen    
-                break;           
+
+        /*
+         *  Block only if there is no frame left to process; otherwise 
+         *  just collect the messages that have arrived in the meantime.
+         */
+        if ((thrProcess1.preRing.count > 0) && 
+            (thrProcess1.postRing.count > 0)) {
+            timeout = SYS_POLL;
         }
+        else {
+            timeout = SYS_FOREVER;
+        }
+
+        for (msg = MSGQ_get(thrProcess1.msgQueue, timeout); msg != NULL; 
+             msg = MSGQ_get(thrProcess1.msgQueue, SYS_POLL)) {
+            msgId = MSGQ_getMsgId(msg);
         
-        if ((msgPostProcess != NULL) && (msgPreProcess != NULL)) {
+            switch (msgId) {
+                case CTRLMSGID:
+                    // process control messages
+                    if (processMsg((CtrlMsg *)msg)) {
+                        MSGQ_free(msg);
+                    }
+                    break;
+                case PREPROCESS_DATAMSGID:
+                    localDataRingPut(&thrProcess1.preRing, 
+                        (LocalDataMsg *)msg);
+                    break;
+                case POSTPROCESS_DATAMSGID:
+                    localDataRingPut(&thrProcess1.postRing, 
+                        (LocalDataMsg *)msg);
+                    break;
+                default:
+                    UTL_assert( msgId < NUMMSGIDS );  //Should never happen
+                    break;
+            }
+        }
+
+        /*
+         *  Process every frame that has both its input and its output
+         *  buffers, up to PROCESSMAXBATCH frames per wake-up, so that the 
+         *  thread catches up when it has fallen behind, without starving
+         *  the control messages.
+         */
+        for (batch = 0; (batch < PROCESSMAXBATCH) && 
+             (thrProcess1.preRing.count > 0) && 
+             (thrProcess1.postRing.count > 0);
+             batch++) {
+
+            msgPreProcess  = localDataRingGet(&thrProcess1.preRing);
+            msgPostProcess = localDataRingGet(&thrProcess1.postRing);
 
             // record the time period between two frames of data in stsTime2
             UTL_stsPeriod( stsTime2 );
+            PRF_frameStart( &thrProcess1.prf );
 
             // process the data
             for( chanNum = 0; chanNum < NUMCHANNELS; chanNum++ ) {
 
                 CHAN_Handle chanHandle = &thrProcess1.chanList[ chanNum ];
 
+                // a channel that is not active outputs silence
+                if (thrProcess1.active[ chanNum ] == FALSE) {
+                    memset( msgPostProcess->bufChannel[chanNum], 0,
+                        FRAMELEN * sizeof( Sample ) );
+                    continue;
+                }
+
                 /*
                  *  Set up the input and output ICC buffers for each channel
                  */
@@ -340,6 +469,7 @@ Void thrProcess1Run()
                 UTL_assert( rc == TRUE );
                 UTL_stsStop( stsTime3 );   // elapsed time goes to this STS 
             }
+            PRF_frameEnd( &thrProcess1.prf );
             
             // send the message describing full output buffers to PostProcess
             status = MSGQ_put(msgqToPostProcess, (MSGQ_Msg)msgPostProcess,
@@ -350,10 +480,6 @@ Void thrProcess1Run()
             status = MSGQ_put(msgqToPreProcess, (MSGQ_Msg)msgPreProcess, 
                 PROCESS1_DATAMSGID, NULL);
             UTL_assert( status == MSGQ_SUCCESS );
-            
-            //Reset the pointers so we are ready for next frame
-            msgPostProcess = NULL;
-            msgPreProcess = NULL;  
         }                  
     }
 }
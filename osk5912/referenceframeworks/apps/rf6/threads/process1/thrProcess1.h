@@ -20,6 +20,7 @@
 // RF module includes
 #include <chan.h>
 #include <icell.h>
+#include <prf.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -31,21 +32,38 @@ enum {
     THRPROCESS1_NUMCELLS 
 }; 
 
+// Profiler cell slots: the cells of each kind share one slot for all channels
+enum {
+    THRPROCESS1_PRFVOL = 0,
+    THRPROCESS1_NUMPRFCELLS
+};
+
 // Definition of the structure describing the state of the thread.
 typedef struct ThrProcess1 {
     CHAN_Obj       chanList[ NUMCHANNELS ];              
     ICELL_Obj      cellList[ NUMCHANNELS * THRPROCESS1_NUMCELLS ];       
-    Sample         *bufInput[ NUMCHANNELS ];
+    Sample         *bufInput[ NUMCHANNELS ];   // first set of input buffers
     Sample         *bufOutput[ NUMCHANNELS ];
+    Bool           active[ NUMCHANNELS ];   // channels executed each frame
     SEM_Obj        msgqSemObj;     // Semaphore used for MSGQ
     MSGQ_Handle    msgQueue;       // Receiving Message Queue
+    LocalDataRing  preRing;        // full input frames from PreProcess
+    LocalDataRing  postRing;       // empty output frames from PostProcess
+    PRF_Obj        prf;            // Cycle-budget profiler, read by Control
+    PRF_Cell       prfCells[ THRPROCESS1_NUMPRFCELLS ];
 } ThrProcess1; 
 
+extern ThrProcess1 thrProcess1;
+
 // prototypes for public functions
 extern Void thrProcess1Init( Void );
 extern Void thrProcess1Startup( Void );
 extern Void thrProcess1Run( Void );
 
+// called by the Control thread to add and remove channels at run time
+extern Bool thrProcess1OpenChannel( Int chanNum );
+extern Bool thrProcess1CloseChannel( Int chanNum );
+
 #ifdef __cplusplus
 }
 #endif // extern "C" 
@@ -26,6 +26,14 @@ timake src/icc/icc54.pjt DEBUG -a
 timake src/icc/icc54f.pjt DEBUG -a
 timake src/icc/icc55.pjt DEBUG -a
 timake src/icc/icc55l.pjt DEBUG -a
+timake src/ilv/ilv54.pjt DEBUG -a
+timake src/ilv/ilv54f.pjt DEBUG -a
+timake src/ilv/ilv55.pjt DEBUG -a
+timake src/ilv/ilv55l.pjt DEBUG -a
+timake src/prf/prf54.pjt DEBUG -a
+timake src/prf/prf54f.pjt DEBUG -a
+timake src/prf/prf55.pjt DEBUG -a
+timake src/prf/prf55l.pjt DEBUG -a
 timake src/scom/scom54.pjt DEBUG -a
 timake src/scom/scom54f.pjt DEBUG -a
 timake src/scom/scom55.pjt DEBUG -a
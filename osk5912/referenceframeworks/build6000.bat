@@ -12,6 +12,10 @@ timake src/chan/chan62.pjt DEBUG -a
 timake src/chan/chan64.pjt DEBUG -a
 timake src/icc/icc62.pjt DEBUG -a
 timake src/icc/icc64.pjt DEBUG -a
+timake src/ilv/ilv62.pjt DEBUG -a
+timake src/ilv/ilv64.pjt DEBUG -a
+timake src/prf/prf62.pjt DEBUG -a
+timake src/prf/prf64.pjt DEBUG -a
 timake src/scom/scom62.pjt DEBUG -a
 timake src/scom/scom64.pjt DEBUG -a
 timake src/sscr/sscr62.pjt DEBUG -a
@@ -0,0 +1,34 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== atm.h ========
+ *  Host build: atomic operations. Single-threaded, as HWI.
+ */
+#ifndef ATM_
+#define ATM_
+
+#include <std.h>
+
+static inline Int ATM_seti(volatile Int *dst, Int src)
+{
+    Int old = *dst;
+
+    *dst = src;
+    return (old);
+}
+
+static inline Uns ATM_setu(volatile Uns *dst, Uns src)
+{
+    Uns old = *dst;
+
+    *dst = src;
+    return (old);
+}
+
+#endif /* ATM_ */
@@ -0,0 +1,44 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== clk.c ========
+ *  Host build: CLK on the host monotonic clock.
+ */
+#include <time.h>
+
+#include <std.h>
+#include <clk.h>
+
+/*
+ *  ======== CLK_gethtime ========
+ */
+LgUns CLK_gethtime(Void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((LgUns)ts.tv_sec * 1000000000UL + (LgUns)ts.tv_nsec);
+}
+
+/*
+ *  ======== CLK_getltime ========
+ */
+LgUns CLK_getltime(Void)
+{
+    return (CLK_gethtime() / 1000000UL);
+}
+
+/*
+ *  ======== CLK_countspms ========
+ */
+LgUns CLK_countspms(Void)
+{
+    return (1000000UL);
+}
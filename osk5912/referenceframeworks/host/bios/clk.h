@@ -0,0 +1,32 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== clk.h ========
+ *  Host build: the high-resolution clock is the host monotonic clock in
+ *  nanoseconds, so CLK_countspms() is 1000000. The low-resolution clock
+ *  ticks every millisecond.
+ */
+#ifndef CLK_
+#define CLK_
+
+#include <std.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern LgUns CLK_gethtime(Void);
+extern LgUns CLK_getltime(Void);
+extern LgUns CLK_countspms(Void);
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* CLK_ */
@@ -0,0 +1,44 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== hwi.c ========
+ *  Host build: the HWI dispatcher's table of plugged ISRs.
+ */
+#include <std.h>
+#include <hwi.h>
+
+typedef struct Vector {
+    Fxn     fxn;
+    Arg     arg;
+} Vector;
+
+static Vector vectors[ HWI_NUMVECS ];
+
+/*
+ *  ======== HWI_dispatchPlug ========
+ *  The masks do not matter on the host: an ISR runs to completion before
+ *  the peripheral model that posted it goes on.
+ */
+Void HWI_dispatchPlug(Int vecid, Fxn fxn, HWI_Attrs *attrs)
+{
+    if (vecid >= 0 && vecid < HWI_NUMVECS) {
+        vectors[ vecid ].fxn = fxn;
+        vectors[ vecid ].arg = (attrs != NULL) ? attrs->arg : NULL;
+    }
+}
+
+/*
+ *  ======== HWI_post ========
+ */
+Void HWI_post(Int vecid)
+{
+    if (vecid >= 0 && vecid < HWI_NUMVECS && vectors[ vecid ].fxn != NULL) {
+        (*vectors[ vecid ].fxn)(vectors[ vecid ].arg);
+    }
+}
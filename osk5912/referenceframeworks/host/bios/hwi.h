@@ -0,0 +1,48 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== hwi.h ========
+ *  Host build: there are no interrupts, and the RF modules run in one
+ *  host thread, so the critical sections reduce to nothing. An ISR
+ *  plugged with HWI_dispatchPlug() runs when a peripheral model calls
+ *  HWI_post() for its vector.
+ */
+#ifndef HWI_
+#define HWI_
+
+#include <std.h>
+
+#define HWI_NUMVECS     32      /* vectors HWI_dispatchPlug() can plug */
+
+typedef struct HWI_Attrs {
+    Uns     ier0mask;   /* interrupts masked while the ISR runs */
+    Uns     ier1mask;
+    Arg     arg;        /* argument passed to the ISR */
+} HWI_Attrs;
+
+extern Void HWI_dispatchPlug(Int vecid, Fxn fxn, HWI_Attrs *attrs);
+
+/* host only: take interrupt vecid, running the ISR plugged for it */
+extern Void HWI_post(Int vecid);
+
+static inline Uns HWI_disable(Void)
+{
+    return (0);
+}
+
+static inline Void HWI_enable(Void)
+{
+}
+
+static inline Void HWI_restore(Uns state)
+{
+    (Void)state;
+}
+
+#endif /* HWI_ */
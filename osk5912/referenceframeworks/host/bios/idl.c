@@ -0,0 +1,30 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== idl.c ========
+ *  Host build: IDL_run().
+ */
+#include <stdlib.h>
+
+#include <std.h>
+#include <idl.h>
+#include <log.h>
+
+/*
+ *  ======== IDL_run ========
+ *  On the target this runs the idle functions, CCS's link among them.
+ *  On the host a caller spinning here after an error (UTL_error()) is
+ *  waiting for a halt that will never come, so end the program.
+ */
+Void IDL_run(Void)
+{
+    if (LOG_errorCnt != 0) {
+        exit(EXIT_FAILURE);
+    }
+}
@@ -0,0 +1,30 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== idl.h ========
+ *  Host build: there is no idle loop. The only caller in the RF modules
+ *  is UTL_error(), which spins on IDL_run() to halt the target; on the
+ *  host IDL_run() ends the program instead once an error is logged.
+ */
+#ifndef IDL_
+#define IDL_
+
+#include <std.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern Void IDL_run(Void);
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* IDL_ */
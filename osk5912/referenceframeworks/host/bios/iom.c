@@ -0,0 +1,22 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== iom.c ========
+ *  Host build: IOM_mdNotImpl().
+ */
+#include <std.h>
+#include <iom.h>
+
+/*
+ *  ======== IOM_mdNotImpl ========
+ */
+Int IOM_mdNotImpl(Void)
+{
+    return (IOM_ENOTIMPL);
+}
@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== iom.h ========
+ *  Host build: the IOM mini-driver interface, as in DSP/BIOS, so that a
+ *  mini-driver can be called through its IOM_Fxns table the way the class
+ *  driver does.
+ */
+#ifndef IOM_
+#define IOM_
+
+#include <std.h>
+#include <que.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* mode of a channel */
+#define IOM_INPUT           0x0001
+#define IOM_OUTPUT          0x0002
+#define IOM_INOUT           (IOM_INPUT | IOM_OUTPUT)
+
+/* status codes */
+#define IOM_COMPLETED       0       /* I/O completed */
+#define IOM_PENDING         1       /* I/O queued and pending */
+#define IOM_FLUSHED         2       /* request flushed */
+#define IOM_ABORTED         3       /* request aborted */
+
+#define IOM_EBADIO          -1      /* generic failure */
+#define IOM_ETIMEOUT        -2      /* timeout */
+#define IOM_ENOPACKETS      -3      /* no packets available */
+#define IOM_EFREE           -4      /* unable to free resources */
+#define IOM_EALLOC          -5      /* unable to allocate resources */
+#define IOM_EABORT          -6      /* I/O aborted */
+#define IOM_EBADMODE        -7      /* illegal device mode */
+#define IOM_EOF             -8      /* end of file */
+#define IOM_ENOTIMPL        -9      /* operation not supported */
+#define IOM_EBADARGS        -10     /* illegal arguments */
+#define IOM_ETIMEOUTUNREC   -11     /* unrecoverable timeout */
+#define IOM_EINUSE          -12     /* device already in use */
+
+/* packet commands */
+#define IOM_READ            0
+#define IOM_WRITE           1
+#define IOM_ABORT           2
+#define IOM_FLUSH           3
+#define IOM_USER            128     /* first driver-defined command */
+
+/* control commands */
+#define IOM_CHAN_RESET      0       /* reset the channel */
+#define IOM_CHAN_TIMEDOUT   1       /* the class driver timed out */
+#define IOM_DEVICE_RESET    2       /* reset the device */
+
+typedef struct IOM_Packet {
+    QUE_Elem    link;       /* queue link, for the driver */
+    Ptr         addr;       /* buffer address */
+    Uns         size;       /* buffer size */
+    Arg         misc;       /* reserved for the class driver */
+    Arg         arg;        /* user argument */
+    Uns         cmd;        /* IOM_READ, IOM_WRITE, ... */
+    Int         status;     /* IOM_COMPLETED, ... */
+} IOM_Packet;
+
+typedef Void (*IOM_TiomCallback)(Ptr arg, IOM_Packet *packet);
+
+typedef Int (*IOM_TmdBindDev)(Ptr *devp, Int devid, Ptr devParams);
+typedef Int (*IOM_TmdUnBindDev)(Ptr devp);
+typedef Int (*IOM_TmdControlChan)(Ptr chanp, Uns cmd, Ptr args);
+typedef Int (*IOM_TmdCreateChan)(Ptr *chanp, Ptr devp, String name,
+                                 Int mode, Ptr chanParams,
+                                 IOM_TiomCallback cbFxn, Ptr cbArg);
+typedef Int (*IOM_TmdDeleteChan)(Ptr chanp);
+typedef Int (*IOM_TmdSubmitChan)(Ptr chanp, IOM_Packet *packet);
+
+typedef struct IOM_Fxns {
+    IOM_TmdBindDev      mdBindDev;
+    IOM_TmdUnBindDev    mdUnBindDev;
+    IOM_TmdControlChan  mdControlChan;
+    IOM_TmdCreateChan   mdCreateChan;
+    IOM_TmdDeleteChan   mdDeleteChan;
+    IOM_TmdSubmitChan   mdSubmitChan;
+} IOM_Fxns;
+
+/* returns IOM_ENOTIMPL, for the functions a mini-driver leaves out */
+extern Int IOM_mdNotImpl(Void);
+
+#define IOM_BINDDEVNOTIMPL      ((IOM_TmdBindDev)IOM_mdNotImpl)
+#define IOM_UNBINDDEVNOTIMPL    ((IOM_TmdUnBindDev)IOM_mdNotImpl)
+#define IOM_CONTROLCHANNOTIMPL  ((IOM_TmdControlChan)IOM_mdNotImpl)
+#define IOM_CREATECHANNOTIMPL   ((IOM_TmdCreateChan)IOM_mdNotImpl)
+#define IOM_DELETECHANNOTIMPL   ((IOM_TmdDeleteChan)IOM_mdNotImpl)
+#define IOM_SUBMITCHANNOTIMPL   ((IOM_TmdSubmitChan)IOM_mdNotImpl)
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* IOM_ */
@@ -0,0 +1,110 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== log.c ========
+ *  Host build: LOG and SYS. Everything goes to stderr so that stdout is
+ *  left to the host program's own report.
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <std.h>
+#include <log.h>
+#include <sys.h>
+
+LOG_Obj LOG_system = LOG_OBJ("system");
+
+Uns LOG_errorCnt = 0;
+
+static Void logLine(LOG_Handle log, String format, va_list ap)
+{
+    if (log == NULL || !log->enabled) {
+        return;
+    }
+
+    fprintf(stderr, "%s: ", log->name);
+    vfprintf(stderr, format, ap);
+    fputc('\n', stderr);
+    log->count++;
+}
+
+/*
+ *  ======== LOG_printf ========
+ */
+Void LOG_printf(LOG_Handle log, String format, ...)
+{
+    va_list ap;
+
+    va_start(ap, format);
+    logLine(log, format, ap);
+    va_end(ap);
+}
+
+/*
+ *  ======== LOG_error ========
+ */
+Void LOG_error(String format, Arg arg0)
+{
+    LOG_errorCnt++;
+
+    if (LOG_system.enabled) {
+        fprintf(stderr, "%s: error: ", LOG_system.name);
+        fprintf(stderr, format, arg0);
+        fputc('\n', stderr);
+        LOG_system.count++;
+    }
+}
+
+/*
+ *  ======== LOG_message ========
+ */
+Void LOG_message(String format, Arg arg0)
+{
+    LOG_printf(LOG_D_system, format, arg0);
+}
+
+/*
+ *  ======== LOG_enable ========
+ */
+Void LOG_enable(LOG_Handle log)
+{
+    log->enabled = TRUE;
+}
+
+/*
+ *  ======== LOG_disable ========
+ */
+Void LOG_disable(LOG_Handle log)
+{
+    log->enabled = FALSE;
+}
+
+/*
+ *  ======== SYS_abort ========
+ */
+Void SYS_abort(String fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    fputc('\n', stderr);
+
+    exit(EXIT_FAILURE);
+}
+
+/*
+ *  ======== SYS_exit ========
+ */
+Void SYS_exit(Int status)
+{
+    exit(status);
+}
@@ -0,0 +1,49 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== log.h ========
+ *  Host build: LOG objects print to stderr, one line per LOG_printf(),
+ *  prefixed with the name of the log. LOG_printf() takes up to two
+ *  arguments, as on the target.
+ */
+#ifndef LOG_
+#define LOG_
+
+#include <std.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct LOG_Obj {
+    String  name;       /* printed in front of every line */
+    Bool    enabled;
+    Uns     count;      /* lines printed so far */
+} LOG_Obj, *LOG_Handle;
+
+#define LOG_OBJ(name)   { (name), TRUE, 0 }
+
+/* the system log, where LOG_error() and LOG_message() go */
+extern LOG_Obj LOG_system;
+#define LOG_D_system    (&LOG_system)
+
+/* host only: number of LOG_error() calls so far */
+extern Uns LOG_errorCnt;
+
+extern Void LOG_printf(LOG_Handle log, String format, ...);
+extern Void LOG_error(String format, Arg arg0);
+extern Void LOG_message(String format, Arg arg0);
+extern Void LOG_enable(LOG_Handle log);
+extern Void LOG_disable(LOG_Handle log);
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* LOG_ */
@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== mem.c ========
+ *  Host build: MEM heaps. Blocks come from the C library with the
+ *  requested alignment; each segment counts the MAUs it has handed out
+ *  so that UTL_showHeapUsage() and the benchmark report work as usual.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include <std.h>
+#include <mem.h>
+
+typedef struct MemSeg {
+    Uns     used;
+    Uns     peak;
+} MemSeg;
+
+static MemSeg memSegs[ MEM_NUMSEGS ];
+
+/*
+ *  ======== MEM_alloc ========
+ */
+Ptr MEM_alloc(Int segid, Uns size, Uns align)
+{
+    Ptr buf;
+
+    if (segid < 0 || segid >= MEM_NUMSEGS || size == 0) {
+        return (MEM_ILLEGAL);
+    }
+
+    /* posix_memalign() wants a power of two no smaller than a pointer */
+    if (align < sizeof(Ptr)) {
+        align = sizeof(Ptr);
+    }
+    if (posix_memalign(&buf, align, size) != 0) {
+        return (MEM_ILLEGAL);
+    }
+
+    memSegs[segid].used += size;
+    if (memSegs[segid].used > memSegs[segid].peak) {
+        memSegs[segid].peak = memSegs[segid].used;
+    }
+
+    return (buf);
+}
+
+/*
+ *  ======== MEM_calloc ========
+ */
+Ptr MEM_calloc(Int segid, Uns size, Uns align)
+{
+    Ptr buf = MEM_alloc(segid, size, align);
+
+    if (buf != MEM_ILLEGAL) {
+        memset(buf, 0, size);
+    }
+
+    return (buf);
+}
+
+/*
+ *  ======== MEM_free ========
+ */
+Bool MEM_free(Int segid, Ptr buf, Uns size)
+{
+    if (segid < 0 || segid >= MEM_NUMSEGS || buf == NULL) {
+        return (FALSE);
+    }
+
+    memSegs[segid].used -= size;
+    free(buf);
+
+    return (TRUE);
+}
+
+/*
+ *  ======== MEM_stat ========
+ *  The host heap has no fixed size; report it as exactly what is in use.
+ */
+Bool MEM_stat(Int segid, MEM_Stat *statbuf)
+{
+    if (segid < 0 || segid >= MEM_NUMSEGS) {
+        return (FALSE);
+    }
+
+    statbuf->used   = memSegs[segid].used;
+    statbuf->size   = memSegs[segid].used;
+    statbuf->length = 0;
+
+    return (TRUE);
+}
+
+/*
+ *  ======== MEM_peak ========
+ */
+Uns MEM_peak(Int segid)
+{
+    return ((segid >= 0 && segid < MEM_NUMSEGS) ? memSegs[segid].peak : 0);
+}
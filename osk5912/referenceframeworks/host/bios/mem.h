@@ -0,0 +1,45 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== mem.h ========
+ *  Host build: MEM heaps on top of the C library heap. Each segment id
+ *  keeps its own usage count so that heap reports still mean something;
+ *  MEM_NUMSEGS segments are available, numbered from 0.
+ */
+#ifndef MEM_
+#define MEM_
+
+#include <std.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MEM_NUMSEGS     4
+#define MEM_ILLEGAL     ((Ptr)NULL)
+
+typedef struct MEM_Stat {
+    Uns     size;       /* configured size of the segment */
+    Uns     used;       /* MAUs currently allocated */
+    Uns     length;     /* largest free block */
+} MEM_Stat;
+
+extern Ptr  MEM_alloc(Int segid, Uns size, Uns align);
+extern Ptr  MEM_calloc(Int segid, Uns size, Uns align);
+extern Bool MEM_free(Int segid, Ptr buf, Uns size);
+extern Bool MEM_stat(Int segid, MEM_Stat *statbuf);
+
+/* host only: peak usage of segid since startup */
+extern Uns  MEM_peak(Int segid);
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* MEM_ */
@@ -0,0 +1,65 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== que.h ========
+ *  Host build: QUE doubly linked queues, as in DSP/BIOS.
+ */
+#ifndef QUE_
+#define QUE_
+
+#include <std.h>
+
+typedef struct QUE_Elem {
+    struct QUE_Elem *next;
+    struct QUE_Elem *prev;
+} QUE_Elem, QUE_Obj, *QUE_Handle;
+
+static inline Void QUE_new(QUE_Handle queue)
+{
+    queue->next = queue;
+    queue->prev = queue;
+}
+
+static inline Bool QUE_empty(QUE_Handle queue)
+{
+    return ((Bool)(queue->next == queue));
+}
+
+static inline Void QUE_put(QUE_Handle queue, Ptr elem)
+{
+    QUE_Elem *e = (QUE_Elem *)elem;
+
+    e->next           = queue;
+    e->prev           = queue->prev;
+    queue->prev->next = e;
+    queue->prev       = e;
+}
+
+/* returns queue itself when the queue is empty, as in DSP/BIOS */
+static inline Ptr QUE_get(QUE_Handle queue)
+{
+    QUE_Elem *e = queue->next;
+
+    queue->next   = e->next;
+    e->next->prev = queue;
+    return ((Ptr)e);
+}
+
+/* the same, for callers that already have interrupts disabled */
+static inline Void QUE_enqueue(QUE_Handle queue, Ptr elem)
+{
+    QUE_put(queue, elem);
+}
+
+static inline Ptr QUE_dequeue(QUE_Handle queue)
+{
+    return (QUE_get(queue));
+}
+
+#endif /* QUE_ */
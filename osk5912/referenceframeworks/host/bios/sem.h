@@ -0,0 +1,51 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== sem.h ========
+ *  Host build: counting semaphores. With a single host thread nothing
+ *  can post while a caller waits, so SEM_pend() on a zero count fails
+ *  at once whatever the timeout.
+ */
+#ifndef SEM_
+#define SEM_
+
+#include <std.h>
+#include <sys.h>
+
+typedef struct SEM_Obj {
+    Int     count;
+} SEM_Obj, *SEM_Handle;
+
+static inline Void SEM_new(SEM_Handle sem, Int count)
+{
+    sem->count = count;
+}
+
+static inline Void SEM_post(SEM_Handle sem)
+{
+    sem->count++;
+}
+
+static inline Bool SEM_pend(SEM_Handle sem, Uns timeout)
+{
+    (Void)timeout;
+
+    if (sem->count == 0) {
+        return (FALSE);
+    }
+    sem->count--;
+    return (TRUE);
+}
+
+static inline Int SEM_count(SEM_Handle sem)
+{
+    return (sem->count);
+}
+
+#endif /* SEM_ */
@@ -0,0 +1,268 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== sio.c ========
+ *  Host build: SIO streams looped back onto each other. Each stream
+ *  keeps the buffers issued on it in order: todo holds those not yet
+ *  transferred, done those ready to be reclaimed. A transfer copies an
+ *  output buffer into an input buffer, as a channel of DSP/BIOS Link
+ *  copies it between the DSP and the GPP.
+ */
+#include <string.h>
+
+#include <std.h>
+#include <sio.h>
+#include <sys.h>
+
+#define MAXSTREAMS      8       /* streams, open or looped back */
+#define MAXNAMELEN      32
+
+typedef struct SioQueue {
+    Ptr     bufs[ SIO_MAXBUFS ];
+    Uns     sizes[ SIO_MAXBUFS ];
+    Arg     args[ SIO_MAXBUFS ];
+    Uns     head;
+    Uns     count;
+} SioQueue;
+
+typedef struct SIO_Obj {
+    Char        name[ MAXNAMELEN ];
+    Bool        inUse;
+    Int         mode;
+    Uns         bufsize;
+    String      peer;           /* input stream fed by this output stream */
+    LgUns       transfers;
+    SioQueue    todo;
+    SioQueue    done;
+} SIO_Obj;
+
+SIO_Attrs SIO_ATTRS = {
+    2,                  /* nbufs */
+    0,                  /* segid */
+    0,                  /* align */
+    FALSE,              /* flush */
+    SIO_STANDARD,       /* model */
+    SYS_FOREVER         /* timeout */
+};
+
+static SIO_Obj sioStreams[ MAXSTREAMS ];
+static Char    sioPeers[ MAXSTREAMS ][ MAXNAMELEN ];
+
+static SIO_Obj *findStream(String name, Bool add);
+static Void     transfer(SIO_Obj *out);
+static Bool     queuePut(SioQueue *q, Ptr buf, Uns size, Arg arg);
+static Bool     queueGet(SioQueue *q, Ptr *buf, Uns *size, Arg *arg);
+
+/*
+ *  ======== SIO_create ========
+ */
+SIO_Handle SIO_create(String name, Int mode, Uns bufsize, SIO_Attrs *attrs)
+{
+    SIO_Obj *stream = findStream(name, TRUE);
+
+    if (attrs == NULL) {
+        attrs = &SIO_ATTRS;
+    }
+    if (stream == NULL || stream->inUse || attrs->nbufs > SIO_MAXBUFS ||
+        attrs->model != SIO_ISSUERECLAIM) {
+        return (NULL);
+    }
+
+    stream->inUse      = TRUE;
+    stream->mode       = mode;
+    stream->bufsize    = bufsize;
+    stream->todo.count = 0;
+    stream->done.count = 0;
+
+    return (stream);
+}
+
+/*
+ *  ======== SIO_delete ========
+ */
+Int SIO_delete(SIO_Handle stream)
+{
+    stream->inUse = FALSE;
+
+    return (SYS_OK);
+}
+
+/*
+ *  ======== SIO_issue ========
+ */
+Int SIO_issue(SIO_Handle stream, Ptr pbuf, Uns nmadus, Arg arg)
+{
+    SIO_Obj *out;
+    Int      i;
+
+    if (!queuePut(&stream->todo, pbuf, nmadus, arg)) {
+        return (SYS_EINVAL);
+    }
+
+    if (stream->mode == SIO_OUTPUT) {
+        transfer(stream);
+    }
+    else {
+        /* an empty input buffer may be what an output stream waits for */
+        for (i = 0; i < MAXSTREAMS; i++) {
+            out = &sioStreams[ i ];
+            if (out->inUse && out->mode == SIO_OUTPUT && out->peer != NULL &&
+                strcmp(out->peer, stream->name) == 0) {
+                transfer(out);
+            }
+        }
+    }
+
+    return (SYS_OK);
+}
+
+/*
+ *  ======== SIO_reclaim ========
+ */
+Int SIO_reclaim(SIO_Handle stream, Ptr *bufp, Arg *parg)
+{
+    Uns size;
+    Arg arg;
+
+    if (!queueGet(&stream->done, bufp, &size, &arg)) {
+        return (-SYS_ETIMEOUT);
+    }
+    if (parg != NULL) {
+        *parg = arg;
+    }
+
+    return ((Int)size);
+}
+
+/*
+ *  ======== SIO_loopback ========
+ */
+Bool SIO_loopback(String outName, String inName)
+{
+    SIO_Obj *out = findStream(outName, TRUE);
+
+    if (out == NULL || strlen(inName) >= MAXNAMELEN) {
+        return (FALSE);
+    }
+    strcpy(sioPeers[ out - sioStreams ], inName);
+    out->peer = sioPeers[ out - sioStreams ];
+
+    return (TRUE);
+}
+
+/*
+ *  ======== SIO_transfers ========
+ */
+LgUns SIO_transfers(String name)
+{
+    SIO_Obj *stream = findStream(name, FALSE);
+
+    return (stream == NULL ? 0 : stream->transfers);
+}
+
+/*
+ *  ======== findStream ========
+ *  Look up a stream by name, adding it if add is TRUE.
+ */
+static SIO_Obj *findStream(String name, Bool add)
+{
+    SIO_Obj *unused = NULL;
+    Int      i;
+
+    for (i = 0; i < MAXSTREAMS; i++) {
+        if (sioStreams[ i ].name[ 0 ] == '\0') {
+            if (unused == NULL) {
+                unused = &sioStreams[ i ];
+            }
+        }
+        else if (strcmp(sioStreams[ i ].name, name) == 0) {
+            return (&sioStreams[ i ]);
+        }
+    }
+    if (!add || unused == NULL || strlen(name) >= MAXNAMELEN) {
+        return (NULL);
+    }
+    strcpy(unused->name, name);
+
+    return (unused);
+}
+
+/*
+ *  ======== transfer ========
+ *  Move the output buffers of out into the empty buffers of its peer
+ *  input stream, as long as there are both. An output stream without a
+ *  peer is a sink: its buffers are transferred at once.
+ */
+static Void transfer(SIO_Obj *out)
+{
+    SIO_Obj *in = NULL;
+    Ptr      outBuf;
+    Ptr      inBuf = NULL;
+    Uns      outSize;
+    Uns      inSize = 0;
+    Arg      outArg;
+    Arg      inArg = NULL;
+
+    if (out->peer != NULL) {
+        in = findStream(out->peer, FALSE);
+        if (in == NULL || !in->inUse) {
+            return;
+        }
+    }
+
+    while (out->todo.count > 0 && (in == NULL || in->todo.count > 0)) {
+        queueGet(&out->todo, &outBuf, &outSize, &outArg);
+        if (in != NULL) {
+            queueGet(&in->todo, &inBuf, &inSize, &inArg);
+            if (outSize > inSize) {
+                outSize = inSize;
+            }
+            memcpy(inBuf, outBuf, outSize);
+            queuePut(&in->done, inBuf, outSize, inArg);
+            in->transfers++;
+        }
+        queuePut(&out->done, outBuf, outSize, outArg);
+        out->transfers++;
+    }
+}
+
+/*
+ *  ======== queuePut ========
+ */
+static Bool queuePut(SioQueue *q, Ptr buf, Uns size, Arg arg)
+{
+    Uns i = (q->head + q->count) % SIO_MAXBUFS;
+
+    if (q->count == SIO_MAXBUFS) {
+        return (FALSE);
+    }
+    q->bufs[ i ]  = buf;
+    q->sizes[ i ] = size;
+    q->args[ i ]  = arg;
+    q->count++;
+
+    return (TRUE);
+}
+
+/*
+ *  ======== queueGet ========
+ */
+static Bool queueGet(SioQueue *q, Ptr *buf, Uns *size, Arg *arg)
+{
+    if (q->count == 0) {
+        return (FALSE);
+    }
+    *buf  = q->bufs[ q->head ];
+    *size = q->sizes[ q->head ];
+    *arg  = q->args[ q->head ];
+    q->head = (q->head + 1) % SIO_MAXBUFS;
+    q->count--;
+
+    return (TRUE);
+}
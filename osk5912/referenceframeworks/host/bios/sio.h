@@ -0,0 +1,65 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== sio.h ========
+ *  Host build: SIO streams in the issue/reclaim model, limited to what
+ *  MSGLINK uses. There is no driver behind a stream: a buffer issued on
+ *  an output stream is transferred, at once, into the oldest buffer
+ *  issued on the input stream it is looped back to (see SIO_loopback()),
+ *  or waits there for one. A reclaim that would have to wait for another
+ *  thread fails at once with SYS_ETIMEOUT, whatever the timeout.
+ */
+#ifndef SIO_
+#define SIO_
+
+#include <std.h>
+#include <sys.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SIO_INPUT           0
+#define SIO_OUTPUT          1
+
+#define SIO_STANDARD        0
+#define SIO_ISSUERECLAIM    1
+
+#define SIO_MAXBUFS         16  /* buffers a stream can have issued */
+
+typedef struct SIO_Attrs {
+    Int     nbufs;      /* number of buffers */
+    Int     segid;      /* MEM segment of the buffers */
+    Int     align;      /* buffer alignment */
+    Bool    flush;      /* TRUE: discard pending output on delete */
+    Uns     model;      /* SIO_STANDARD or SIO_ISSUERECLAIM */
+    Uns     timeout;    /* reclaim timeout */
+} SIO_Attrs;
+
+extern SIO_Attrs SIO_ATTRS;
+
+typedef struct SIO_Obj *SIO_Handle;
+
+extern SIO_Handle SIO_create(String name, Int mode, Uns bufsize,
+                             SIO_Attrs *attrs);
+extern Int  SIO_delete(SIO_Handle stream);
+extern Int  SIO_issue(SIO_Handle stream, Ptr pbuf, Uns nmadus, Arg arg);
+extern Int  SIO_reclaim(SIO_Handle stream, Ptr *bufp, Arg *parg);
+
+/* host only: transfer what is output on outName into input stream inName */
+extern Bool SIO_loopback(String outName, String inName);
+
+/* host only: number of buffers transferred so far on stream name */
+extern LgUns SIO_transfers(String name);
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* SIO_ */
@@ -0,0 +1,68 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== std.h ========
+ *  Host build: the DSP/BIOS standard types, sized as on the C6x (32-bit
+ *  Int). Arg is a pointer, so that it can carry a host pointer and NULL
+ *  can be passed for it as the applications do.
+ */
+#ifndef STD_
+#define STD_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define _TI_STD_TYPES
+
+typedef int             Int;
+typedef unsigned int    Uns;
+typedef char            Char;
+typedef char           *String;
+typedef void           *Ptr;
+typedef unsigned short  Bool;
+typedef short           Short;
+typedef long            LgInt;
+typedef unsigned long   LgUns;
+typedef char            SmInt;
+typedef unsigned char   SmUns;
+typedef int             MdInt;
+typedef unsigned int    MdUns;
+typedef unsigned char   Uchar;
+typedef float           Float;
+typedef double          Double;
+
+typedef int8_t          Int8;
+typedef int16_t         Int16;
+typedef int32_t         Int32;
+typedef uint8_t         Uint8;
+typedef uint16_t        Uint16;
+typedef uint32_t        Uint32;
+
+typedef void           *Arg;
+typedef Int           (*Fxn)();
+
+#define Void            void
+
+#ifndef TRUE
+#define FALSE           ((Bool)0)
+#define TRUE            ((Bool)1)
+#endif
+
+#define ArgToInt(A)     ((Int)(intptr_t)(A))
+#define ArgToPtr(A)     ((Ptr)(A))
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* STD_ */
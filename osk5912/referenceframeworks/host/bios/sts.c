@@ -0,0 +1,53 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== sts.c ========
+ *  Host build: STS accumulators, with the same semantics as on the
+ *  target (STS_delta() adds value - prev, where prev is set by STS_set()).
+ */
+#include <std.h>
+#include <sts.h>
+
+/*
+ *  ======== STS_add ========
+ */
+Void STS_add(STS_Handle sts, LgInt value)
+{
+    if (sts->num == 0 || value > sts->max) {
+        sts->max = value;
+    }
+    sts->acc += value;
+    sts->num++;
+}
+
+/*
+ *  ======== STS_delta ========
+ */
+Void STS_delta(STS_Handle sts, LgInt value)
+{
+    STS_add(sts, value - sts->prev);
+}
+
+/*
+ *  ======== STS_reset ========
+ */
+Void STS_reset(STS_Handle sts)
+{
+    sts->num = 0;
+    sts->acc = 0;
+    sts->max = 0;
+}
+
+/*
+ *  ======== STS_set ========
+ */
+Void STS_set(STS_Handle sts, LgInt value)
+{
+    sts->prev = value;
+}
@@ -0,0 +1,39 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== sts.h ========
+ *  Host build: STS statistics accumulators, read directly by the host
+ *  program instead of by the CCS statistics view.
+ */
+#ifndef STS_
+#define STS_
+
+#include <std.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct STS_Obj {
+    LgInt   num;        /* number of values added */
+    LgInt   acc;        /* sum of the values */
+    LgInt   max;        /* largest value */
+    LgInt   prev;       /* base for STS_delta() */
+} STS_Obj, *STS_Handle;
+
+extern Void STS_add(STS_Handle sts, LgInt value);
+extern Void STS_delta(STS_Handle sts, LgInt value);
+extern Void STS_reset(STS_Handle sts);
+extern Void STS_set(STS_Handle sts, LgInt value);
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* STS_ */
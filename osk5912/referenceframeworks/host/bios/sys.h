@@ -0,0 +1,29 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== sys.h ========
+ *  Host build: SYS timeouts and the abort/exit hooks.
+ */
+#ifndef SYS_
+#define SYS_
+
+#include <std.h>
+
+#define SYS_FOREVER     ((Uns)-1)
+#define SYS_POLL        ((Uns)0)
+
+#define SYS_OK          0
+#define SYS_EALLOC      1
+#define SYS_EINVAL      5
+#define SYS_ETIMEOUT    9
+
+extern Void SYS_abort(String fmt, ...);
+extern Void SYS_exit(Int status);
+
+#endif /* SYS_ */
@@ -0,0 +1,26 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== tsk.h ========
+ *  Host build: task scheduler locking. Single-threaded, so nothing to lock.
+ */
+#ifndef TSK_
+#define TSK_
+
+#include <std.h>
+
+static inline Void TSK_disable(Void)
+{
+}
+
+static inline Void TSK_enable(Void)
+{
+}
+
+#endif /* TSK_ */
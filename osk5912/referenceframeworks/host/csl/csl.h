@@ -0,0 +1,53 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== csl.h ========
+ *  Host build: the Chip Support Library v3 types and field macros, as in
+ *  the 5912 CSL, for the peripheral models in this directory.
+ */
+#ifndef CSL_
+#define CSL_
+
+#include <std.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef Int16           CSL_Status;
+typedef Uint16          CSL_BitMask16;
+typedef volatile Uint16 CSL_Reg16;
+
+typedef enum {
+    CSL_EXCLUSIVE = 0,
+    CSL_SHARED    = 1
+} CSL_OpenMode;
+
+#define CSL_SOK                 (1)     /* success */
+#define CSL_ESYS_FAIL           (-1)    /* generic failure */
+#define CSL_ESYS_INUSE          (-2)    /* resource already in use */
+#define CSL_ESYS_BADHANDLE      (-5)    /* invalid handle */
+#define CSL_ESYS_INVCMD         (-7)    /* invalid command */
+
+/* the field make, extract and insert macros of cslr.h */
+#define CSL_FMK(PER_REG_FIELD, val)                                         \
+    (((val) << CSL_##PER_REG_FIELD##_SHIFT) & CSL_##PER_REG_FIELD##_MASK)
+
+#define CSL_FEXT(reg, PER_REG_FIELD)                                        \
+    (((reg) & CSL_##PER_REG_FIELD##_MASK) >> CSL_##PER_REG_FIELD##_SHIFT)
+
+#define CSL_FINS(reg, PER_REG_FIELD, val)                                   \
+    ((reg) = ((reg) & ~CSL_##PER_REG_FIELD##_MASK)                          \
+    | CSL_FMK(PER_REG_FIELD, val))
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* CSL_ */
@@ -0,0 +1,377 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== csl_dma.c ========
+ *  Host build: the DMA channel model behind the CSL DMA (see csl_dma.h).
+ */
+#include <string.h>
+
+#include <std.h>
+
+#include <csl_dma.h>
+#include <csl_intc.h>
+
+/*
+ *  A channel: its registers and, as the 16-bit address registers cannot
+ *  hold a host address, the addresses programmed next to them. The
+ *  working set is what the channel runs on; it is loaded from the
+ *  configuration at start and at each autoinit.
+ */
+typedef struct Channel {
+    CSL_DmaChaRegs  regs;
+    Bool            open;
+    Uint8          *srcAddr;        // programmed source address
+    Uint8          *dstAddr;        // programmed destination address
+    Bool            running;        // started and not stopped
+    Bool            waiting;        // block done, waiting for ENDPROG
+    Uint8          *src;            // working source address
+    Uint8          *dst;            // working destination address
+    Uns             elmCnt;         // working element count
+    Uns             frmCnt;         // working frame count
+    Int16           srcElmIndex;    // working indexes, in bytes
+    Int16           srcFrmIndex;
+    Int16           dstElmIndex;
+    Int16           dstFrmIndex;
+    Uns             elm;            // elements done in the frame
+    Uns             frm;            // frames done in the block
+} Channel;
+
+static Channel           channels[ CSL_DMA_CHA_CNT ];
+static CSL_DmaGlobalRegs globalRegs;
+
+static Void reload(Channel *chan);
+static Uint8 *advance(Uint8 *addr, Uns amode, Bool lastElm, Int16 elmIndex,
+                      Int16 frmIndex);
+
+/*
+ *  ======== CSL_dmaInit ========
+ */
+CSL_Status CSL_dmaInit(Void)
+{
+    return (CSL_SOK);
+}
+
+/*
+ *  ======== CSL_dmaOpen ========
+ *  Resets the channel's registers, then applies setup if there is one.
+ */
+CSL_DmaHandle CSL_dmaOpen(CSL_DmaObj *dmaObj, CSL_DmaNum dmaNum,
+    CSL_DmaChaNum chaNum, CSL_OpenMode openMode, CSL_DmaHwSetup *setup,
+    CSL_Status *status)
+{
+    Channel *chan;
+
+    if (dmaNum != CSL_DMA || chaNum < 0 || chaNum >= CSL_DMA_CHA_CNT) {
+        *status = CSL_ESYS_FAIL;
+        return (NULL);
+    }
+    chan = &channels[ chaNum ];
+    if (chan->open && openMode == CSL_EXCLUSIVE) {
+        *status = CSL_ESYS_INUSE;
+        return (NULL);
+    }
+
+    memset(chan, 0, sizeof(Channel));
+    chan->open = TRUE;
+
+    dmaObj->openMode = openMode;
+    dmaObj->gRegs    = &globalRegs;
+    dmaObj->dmaNum   = dmaNum;
+    dmaObj->regs     = &chan->regs;
+    dmaObj->chaNum   = chaNum;
+
+    *status = (setup != NULL) ? CSL_dmaHwSetup(dmaObj, setup) : CSL_SOK;
+
+    return (dmaObj);
+}
+
+/*
+ *  ======== CSL_dmaClose ========
+ */
+CSL_Status CSL_dmaClose(CSL_DmaHandle hDma)
+{
+    if (hDma == NULL) {
+        return (CSL_ESYS_BADHANDLE);
+    }
+    channels[ hDma->chaNum ].open = FALSE;
+    channels[ hDma->chaNum ].running = FALSE;
+
+    return (CSL_SOK);
+}
+
+/*
+ *  ======== CSL_dmaHwSetup ========
+ */
+CSL_Status CSL_dmaHwSetup(CSL_DmaHandle hDma, CSL_DmaHwSetup *setup)
+{
+    CSL_DmaChaRegs *regs;
+    Channel        *chan;
+
+    if (hDma == NULL || setup == NULL) {
+        return (CSL_ESYS_BADHANDLE);
+    }
+    regs = hDma->regs;
+    chan = &channels[ hDma->chaNum ];
+
+    if (setup->srcStruct != NULL) {
+        CSL_FINS(regs->CCR, DMA_CCR_SRCAMODE, setup->srcStruct->amode);
+        regs->CSSAL = (Uint16)(setup->srcStruct->staddr << 1);
+        regs->CSSAU = (Uint16)(setup->srcStruct->staddr >> 15);
+        regs->CSFI  = (Uint16)setup->srcStruct->frmIndex;
+        regs->CSEI  = (Uint16)setup->srcStruct->elmIndex;
+        chan->srcAddr = NULL;
+    }
+    if (setup->dstStruct != NULL) {
+        CSL_FINS(regs->CCR, DMA_CCR_DSTAMODE, setup->dstStruct->amode);
+        regs->CDSAL = (Uint16)(setup->dstStruct->staddr << 1);
+        regs->CDSAU = (Uint16)(setup->dstStruct->staddr >> 15);
+        regs->CDFI  = (Uint16)setup->dstStruct->frmIndex;
+        regs->CDEI  = (Uint16)setup->dstStruct->elmIndex;
+        chan->dstAddr = NULL;
+    }
+    if (setup->channelStruct != NULL) {
+        regs->CEN = setup->channelStruct->elmCnt;
+        regs->CFN = setup->channelStruct->frmCnt;
+        CSL_FINS(regs->CCR, DMA_CCR_ENDPROG, setup->channelStruct->endprog);
+        CSL_FINS(regs->CCR, DMA_CCR_REPEAT, setup->channelStruct->repeat);
+        CSL_FINS(regs->CCR, DMA_CCR_AUTOINIT, setup->channelStruct->autoinit);
+    }
+    if (setup->intrStruct != NULL) {
+        CSL_FINS(regs->CICR, DMA_CICR_BLOCKIE, setup->intrStruct->blockie);
+        CSL_FINS(regs->CICR, DMA_CICR_FRAMEIE, setup->intrStruct->frameie);
+    }
+    if (setup->globalStruct != NULL) {
+        CSL_FINS(hDma->gRegs->GSCR, DMA_GSCR_INDEXMODE,
+            setup->globalStruct->indexMode);
+    }
+
+    return (CSL_SOK);
+}
+
+/*
+ *  ======== CSL_dmaHwControl ========
+ */
+CSL_Status CSL_dmaHwControl(CSL_DmaHandle hDma, CSL_DmaHwControlCmd cmd,
+    Void *arg)
+{
+    CSL_DmaChaRegs *regs;
+    Channel        *chan;
+    Uint8          *addr;
+
+    if (hDma == NULL) {
+        return (CSL_ESYS_BADHANDLE);
+    }
+    regs = hDma->regs;
+    chan = &channels[ hDma->chaNum ];
+
+    switch (cmd) {
+        case CSL_DMA_CMD_START:
+            if (!chan->running) {
+                chan->running = TRUE;
+                reload(chan);
+                CSL_FINS(regs->CCR, DMA_CCR_EN, 1);
+            }
+            break;
+
+        case CSL_DMA_CMD_STOP:
+            chan->running = FALSE;
+            chan->waiting = FALSE;
+            CSL_FINS(regs->CCR, DMA_CCR_EN, 0);
+            break;
+
+        // the registers get the low bits of the byte address
+        case CSL_DMA_CMD_CHNG_SRC:
+            addr = *(Uint8 **)arg;
+            chan->srcAddr = addr;
+            regs->CSSAL = (Uint16)(uintptr_t)addr;
+            regs->CSSAU = (Uint16)((uintptr_t)addr >> 16);
+            break;
+
+        case CSL_DMA_CMD_CHNG_DST:
+            addr = *(Uint8 **)arg;
+            chan->dstAddr = addr;
+            regs->CDSAL = (Uint16)(uintptr_t)addr;
+            regs->CDSAU = (Uint16)((uintptr_t)addr >> 16);
+            break;
+
+        case CSL_DMA_CMD_CHNG_ELEMENT_COUNT:
+            regs->CEN = (Uint16)*(Uns *)arg;
+            break;
+
+        case CSL_DMA_CMD_CHNG_FRAME_COUNT:
+            regs->CFN = (Uint16)*(Uns *)arg;
+            break;
+
+        case CSL_DMA_CMD_CLEAR_CHANNEL_STATUS:
+            regs->CSR = 0;
+            break;
+
+        case CSL_DMA_CMD_NOTIFY_ENDPROG:
+            CSL_FINS(regs->CCR, DMA_CCR_ENDPROG, 1);
+            break;
+
+        default:
+            return (CSL_ESYS_INVCMD);
+    }
+
+    return (CSL_SOK);
+}
+
+/*
+ *  ======== CSL_dmaGetChipCtxt ========
+ */
+CSL_Status CSL_dmaGetChipCtxt(CSL_DmaHandle hDma, CSL_DmaChipCtxtQuery query,
+    Void *response)
+{
+    if (hDma == NULL) {
+        return (CSL_ESYS_BADHANDLE);
+    }
+    if (query != CSL_DMA_CHIPCTXTQUERY_EVENTID) {
+        return (CSL_ESYS_INVCMD);
+    }
+    *(CSL_IntcEventId *)response =
+        (CSL_IntcEventId)(CSL_INTC_EVENTID_DMACH0 + hDma->chaNum);
+
+    return (CSL_SOK);
+}
+
+/*
+ *  ======== CSL_dmaSync ========
+ */
+Bool CSL_dmaSync(CSL_DmaChaNum chaNum, Uint16 *word)
+{
+    Channel        *chan = &channels[ chaNum ];
+    CSL_DmaChaRegs *regs = &chan->regs;
+    Uns             srcAmode = CSL_FEXT(regs->CCR, DMA_CCR_SRCAMODE);
+    Uns             dstAmode = CSL_FEXT(regs->CCR, DMA_CCR_DSTAMODE);
+    Bool            lastElm;
+    Bool            post = FALSE;
+
+    if (!chan->running) {
+        return (FALSE);
+    }
+    if (chan->waiting) {
+        if (!CSL_FEXT(regs->CCR, DMA_CCR_ENDPROG)) {
+            return (FALSE);
+        }
+        reload(chan);
+    }
+    if ((srcAmode != CSL_DMA_AMODE_CONST && chan->src == NULL) ||
+        (dstAmode != CSL_DMA_AMODE_CONST && chan->dst == NULL) ||
+        chan->elmCnt == 0 || chan->frmCnt == 0) {
+        return (FALSE);
+    }
+
+    // one 16-bit element; the McBSP side is the CONST one
+    if (srcAmode == CSL_DMA_AMODE_CONST) {
+        memcpy(chan->dst, word, sizeof(Uint16));
+    }
+    else if (dstAmode == CSL_DMA_AMODE_CONST) {
+        memcpy(word, chan->src, sizeof(Uint16));
+    }
+    else {
+        memcpy(chan->dst, chan->src, sizeof(Uint16));
+    }
+
+    lastElm = (Bool)(chan->elm + 1 == chan->elmCnt);
+    chan->src = advance(chan->src, srcAmode, lastElm, chan->srcElmIndex,
+        chan->srcFrmIndex);
+    chan->dst = advance(chan->dst, dstAmode, lastElm, chan->dstElmIndex,
+        chan->dstFrmIndex);
+    regs->CSAC = (Uint16)(uintptr_t)chan->src;
+    regs->CDAC = (Uint16)(uintptr_t)chan->dst;
+
+    if (++chan->elm < chan->elmCnt) {
+        return (TRUE);
+    }
+
+    // end of frame
+    chan->elm = 0;
+    CSL_FINS(regs->CSR, DMA_CSR_FRAME, 1);
+    post = (Bool)CSL_FEXT(regs->CICR, DMA_CICR_FRAMEIE);
+
+    if (++chan->frm == chan->frmCnt) {
+
+        // end of block: autoinit, or wait for ENDPROG, or stop
+        chan->frm = 0;
+        CSL_FINS(regs->CSR, DMA_CSR_BLOCK, 1);
+        post |= (Bool)CSL_FEXT(regs->CICR, DMA_CICR_BLOCKIE);
+
+        if (CSL_FEXT(regs->CCR, DMA_CCR_REPEAT) ||
+            (CSL_FEXT(regs->CCR, DMA_CCR_AUTOINIT) &&
+             CSL_FEXT(regs->CCR, DMA_CCR_ENDPROG))) {
+            reload(chan);
+        }
+        else if (CSL_FEXT(regs->CCR, DMA_CCR_AUTOINIT)) {
+            chan->waiting = TRUE;
+        }
+        else {
+            chan->running = FALSE;
+            CSL_FINS(regs->CCR, DMA_CCR_EN, 0);
+        }
+    }
+
+    if (post) {
+        CSL_intcPost((CSL_IntcEventId)(CSL_INTC_EVENTID_DMACH0 + chaNum));
+    }
+
+    return (TRUE);
+}
+
+/*
+ *  ======== reload ========
+ *  Copies the configuration to the working set and clears ENDPROG.
+ */
+static Void reload(Channel *chan)
+{
+    CSL_DmaChaRegs *regs = &chan->regs;
+
+    chan->src    = chan->srcAddr;
+    chan->dst    = chan->dstAddr;
+    chan->elmCnt = regs->CEN;
+    chan->frmCnt = regs->CFN;
+    chan->srcElmIndex = (Int16)regs->CSEI;
+    chan->srcFrmIndex = (Int16)regs->CSFI;
+    if (CSL_FEXT(globalRegs.GSCR, DMA_GSCR_INDEXMODE) ==
+        CSL_DMA_INDEXMODE_DIFF) {
+        chan->dstElmIndex = (Int16)regs->CDEI;
+        chan->dstFrmIndex = (Int16)regs->CDFI;
+    }
+    else {
+        chan->dstElmIndex = chan->srcElmIndex;
+        chan->dstFrmIndex = chan->srcFrmIndex;
+    }
+    chan->elm = 0;
+    chan->frm = 0;
+    chan->waiting = FALSE;
+    CSL_FINS(regs->CCR, DMA_CCR_ENDPROG, 0);
+}
+
+/*
+ *  ======== advance ========
+ *  Returns the address after an element, lastElm being the last of its
+ *  frame.
+ */
+static Uint8 *advance(Uint8 *addr, Uns amode, Bool lastElm, Int16 elmIndex,
+                      Int16 frmIndex)
+{
+    switch (amode) {
+        case CSL_DMA_AMODE_POSTINC:
+            return (addr + sizeof(Uint16));
+
+        case CSL_DMA_AMODE_SNGLIND:
+            return (addr + elmIndex);
+
+        case CSL_DMA_AMODE_DBLIND:
+            return (addr + (lastElm ? frmIndex : elmIndex));
+
+        default:
+            return (addr);
+    }
+}
@@ -0,0 +1,220 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== csl_dma.h ========
+ *  Host build: the CSL DMA of the 5912 DSP, over a model of its channel
+ *  registers, limited to 16-bit elements synchronized on a McBSP.
+ *
+ *  A driver programs the configuration registers (CEN, CFN, CCR, CICR,
+ *  the element and frame indexes) and the addresses through the CSL, as
+ *  on the target. CSL_DMA_CMD_START copies them to the channel's working
+ *  set. Each call of CSL_dmaSync() stands for one McBSP event: the channel
+ *  moves one element and walks its addresses, in the mode CCR gives each
+ *  side:
+ *
+ *    CSL_DMA_AMODE_CONST    the address does not move (the McBSP side)
+ *    CSL_DMA_AMODE_POSTINC  +2 bytes after each element
+ *    CSL_DMA_AMODE_SNGLIND  + the element index after each element
+ *    CSL_DMA_AMODE_DBLIND   + the element index after each element of a
+ *                           frame but the last, + the frame index after
+ *                           the last
+ *
+ *  The indexes are signed bytes counts. With GSCR's INDEXMODE
+ *  CSL_DMA_INDEXMODE_SAME both sides use CSEI/CSFI, with
+ *  CSL_DMA_INDEXMODE_DIFF the destination uses CDEI/CDFI.
+ *
+ *  After CEN elements the frame is done, after CFN frames the block. In
+ *  autoinit mode the channel then reloads its working set from the
+ *  configuration registers if ENDPROG is set, clearing it, or waits for
+ *  ENDPROG otherwise, losing the McBSP words meanwhile. CSR's FRAME and
+ *  BLOCK bits are set and, when CICR enables them, the channel's event is
+ *  raised through the interrupt controller (csl_intc.h). Reading CSR does
+ *  not clear it here.
+ */
+#ifndef CSL_DMA_
+#define CSL_DMA_
+
+#include <csl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CSL_DMA_CHA_CNT                 6
+
+/* the CCR, CICR, CSR and GSCR fields the model uses, as in cslr_dma_001.h */
+#define CSL_DMA_CCR_DSTAMODE_MASK       (0xC000u)
+#define CSL_DMA_CCR_DSTAMODE_SHIFT      (0x000Eu)
+#define CSL_DMA_CCR_SRCAMODE_MASK       (0x3000u)
+#define CSL_DMA_CCR_SRCAMODE_SHIFT      (0x000Cu)
+#define CSL_DMA_CCR_ENDPROG_MASK        (0x0800u)
+#define CSL_DMA_CCR_ENDPROG_SHIFT       (0x000Bu)
+#define CSL_DMA_CCR_REPEAT_MASK         (0x0200u)
+#define CSL_DMA_CCR_REPEAT_SHIFT        (0x0009u)
+#define CSL_DMA_CCR_AUTOINIT_MASK       (0x0100u)
+#define CSL_DMA_CCR_AUTOINIT_SHIFT      (0x0008u)
+#define CSL_DMA_CCR_EN_MASK             (0x0080u)
+#define CSL_DMA_CCR_EN_SHIFT            (0x0007u)
+
+#define CSL_DMA_CICR_BLOCKIE_MASK       (0x0020u)
+#define CSL_DMA_CICR_BLOCKIE_SHIFT      (0x0005u)
+#define CSL_DMA_CICR_FRAMEIE_MASK       (0x0008u)
+#define CSL_DMA_CICR_FRAMEIE_SHIFT      (0x0003u)
+
+#define CSL_DMA_CSR_BLOCK_MASK          (0x0020u)
+#define CSL_DMA_CSR_BLOCK_SHIFT         (0x0005u)
+#define CSL_DMA_CSR_FRAME_MASK          (0x0008u)
+#define CSL_DMA_CSR_FRAME_SHIFT         (0x0003u)
+
+#define CSL_DMA_GSCR_INDEXMODE_MASK     (0x0001u)
+#define CSL_DMA_GSCR_INDEXMODE_SHIFT    (0x0000u)
+
+typedef enum {
+    CSL_DMA = 0
+} CSL_DmaNum;
+
+typedef enum {
+    CSL_DMA_CHA_0 = 0,
+    CSL_DMA_CHA_1,
+    CSL_DMA_CHA_2,
+    CSL_DMA_CHA_3,
+    CSL_DMA_CHA_4,
+    CSL_DMA_CHA_5
+} CSL_DmaChaNum;
+
+typedef enum {
+    CSL_DMA_AMODE_CONST   = 0,
+    CSL_DMA_AMODE_POSTINC = 1,
+    CSL_DMA_AMODE_SNGLIND = 2,
+    CSL_DMA_AMODE_DBLIND  = 3
+} CSL_DmaAmode;
+
+typedef enum {
+    CSL_DMA_ONOFF_OFF = 0,
+    CSL_DMA_ONOFF_ON  = 1
+} CSL_DmaOnOff;
+
+typedef enum {
+    CSL_DMA_INDEXMODE_SAME = 0,
+    CSL_DMA_INDEXMODE_DIFF = 1
+} CSL_DmaIndexMode;
+
+typedef enum {
+    CSL_DMA_CMD_START                = 0,   /* NULL */
+    CSL_DMA_CMD_STOP                 = 1,   /* NULL */
+    CSL_DMA_CMD_CHNG_SRC             = 2,   /* Ptr *, a host address */
+    CSL_DMA_CMD_CHNG_DST             = 3,   /* Ptr *, a host address */
+    CSL_DMA_CMD_CHNG_ELEMENT_COUNT   = 4,   /* Uns * */
+    CSL_DMA_CMD_CHNG_FRAME_COUNT     = 5,   /* Uns * */
+    CSL_DMA_CMD_CLEAR_CHANNEL_STATUS = 6,   /* NULL */
+    CSL_DMA_CMD_NOTIFY_ENDPROG       = 7    /* NULL */
+} CSL_DmaHwControlCmd;
+
+typedef enum {
+    CSL_DMA_CHIPCTXTQUERY_EVENTID = 0       /* CSL_IntcEventId * */
+} CSL_DmaChipCtxtQuery;
+
+/* the channel registers, as in cslr_dma_001.h */
+typedef struct CSL_DmaChaRegs {
+    CSL_Reg16 CSDP;
+    CSL_Reg16 CCR;
+    CSL_Reg16 CICR;
+    CSL_Reg16 CSR;
+    CSL_Reg16 CSSAL;
+    CSL_Reg16 CSSAU;
+    CSL_Reg16 CDSAL;
+    CSL_Reg16 CDSAU;
+    CSL_Reg16 CEN;
+    CSL_Reg16 CFN;
+    CSL_Reg16 CSFI;
+    CSL_Reg16 CSEI;
+    CSL_Reg16 CSAC;
+    CSL_Reg16 CDAC;
+    CSL_Reg16 CDFI;
+    CSL_Reg16 CDEI;
+} CSL_DmaChaRegs;
+
+typedef struct CSL_DmaGlobalRegs {
+    CSL_Reg16 GCR;
+    CSL_Reg16 GTCR;
+    CSL_Reg16 GSCR;
+} CSL_DmaGlobalRegs;
+
+typedef CSL_DmaChaRegs    *CSL_DmaChaRegsOvly;
+typedef CSL_DmaGlobalRegs *CSL_DmaGlobalRegsOvly;
+
+/* setup of a source or destination port; staddr is a word address */
+typedef struct CSL_DmaHwSetupPort {
+    CSL_DmaAmode    amode;
+    Uint32          staddr;
+    Int16           frmIndex;
+    Int16           elmIndex;
+} CSL_DmaHwSetupPort;
+
+typedef CSL_DmaHwSetupPort CSL_DmaHwSetupSrcPort;
+typedef CSL_DmaHwSetupPort CSL_DmaHwSetupDstPort;
+
+typedef struct CSL_DmaHwSetupChannel {
+    Uint16          elmCnt;
+    Uint16          frmCnt;
+    CSL_DmaOnOff    endprog;
+    CSL_DmaOnOff    repeat;
+    CSL_DmaOnOff    autoinit;
+} CSL_DmaHwSetupChannel;
+
+typedef struct CSL_DmaHwSetupIntr {
+    CSL_DmaOnOff    blockie;
+    CSL_DmaOnOff    frameie;
+} CSL_DmaHwSetupIntr;
+
+typedef struct CSL_DmaHwSetupGlobal {
+    CSL_DmaIndexMode indexMode;
+} CSL_DmaHwSetupGlobal;
+
+typedef struct CSL_DmaHwSetup {
+    CSL_DmaHwSetupSrcPort   *srcStruct;
+    CSL_DmaHwSetupDstPort   *dstStruct;
+    CSL_DmaHwSetupChannel   *channelStruct;
+    CSL_DmaHwSetupIntr      *intrStruct;
+    CSL_DmaHwSetupGlobal    *globalStruct;
+} CSL_DmaHwSetup;
+
+typedef struct CSL_DmaObj {
+    CSL_OpenMode            openMode;
+    CSL_DmaGlobalRegsOvly   gRegs;
+    CSL_DmaNum              dmaNum;
+    CSL_DmaChaRegsOvly      regs;
+    CSL_DmaChaNum           chaNum;
+} CSL_DmaObj;
+
+typedef CSL_DmaObj *CSL_DmaHandle;
+
+extern CSL_Status CSL_dmaInit(Void);
+extern CSL_DmaHandle CSL_dmaOpen(CSL_DmaObj *dmaObj, CSL_DmaNum dmaNum,
+    CSL_DmaChaNum chaNum, CSL_OpenMode openMode, CSL_DmaHwSetup *setup,
+    CSL_Status *status);
+extern CSL_Status CSL_dmaClose(CSL_DmaHandle hDma);
+extern CSL_Status CSL_dmaHwSetup(CSL_DmaHandle hDma, CSL_DmaHwSetup *setup);
+extern CSL_Status CSL_dmaHwControl(CSL_DmaHandle hDma,
+    CSL_DmaHwControlCmd cmd, Void *arg);
+extern CSL_Status CSL_dmaGetChipCtxt(CSL_DmaHandle hDma,
+    CSL_DmaChipCtxtQuery query, Void *response);
+
+/*
+ *  host only: a McBSP event for channel chaNum, which moves one element
+ *  from *word (a CONST source) or to *word (a CONST destination). Returns
+ *  FALSE if the channel is stopped or waits for ENDPROG: the word is lost.
+ */
+extern Bool CSL_dmaSync(CSL_DmaChaNum chaNum, Uint16 *word);
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* CSL_DMA_ */
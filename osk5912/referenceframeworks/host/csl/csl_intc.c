@@ -0,0 +1,93 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== csl_intc.c ========
+ *  Host build: the CSL interrupt controller's event enables.
+ */
+#include <std.h>
+#include <hwi.h>
+
+#include <csl_intc.h>
+
+static Bool enabled[ CSL_INTC_EVENTID_CNT ];
+
+/*
+ *  ======== CSL_intcInit ========
+ */
+CSL_Status CSL_intcInit(Void)
+{
+    return (CSL_SOK);
+}
+
+/*
+ *  ======== CSL_intcOpen ========
+ */
+CSL_IntcHandle CSL_intcOpen(CSL_IntcObj *intcObj, CSL_IntcEventId eventId,
+    CSL_IntcVectId vectId, CSL_IntcHwSetup *setup, CSL_Status *status)
+{
+    if (eventId < 0 || eventId >= CSL_INTC_EVENTID_CNT) {
+        if (status != NULL) {
+            *status = CSL_ESYS_FAIL;
+        }
+        return (NULL);
+    }
+
+    intcObj->eventId  = eventId;
+    intcObj->vectId   = vectId;
+    intcObj->reserved = NULL;
+    if (status != NULL) {
+        *status = CSL_SOK;
+    }
+
+    return (intcObj);
+}
+
+/*
+ *  ======== CSL_intcEventEnable ========
+ */
+CSL_Status CSL_intcEventEnable(CSL_IntcEventId eventId,
+    CSL_IntcEventEnableState *prevState)
+{
+    if (eventId < 0 || eventId >= CSL_INTC_EVENTID_CNT) {
+        return (CSL_ESYS_FAIL);
+    }
+    if (prevState != NULL) {
+        *prevState = (CSL_IntcEventEnableState)enabled[ eventId ];
+    }
+    enabled[ eventId ] = TRUE;
+
+    return (CSL_SOK);
+}
+
+/*
+ *  ======== CSL_intcEventDisable ========
+ */
+CSL_Status CSL_intcEventDisable(CSL_IntcEventId eventId,
+    CSL_IntcEventEnableState *prevState)
+{
+    if (eventId < 0 || eventId >= CSL_INTC_EVENTID_CNT) {
+        return (CSL_ESYS_FAIL);
+    }
+    if (prevState != NULL) {
+        *prevState = (CSL_IntcEventEnableState)enabled[ eventId ];
+    }
+    enabled[ eventId ] = FALSE;
+
+    return (CSL_SOK);
+}
+
+/*
+ *  ======== CSL_intcPost ========
+ */
+Void CSL_intcPost(CSL_IntcEventId eventId)
+{
+    if (eventId >= 0 && eventId < CSL_INTC_EVENTID_CNT && enabled[ eventId ]) {
+        HWI_post((Int)eventId);
+    }
+}
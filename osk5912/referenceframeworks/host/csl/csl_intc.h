@@ -0,0 +1,68 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== csl_intc.h ========
+ *  Host build: the CSL interrupt controller, limited to opening an event
+ *  and enabling it. An event is its own HWI vector: a peripheral model
+ *  raises it with CSL_intcPost(), which runs the ISR HWI_dispatchPlug()
+ *  plugged for it if the event is enabled.
+ */
+#ifndef CSL_INTC_
+#define CSL_INTC_
+
+#include <csl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    CSL_INTC_EVENTID_DMACH0 = 0,
+    CSL_INTC_EVENTID_DMACH1,
+    CSL_INTC_EVENTID_DMACH2,
+    CSL_INTC_EVENTID_DMACH3,
+    CSL_INTC_EVENTID_DMACH4,
+    CSL_INTC_EVENTID_DMACH5,
+    CSL_INTC_EVENTID_CNT,
+    CSL_INTC_EVENTID_INVALID = -1
+} CSL_IntcEventId;
+
+typedef enum {
+    CSL_INTC_VECTID_DEFAULT = 0
+} CSL_IntcVectId;
+
+typedef Uint8 CSL_IntcEventEnableState;
+
+typedef struct CSL_IntcHwSetup CSL_IntcHwSetup;    /* not modelled */
+
+typedef struct CSL_IntcObj {
+    CSL_IntcEventId eventId;    /* the event */
+    CSL_IntcVectId  vectId;     /* the vector */
+    Void           *reserved;
+} CSL_IntcObj;
+
+typedef CSL_IntcObj *CSL_IntcHandle;
+
+extern CSL_Status CSL_intcInit(Void);
+extern CSL_IntcHandle CSL_intcOpen(CSL_IntcObj *intcObj,
+    CSL_IntcEventId eventId, CSL_IntcVectId vectId, CSL_IntcHwSetup *setup,
+    CSL_Status *status);
+extern CSL_Status CSL_intcEventEnable(CSL_IntcEventId eventId,
+    CSL_IntcEventEnableState *prevState);
+extern CSL_Status CSL_intcEventDisable(CSL_IntcEventId eventId,
+    CSL_IntcEventEnableState *prevState);
+
+/* host only: raise eventId */
+extern Void CSL_intcPost(CSL_IntcEventId eventId);
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* CSL_INTC_ */
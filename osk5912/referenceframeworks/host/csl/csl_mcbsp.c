@@ -0,0 +1,86 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== csl_mcbsp.c ========
+ *  Host build: the CSL McBSP's receiver and transmitter enables.
+ */
+#include <std.h>
+
+#include <csl_mcbsp.h>
+
+/*
+ *  ======== CSL_mcbspInit ========
+ */
+CSL_Status CSL_mcbspInit(Void)
+{
+    return (CSL_SOK);
+}
+
+/*
+ *  ======== CSL_mcbspOpen ========
+ */
+CSL_McbspHandle CSL_mcbspOpen(CSL_McbspObj *mcbspObj, CSL_McbspNum mcbspNum,
+    CSL_OpenMode openMode, CSL_McbspHwSetup *setup, CSL_Status *status)
+{
+    if (mcbspNum < 0 || mcbspNum >= CSL_MCBSP_CNT) {
+        *status = CSL_ESYS_FAIL;
+        return (NULL);
+    }
+
+    mcbspObj->openMode = openMode;
+    mcbspObj->perNum   = (Int16)mcbspNum;
+    mcbspObj->enabled  = 0;
+    *status = CSL_SOK;
+
+    return (mcbspObj);
+}
+
+/*
+ *  ======== CSL_mcbspHwSetup ========
+ */
+CSL_Status CSL_mcbspHwSetup(CSL_McbspHandle hMcbsp, CSL_McbspHwSetup *setup)
+{
+    return ((hMcbsp != NULL) ? CSL_SOK : CSL_ESYS_BADHANDLE);
+}
+
+/*
+ *  ======== CSL_mcbspHwControl ========
+ */
+CSL_Status CSL_mcbspHwControl(CSL_McbspHandle hMcbsp,
+    CSL_McbspHwControlCmd cmd, Void *arg)
+{
+    CSL_BitMask16 ctrl;
+
+    if (hMcbsp == NULL) {
+        return (CSL_ESYS_BADHANDLE);
+    }
+
+    switch (cmd) {
+        case CSL_MCBSP_CMD_REG_RESET:
+            hMcbsp->enabled = 0;
+            break;
+
+        case CSL_MCBSP_CMD_RESET_CONTROL:
+            ctrl = *(CSL_BitMask16 *)arg;
+            hMcbsp->enabled |= ctrl &
+                (CSL_MCBSP_CTRL_RX_ENABLE | CSL_MCBSP_CTRL_TX_ENABLE);
+            if (ctrl & CSL_MCBSP_CTRL_RX_DISABLE) {
+                hMcbsp->enabled &= ~CSL_MCBSP_CTRL_RX_ENABLE;
+            }
+            if (ctrl & CSL_MCBSP_CTRL_TX_DISABLE) {
+                hMcbsp->enabled &= ~CSL_MCBSP_CTRL_TX_ENABLE;
+            }
+            break;
+
+        default:
+            return (CSL_ESYS_INVCMD);
+    }
+
+    return (CSL_SOK);
+}
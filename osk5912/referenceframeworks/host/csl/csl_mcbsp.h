@@ -0,0 +1,66 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== csl_mcbsp.h ========
+ *  Host build: the CSL McBSP, limited to opening a port and enabling its
+ *  receiver and transmitter. The serial port itself is not modelled: the
+ *  DMA model (csl_dma.h) stands for the words it moves.
+ */
+#ifndef CSL_MCBSP_
+#define CSL_MCBSP_
+
+#include <csl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CSL_MCBSP_CNT                   3
+
+/* enable/disable controls of CSL_MCBSP_CMD_RESET_CONTROL */
+#define CSL_MCBSP_CTRL_RX_ENABLE        (1)
+#define CSL_MCBSP_CTRL_TX_ENABLE        (2)
+#define CSL_MCBSP_CTRL_RX_DISABLE       (4)
+#define CSL_MCBSP_CTRL_TX_DISABLE       (8)
+
+typedef enum {
+    CSL_MCBSP_1 = 0,
+    CSL_MCBSP_2 = 1,
+    CSL_MCBSP_3 = 2
+} CSL_McbspNum;
+
+typedef enum {
+    CSL_MCBSP_CMD_REG_RESET     = 4,    /* registers to reset values */
+    CSL_MCBSP_CMD_RESET_CONTROL = 5     /* CSL_MCBSP_CTRL_* bit mask */
+} CSL_McbspHwControlCmd;
+
+typedef struct CSL_McbspHwSetup CSL_McbspHwSetup;  /* not modelled */
+
+typedef struct CSL_McbspObj {
+    CSL_OpenMode    openMode;
+    Int16           perNum;
+    CSL_BitMask16   enabled;    /* CSL_MCBSP_CTRL_RX/TX_ENABLE */
+} CSL_McbspObj;
+
+typedef CSL_McbspObj *CSL_McbspHandle;
+
+extern CSL_Status CSL_mcbspInit(Void);
+extern CSL_McbspHandle CSL_mcbspOpen(CSL_McbspObj *mcbspObj,
+    CSL_McbspNum mcbspNum, CSL_OpenMode openMode, CSL_McbspHwSetup *setup,
+    CSL_Status *status);
+extern CSL_Status CSL_mcbspHwSetup(CSL_McbspHandle hMcbsp,
+    CSL_McbspHwSetup *setup);
+extern CSL_Status CSL_mcbspHwControl(CSL_McbspHandle hMcbsp,
+    CSL_McbspHwControlCmd cmd, Void *arg);
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* CSL_MCBSP_ */
@@ -0,0 +1,648 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== dmatest.c ========
+ *  Checks of the C55XX_DMA_MCBSP_CSLV3 driver on the host, built for the
+ *  5912 as in its c5912 project, on a model of the DMA channel registers
+ *  (csl/csl_dma.h). The driver is called through its IOM_Fxns table, as
+ *  the class driver does; each McBSP word is a CSL_dmaSync() call, which
+ *  moves it to or from the address the model computes from the registers
+ *  the driver programmed, and the completion interrupts run the driver's
+ *  ISR.
+ *
+ *  sort: for 2 to 8 sorted channels (and 1, the contiguous transfer), on
+ *  input and on output, with shared and with separate source and
+ *  destination indexes, two blocks of each length are submitted. The
+ *  McBSP stream is interleaved, word k of a block being sample k / chans
+ *  of channel k % chans, which must be found at, or taken from, word
+ *  k / chans of that channel's run in the packet. Each block must complete
+ *  with one interrupt, after its last word, and the DMA must then wait
+ *  for the next packet. Blocks that are not whole sample periods, or too
+ *  long for the 16-bit indexes, must be refused.
+ *
+ *  continuous: for 1 to 3 channels, on input and on output, a continuous
+ *  channel is replayed through a late application: two packets, then
+ *  none, so that the DMA runs into the driver's fill block, then two late
+ *  packets submitted in the middle of the second fill block, which must
+ *  not be picked up before its end. The fill blocks must send silence or
+ *  discard the input, never come back to the callback, and be counted by
+ *  C55XX_DMA_MCBSP_CSLV3_CMD_GETSTATS, which RESETSTATS must clear. Last,
+ *  the channel is aborted, flushed or timed out while a fill block is in
+ *  flight, with packets lined up and queued behind it. No McBSP word may
+ *  be lost until then.
+ *
+ *  usage: dmatest [-a]
+ *      -a  sort every block length up to C55XX_DMA_MCBSP_CSLV3_SORTSIZEMAX,
+ *          not only the short ones and those around the powers of two
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <std.h>
+#include <iom.h>
+
+#include <csl.h>
+#include <csl_dma.h>
+#include <csl_mcbsp.h>
+
+// RF module includes
+#include <c55xx_dma_mcbsp_cslv3.h>
+
+#define SIZEMAX         C55XX_DMA_MCBSP_CSLV3_SORTSIZEMAX
+#define MAXCHANS        8       // channels sorted
+#define NUMBLOCKS       2       // blocks submitted per configuration
+#define NUMPACKETS      6       // packets of the continuous replay
+#define CONTCHANS       3       // channels of the continuous replay
+#define CONTLEN         40      // samples per channel of its packets
+#define FILL            NUMPACKETS  // block index of the fill block
+#define FILLWORD        0xFFFE  // what the McBSP receives in fill blocks
+#define SHORTLEN        128     // lengths checked one by one without -a
+#define GUARD           SIZEMAX // words around the blocks, past one index
+#define POISON          0xFFFF  // never a sample
+#define RXDMA           CSL_DMA_CHA_4
+#define TXDMA           CSL_DMA_CHA_5
+
+/* word k of block b on the McBSP */
+#define SAMPLE(b, k)    ((Uint16)((b) * SIZEMAX + (k)))
+
+/* how the continuous replay stops its channel */
+typedef enum Stop {
+    STOPABORT = 0,      // an IOM_ABORT packet
+    STOPFLUSH,          // an IOM_FLUSH packet
+    STOPTIMEOUT,        // IOM_CHAN_TIMEDOUT from the class driver
+    NUMSTOPS
+} Stop;
+
+/* word k of packet b of the continuous replay */
+#define CONTSAMPLE(b, k) ((Uint16)((b) * CONTCHANS * CONTLEN + (k)))
+
+/*
+ *  The DMA setups of the OSK5912 driver: the McBSP side is constant, the
+ *  memory side post-incremented, and the frame interrupt signals the end
+ *  of a contiguous block. The McBSP addresses are not modelled.
+ */
+static CSL_DmaHwSetupPort mcbspPort = {
+    CSL_DMA_AMODE_CONST, 0x00000000, 0, 0
+};
+static CSL_DmaHwSetupPort memPort = {
+    CSL_DMA_AMODE_POSTINC, 0x00000000, 0, 0
+};
+static CSL_DmaHwSetupChannel channelSetup = {
+    0, 1, CSL_DMA_ONOFF_OFF, CSL_DMA_ONOFF_OFF, CSL_DMA_ONOFF_ON
+};
+static CSL_DmaHwSetupIntr intrSetup = {
+    CSL_DMA_ONOFF_OFF, CSL_DMA_ONOFF_ON
+};
+static CSL_DmaHwSetupGlobal globalSetup = {
+    CSL_DMA_INDEXMODE_SAME
+};
+static CSL_DmaHwSetup dmaRxCfg = {
+    &mcbspPort, &memPort, &channelSetup, &intrSetup, &globalSetup
+};
+static CSL_DmaHwSetup dmaTxCfg = {
+    &memPort, &mcbspPort, &channelSetup, &intrSetup, &globalSetup
+};
+
+static IOM_Fxns    *drv = &C55XX_DMA_MCBSP_CSLV3_FXNS;
+static Ptr          dev;
+static CSL_McbspObj mcbspObj;
+static CSL_DmaObj   dmaObj;
+
+/* the blocks, between guards */
+static Uint16       mem[ GUARD + NUMBLOCKS * SIZEMAX + GUARD ];
+static IOM_Packet   packets[ NUMPACKETS ];
+
+/* the packets the driver completed, in order */
+static IOM_Packet  *done[ NUMPACKETS ];
+static Uns          doneCnt;
+
+static Bool checkSort(Int mode, Uns chans, Uns len,
+                      CSL_DmaIndexMode indexMode);
+static Bool checkRefused(Uns chans, Uns size);
+static Bool checkContinuous(Int mode, Uns chans, Stop stop);
+static Bool replay(Int mode, Uns chans, Uns b, Uns from, Uns to,
+                   Uns doneAfter);
+static Bool checkStats(Ptr chan, Int mode, Uns blockCnt, Uns fillCnt,
+                       Uns minSlack);
+static Ptr  openChan(Int mode, Uns chans, CSL_DmaIndexMode indexMode,
+                     Bool continuous);
+static Void closeChan(Ptr chan);
+static Bool nearPow2(Uns n);
+static Void callback(Ptr arg, IOM_Packet *packet);
+static Void usage(Void);
+
+/*
+ *  ======== main ========
+ */
+Int main(Int argc, Char *argv[])
+{
+    C55XX_DMA_MCBSP_CSLV3_DevParams devParams;
+    Bool    all = FALSE;
+    Int     checks = 0;
+    Int     failures = 0;
+    Int     total = 0;
+    Int     mode, indexMode, stop, k;
+    Uns     chans, len, maxLen;
+
+    for (k = 1; k < argc; k++) {
+        if (strcmp(argv[k], "-a") == 0) {
+            all = TRUE;
+        }
+        else {
+            usage();
+        }
+    }
+
+    C55XX_DMA_MCBSP_CSLV3_init();
+
+    memset(&devParams, 0, sizeof(devParams));
+    devParams.versionId = C55XX_DMA_MCBSP_CSLV3_VERSION_2;
+    devParams.rxDmaId   = RXDMA;
+    devParams.txDmaId   = TXDMA;
+    devParams.mcbspObj  = &mcbspObj;
+    devParams.mcbspCfg  = NULL;
+    if (drv->mdBindDev(&dev, CSL_MCBSP_1, &devParams) != IOM_COMPLETED) {
+        fprintf(stderr, "dmatest: cannot bind the McBSP\n");
+        return (1);
+    }
+
+    for (mode = IOM_INPUT; mode <= IOM_OUTPUT; mode++) {
+        for (indexMode = CSL_DMA_INDEXMODE_SAME;
+            indexMode <= CSL_DMA_INDEXMODE_DIFF; indexMode++) {
+            for (chans = 1; chans <= MAXCHANS; chans++) {
+                maxLen = SIZEMAX / chans;
+                for (len = 1; len <= maxLen; len++) {
+                    if (!all && len > SHORTLEN && len != maxLen &&
+                        !nearPow2(len)) {
+                        continue;
+                    }
+                    checks++;
+                    if (!checkSort(mode, chans, len,
+                        (CSL_DmaIndexMode)indexMode)) {
+                        failures++;
+                    }
+                }
+            }
+        }
+    }
+    for (chans = 2; chans <= MAXCHANS; chans++) {
+        checks += 2;
+        failures += checkRefused(chans, 2 * chans - 1) ? 0 : 1;
+        failures += checkRefused(chans, (SIZEMAX / chans + 1) * chans) ?
+            0 : 1;
+    }
+    printf("dmatest: sort: %d configurations, %d failed\n", checks,
+        failures);
+    total += failures;
+
+    checks = 0;
+    failures = 0;
+    for (mode = IOM_INPUT; mode <= IOM_OUTPUT; mode++) {
+        for (chans = 1; chans <= CONTCHANS; chans++) {
+            for (stop = STOPABORT; stop < NUMSTOPS; stop++) {
+                checks++;
+                if (!checkContinuous(mode, chans, (Stop)stop)) {
+                    failures++;
+                }
+            }
+        }
+    }
+    printf("dmatest: continuous: %d configurations, %d failed\n", checks,
+        failures);
+    total += failures;
+
+    if (total != 0) {
+        printf("dmatest: FAILED\n");
+        return (1);
+    }
+
+    return (0);
+}
+
+/*
+ *  ======== checkSort ========
+ *  Move NUMBLOCKS blocks of chans channels of len samples through a
+ *  channel sorted by the DMA, word by word, checking where each word
+ *  lands or comes from, and when the blocks complete.
+ */
+static Bool checkSort(Int mode, Uns chans, Uns len,
+                      CSL_DmaIndexMode indexMode)
+{
+    CSL_DmaChaNum chaNum = (mode == IOM_INPUT) ? RXDMA : TXDMA;
+    String      dir = (mode == IOM_INPUT) ? "input" : "output";
+    String      how = (indexMode == CSL_DMA_INDEXMODE_SAME) ? "shared" :
+                      "separate";
+    Uns         size = chans * len;
+    Uns         b, k, i;
+    Uint16     *block;
+    Uint16      word;
+    Ptr         chan;
+    Bool        ok = TRUE;
+
+    chan = openChan(mode, chans, indexMode, FALSE);
+    if (chan == NULL) {
+        return (FALSE);
+    }
+
+    for (i = 0; i < sizeof(mem) / sizeof(mem[0]); i++) {
+        mem[i] = POISON;
+    }
+    doneCnt = 0;
+    for (b = 0; b < NUMBLOCKS; b++) {
+        block = &mem[ GUARD + b * size ];
+        packets[b].addr   = block;
+        packets[b].size   = size;
+        packets[b].cmd    = (mode == IOM_INPUT) ? IOM_READ : IOM_WRITE;
+        packets[b].status = IOM_PENDING;
+        if (mode == IOM_OUTPUT) {
+            for (k = 0; k < size; k++) {
+                block[ (k % chans) * len + k / chans ] = SAMPLE(b, k);
+            }
+        }
+        if (drv->mdSubmitChan(chan, &packets[b]) != IOM_PENDING) {
+            printf("dmatest: sort: %s, %u channels of %u: block %u "
+                "refused\n", dir, chans, len, b);
+            ok = FALSE;
+        }
+    }
+
+    // one element per channel and one frame per sample period
+    if (ok && chans > 1 &&
+        (dmaObj.regs->CEN != chans || dmaObj.regs->CFN != len)) {
+        printf("dmatest: sort: %s, %u channels of %u: CEN %u, CFN %u\n",
+            dir, chans, len, dmaObj.regs->CEN, dmaObj.regs->CFN);
+        ok = FALSE;
+    }
+
+    for (b = 0; ok && b < NUMBLOCKS; b++) {
+        block = packets[b].addr;
+        for (k = 0; ok && k < size; k++) {
+            word = SAMPLE(b, k);
+            i = (k % chans) * len + k / chans;
+            if (!CSL_dmaSync(chaNum, &word)) {
+                printf("dmatest: sort: %s, %u channels of %u, %s indexes: "
+                    "word %u of block %u lost\n", dir, chans, len, how, k,
+                    b);
+                ok = FALSE;
+            }
+            else if (mode == IOM_INPUT ? block[i] != SAMPLE(b, k) :
+                word != SAMPLE(b, k)) {
+                printf("dmatest: sort: %s, %u channels of %u, %s indexes: "
+                    "word %u of block %u is not sample %u of channel %u\n",
+                    dir, chans, len, how, k, b, k / chans, k % chans);
+                ok = FALSE;
+            }
+            else if (doneCnt != b + (k + 1 == size ? 1 : 0)) {
+                printf("dmatest: sort: %s, %u channels of %u, %s indexes: "
+                    "%u blocks completed after word %u of block %u\n",
+                    dir, chans, len, how, doneCnt, k, b);
+                ok = FALSE;
+            }
+        }
+        for (k = 0; ok && mode == IOM_INPUT && k < size; k++) {
+            if (block[ (k % chans) * len + k / chans ] != SAMPLE(b, k)) {
+                printf("dmatest: sort: %s, %u channels of %u, %s indexes: "
+                    "sample %u of channel %u of block %u overwritten\n",
+                    dir, chans, len, how, k / chans, k % chans, b);
+                ok = FALSE;
+            }
+        }
+        if (ok && (done[b] != &packets[b] ||
+            packets[b].status != IOM_COMPLETED)) {
+            printf("dmatest: sort: %s, %u channels of %u: block %u not "
+                "completed\n", dir, chans, len, b);
+            ok = FALSE;
+        }
+    }
+
+    for (i = 0; ok && i < GUARD; i++) {
+        if (mem[i] != POISON || mem[ GUARD + NUMBLOCKS * size + i ] !=
+            POISON) {
+            printf("dmatest: sort: %s, %u channels of %u, %s indexes: "
+                "written outside the blocks\n", dir, chans, len, how);
+            ok = FALSE;
+        }
+    }
+
+    // no packet left: the DMA waits for ENDPROG
+    if (ok && CSL_dmaSync(chaNum, &word)) {
+        printf("dmatest: sort: %s, %u channels of %u: the DMA ran past "
+            "the last block\n", dir, chans, len);
+        ok = FALSE;
+    }
+
+    closeChan(chan);
+
+    return (ok);
+}
+
+/*
+ *  ======== checkRefused ========
+ *  A sorted block of size words must be refused.
+ */
+static Bool checkRefused(Uns chans, Uns size)
+{
+    IOM_Packet  packet;
+    Ptr         chan;
+    Int         status;
+
+    chan = openChan(IOM_INPUT, chans, CSL_DMA_INDEXMODE_SAME, FALSE);
+    if (chan == NULL) {
+        return (FALSE);
+    }
+
+    packet.addr = &mem[ GUARD ];
+    packet.size = size;
+    packet.cmd  = IOM_READ;
+    status = drv->mdSubmitChan(chan, &packet);
+
+    closeChan(chan);
+
+    if (status != IOM_EBADARGS) {
+        printf("dmatest: sort: %u channels, block of %u words not "
+            "refused\n", chans, size);
+        return (FALSE);
+    }
+
+    return (TRUE);
+}
+
+/*
+ *  ======== checkContinuous ========
+ *  Replay a late application on a continuous channel of chans channels,
+ *  and stop it the way stop says while a fill block is in flight.
+ */
+static Bool checkContinuous(Int mode, Uns chans, Stop stop)
+{
+    CSL_DmaChaNum chaNum = (mode == IOM_INPUT) ? RXDMA : TXDMA;
+    String      dir = (mode == IOM_INPUT) ? "input" : "output";
+    String      how = (stop == STOPABORT) ? "abort" :
+                      (stop == STOPFLUSH) ? "flush" : "timeout";
+    Uns         size = chans * CONTLEN;
+    Uns         fill = C55XX_DMA_MCBSP_CSLV3_FILLSIZE -
+                       C55XX_DMA_MCBSP_CSLV3_FILLSIZE % chans;
+    Uns         b, k, i;
+    Uint16     *block;
+    Uint16      word;
+    IOM_Packet  packet;
+    Ptr         chan;
+    Bool        ok = TRUE;
+
+    chan = openChan(mode, chans, CSL_DMA_INDEXMODE_SAME, TRUE);
+    if (chan == NULL) {
+        return (FALSE);
+    }
+
+    for (i = 0; i < sizeof(mem) / sizeof(mem[0]); i++) {
+        mem[i] = POISON;
+    }
+    doneCnt = 0;
+    for (b = 0; b < NUMPACKETS; b++) {
+        block = &mem[ GUARD + b * size ];
+        packets[b].addr   = block;
+        packets[b].size   = size;
+        packets[b].cmd    = (mode == IOM_INPUT) ? IOM_READ : IOM_WRITE;
+        packets[b].status = IOM_PENDING;
+        if (mode == IOM_OUTPUT) {
+            for (k = 0; k < size; k++) {
+                block[ (k % chans) * CONTLEN + k / chans ] =
+                    CONTSAMPLE(b, k);
+            }
+        }
+    }
+
+    // two packets in time, then the application is late twice over
+    ok = ok && checkStats(chan, mode, 0, 0, (Uns)-1);
+    drv->mdSubmitChan(chan, &packets[0]);
+    drv->mdSubmitChan(chan, &packets[1]);
+    ok = ok && replay(mode, chans, 0, 0, size, 1);
+    ok = ok && replay(mode, chans, 1, 0, size, 2);
+    ok = ok && replay(mode, chans, FILL, 0, fill, 2);
+
+    // late packets resume at the next block boundary, not mid-block
+    ok = ok && replay(mode, chans, FILL, 0, fill / 2, 2);
+    drv->mdSubmitChan(chan, &packets[2]);
+    drv->mdSubmitChan(chan, &packets[3]);
+    ok = ok && replay(mode, chans, FILL, fill / 2, fill, 2);
+    ok = ok && replay(mode, chans, 2, 0, size, 3);
+    ok = ok && checkStats(chan, mode, 5, 2, 0);
+
+    drv->mdControlChan(chan, C55XX_DMA_MCBSP_CSLV3_CMD_RESETSTATS, NULL);
+    ok = ok && checkStats(chan, mode, 0, 0, (Uns)-1);
+
+    // the fill block is in flight when the channel is stopped
+    ok = ok && replay(mode, chans, 3, 0, size, 4);
+    ok = ok && checkStats(chan, mode, 1, 1, 0);
+    ok = ok && replay(mode, chans, FILL, 0, fill / 2, 4);
+    drv->mdSubmitChan(chan, &packets[4]);
+    drv->mdSubmitChan(chan, &packets[5]);
+    if (stop == STOPTIMEOUT) {
+        drv->mdControlChan(chan, IOM_CHAN_TIMEDOUT, NULL);
+    }
+    else {
+        packet.cmd = (stop == STOPABORT) ? IOM_ABORT : IOM_FLUSH;
+        if (drv->mdSubmitChan(chan, &packet) != IOM_COMPLETED ||
+            packet.status != IOM_COMPLETED) {
+            printf("dmatest: continuous: %s, %u channels: %s not "
+                "completed\n", dir, chans, how);
+            ok = FALSE;
+        }
+    }
+
+    for (b = 0; ok && b < NUMPACKETS; b++) {
+        if (doneCnt != NUMPACKETS || done[b] != &packets[b] ||
+            packets[b].status != (b < 4 ? IOM_COMPLETED : IOM_ABORTED)) {
+            printf("dmatest: continuous: %s, %u channels, %s: %u packets "
+                "back, packet %u not %s\n", dir, chans, how, doneCnt, b,
+                (b < 4) ? "completed" : "aborted");
+            ok = FALSE;
+        }
+    }
+
+    // nothing written to the guards, nor to the aborted input packets
+    for (i = 0; ok && i < GUARD + 2 * size; i++) {
+        if ((i < GUARD && mem[i] != POISON) ||
+            ((mode == IOM_INPUT || i >= 2 * size) &&
+             mem[ GUARD + 4 * size + i ] != POISON)) {
+            printf("dmatest: continuous: %s, %u channels, %s: written "
+                "outside the completed packets\n", dir, chans, how);
+            ok = FALSE;
+        }
+    }
+
+    if (ok && CSL_dmaSync(chaNum, &word)) {
+        printf("dmatest: continuous: %s, %u channels, %s: the DMA still "
+            "runs\n", dir, chans, how);
+        ok = FALSE;
+    }
+
+    closeChan(chan);
+
+    return (ok);
+}
+
+/*
+ *  ======== replay ========
+ *  McBSP words from to to - 1 of packet b of the continuous replay, or of
+ *  a fill block if b is FILL. None may be lost, each must land in or come
+ *  from its place in the packet (silence for an output fill block), and
+ *  doneAfter packets must be done after the last one, not before.
+ */
+static Bool replay(Int mode, Uns chans, Uns b, Uns from, Uns to,
+                   Uns doneAfter)
+{
+    CSL_DmaChaNum chaNum = (mode == IOM_INPUT) ? RXDMA : TXDMA;
+    String      dir = (mode == IOM_INPUT) ? "input" : "output";
+    Uns         doneBefore = doneCnt;
+    Uns         size = chans * CONTLEN;
+    Uint16     *block = (b == FILL) ? NULL : packets[b].addr;
+    Uint16      word;
+    Char        name[ 32 ];
+    Uns         k;
+
+    if (b == FILL) {
+        strcpy(name, "a fill block");
+    }
+    else {
+        sprintf(name, "packet %u", b);
+    }
+
+    for (k = from; k < to; k++) {
+        word = (b == FILL) ? FILLWORD : CONTSAMPLE(b, k);
+        if (!CSL_dmaSync(chaNum, &word)) {
+            printf("dmatest: continuous: %s, %u channels: word %u of %s "
+                "lost\n", dir, chans, k, name);
+            return (FALSE);
+        }
+        if (b == FILL ? (mode == IOM_OUTPUT && word != 0) :
+            (mode == IOM_INPUT ?
+             block[ (k % chans) * CONTLEN + k / chans ] != CONTSAMPLE(b, k) :
+             word != CONTSAMPLE(b, k))) {
+            printf("dmatest: continuous: %s, %u channels: word %u of %s "
+                "misplaced\n", dir, chans, k, name);
+            return (FALSE);
+        }
+        if (doneCnt != (k + 1 == to ? doneAfter : doneBefore)) {
+            printf("dmatest: continuous: %s, %u channels: %u packets "
+                "done after word %u of %s\n", dir, chans, doneCnt, k, name);
+            return (FALSE);
+        }
+    }
+
+    // a completed input packet holds all its samples
+    for (k = 0; mode == IOM_INPUT && b != FILL && to == size && k < size;
+        k++) {
+        if (block[ (k % chans) * CONTLEN + k / chans ] != CONTSAMPLE(b, k)) {
+            printf("dmatest: continuous: %s, %u channels: sample %u of "
+                "channel %u of packet %u overwritten\n", dir, chans,
+                k / chans, k % chans, b);
+            return (FALSE);
+        }
+    }
+
+    return (TRUE);
+}
+
+/*
+ *  ======== checkStats ========
+ *  The channel statistics must show blockCnt blocks, fillCnt of them fill
+ *  blocks (overruns on input, underruns on output), and minSlack.
+ */
+static Bool checkStats(Ptr chan, Int mode, Uns blockCnt, Uns fillCnt,
+                       Uns minSlack)
+{
+    C55XX_DMA_MCBSP_CSLV3_Stats stats;
+
+    if (drv->mdControlChan(chan, C55XX_DMA_MCBSP_CSLV3_CMD_GETSTATS,
+        &stats) != IOM_COMPLETED) {
+        printf("dmatest: continuous: no statistics\n");
+        return (FALSE);
+    }
+    if (stats.blockCnt != blockCnt || stats.minSlack != minSlack ||
+        stats.overruns != (mode == IOM_INPUT ? fillCnt : 0) ||
+        stats.underruns != (mode == IOM_OUTPUT ? fillCnt : 0)) {
+        printf("dmatest: continuous: %u blocks, %u underruns, %u overruns, "
+            "slack %d; expected %u blocks, %u fill blocks, slack %d\n",
+            stats.blockCnt, stats.underruns, stats.overruns,
+            (Int)stats.minSlack, blockCnt, fillCnt, (Int)minSlack);
+        return (FALSE);
+    }
+
+    return (TRUE);
+}
+
+/*
+ *  ======== openChan ========
+ */
+static Ptr openChan(Int mode, Uns chans, CSL_DmaIndexMode indexMode,
+                    Bool continuous)
+{
+    C55XX_DMA_MCBSP_CSLV3_ChanParams chanParams;
+    Ptr chan;
+
+    globalSetup.indexMode = indexMode;
+
+    chanParams.dmaObj     = &dmaObj;
+    chanParams.dmaCfg     = (mode == IOM_INPUT) ? &dmaRxCfg : &dmaTxCfg;
+    chanParams.sortChans  = chans;
+    chanParams.continuous = continuous;
+
+    if (drv->mdCreateChan(&chan, dev, "", mode, &chanParams, callback,
+        NULL) != IOM_COMPLETED) {
+        printf("dmatest: cannot create the %s channel\n",
+            (mode == IOM_INPUT) ? "input" : "output");
+        return (NULL);
+    }
+
+    return (chan);
+}
+
+/*
+ *  ======== closeChan ========
+ *  Abort what is left on the channel, as SIO_delete() does, and delete it.
+ */
+static Void closeChan(Ptr chan)
+{
+    IOM_Packet packet;
+
+    packet.cmd = IOM_ABORT;
+    drv->mdSubmitChan(chan, &packet);
+    drv->mdDeleteChan(chan);
+}
+
+/*
+ *  ======== nearPow2 ========
+ *  TRUE if n is a power of two or next to one.
+ */
+static Bool nearPow2(Uns n)
+{
+    return ((Bool)(((n - 1) & (n - 2)) == 0 || (n & (n - 1)) == 0 ||
+        ((n + 1) & n) == 0));
+}
+
+/*
+ *  ======== callback ========
+ */
+static Void callback(Ptr arg, IOM_Packet *packet)
+{
+    if (doneCnt < NUMPACKETS) {
+        done[ doneCnt ] = packet;
+    }
+    doneCnt++;
+}
+
+/*
+ *  ======== usage ========
+ */
+static Void usage(Void)
+{
+    fprintf(stderr, "usage: dmatest [-a]\n");
+    exit(1);
+}
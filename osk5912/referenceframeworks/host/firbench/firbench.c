@@ -0,0 +1,327 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== firbench.c ========
+ *  Crossover benchmark of FIR_TI on the host: direct form against fast
+ *  convolution.
+ *
+ *  For filter lengths from MINTAPS, doubling up to maxTaps, FIR_TI
+ *  instances are created with ALGRF and activated, and their filter()
+ *  is timed on frames of frameLen samples of noise: in direct form, and
+ *  by fast convolution with each FFT length from the filter length up
+ *  to MAXFFTSTEPS doublings further. The fastest FFT length is reported
+ *  next to the one IFIR_FFTAUTO takes, which FIR_TI_alloc reveals
+ *  through the size of the transform buffer it asks for, and the filter
+ *  length from which fast convolution wins is reported at the end.
+ *
+ *  Every output of fast convolution is compared with the direct form
+ *  accumulated in IFIR_ACCUMWIDE. With -c the run fails if any differs
+ *  by more than tolerance.
+ *
+ *  usage: firbench [-n frameLen] [-r frames] [-l maxTaps] [-c tolerance]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <std.h>
+#include <clk.h>
+
+// RF module includes
+#include <algrf.h>
+#include <fir_ti.h>
+
+#define DEFFRAMELEN     256     // samples per frame
+#define DEFFRAMES       100     // frames timed per configuration
+#define DEFMAXTAPS      1024
+#define MINTAPS         8
+#define MAXTAPS         4096
+#define MAXFFT          8192    // as in fir_ti_fft.c
+#define MAXFFTSTEPS     3       // FFT lengths tried beyond the shortest
+#define FFTBUF          5       // memTab of the transform buffer
+#define MAXMEMRECS      16
+
+/*
+ *  Results of one configuration.
+ */
+typedef struct Result {
+    Int         fftLen;         // 0 for direct form
+    LgUns       elapsed;        // ns
+    Int         maxErr;         // against the wide direct form
+} Result;
+
+static Int  fftLenOf(IFIR_Params *params);
+static Bool runFir(IFIR_Params *params, Short *in, Short *out, Uns frames,
+                   LgUns *elapsed);
+static Int  maxDiff(Short *a, Short *b, LgUns n);
+static Void makeLowPass(Short *coeff, Int taps);
+static Void usage(Void);
+
+/*
+ *  ======== main ========
+ */
+Int main(Int argc, Char *argv[])
+{
+    Int     frameLen  = DEFFRAMELEN;
+    Uns     frames    = DEFFRAMES;
+    Int     maxTaps   = DEFMAXTAPS;
+    Int     tolerance = -1;
+    Int     crossover = 0;
+    Int     autoCrossover = 0;
+    LgUns   samples;
+    LgUns   seed = 1;
+    LgUns   j;
+    IFIR_Params params;
+    Result  direct, best, autoFft, fft;
+    Short  *coeff, *in, *ref, *out;
+    Int     taps, shortest, step, i;
+    Bool    ok = TRUE;
+
+    for (i = 1; i < argc; i++) {
+        if (strlen(argv[i]) != 2 || argv[i][0] != '-' || i + 1 >= argc) {
+            usage();
+        }
+        switch (argv[i][1]) {
+            case 'n': frameLen  = atoi(argv[++i]);  break;
+            case 'r': frames    = (Uns)atoi(argv[++i]); break;
+            case 'l': maxTaps   = atoi(argv[++i]);  break;
+            case 'c': tolerance = atoi(argv[++i]);  break;
+            default:  usage();
+        }
+    }
+    if (frameLen <= 0 || frames == 0 || maxTaps < MINTAPS ||
+        maxTaps > MAXTAPS) {
+        usage();
+    }
+
+    ALGRF_init();
+    FIR_TI_init();
+
+    /* noise at half of full scale, which no filter below can saturate */
+    samples = (LgUns)frames * frameLen;
+    coeff = malloc(maxTaps * sizeof(Short));
+    in    = malloc(samples * sizeof(Short));
+    ref   = malloc(samples * sizeof(Short));
+    out   = malloc(samples * sizeof(Short));
+    if (coeff == NULL || in == NULL || ref == NULL || out == NULL) {
+        fprintf(stderr, "firbench: out of memory\n");
+        return (1);
+    }
+    for (j = 0; j < samples; j++) {
+        seed = (seed * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+        in[j] = (Short)(((Int)(seed >> 15) - 32768) / 2);
+    }
+
+    printf("firbench: %d samples per frame, %u frames, ns per sample\n",
+        frameLen, frames);
+    printf("   taps    direct    fastest FFT    IFIR_FFTAUTO    max error\n");
+
+    for (taps = MINTAPS; taps <= maxTaps; taps *= 2) {
+        makeLowPass(coeff, taps);
+        for (shortest = 2; shortest < taps; shortest *= 2) {
+        }
+
+        params           = IFIR_PARAMS;
+        params.coeffPtr  = coeff;
+        params.filterLen = taps;
+        params.frameLen  = frameLen;
+
+        /* the reference, and the direct form that fast convolution meets */
+        params.accum  = IFIR_ACCUMWIDE;
+        params.fftLen = IFIR_FFTOFF;
+        ok = ok && runFir(&params, in, ref, frames, &direct.elapsed);
+        params.accum  = IFIR_ACCUM32;
+        ok = ok && runFir(&params, in, out, frames, &direct.elapsed);
+
+        params.fftLen  = IFIR_FFTAUTO;
+        autoFft.fftLen = fftLenOf(&params);
+        autoFft.elapsed = direct.elapsed;
+        if (autoFft.fftLen > (shortest << MAXFFTSTEPS)) {
+            params.fftLen = autoFft.fftLen;
+            ok = ok && runFir(&params, in, out, frames, &autoFft.elapsed);
+        }
+
+        best.fftLen  = 0;
+        best.elapsed = 0;
+        best.maxErr  = 0;
+        for (step = 0; step <= MAXFFTSTEPS; step++) {
+            fft.fftLen = shortest << step;
+            if (fft.fftLen > MAXFFT) {
+                break;
+            }
+            params.fftLen = fft.fftLen;
+            ok = ok && runFir(&params, in, out, frames, &fft.elapsed);
+            fft.maxErr = maxDiff(ref, out, samples);
+
+            if (best.fftLen == 0 || fft.elapsed < best.elapsed) {
+                best.fftLen  = fft.fftLen;
+                best.elapsed = fft.elapsed;
+            }
+            if (fft.fftLen == autoFft.fftLen) {
+                autoFft.elapsed = fft.elapsed;
+            }
+            if (fft.maxErr > best.maxErr) {
+                best.maxErr = fft.maxErr;
+            }
+        }
+        if (!ok) {
+            fprintf(stderr, "firbench: cannot create FIR_TI instance\n");
+            return (1);
+        }
+
+        printf("  %5d  %8.2f  %8.2f %5d   %8.2f ", taps,
+            (double)direct.elapsed / samples,
+            (double)best.elapsed / samples, best.fftLen,
+            (double)autoFft.elapsed / samples);
+        if (autoFft.fftLen == 0) {
+            printf(" direct");
+        }
+        else {
+            printf("%6d ", autoFft.fftLen);
+        }
+        printf("  %5d\n", best.maxErr);
+
+        if (crossover == 0 && best.elapsed < direct.elapsed) {
+            crossover = taps;
+        }
+        if (autoCrossover == 0 && autoFft.fftLen != 0) {
+            autoCrossover = taps;
+        }
+        if (tolerance >= 0 && best.maxErr > tolerance) {
+            ok = FALSE;
+        }
+    }
+
+    if (crossover != 0) {
+        printf("  fast convolution is faster from %d taps", crossover);
+    }
+    else {
+        printf("  fast convolution is never faster");
+    }
+    if (autoCrossover != 0) {
+        printf(", IFIR_FFTAUTO takes it from %d taps\n", autoCrossover);
+    }
+    else {
+        printf(", IFIR_FFTAUTO never takes it\n");
+    }
+
+    if (!ok) {
+        printf("firbench: FAILED, fast convolution differs by more than "
+            "%d\n", tolerance);
+        return (1);
+    }
+
+    return (0);
+}
+
+/*
+ *  ======== fftLenOf ========
+ *  The FFT length FIR_TI takes for params, 0 for direct form, from the
+ *  size of the transform buffer it asks for, which is followed by a frame
+ *  for crossfades.
+ */
+static Int fftLenOf(IFIR_Params *params)
+{
+    IALG_MemRec memTab[MAXMEMRECS];
+    IALG_Fxns  *fxns = &FIR_TI_IFIR.ialg;
+
+    if (fxns->algAlloc((IALG_Params *)params, &fxns, memTab) <= FFTBUF) {
+        return (0);
+    }
+
+    return ((Int)((memTab[FFTBUF].size - params->frameLen * sizeof(Short)) /
+        (2 * sizeof(Int32))));
+}
+
+/*
+ *  ======== runFir ========
+ *  Filter frames frames from in to out with a new instance created with
+ *  params, and time the filter() calls.
+ */
+static Bool runFir(IFIR_Params *params, Short *in, Short *out, Uns frames,
+                   LgUns *elapsed)
+{
+    ALGRF_Handle alg;
+    IFIR_Fxns   *fxns = &FIR_TI_IFIR;
+    Int          frameLen = params->frameLen;
+    LgUns        start;
+    Uns          f;
+
+    alg = ALGRF_create(&fxns->ialg, NULL, (IALG_Params *)params);
+    if (alg == NULL) {
+        return (FALSE);
+    }
+    ALGRF_activate(alg);
+
+    start = CLK_gethtime();
+    for (f = 0; f < frames; f++) {
+        fxns->filter((IFIR_Handle)alg, in + (LgUns)f * frameLen,
+            out + (LgUns)f * frameLen);
+    }
+    *elapsed = CLK_gethtime() - start;
+
+    ALGRF_deactivate(alg);
+    ALGRF_delete(alg);
+
+    return (TRUE);
+}
+
+/*
+ *  ======== maxDiff ========
+ */
+static Int maxDiff(Short *a, Short *b, LgUns n)
+{
+    Int   diff;
+    Int   max = 0;
+    LgUns i;
+
+    for (i = 0; i < n; i++) {
+        diff = abs((Int)a[i] - (Int)b[i]);
+        if (diff > max) {
+            max = diff;
+        }
+    }
+
+    return (max);
+}
+
+/*
+ *  ======== makeLowPass ========
+ *  A Hann-windowed sinc low-pass at a quarter of the sampling rate, in
+ *  Q15, scaled so that the magnitudes of the taps add up to below one.
+ */
+static Void makeLowPass(Short *coeff, Int taps)
+{
+    Double  h[MAXTAPS];
+    Double  sum = 0;
+    Double  t;
+    Int     i;
+
+    for (i = 0; i < taps; i++) {
+        t = i - (taps - 1) / 2.0;
+        h[i] = (t == 0) ? 0.5 : sin(M_PI * t / 2) / (M_PI * t);
+        h[i] *= 0.5 - 0.5 * cos(2 * M_PI * (i + 0.5) / taps);
+        sum += fabs(h[i]);
+    }
+    for (i = 0; i < taps; i++) {
+        coeff[i] = (Short)floor(h[i] / sum * 32000 + 0.5);
+    }
+}
+
+/*
+ *  ======== usage ========
+ */
+static Void usage(Void)
+{
+    fprintf(stderr,
+        "usage: firbench [-n frameLen] [-r frames] [-l maxTaps] "
+        "[-c tolerance]\n");
+    exit(1);
+}
@@ -0,0 +1,866 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== firtest.c ========
+ *  Bit-exactness checks of FIR_TI on the host.
+ *
+ *  kernels: the outputs of FIR_TI in IFIR_ACCUM32 are compared with the
+ *  single-pass direct form FIR_TI started from, which copies each frame
+ *  after the history and sums every output over the two. For a range of
+ *  filter and frame lengths, with symmetric and asymmetric coefficients,
+ *  every output of filter(), of filter() in place, of filterBlock() on
+ *  parts of frames and of filterMulti() on a batch of channels must be
+ *  identical to it, frame after frame.
+ *
+ *  hot: long filters are run on hot input, full-scale noise and square
+ *  waves between quiet frames and silence, with coefficients that add up
+ *  to less than one and with full-scale ones, so that outputs saturate
+ *  and the block exponent of IFIR_ACCUMBLOCK goes from 0 on quiet frames
+ *  up to 9 on the hottest. The reference sums in 64 bits and saturates.
+ *  IFIR_ACCUMWIDE must be identical to it; IFIR_ACCUMBLOCK may lose what
+ *  its block exponent shifts out of the input, and no more.
+ *
+ *  swap: coefficients are staged with IFIR_STAGECOEFF after frame
+ *  SWAPFRAME, with and without crossfade. Up to that frame the output must
+ *  be identical to that of an instance that keeps the old coefficients;
+ *  from the frame after the next, to that of an instance created with the
+ *  new ones. The frame in between is either the new output, or the linear
+ *  mix of both that ends on it. This is checked with filter() in direct
+ *  form and by fast convolution, whose spectra are also moved with
+ *  algMoved() once the banks have swapped, with filterBlock() when the
+ *  coefficients are staged within a frame, and with filterMulti(), where
+ *  the instance that fades out of the batch must not disturb the others.
+ *
+ *  The IFIR_ACCUMBLOCK outputs of the hot check can be written to a file
+ *  with -o, and compared with such a file with -g; make check builds
+ *  firtest a second time with FIR_TI's portable kernels, without SSE2,
+ *  and compares its outputs with those of the SSE2 kernels that way.
+ *
+ *  usage: firtest [-o out.raw] [-g golden.raw]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <std.h>
+
+// RF module includes
+#include <algrf.h>
+#include <fir_ti.h>
+
+#define NUMFRAMES       5       // frames filtered per configuration
+#define HOTFRAMES       10      // frames filtered per hot configuration
+#define SWAPFRAMES      5       // frames filtered per swap configuration
+#define SWAPFRAME       1       // frame after which coefficients are staged
+#define NUMCHANS        3       // channels filtered by filterMulti()
+#define MAXTAPS         1024
+#define MAXFRAMELEN     256
+#define MAXSAMPLES      (HOTFRAMES * MAXFRAMELEN)
+#define MAXWHAT         64
+#define SPECTRUM        3       // memTab of the spectra
+#define MAXMEMRECS      16
+
+/* the lengths around the block size and the history of the kernels */
+static Int filterLens[] = { 2, 3, 4, 5, 8, 9, 16, 31, 32, 33, 64 };
+static Int frameLens[]  = { 1, 3, 4, 5, 7, 16, 33, 80 };
+
+#define NUMFILTERLENS   (sizeof(filterLens) / sizeof(filterLens[0]))
+#define NUMFRAMELENS    (sizeof(frameLens) / sizeof(frameLens[0]))
+
+/* the long filters of the hot check, not multiples of the SSE2 width */
+static Int hotFilterLens[] = { 63, 201, 1023 };
+static Int hotFrameLens[]  = { 80, 256 };
+
+#define NUMHOTFILTERLENS (sizeof(hotFilterLens) / sizeof(hotFilterLens[0]))
+#define NUMHOTFRAMELENS  (sizeof(hotFrameLens) / sizeof(hotFrameLens[0]))
+
+/* the filters of the swap check, and their frames */
+static Int swapFilterLens[] = { 3, 8, 33, 64 };
+static Int swapFrameLens[]  = { 1, 5, 16, 80 };
+
+#define NUMSWAPFILTERLENS (sizeof(swapFilterLens) / sizeof(swapFilterLens[0]))
+#define NUMSWAPFRAMELENS  (sizeof(swapFrameLens) / sizeof(swapFrameLens[0]))
+
+/*
+ *  The single-pass filter of one channel: the history, followed by room
+ *  for a frame.
+ */
+typedef struct Ref {
+    Short       buf[MAXTAPS + MAXFRAMELEN];
+} Ref;
+
+static LgUns seed = 1;
+
+/* what the hot check went through */
+static LgUns saturated = 0;
+static Int   minShift = 15;
+static Int   maxShift = 0;
+
+/* the files of -o and -g */
+static FILE *outFile = NULL;
+static FILE *goldFile = NULL;
+
+static Bool checkKernels(Int filterLen, Int frameLen, Bool symmetric);
+static Bool checkHot(Int filterLen, Int frameLen, Int amplitude);
+static Bool checkSwap(Int filterLen, Int frameLen, Bool fade);
+static Bool checkSwapFft(Short *coeff, Short *newCoeff, Int filterLen,
+                         Int frameLen, Bool fade, Short *in);
+static Void expectSwap(Short *old, Short *new, Short *expect, Int frameLen,
+                       Bool fade);
+static Void stage(ALGRF_Handle alg, Short *coeff, Bool fade);
+static Void moveSpectra(ALGRF_Handle alg, Void *base);
+static Int  refFilter(Ref *ref, Short *coeff, Int filterLen,
+                      IFIR_Accum accum, Short *in, Short *out, Int n);
+static Int  blockExp(Short *x, Int n, LgUns gain);
+static Void runFilter(Short *coeff, Int filterLen, Int frameLen,
+                      IFIR_Accum accum, Int fftLen, Short *in, Short *out,
+                      Int frames);
+static ALGRF_Handle create(Short *coeff, Int filterLen, Int frameLen,
+                           IFIR_Accum accum, Int fftLen);
+static Bool within(String what, Int filterLen, Int frameLen, Short *ref,
+                   Short *out, Int n, Int tolerance);
+static Void makeCoeff(Short *coeff, Int taps, Bool symmetric);
+static Void hot(Short *x, Int n, Int frame);
+static Void noise(Short *x, Int n, Int amplitude);
+static Void usage(Void);
+
+/*
+ *  ======== main ========
+ */
+Int main(Int argc, Char *argv[])
+{
+    Int     checks = 0;
+    Int     failures = 0;
+    Int     hotChecks = 0;
+    Int     hotFailures = 0;
+    Int     swapChecks = 0;
+    Int     swapFailures = 0;
+    Uns     i, j;
+    Int     symmetric, full, fade, k;
+
+    for (k = 1; k < argc; k++) {
+        if (strlen(argv[k]) != 2 || argv[k][0] != '-' || k + 1 >= argc) {
+            usage();
+        }
+        switch (argv[k][1]) {
+            case 'o': outFile  = fopen(argv[++k], "wb");  break;
+            case 'g': goldFile = fopen(argv[++k], "rb");  break;
+            default:  usage();
+        }
+        if ((argv[k - 1][1] == 'o' && outFile == NULL) ||
+            (argv[k - 1][1] == 'g' && goldFile == NULL)) {
+            fprintf(stderr, "firtest: cannot open %s\n", argv[k]);
+            return (1);
+        }
+    }
+
+    ALGRF_init();
+    FIR_TI_init();
+
+    for (i = 0; i < NUMFILTERLENS; i++) {
+        for (j = 0; j < NUMFRAMELENS; j++) {
+            for (symmetric = 0; symmetric <= 1; symmetric++) {
+                checks++;
+                if (!checkKernels(filterLens[i], frameLens[j],
+                    (Bool)symmetric)) {
+                    failures++;
+                }
+            }
+        }
+    }
+    printf("firtest: kernels: %d configurations, %d differ from the "
+        "single-pass filter\n", checks, failures);
+
+    for (i = 0; i < NUMHOTFILTERLENS; i++) {
+        for (j = 0; j < NUMHOTFRAMELENS; j++) {
+            for (full = 0; full <= 1; full++) {
+                hotChecks++;
+                if (!checkHot(hotFilterLens[i], hotFrameLens[j],
+                    full ? 32767 : 32767 / hotFilterLens[i])) {
+                    hotFailures++;
+                }
+            }
+        }
+    }
+    printf("firtest: hot: %d configurations, %d failed, %lu outputs "
+        "saturated, block exponents %d to %d\n", hotChecks, hotFailures,
+        saturated, minShift, maxShift);
+
+    for (i = 0; i < NUMSWAPFILTERLENS; i++) {
+        for (j = 0; j < NUMSWAPFRAMELENS; j++) {
+            for (fade = 0; fade <= 1; fade++) {
+                swapChecks++;
+                if (!checkSwap(swapFilterLens[i], swapFrameLens[j],
+                    (Bool)fade)) {
+                    swapFailures++;
+                }
+            }
+        }
+    }
+    printf("firtest: swap: %d configurations, %d failed\n", swapChecks,
+        swapFailures);
+
+    if (outFile != NULL) {
+        fclose(outFile);
+    }
+    if (goldFile != NULL) {
+        fclose(goldFile);
+    }
+
+    if (failures != 0 || hotFailures != 0 || swapFailures != 0) {
+        printf("firtest: FAILED\n");
+        return (1);
+    }
+
+    return (0);
+}
+
+/*
+ *  ======== checkKernels ========
+ *  Filter NUMFRAMES frames of noise on NUMCHANS channels with the
+ *  single-pass filter, and with each operation of FIR_TI in
+ *  IFIR_ACCUM32, which must give the same outputs. The coefficients add
+ *  up to less than one, so no sum wraps around.
+ */
+static Bool checkKernels(Int filterLen, Int frameLen, Bool symmetric)
+{
+    static Short in[ NUMCHANS ][ MAXSAMPLES ];
+    static Short ref[ NUMCHANS ][ MAXSAMPLES ];
+    static Short out[ NUMCHANS ][ MAXSAMPLES ];
+    static Ref   refs[ NUMCHANS ];
+    Short        coeff[ MAXTAPS ];
+    IFIR_Fxns   *fxns = &FIR_TI_IFIR;
+    ALGRF_Handle algs[ NUMCHANS ];
+    IFIR_Handle  handles[ NUMCHANS ];
+    Short       *inPtrs[ NUMCHANS ];
+    Short       *outPtrs[ NUMCHANS ];
+    Int          samples = NUMFRAMES * frameLen;
+    Int          f, k, off, cut;
+    Bool         ok = TRUE;
+
+    makeCoeff(coeff, filterLen, symmetric);
+    for (k = 0; k < NUMCHANS; k++) {
+        noise(in[k], samples, 32767);
+        memset(&refs[k], 0, sizeof(Ref));
+        for (f = 0; f < NUMFRAMES; f++) {
+            refFilter(&refs[k], coeff, filterLen, IFIR_ACCUM32,
+                in[k] + f * frameLen, ref[k] + f * frameLen, frameLen);
+        }
+    }
+
+    /* filter() on an active instance */
+    runFilter(coeff, filterLen, frameLen, IFIR_ACCUM32, IFIR_FFTOFF, in[0],
+        out[0], NUMFRAMES);
+    ok = within("filter()", filterLen, frameLen, ref[0], out[0], samples,
+        0) && ok;
+
+    /* filter() in place */
+    memcpy(out[0], in[0], samples * sizeof(Short));
+    runFilter(coeff, filterLen, frameLen, IFIR_ACCUM32, IFIR_FFTOFF, out[0],
+        out[0], NUMFRAMES);
+    ok = within("filter() in place", filterLen, frameLen, ref[0], out[0],
+        samples, 0) && ok;
+
+    /* filterBlock() on two parts of each frame, cut in varying places */
+    algs[0] = create(coeff, filterLen, frameLen, IFIR_ACCUM32,
+        IFIR_FFTOFF);
+    for (f = 0; f < NUMFRAMES; f++) {
+        off = f * frameLen;
+        cut = frameLen * (f + 1) / (NUMFRAMES + 1);
+        if (cut > 0) {
+            fxns->filterBlock((IFIR_Handle)algs[0], in[0] + off,
+                out[0] + off, cut);
+        }
+        fxns->filterBlock((IFIR_Handle)algs[0], in[0] + off + cut,
+            out[0] + off + cut, frameLen - cut);
+    }
+    ALGRF_delete(algs[0]);
+    ok = within("filterBlock()", filterLen, frameLen, ref[0], out[0],
+        samples, 0) && ok;
+
+    /* filterMulti() on a batch of channels sharing the coefficients */
+    for (k = 0; k < NUMCHANS; k++) {
+        algs[k] = create(coeff, filterLen, frameLen, IFIR_ACCUM32,
+            IFIR_FFTOFF);
+        handles[k] = (IFIR_Handle)algs[k];
+    }
+    for (f = 0; f < NUMFRAMES; f++) {
+        for (k = 0; k < NUMCHANS; k++) {
+            inPtrs[k]  = in[k] + f * frameLen;
+            outPtrs[k] = out[k] + f * frameLen;
+        }
+        fxns->filterMulti(handles, inPtrs, outPtrs, NUMCHANS);
+    }
+    for (k = 0; k < NUMCHANS; k++) {
+        ALGRF_delete(algs[k]);
+        ok = within("filterMulti()", filterLen, frameLen, ref[k], out[k],
+            samples, 0) && ok;
+    }
+
+    return (ok);
+}
+
+/*
+ *  ======== checkHot ========
+ *  Filter HOTFRAMES frames of hot input with random coefficients between
+ *  -amplitude and amplitude, in IFIR_ACCUMWIDE with filter() and with
+ *  filterBlock() on halves of frames, and in IFIR_ACCUMBLOCK with
+ *  filter(), and compare them with the reference in 64 bits.
+ */
+static Bool checkHot(Int filterLen, Int frameLen, Int amplitude)
+{
+    static Short in[ MAXSAMPLES ];
+    static Short ref[ MAXSAMPLES ];
+    static Short out[ MAXSAMPLES ];
+    static Short gold[ MAXSAMPLES ];
+    static Ref   wide, block;
+    Short        coeff[ MAXTAPS ];
+    Int          bounds[ HOTFRAMES ];
+    Char         what[ MAXWHAT ];
+    IFIR_Fxns   *fxns = &FIR_TI_IFIR;
+    ALGRF_Handle alg;
+    Int          samples = HOTFRAMES * frameLen;
+    Int          f, off, cut;
+    Bool         ok = TRUE;
+
+    noise(coeff, filterLen, amplitude);
+    for (f = 0; f < HOTFRAMES; f++) {
+        hot(in + f * frameLen, frameLen, f);
+    }
+
+    /* IFIR_ACCUMWIDE loses nothing */
+    memset(&wide, 0, sizeof(Ref));
+    for (f = 0; f < HOTFRAMES; f++) {
+        off = f * frameLen;
+        refFilter(&wide, coeff, filterLen, IFIR_ACCUMWIDE, in + off,
+            ref + off, frameLen);
+    }
+
+    runFilter(coeff, filterLen, frameLen, IFIR_ACCUMWIDE, IFIR_FFTOFF, in,
+        out, HOTFRAMES);
+    ok = within("IFIR_ACCUMWIDE filter()", filterLen, frameLen, ref, out,
+        samples, 0) && ok;
+
+    alg = create(coeff, filterLen, frameLen, IFIR_ACCUMWIDE, IFIR_FFTOFF);
+    for (f = 0; f < HOTFRAMES; f++) {
+        off = f * frameLen;
+        cut = frameLen / 2;
+        fxns->filterBlock((IFIR_Handle)alg, in + off, out + off, cut);
+        fxns->filterBlock((IFIR_Handle)alg, in + off + cut,
+            out + off + cut, frameLen - cut);
+    }
+    ALGRF_delete(alg);
+    ok = within("IFIR_ACCUMWIDE filterBlock()", filterLen, frameLen, ref,
+        out, samples, 0) && ok;
+
+    /* IFIR_ACCUMBLOCK loses what each frame's block exponent shifts out */
+    memset(&block, 0, sizeof(Ref));
+    for (f = 0; f < HOTFRAMES; f++) {
+        off = f * frameLen;
+        bounds[f] = refFilter(&block, coeff, filterLen, IFIR_ACCUMBLOCK,
+            in + off, ref + off, frameLen);
+    }
+
+    runFilter(coeff, filterLen, frameLen, IFIR_ACCUMBLOCK, IFIR_FFTOFF, in,
+        out, HOTFRAMES);
+    for (f = 0; f < HOTFRAMES; f++) {
+        off = f * frameLen;
+        sprintf(what, "IFIR_ACCUMBLOCK filter(), frame %d", f);
+        ok = within(what, filterLen, frameLen, ref + off, out + off,
+            frameLen, bounds[f]) && ok;
+    }
+
+    /* ... and must be the same with every build of its kernels */
+    if (outFile != NULL) {
+        fwrite(out, sizeof(Short), samples, outFile);
+    }
+    if (goldFile != NULL) {
+        if (fread(gold, sizeof(Short), samples, goldFile) != samples) {
+            printf("firtest: golden file too short\n");
+            return (FALSE);
+        }
+        ok = within("IFIR_ACCUMBLOCK filter() against golden", filterLen,
+            frameLen, gold, out, samples, 0) && ok;
+    }
+
+    return (ok);
+}
+
+/*
+ *  ======== checkSwap ========
+ *  Stage new coefficients after frame SWAPFRAME, with crossfade if fade,
+ *  and check the output of each operation against that of instances that
+ *  keep the old coefficients and of instances created with the new ones.
+ *  The old coefficients are asymmetric, the new ones symmetric, so the
+ *  kernel changes too.
+ */
+static Bool checkSwap(Int filterLen, Int frameLen, Bool fade)
+{
+    static Short in[ NUMCHANS ][ MAXSAMPLES ];
+    static Short old[ NUMCHANS ][ MAXSAMPLES ];
+    static Short new[ NUMCHANS ][ MAXSAMPLES ];
+    static Short expect[ MAXSAMPLES ];
+    static Short out[ NUMCHANS ][ MAXSAMPLES ];
+    Short        coeff[ MAXTAPS ];
+    Short        newCoeff[ MAXTAPS ];
+    IFIR_Fxns   *fxns = &FIR_TI_IFIR;
+    ALGRF_Handle algs[ NUMCHANS ];
+    IFIR_Handle  handles[ NUMCHANS ];
+    Short       *inPtrs[ NUMCHANS ];
+    Short       *outPtrs[ NUMCHANS ];
+    Int          samples = SWAPFRAMES * frameLen;
+    Int          f, k, off, cut;
+    Bool         ok = TRUE;
+
+    makeCoeff(coeff, filterLen, FALSE);
+    makeCoeff(newCoeff, filterLen, TRUE);
+    for (k = 0; k < NUMCHANS; k++) {
+        noise(in[k], samples, 32767);
+        runFilter(coeff, filterLen, frameLen, IFIR_ACCUM32, IFIR_FFTOFF,
+            in[k], old[k], SWAPFRAMES);
+        runFilter(newCoeff, filterLen, frameLen, IFIR_ACCUM32, IFIR_FFTOFF,
+            in[k], new[k], SWAPFRAMES);
+    }
+
+    /* filter() in direct form, staged between frames */
+    expectSwap(old[0], new[0], expect, frameLen, fade);
+    algs[0] = create(coeff, filterLen, frameLen, IFIR_ACCUM32, IFIR_FFTOFF);
+    ALGRF_activate(algs[0]);
+    for (f = 0; f < SWAPFRAMES; f++) {
+        off = f * frameLen;
+        fxns->filter((IFIR_Handle)algs[0], in[0] + off, out[0] + off);
+        if (f == SWAPFRAME) {
+            stage(algs[0], newCoeff, fade);
+        }
+    }
+    ALGRF_deactivate(algs[0]);
+    ALGRF_delete(algs[0]);
+    ok = within(fade ? "filter() crossfade" : "filter() swap", filterLen,
+        frameLen, expect, out[0], samples, 0) && ok;
+
+    /* filter() by fast convolution */
+    ok = checkSwapFft(coeff, newCoeff, filterLen, frameLen, fade, in[0]) &&
+        ok;
+
+    /* filterBlock() on two parts of each frame, staged within the frame */
+    algs[0] = create(coeff, filterLen, frameLen, IFIR_ACCUM32, IFIR_FFTOFF);
+    cut = frameLen / 3;
+    for (f = 0; f < SWAPFRAMES; f++) {
+        off = f * frameLen;
+        if (cut > 0) {
+            fxns->filterBlock((IFIR_Handle)algs[0], in[0] + off,
+                out[0] + off, cut);
+            if (f == SWAPFRAME) {
+                stage(algs[0], newCoeff, fade);
+            }
+        }
+        fxns->filterBlock((IFIR_Handle)algs[0], in[0] + off + cut,
+            out[0] + off + cut, frameLen - cut);
+        if (f == SWAPFRAME && cut == 0) {
+            stage(algs[0], newCoeff, fade);
+        }
+    }
+    ALGRF_delete(algs[0]);
+    ok = within(fade ? "filterBlock() crossfade" : "filterBlock() swap",
+        filterLen, frameLen, expect, out[0], samples, 0) && ok;
+
+    /*
+     *  filterMulti(): the first channel keeps its coefficients, the second
+     *  stages the new ones with fade and the third without, so that one
+     *  of them crossfades out of the batch.
+     */
+    for (k = 0; k < NUMCHANS; k++) {
+        algs[k] = create(coeff, filterLen, frameLen, IFIR_ACCUM32,
+            IFIR_FFTOFF);
+        handles[k] = (IFIR_Handle)algs[k];
+    }
+    for (f = 0; f < SWAPFRAMES; f++) {
+        for (k = 0; k < NUMCHANS; k++) {
+            inPtrs[k]  = in[k] + f * frameLen;
+            outPtrs[k] = out[k] + f * frameLen;
+        }
+        fxns->filterMulti(handles, inPtrs, outPtrs, NUMCHANS);
+        if (f == SWAPFRAME) {
+            stage(algs[1], newCoeff, fade);
+            stage(algs[2], newCoeff, !fade);
+        }
+    }
+    for (k = 0; k < NUMCHANS; k++) {
+        ALGRF_delete(algs[k]);
+    }
+    ok = within("filterMulti() unchanged channel", filterLen, frameLen,
+        old[0], out[0], samples, 0) && ok;
+    expectSwap(old[1], new[1], expect, frameLen, fade);
+    ok = within("filterMulti() swapped channel", filterLen, frameLen,
+        expect, out[1], samples, 0) && ok;
+    expectSwap(old[2], new[2], expect, frameLen, !fade);
+    ok = within("filterMulti() swapped channel", filterLen, frameLen,
+        expect, out[2], samples, 0) && ok;
+
+    return (ok);
+}
+
+/*
+ *  ======== checkSwapFft ========
+ *  The swap with filter() by fast convolution, against instances by fast
+ *  convolution with each set of coefficients. After the frame that takes
+ *  the new coefficients, the current bank's spectrum is the second one in
+ *  the SPECTRUM record: algFree() must still give the first, and the
+ *  spectra are moved elsewhere with algMoved() for a frame, and back.
+ */
+static Bool checkSwapFft(Short *coeff, Short *newCoeff, Int filterLen,
+                         Int frameLen, Bool fade, Short *in)
+{
+    static Short old[ MAXSAMPLES ];
+    static Short new[ MAXSAMPLES ];
+    static Short expect[ MAXSAMPLES ];
+    static Short out[ MAXSAMPLES ];
+    IALG_MemRec  memTab[ MAXMEMRECS ];
+    Void        *base, *moved;
+    ALGRF_Handle alg;
+    Int          samples = SWAPFRAMES * frameLen;
+    Int          fftLen, f, off;
+    Bool         ok = TRUE;
+
+    for (fftLen = 2; fftLen < 2 * filterLen; fftLen *= 2) {
+    }
+
+    runFilter(coeff, filterLen, frameLen, IFIR_ACCUM32, fftLen, in, old,
+        SWAPFRAMES);
+    runFilter(newCoeff, filterLen, frameLen, IFIR_ACCUM32, fftLen, in, new,
+        SWAPFRAMES);
+    expectSwap(old, new, expect, frameLen, fade);
+
+    alg = create(coeff, filterLen, frameLen, IFIR_ACCUM32, fftLen);
+    FIR_TI_IFIR.ialg.algFree(alg, memTab);
+    base = memTab[SPECTRUM].base;
+    moved = malloc(memTab[SPECTRUM].size);
+    if (moved == NULL) {
+        fprintf(stderr, "firtest: out of memory\n");
+        exit(1);
+    }
+
+    ALGRF_activate(alg);
+    for (f = 0; f < SWAPFRAMES; f++) {
+        off = f * frameLen;
+        FIR_TI_IFIR.filter((IFIR_Handle)alg, in + off, out + off);
+        if (f == SWAPFRAME) {
+            stage(alg, newCoeff, fade);
+        }
+        else if (f == SWAPFRAME + 1) {
+            FIR_TI_IFIR.ialg.algFree(alg, memTab);
+            if (memTab[SPECTRUM].base != base) {
+                printf("firtest: algFree(), %d taps, frames of %d: "
+                    "spectra at %p, not %p\n", filterLen, frameLen,
+                    memTab[SPECTRUM].base, base);
+
+                /* nor could ALGRF_delete() free them */
+                ALGRF_deactivate(alg);
+                free(moved);
+                return (FALSE);
+            }
+            moveSpectra(alg, moved);
+        }
+        else if (f == SWAPFRAME + 2) {
+            moveSpectra(alg, base);
+        }
+    }
+    ALGRF_deactivate(alg);
+    ALGRF_delete(alg);
+    free(moved);
+
+    ok = within(fade ? "FFT filter() crossfade" : "FFT filter() swap",
+        filterLen, frameLen, expect, out, samples, 0) && ok;
+
+    return (ok);
+}
+
+/*
+ *  ======== expectSwap ========
+ *  The output of a swap after frame SWAPFRAME, from the outputs of the
+ *  old and the new coefficients: the frame after it is the new output
+ *  or, with fade, their linear mix, which ends on the new output.
+ */
+static Void expectSwap(Short *old, Short *new, Short *expect, Int frameLen,
+                       Bool fade)
+{
+    Int start = (SWAPFRAME + 1) * frameLen;
+    Int j;
+
+    memcpy(expect, old, start * sizeof(Short));
+    memcpy(expect + start, new + start,
+        (SWAPFRAMES * frameLen - start) * sizeof(Short));
+
+    if (fade) {
+        for (j = 0; j < frameLen; j++) {
+            expect[start + j] = (Short)(old[start + j] +
+                ((Int32)new[start + j] - old[start + j]) * (j + 1) /
+                frameLen);
+        }
+    }
+}
+
+/*
+ *  ======== stage ========
+ *  Stage coeff with IFIR_STAGECOEFF, faded to if fade.
+ */
+static Void stage(ALGRF_Handle alg, Short *coeff, Bool fade)
+{
+    IFIR_Status status;
+
+    status.size      = sizeof(status);
+    status.coeffPtr  = coeff;
+    status.crossfade = fade;
+
+    if (ALGRF_control(alg, (IALG_Cmd)IFIR_STAGECOEFF,
+        (IALG_Status *)&status) != IALG_EOK) {
+        fprintf(stderr, "firtest: IFIR_STAGECOEFF failed\n");
+        exit(1);
+    }
+}
+
+/*
+ *  ======== moveSpectra ========
+ *  Copy the spectra of an instance to base, and tell it with algMoved().
+ */
+static Void moveSpectra(ALGRF_Handle alg, Void *base)
+{
+    IALG_MemRec memTab[ MAXMEMRECS ];
+
+    FIR_TI_IFIR.ialg.algFree(alg, memTab);
+    memcpy(base, memTab[SPECTRUM].base, memTab[SPECTRUM].size);
+    memTab[SPECTRUM].base = base;
+    FIR_TI_IFIR.ialg.algMoved(alg, memTab, NULL, NULL);
+}
+
+/*
+ *  ======== refFilter ========
+ *  The single-pass filter FIR_TI started from: copy the frame after the
+ *  history, sum each output over the two, and move the end of the frame
+ *  to the start of the buffer as the next history. IFIR_ACCUM32 sums in
+ *  32 bits as it did, the other modes in 64 bits and saturate.
+ *
+ *  Returns how far IFIR_ACCUMBLOCK may be from the result: its block
+ *  exponent shifts less than 2^shift out of each input, and the error
+ *  adds up to less than gain times that, plus the truncation.
+ */
+static Int refFilter(Ref *ref, Short *coeff, Int filterLen,
+                     IFIR_Accum accum, Short *in, Short *out, Int n)
+{
+    Int     nHist = filterLen - 1;
+    Int32   sum;
+    LgInt   wideSum;
+    LgUns   gain = 0;
+    Int     bound = 0;
+    Int     i, j;
+
+    memcpy(ref->buf + nHist, in, n * sizeof(Short));
+
+    if (accum == IFIR_ACCUMBLOCK) {
+        for (i = 0; i < filterLen; i++) {
+            gain += (coeff[i] < 0) ? -(LgInt)coeff[i] : coeff[i];
+        }
+        i = blockExp(ref->buf, nHist + n, gain);
+        minShift = (i < minShift) ? i : minShift;
+        maxShift = (i > maxShift) ? i : maxShift;
+        bound = (Int)((gain << i) >> 15) + 1;
+    }
+
+    for (j = 0; j < n; j++) {
+        if (accum == IFIR_ACCUM32) {
+            sum = 0;
+            for (i = 0; i < filterLen; i++) {
+                sum += (Int32)ref->buf[i + j] * (Int32)coeff[i];
+            }
+            out[j] = sum >> 15;
+        }
+        else {
+            wideSum = 0;
+            for (i = 0; i < filterLen; i++) {
+                wideSum += (Int32)ref->buf[i + j] * (Int32)coeff[i];
+            }
+            wideSum >>= 15;
+            if (wideSum > 32767 || wideSum < -32768) {
+                out[j] = (wideSum > 0) ? 32767 : -32768;
+                saturated += (accum == IFIR_ACCUMWIDE);
+            }
+            else {
+                out[j] = (Short)wideSum;
+            }
+        }
+    }
+
+    memmove(ref->buf, ref->buf + n, nHist * sizeof(Short));
+
+    return (bound);
+}
+
+/*
+ *  ======== blockExp ========
+ *  The block exponent of IFIR_ACCUMBLOCK for the n inputs at x: the
+ *  smallest right shift, up to 15, after which the peak input, rounded
+ *  up, times gain fits in 32 bits.
+ */
+static Int blockExp(Short *x, Int n, LgUns gain)
+{
+    LgUns   peak = 0;
+    LgUns   mag;
+    Int     i, shift;
+
+    for (i = 0; i < n; i++) {
+        mag = (x[i] < 0) ? -(LgInt)x[i] : x[i];
+        peak = (mag > peak) ? mag : peak;
+    }
+    for (shift = 0; shift < 15 && gain != 0; shift++) {
+        if (((peak + (1UL << shift) - 1) >> shift) * gain <= 0x7FFFFFFFUL) {
+            break;
+        }
+    }
+
+    return (shift);
+}
+
+/*
+ *  ======== runFilter ========
+ *  Filter frames frames from in to out with filter() on a new instance,
+ *  active for the duration.
+ */
+static Void runFilter(Short *coeff, Int filterLen, Int frameLen,
+                      IFIR_Accum accum, Int fftLen, Short *in, Short *out,
+                      Int frames)
+{
+    ALGRF_Handle alg = create(coeff, filterLen, frameLen, accum, fftLen);
+    Int          f;
+
+    ALGRF_activate(alg);
+    for (f = 0; f < frames; f++) {
+        FIR_TI_IFIR.filter((IFIR_Handle)alg, in + f * frameLen,
+            out + f * frameLen);
+    }
+    ALGRF_deactivate(alg);
+    ALGRF_delete(alg);
+}
+
+/*
+ *  ======== create ========
+ *  A new FIR_TI instance, not active.
+ */
+static ALGRF_Handle create(Short *coeff, Int filterLen, Int frameLen,
+                           IFIR_Accum accum, Int fftLen)
+{
+    IFIR_Params  params = IFIR_PARAMS;
+    ALGRF_Handle alg;
+
+    params.coeffPtr  = coeff;
+    params.filterLen = filterLen;
+    params.frameLen  = frameLen;
+    params.accum     = accum;
+    params.fftLen    = fftLen;
+
+    alg = ALGRF_create(&FIR_TI_IFIR.ialg, NULL, (IALG_Params *)&params);
+    if (alg == NULL) {
+        fprintf(stderr, "firtest: cannot create FIR_TI instance\n");
+        exit(1);
+    }
+
+    return (alg);
+}
+
+/*
+ *  ======== within ========
+ *  TRUE if no output of out is more than tolerance away from ref;
+ *  otherwise report the first one that is.
+ */
+static Bool within(String what, Int filterLen, Int frameLen, Short *ref,
+                   Short *out, Int n, Int tolerance)
+{
+    Int i;
+
+    for (i = 0; i < n; i++) {
+        if (abs((Int)out[i] - (Int)ref[i]) > tolerance) {
+            printf("firtest: %s, %d taps, frames of %d: output %d is %d, "
+                "not %d within %d\n", what, filterLen, frameLen, i, out[i],
+                ref[i], tolerance);
+            return (FALSE);
+        }
+    }
+
+    return (TRUE);
+}
+
+/*
+ *  ======== makeCoeff ========
+ *  Random coefficients whose magnitudes add up to less than one in Q15,
+ *  symmetric around their centre if asked.
+ */
+static Void makeCoeff(Short *coeff, Int taps, Bool symmetric)
+{
+    Int i;
+
+    noise(coeff, taps, 32767 / taps);
+    if (symmetric) {
+        for (i = 0; i < taps / 2; i++) {
+            coeff[taps - 1 - i] = coeff[i];
+        }
+    }
+}
+
+/*
+ *  ======== hot ========
+ *  Frame number frame of the hot input: full-scale noise, a full-scale
+ *  square wave, quiet noise, silence, and a lone negative full-scale
+ *  sample, in turn.
+ */
+static Void hot(Short *x, Int n, Int frame)
+{
+    Int i;
+
+    switch (frame % 5) {
+        case 0:
+            noise(x, n, 32767);
+            break;
+        case 1:
+            for (i = 0; i < n; i++) {
+                x[i] = ((i / 16) & 1) ? -32768 : 32767;
+            }
+            break;
+        case 2:
+            noise(x, n, 64);
+            break;
+        default:
+            memset(x, 0, n * sizeof(Short));
+            if (frame % 5 == 4) {
+                x[n / 2] = -32768;
+            }
+            break;
+    }
+}
+
+/*
+ *  ======== noise ========
+ *  n samples of uniform noise between -amplitude and amplitude.
+ */
+static Void noise(Short *x, Int n, Int amplitude)
+{
+    Int i;
+
+    for (i = 0; i < n; i++) {
+        seed = (seed * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+        x[i] = (Short)((Int)(seed >> 15) % (2 * amplitude + 1) - amplitude);
+    }
+}
+
+/*
+ *  ======== usage ========
+ */
+static Void usage(Void)
+{
+    fprintf(stderr, "usage: firtest [-o out.raw] [-g golden.raw]\n");
+    exit(1);
+}
@@ -0,0 +1,310 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== msgbench.c ========
+ *  Throughput benchmark of MSGLINK on the host, copying links against
+ *  zero-copy links.
+ *
+ *  The DSP output link (channel 15) is looped back onto the DSP input
+ *  link (channel 14) by the host SIO shim, standing for a GPP that echoes
+ *  every message. Messages of varying sizes, up to maxSize MADUs, are
+ *  sent and received back, and their contents are checked. On the
+ *  copying links every message is copied into and out of a maxSize
+ *  transfer buffer and takes a transfer of its own. On the zero-copy
+ *  links the messages are built and read in place, packed into bufSize
+ *  transfer buffers, and the output link is flushed after every frame of
+ *  frameMsgs messages. The message rate and the number of channel
+ *  transfers are reported for both; on the target the transfers
+ *  dominate.
+ *
+ *  usage: msgbench [-n msgs] [-f frameMsgs] [-s maxSize] [-b bufSize]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <std.h>
+#include <clk.h>
+#include <log.h>
+#include <sio.h>
+
+// RF module includes
+#include <msglink.h>
+#include <utl.h>
+
+#define INPUTDEVNAME    "/dio_dsplink14"   // as in msglink.c
+#define OUTPUTDEVNAME   "/dio_dsplink15"
+
+#define DEFNUMMSGS      100000
+#define DEFFRAMEMSGS    8       // messages sent per frame
+#define DEFMAXSIZE      64      // largest message, in MADUs
+#define DEFBUFSIZE      512     // zero-copy transfer buffer, in MADUs
+
+/*
+ *  Results of one run.
+ */
+typedef struct Result {
+    LgUns       msgCnt;
+    LgUns       madus;          // message contents sent
+    LgUns       transfers;      // channel transfers out of the DSP
+    LgUns       elapsed;        // ns
+} Result;
+
+static LOG_Obj logTrace = LOG_OBJ("trace");
+
+static Bool runCopy(LgUns msgCnt, Uns maxSize, Result *res);
+static Bool runZeroCopy(LgUns msgCnt, Uns frameMsgs, Uns maxSize,
+                        Uns bufSize, Result *res);
+static Uns  msgWords(LgUns seq, Uns maxSize);
+static Void fillMsg(Uns *msg, LgUns seq, Uns words);
+static Bool checkMsg(Uns *msg, LgUns seq, Uns words);
+static Void report(String name, Result *res);
+static Void usage(Void);
+
+/*
+ *  ======== main ========
+ */
+Int main(Int argc, Char *argv[])
+{
+    LgUns   msgCnt    = DEFNUMMSGS;
+    Uns     frameMsgs = DEFFRAMEMSGS;
+    Uns     maxSize   = DEFMAXSIZE;
+    Uns     bufSize   = DEFBUFSIZE;
+    Result  copy;
+    Result  zeroCopy;
+    Int     i;
+
+    for (i = 1; i < argc; i++) {
+        if (strlen(argv[i]) != 2 || argv[i][0] != '-' || i + 1 >= argc) {
+            usage();
+        }
+        switch (argv[i][1]) {
+            case 'n': msgCnt    = strtoul(argv[++i], NULL, 0);  break;
+            case 'f': frameMsgs = (Uns)atoi(argv[++i]);         break;
+            case 's': maxSize   = (Uns)atoi(argv[++i]);         break;
+            case 'b': bufSize   = (Uns)atoi(argv[++i]);         break;
+            default:  usage();
+        }
+    }
+    if (msgCnt == 0 || frameMsgs == 0 || maxSize < 2 * sizeof(Uns) ||
+        bufSize < maxSize + 2 * MSGLINK_ALIGN) {
+        usage();
+    }
+
+    UTL_setLogs( &logTrace, &logTrace, NULL, NULL );
+
+    MSGLINK_init();
+    SIO_loopback(OUTPUTDEVNAME, INPUTDEVNAME);
+
+    if (!runCopy(msgCnt, maxSize, &copy) ||
+        !runZeroCopy(msgCnt, frameMsgs, maxSize, bufSize, &zeroCopy)) {
+        return (1);
+    }
+
+    printf("msgbench: %lu messages of up to %u MADUs, %u per frame\n",
+        msgCnt, maxSize, frameMsgs);
+    report("copy:", &copy);
+    report("zero-copy:", &zeroCopy);
+    printf("  zero-copy:  %lu.%02lux the message rate, %lu.%02lux fewer "
+        "transfers\n",
+        copy.elapsed / (zeroCopy.elapsed ? zeroCopy.elapsed : 1),
+        copy.elapsed * 100 / (zeroCopy.elapsed ? zeroCopy.elapsed : 1) % 100,
+        copy.transfers / zeroCopy.transfers,
+        copy.transfers * 100 / zeroCopy.transfers % 100);
+
+    MSGLINK_exit();
+
+    return (0);
+}
+
+/*
+ *  ======== runCopy ========
+ *  Send and receive msgCnt messages over copying links of maxSize
+ *  messages. Each message is received as soon as it is sent, since a
+ *  copying link holds only MSGLINK_NUMBUFS messages in each direction.
+ */
+static Bool runCopy(LgUns msgCnt, Uns maxSize, Result *res)
+{
+    Uns    *msg = malloc(maxSize);
+    LgUns   transfers = SIO_transfers(OUTPUTDEVNAME);
+    LgUns   start;
+    LgUns   seq;
+    Uns     words;
+    Bool    ok = TRUE;
+
+    if (msg == NULL ||
+        MSGLINK_create(MSGLINK_INPUT, maxSize, SYS_FOREVER, NULL) !=
+            MSGLINK_SUCCESS ||
+        MSGLINK_create(MSGLINK_OUTPUT, maxSize, SYS_FOREVER, NULL) !=
+            MSGLINK_SUCCESS) {
+        fprintf(stderr, "msgbench: cannot create the copying links\n");
+        return (FALSE);
+    }
+
+    res->madus = 0;
+    start = CLK_gethtime();
+    for (seq = 0; ok && seq < msgCnt; seq++) {
+        words = msgWords(seq, maxSize);
+        fillMsg(msg, seq, words);
+        ok = (MSGLINK_send(msg) == MSGLINK_SUCCESS &&
+            MSGLINK_recv(msg) == MSGLINK_SUCCESS &&
+            checkMsg(msg, seq, words));
+        res->madus += words * sizeof(Uns);
+    }
+    res->elapsed   = CLK_gethtime() - start;
+    res->msgCnt    = msgCnt;
+    res->transfers = SIO_transfers(OUTPUTDEVNAME) - transfers;
+
+    MSGLINK_delete(MSGLINK_OUTPUT);
+    MSGLINK_delete(MSGLINK_INPUT);
+    free(msg);
+
+    if (!ok) {
+        fprintf(stderr, "msgbench: copying link failed at message %lu\n",
+            seq - 1);
+    }
+
+    return (ok);
+}
+
+/*
+ *  ======== runZeroCopy ========
+ *  Send and receive msgCnt messages over zero-copy links with bufSize
+ *  transfer buffers, flushing the output link once per frame.
+ */
+static Bool runZeroCopy(LgUns msgCnt, Uns frameMsgs, Uns maxSize,
+                        Uns bufSize, Result *res)
+{
+    MSGLINK_Attrs attrs = MSGLINK_ATTRS;
+    LgUns   transfers = SIO_transfers(OUTPUTDEVNAME);
+    LgUns   start;
+    LgUns   seq;
+    LgUns   rseq;
+    Uns     words;
+    Uns    *msg;
+    MdUns   size;
+    Bool    ok = TRUE;
+
+    attrs.zeroCopy = TRUE;
+    if (MSGLINK_create(MSGLINK_INPUT, bufSize, SYS_FOREVER, &attrs) !=
+            MSGLINK_SUCCESS ||
+        MSGLINK_create(MSGLINK_OUTPUT, bufSize, SYS_FOREVER, &attrs) !=
+            MSGLINK_SUCCESS) {
+        fprintf(stderr, "msgbench: cannot create the zero-copy links\n");
+        return (FALSE);
+    }
+
+    res->madus = 0;
+    start = CLK_gethtime();
+    for (seq = 0; ok && seq < msgCnt; seq = rseq) {
+        for (rseq = seq; ok && rseq < msgCnt && rseq < seq + frameMsgs;
+             rseq++) {
+            words = msgWords(rseq, maxSize);
+            msg = MSGLINK_alloc(words * sizeof(Uns));
+            if (msg != NULL) {
+                fillMsg(msg, rseq, words);
+                ok = (MSGLINK_put(msg) == MSGLINK_SUCCESS);
+            }
+            else {
+                ok = FALSE;
+            }
+            res->madus += words * sizeof(Uns);
+        }
+        ok = ok && (MSGLINK_flush() == MSGLINK_SUCCESS);
+        for (rseq = seq; ok && rseq < msgCnt && rseq < seq + frameMsgs;
+             rseq++) {
+            words = msgWords(rseq, maxSize);
+            msg = MSGLINK_get(&size);
+            ok = (msg != NULL && size == words * sizeof(Uns) &&
+                checkMsg(msg, rseq, words));
+        }
+    }
+    res->elapsed   = CLK_gethtime() - start;
+    res->msgCnt    = msgCnt;
+    res->transfers = SIO_transfers(OUTPUTDEVNAME) - transfers;
+
+    MSGLINK_delete(MSGLINK_OUTPUT);
+    MSGLINK_delete(MSGLINK_INPUT);
+
+    if (!ok) {
+        fprintf(stderr, "msgbench: zero-copy link failed at message %lu\n",
+            rseq);
+    }
+
+    return (ok);
+}
+
+/*
+ *  ======== msgWords ========
+ *  Size of message seq, in words: from 2 words up to maxSize MADUs.
+ */
+static Uns msgWords(LgUns seq, Uns maxSize)
+{
+    Uns maxWords = maxSize / sizeof(Uns);
+
+    return (2 + (Uns)(seq * 7 % (maxWords - 1)));
+}
+
+/*
+ *  ======== fillMsg ========
+ */
+static Void fillMsg(Uns *msg, LgUns seq, Uns words)
+{
+    Uns i;
+
+    msg[ 0 ] = (Uns)seq;
+    msg[ 1 ] = words;
+    for (i = 2; i < words; i++) {
+        msg[ i ] = (Uns)seq ^ i;
+    }
+}
+
+/*
+ *  ======== checkMsg ========
+ */
+static Bool checkMsg(Uns *msg, LgUns seq, Uns words)
+{
+    Uns i;
+
+    if (msg[ 0 ] != (Uns)seq || msg[ 1 ] != words) {
+        return (FALSE);
+    }
+    for (i = 2; i < words; i++) {
+        if (msg[ i ] != ((Uns)seq ^ i)) {
+            return (FALSE);
+        }
+    }
+
+    return (TRUE);
+}
+
+/*
+ *  ======== report ========
+ */
+static Void report(String name, Result *res)
+{
+    LgUns elapsed = res->elapsed ? res->elapsed : 1;
+
+    printf("  %-11s %lu msgs/s, %lu MADUs/s, %lu transfers, "
+        "%lu.%02lu msgs per transfer\n", name,
+        res->msgCnt * 1000000000UL / elapsed,
+        res->madus * 1000000000UL / elapsed, res->transfers,
+        res->msgCnt / res->transfers, res->msgCnt * 100 / res->transfers % 100);
+}
+
+/*
+ *  ======== usage ========
+ */
+static Void usage(Void)
+{
+    fprintf(stderr,
+        "usage: msgbench [-n msgs] [-f frameMsgs] [-s maxSize] "
+        "[-b bufSize]\n");
+    exit(1);
+}
@@ -0,0 +1,614 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== rfbench.c ========
+ *  Offline benchmark of the RF6 processing chain on the host.
+ *
+ *  Each channel of a 16-bit PCM WAV file goes through the cells of the
+ *  RF6 Process0 thread, frame by frame: the FIR cells of all channels are
+ *  executed as one batch, then each channel's VOL cell runs in its own
+ *  CHAN channel. The whole input is held in memory so that only the
+ *  processing is timed. The output can be saved as a WAV file and
+ *  compared against a golden WAV file; the frame rate and the PRF
+ *  profile of the cells are reported on stdout.
+ *
+ *  usage: rfbench -i in.wav [-o out.wav] [-g golden.wav] [-t tolerance]
+ *                 [-r repeat] [-n frameLen] [-c filter] [-l taps]
+ *                 [-a accum] [-v gain] [-d]
+ *         rfbench -s test.wav
+ *
+ *  -r repeats the input, with the algorithms keeping their state; only
+ *  the first pass is saved and compared. -c picks the FIR coefficients
+ *  as the RF6 control thread does (0: low-pass, 1: high-pass, 2: pass
+ *  through). -l stretches them to a longer filter of up to MAXFIRTAPS
+ *  taps, and -a picks the FIR accumulation (0: 32 bits, 1: wide, 2: block
+ *  floating point); the FIR cost per tap and per sample is reported, to
+ *  compare them. -v is the VOL gain in percent. -d sends the RF modules'
+ *  debug messages to stderr. -s writes the test signal used by make check.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <std.h>
+#include <clk.h>
+#include <log.h>
+#include <mem.h>
+
+// RF module includes
+#include <chan.h>
+#include <icell.h>
+#include <icc.h>
+#include <icc_linear.h>
+#include <prf.h>
+#include <utl.h>
+
+// Cell includes
+#include "fir/cellFir.h"
+#include "vol/cellVol.h"
+
+#include "wav.h"
+
+#define MAXCHANNELS     8       // channels of the input processed
+#define MAXFRAMELEN     4096    // samples per frame, per channel
+#define DEFFRAMELEN     80      // FRAMELEN of the RF6 application
+
+#define INTERNALHEAP    0       // MEM segments standing for the target's
+#define EXTERNALHEAP    1       // internal and external heaps
+#define NUMSCRBUCKETS   1
+#define SCRBUCKET       0
+
+#define NUMFIRTAPS      32
+#define MAXFIRTAPS      1024    // longest filter made by -l
+
+// cells of each channel's VOL channel
+enum { CELLVOL = 0, NUMCELLS };
+
+// ICCs of each channel, one per buffer
+enum { ICCINPUT = 0, ICCINTERMEDIATE, ICCOUTPUT, NUMICCS };
+
+// profiler cell slots: the FIR batch, then the VOL cells of all channels
+enum { PRFFIR = 0, PRFVOL, NUMPRFCELLS };
+
+/*
+ *  The RF6 Process0 filters, designed for 8 kHz but usable from 8 to
+ *  48 kHz.
+ */
+static Short filterCoeffLowPass[ NUMFIRTAPS ] = {
+    // Low-pass, 32 taps, passband 0 to 500 Hz for sampling rate of 8kHz
+    0x08FC, 0xF6DE, 0xF92A, 0xFA50, 0xFB17, 0xFBF0, 0xFD2A, 0xFECF,
+    0x00EC, 0x036C, 0x0623, 0x08E1, 0x0B6E, 0x0D91, 0x0F1A, 0x0FE9,
+    0x0FE9, 0x0F1A, 0x0D91, 0x0B6E, 0x08E1, 0x0623, 0x036C, 0x00EC,
+    0xFECF, 0xFD2A, 0xFBF0, 0xFB17, 0xFA50, 0xF92A, 0xF6DE, 0x08FC
+};
+static Short filterCoeffHighPass[ NUMFIRTAPS ] = {
+    // High-pass, 32 taps, passband 500 Hz to 4 kHz for sampling rate of 8kHz
+    0x08B6, 0xFC32, 0xFC41, 0x09CF, 0x0467, 0x0B2E, 0x0099, 0x05FB,
+    0xF920, 0x014E, 0xF1B4, 0xFF3F, 0xE8F9, 0x02AB, 0xD626, 0x41EB,
+    0x41EB, 0xD626, 0x02AB, 0xE8F9, 0xFF3F, 0xF1B4, 0x014E, 0xF920,
+    0x05FB, 0x0099, 0x0B2E, 0x0467, 0x09CF, 0xFC41, 0xFC32, 0x08B6
+};
+static Short filterCoeffPassThrough[ NUMFIRTAPS ] = {
+    // Pass-through, 32 taps
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FFF
+};
+
+static Short * filterCoeffList[] = {
+    filterCoeffLowPass, filterCoeffHighPass, filterCoeffPassThrough
+};
+
+static Short filterCoeffLong[ MAXFIRTAPS ];
+
+static String accumNames[] = {
+    "32-bit accumulation", "wide accumulation", "block floating point"
+};
+
+/*
+ *  The processing chain: the state a Process0-like thread would keep.
+ */
+typedef struct Chain {
+    Uns         chanCnt;
+    Uns         frameLen;
+    Uns         filterLen;
+    LgUns       firTime;        // time in the FIR batch, over all frames
+    Short      *bufInput[ MAXCHANNELS ];
+    Short      *bufIntermediate[ MAXCHANNELS ];
+    Short      *bufOutput[ MAXCHANNELS ];
+    ICELL_Obj   firCellList[ MAXCHANNELS ];
+    ICELL_Handle firCells[ MAXCHANNELS ];   // the FIR cells, for the batch
+    CHAN_Obj    firChan;
+    ICELL_Obj   cellList[ MAXCHANNELS * NUMCELLS ];
+    CHAN_Obj    chanList[ MAXCHANNELS ];
+    ICC_LinearHandle iccList[ MAXCHANNELS * NUMICCS ];  // the ICCs to delete
+    PRF_Cell    prfCells[ NUMPRFCELLS ];
+    PRF_Obj     prf;
+} Chain;
+
+static LOG_Obj logTrace = LOG_OBJ("trace");
+
+static Bool chainOpen(Chain *chain, Uns chanCnt, Uns frameLen,
+                      LgUns rate, Short *coeffPtr, Uns filterLen,
+                      IFIR_Accum accum, Int gain);
+static Void chainClose(Chain *chain);
+static Void chainRun(Chain *chain, WAV_Data *in, WAV_Data *out);
+static Bool compareGolden(String name, WAV_Data *out, Int tolerance);
+static Bool makeTestSignal(String name);
+static Void stretchFilter(Short *src, Short *dst, Uns len);
+static Void usage(Void);
+
+/*
+ *  ======== main ========
+ */
+Int main(Int argc, Char *argv[])
+{
+    String   inName     = NULL;
+    String   outName    = NULL;
+    String   goldenName = NULL;
+    Int      tolerance  = 0;
+    Uns      repeat     = 1;
+    Uns      frameLen   = DEFFRAMELEN;
+    Uns      filter     = 0;
+    Uns      filterLen  = NUMFIRTAPS;
+    Uns      accum      = IFIR_ACCUM32;
+    Short   *coeffPtr;
+    LgUns    tapCnt;
+    Int      gain       = 100;
+    Bool     debug      = FALSE;
+    WAV_Data in;
+    WAV_Data out;
+    Chain   *chain;
+    LgUns    frameCnt;
+    LgUns    start;
+    LgUns    elapsed;
+    Uns      pass;
+    Int      i;
+    Bool     ok         = TRUE;
+
+    for (i = 1; i < argc; i++) {
+        if (strlen(argv[i]) != 2 || argv[i][0] != '-' ||
+            (argv[i][1] != 'd' && i + 1 >= argc)) {
+            usage();
+        }
+        switch (argv[i][1]) {
+            case 'i': inName     = argv[++i];               break;
+            case 'o': outName    = argv[++i];               break;
+            case 'g': goldenName = argv[++i];               break;
+            case 't': tolerance  = atoi(argv[++i]);         break;
+            case 'r': repeat     = (Uns)atoi(argv[++i]);    break;
+            case 'n': frameLen   = (Uns)atoi(argv[++i]);    break;
+            case 'c': filter     = (Uns)atoi(argv[++i]);    break;
+            case 'l': filterLen  = (Uns)atoi(argv[++i]);    break;
+            case 'a': accum      = (Uns)atoi(argv[++i]);    break;
+            case 'v': gain       = atoi(argv[++i]);         break;
+            case 'd': debug      = TRUE;                    break;
+            case 's': return (makeTestSignal(argv[++i]) ? 0 : 1);
+            default:  usage();
+        }
+    }
+    if (inName == NULL || repeat == 0 || frameLen == 0 ||
+        frameLen > MAXFRAMELEN || filter > 2 || filterLen < NUMFIRTAPS ||
+        filterLen > MAXFIRTAPS || accum > IFIR_ACCUMBLOCK) {
+        usage();
+    }
+
+    coeffPtr = filterCoeffList[ filter ];
+    if (filterLen != NUMFIRTAPS) {
+        stretchFilter(coeffPtr, filterCoeffLong, filterLen);
+        coeffPtr = filterCoeffLong;
+    }
+
+    // errors and warnings always go to stderr, debug messages on request
+    UTL_setLogs( &logTrace, &logTrace, debug ? &logTrace : NULL,
+        debug ? &logTrace : NULL );
+
+    if (!WAV_load(inName, &in)) {
+        fprintf(stderr, "rfbench: cannot load %s as 16-bit PCM\n", inName);
+        return (1);
+    }
+    if (in.channels > MAXCHANNELS) {
+        fprintf(stderr, "rfbench: %s has more than %d channels\n", inName,
+            MAXCHANNELS);
+        return (1);
+    }
+
+    chain = calloc(1, sizeof(Chain));
+    if (chain == NULL || !WAV_alloc(&out, in.channels, in.rate, in.frames) ||
+        !chainOpen(chain, in.channels, frameLen, in.rate, coeffPtr,
+            filterLen, (IFIR_Accum)accum, gain)) {
+        fprintf(stderr, "rfbench: cannot open the processing chain\n");
+        return (1);
+    }
+
+    start = CLK_gethtime();
+    for (pass = 0; pass < repeat; pass++) {
+        chainRun(chain, &in, &out);
+        if (pass == 0) {
+            elapsed = CLK_gethtime() - start;
+            if (outName != NULL && !WAV_save(outName, &out)) {
+                fprintf(stderr, "rfbench: cannot save %s\n", outName);
+                ok = FALSE;
+            }
+            if (goldenName != NULL && !compareGolden(goldenName, &out,
+                tolerance)) {
+                ok = FALSE;
+            }
+            start = CLK_gethtime() - elapsed;
+        }
+    }
+    elapsed = CLK_gethtime() - start;
+
+    frameCnt = chain->prf.frameCnt;
+    printf("rfbench: %s, %u channels at %lu Hz, %u-sample frames\n",
+        inName, in.channels, in.rate, frameLen);
+    printf("  frames:     %lu in %lu.%03lu ms, %lu frames/s, "
+        "%lu.%02lux real time\n", frameCnt,
+        elapsed / 1000000, elapsed / 1000 % 1000,
+        frameCnt * 1000000000UL / (elapsed ? elapsed : 1),
+        chain->prf.deadline * frameCnt / (elapsed ? elapsed : 1),
+        chain->prf.deadline * frameCnt * 100 / (elapsed ? elapsed : 1) % 100);
+    printf("  frame time: %lu ns avg, %lu ns max, deadline %lu ns, "
+        "%lu missed\n", elapsed / (frameCnt ? frameCnt : 1),
+        chain->prf.maxTime, chain->prf.deadline, chain->prf.missCnt);
+    printf("  cells:      FIR batch %lu ns max, VOL %lu ns max per frame\n",
+        chain->prfCells[ PRFFIR ].maxTime, chain->prfCells[ PRFVOL ].maxTime);
+    tapCnt = frameCnt * in.channels * frameLen * filterLen;
+    printf("  FIR:        %u taps, %s, %lu ps per tap and sample\n",
+        filterLen, accumNames[ accum ],
+        chain->firTime * 1000 / (tapCnt ? tapCnt : 1));
+    printf("  heaps:      internal %u MAUs, external %u MAUs at peak\n",
+        MEM_peak(INTERNALHEAP), MEM_peak(EXTERNALHEAP));
+
+    chainClose(chain);
+    free(chain);
+    WAV_free(&out);
+    WAV_free(&in);
+
+    return (ok ? 0 : 1);
+}
+
+/*
+ *  ======== chainOpen ========
+ *  Registers the cells and opens the channels, as Process0 does in its
+ *  init and startup phases.
+ */
+static Bool chainOpen(Chain *chain, Uns chanCnt, Uns frameLen,
+                      LgUns rate, Short *coeffPtr, Uns filterLen,
+                      IFIR_Accum accum, Int gain)
+{
+    IFIR_Params firParams;
+    IVOL_Params volParams;
+    ICELL_Obj   defaultCell = ICELL_DEFAULT;
+    ICELL_Obj  *cell;
+    ICC_Handle  inputIcc;
+    ICC_Handle  outputIcc;
+    ICC_LinearHandle *icc;
+    CHAN_Attrs  chanAttrs;
+    Uns         bufSize = frameLen * sizeof(Short);
+    Uns         chanNum;
+    Bool        rc;
+
+    chain->chanCnt   = chanCnt;
+    chain->frameLen  = frameLen;
+    chain->filterLen = filterLen;
+    chain->firTime   = 0;
+
+    CHAN_init();
+    ICC_init();
+    if (!CHAN_setup( INTERNALHEAP, EXTERNALHEAP, INTERNALHEAP,
+            NUMSCRBUCKETS, NULL, NULL )) {
+        return (FALSE);
+    }
+
+    PRF_new( &chain->prf, PRF_deadline( frameLen, rate ), chain->prfCells,
+        NUMPRFCELLS );
+
+    firParams           = IFIR_PARAMS;
+    firParams.coeffPtr  = coeffPtr;
+    firParams.filterLen = filterLen;
+    firParams.frameLen  = frameLen;
+    firParams.accum     = accum;
+    firParams.fftLen    = IFIR_FFTOFF;  // the batch is always direct form
+
+    volParams                = IVOL_PARAMS;
+    volParams.frameSize      = frameLen;
+    volParams.gainPercentage = gain;
+
+    for (chanNum = 0; chanNum < chanCnt; chanNum++) {
+        chain->bufInput[ chanNum ]        = calloc(frameLen, sizeof(Short));
+        chain->bufIntermediate[ chanNum ] = calloc(frameLen, sizeof(Short));
+        chain->bufOutput[ chanNum ]       = calloc(frameLen, sizeof(Short));
+        if (chain->bufInput[ chanNum ] == NULL ||
+            chain->bufIntermediate[ chanNum ] == NULL ||
+            chain->bufOutput[ chanNum ] == NULL) {
+            return (FALSE);
+        }
+
+        // FIR cell: bufInput -> bufIntermediate
+        cell = &chain->firCellList[ chanNum ];
+        *cell                = defaultCell;
+        cell->name           = "FIR";
+        cell->cellFxns       = &FIR_CELLFXNS;
+        cell->algFxns        = (IALG_Fxns *)&FIR_IFIR;
+        cell->algParams      = (IALG_Params *)&firParams;
+        cell->scrBucketIndex = SCRBUCKET;
+
+        icc = &chain->iccList[ chanNum * NUMICCS ];
+        icc[ ICCINPUT ]        = ICC_linearCreate(
+            chain->bufInput[ chanNum ], bufSize );
+        icc[ ICCINTERMEDIATE ] = ICC_linearCreate(
+            chain->bufIntermediate[ chanNum ], bufSize );
+        inputIcc  = (ICC_Handle)icc[ ICCINPUT ];
+        outputIcc = (ICC_Handle)icc[ ICCINTERMEDIATE ];
+        if (inputIcc == NULL || outputIcc == NULL ||
+            !CHAN_regCell( cell, &inputIcc, 1, &outputIcc, 1 )) {
+            return (FALSE);
+        }
+
+        // VOL cell: bufIntermediate -> bufOutput
+        cell = &chain->cellList[ chanNum * NUMCELLS + CELLVOL ];
+        *cell                = defaultCell;
+        cell->name           = "VOL";
+        cell->cellFxns       = &VOL_CELLFXNS;
+        cell->algFxns        = (IALG_Fxns *)&VOL_IVOL;
+        cell->algParams      = (IALG_Params *)&volParams;
+        cell->scrBucketIndex = SCRBUCKET;
+
+        inputIcc  = outputIcc;
+        icc[ ICCOUTPUT ] = ICC_linearCreate(
+            chain->bufOutput[ chanNum ], bufSize );
+        outputIcc = (ICC_Handle)icc[ ICCOUTPUT ];
+        if (outputIcc == NULL ||
+            !CHAN_regCell( cell, &inputIcc, 1, &outputIcc, 1 )) {
+            return (FALSE);
+        }
+    }
+
+    // the VOL cells of all channels are profiled in one slot
+    chanAttrs         = CHAN_ATTRS;
+    chanAttrs.prf     = &chain->prf;
+    chanAttrs.prfCell = PRFVOL;
+
+    rc = CHAN_open( &chain->firChan, chain->firCellList, chanCnt, NULL );
+    for (chanNum = 0; rc && chanNum < chanCnt; chanNum++) {
+        chain->firCells[ chanNum ] = &chain->firCellList[ chanNum ];
+        rc = CHAN_open( &chain->chanList[ chanNum ],
+            &chain->cellList[ chanNum * NUMCELLS ], NUMCELLS, &chanAttrs );
+    }
+
+    return (rc);
+}
+
+/*
+ *  ======== chainClose ========
+ */
+static Void chainClose(Chain *chain)
+{
+    Uns chanNum;
+    Uns iccNum;
+
+    CHAN_close( &chain->firChan );
+    for (chanNum = 0; chanNum < chain->chanCnt; chanNum++) {
+        CHAN_close( &chain->chanList[ chanNum ] );
+        CHAN_unregCell( &chain->cellList[ chanNum * NUMCELLS + CELLVOL ] );
+        CHAN_unregCell( &chain->firCellList[ chanNum ] );
+        for (iccNum = 0; iccNum < NUMICCS; iccNum++) {
+            if (chain->iccList[ chanNum * NUMICCS + iccNum ] != NULL) {
+                ICC_linearDelete( chain->iccList[ chanNum * NUMICCS + iccNum ] );
+            }
+        }
+        free(chain->bufInput[ chanNum ]);
+        free(chain->bufIntermediate[ chanNum ]);
+        free(chain->bufOutput[ chanNum ]);
+    }
+    CHAN_exit();
+}
+
+/*
+ *  ======== chainRun ========
+ *  Runs all of in through the chain into out. The last frame is padded
+ *  with silence.
+ */
+static Void chainRun(Chain *chain, WAV_Data *in, WAV_Data *out)
+{
+    LgUns  pos;
+    Uns    len;
+    Uns    chanNum;
+    Uns    i;
+    Short *src;
+    Short *dst;
+
+    for (pos = 0; pos < in->frames; pos += len) {
+        len = (in->frames - pos < chain->frameLen) ?
+            (Uns)(in->frames - pos) : chain->frameLen;
+
+        // de-interleave, as PreProcess would
+        src = in->samples + pos * in->channels;
+        for (chanNum = 0; chanNum < chain->chanCnt; chanNum++) {
+            for (i = 0; i < len; i++) {
+                chain->bufInput[ chanNum ][ i ] = src[ i * in->channels +
+                    chanNum ];
+            }
+            for (; i < chain->frameLen; i++) {
+                chain->bufInput[ chanNum ][ i ] = 0;
+            }
+        }
+
+        PRF_frameStart( &chain->prf );
+
+        PRF_cellStart( &chain->prf, PRFFIR );
+        FIR_cellExecuteBatch( chain->firCells, chain->chanCnt );
+        PRF_cellStop( &chain->prf, PRFFIR );
+
+        for (chanNum = 0; chanNum < chain->chanCnt; chanNum++) {
+            CHAN_execute( &chain->chanList[ chanNum ], NULL );
+        }
+
+        PRF_frameEnd( &chain->prf );
+        chain->firTime += chain->prfCells[ PRFFIR ].lastTime;
+
+        // interleave, as PostProcess would
+        dst = out->samples + pos * out->channels;
+        for (chanNum = 0; chanNum < chain->chanCnt; chanNum++) {
+            for (i = 0; i < len; i++) {
+                dst[ i * out->channels + chanNum ] =
+                    chain->bufOutput[ chanNum ][ i ];
+            }
+        }
+    }
+}
+
+/*
+ *  ======== stretchFilter ========
+ *  Makes a filter of len taps from a NUMFIRTAPS-tap one by linear
+ *  interpolation, scaled to keep its gain: its frequency response is
+ *  compressed by len / NUMFIRTAPS, so a low-pass gets sharper. Integer
+ *  only, like the test signal.
+ */
+static Void stretchFilter(Short *src, Short *dst, Uns len)
+{
+    LgUns pos;
+    Uns   k;
+    Int   frac;
+    LgInt sum;
+    Uns   i;
+
+    for (i = 0; i < len; i++) {
+        // position in src, with an 8-bit fraction
+        pos  = (LgUns)i * (NUMFIRTAPS - 1) * 256 / (len - 1);
+        k    = (Uns)(pos >> 8);
+        frac = (Int)(pos & 0xFF);
+
+        sum = (LgInt)src[ k ] * (256 - frac);
+        if (k + 1 < NUMFIRTAPS) {
+            sum += (LgInt)src[ k + 1 ] * frac;
+        }
+        dst[ i ] = (Short)(sum * NUMFIRTAPS / (256 * (LgInt)len));
+    }
+}
+
+/*
+ *  ======== compareGolden ========
+ *  Reports the first sample that differs from the golden output by more
+ *  than tolerance, and the largest difference.
+ */
+static Bool compareGolden(String name, WAV_Data *out, Int tolerance)
+{
+    WAV_Data golden;
+    LgUns    i;
+    LgUns    first   = 0;
+    LgUns    badCnt  = 0;
+    Int      maxDiff = 0;
+    Int      diff;
+
+    if (!WAV_load(name, &golden)) {
+        fprintf(stderr, "rfbench: cannot load golden output %s\n", name);
+        return (FALSE);
+    }
+    if (golden.channels != out->channels || golden.rate != out->rate ||
+        golden.frames != out->frames) {
+        printf("golden: %s is %u channels, %lu Hz, %lu samples; "
+            "output is %u channels, %lu Hz, %lu samples\n", name,
+            golden.channels, golden.rate, golden.frames,
+            out->channels, out->rate, out->frames);
+        WAV_free(&golden);
+        return (FALSE);
+    }
+
+    for (i = 0; i < out->frames * out->channels; i++) {
+        diff = abs((Int)out->samples[i] - (Int)golden.samples[i]);
+        if (diff > tolerance && badCnt++ == 0) {
+            first = i;
+        }
+        if (diff > maxDiff) {
+            maxDiff = diff;
+        }
+    }
+    WAV_free(&golden);
+
+    if (badCnt != 0) {
+        printf("golden: MISMATCH with %s: %lu samples off by more than %d, "
+            "first at sample %lu of channel %lu, max difference %d\n", name,
+            badCnt, tolerance, first / out->channels, first % out->channels,
+            maxDiff);
+        return (FALSE);
+    }
+
+    printf("golden: match with %s, max difference %d\n", name, maxDiff);
+    return (TRUE);
+}
+
+/*
+ *  ======== sine ========
+ *  A parabolic approximation of a sine, in Q15, for a phase in 1/65536
+ *  of a period. Integer only, so that the test signal is the same on
+ *  every host.
+ */
+static Short sine(Uns phase)
+{
+    Int x = (Int)(phase & 0x7FFF) - 0x4000;
+    Int y = (0x4000 * 0x4000 - x * x) >> 13;
+
+    if (y > 0x7FFF) {
+        y = 0x7FFF;
+    }
+
+    return ((Short)((phase & 0x8000) ? -y : y));
+}
+
+/*
+ *  ======== makeTestSignal ========
+ *  One second at 8 kHz: channel 0 is a chirp from 50 Hz to 3.5 kHz,
+ *  channel 1 a 300 Hz tone, a 2 kHz tone and white noise.
+ */
+static Bool makeTestSignal(String name)
+{
+    WAV_Data wav;
+    LgUns    rate   = 8000;
+    LgUns    frames = rate;
+    LgUns    i;
+    Uint32   chirp  = 0;
+    Uint32   noise  = 1;
+    Bool     rc;
+
+    if (!WAV_alloc(&wav, 2, rate, frames)) {
+        return (FALSE);
+    }
+
+    for (i = 0; i < frames; i++) {
+        chirp += (Uint32)(((50 + 3450 * i / frames) << 16) / rate) << 16;
+        noise  = noise * 1664525 + 1013904223;
+
+        wav.samples[ 2 * i ]     = sine(chirp >> 16) / 2;
+        wav.samples[ 2 * i + 1 ] = sine((Uns)(i * 300 * 65536 / rate)) / 4 +
+                                   sine((Uns)(i * 2000 * 65536 / rate)) / 8 +
+                                   (Short)(noise >> 16) / 16;
+    }
+
+    rc = WAV_save(name, &wav);
+    WAV_free(&wav);
+
+    return (rc);
+}
+
+/*
+ *  ======== usage ========
+ */
+static Void usage(Void)
+{
+    fprintf(stderr,
+        "usage: rfbench -i in.wav [-o out.wav] [-g golden.wav] "
+        "[-t tolerance]\n"
+        "               [-r repeat] [-n frameLen] [-c filter] [-l taps]\n"
+        "               [-a accum] [-v gain] [-d]\n"
+        "       rfbench -s test.wav\n");
+    exit(1);
+}
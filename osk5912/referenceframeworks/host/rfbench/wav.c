@@ -0,0 +1,185 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== wav.c ========
+ *  16-bit PCM WAV files. The RIFF fields are read and written byte by
+ *  byte, so the code does not depend on the host's byte order; chunks
+ *  other than "fmt " and "data" are skipped.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <std.h>
+
+#include "wav.h"
+
+#define WAV_PCM         1       /* format tag of uncompressed PCM */
+#define WAV_BITS        16      /* the only sample size supported */
+#define WAV_HEADERLEN   44      /* RIFF, fmt and data headers when saving */
+
+static LgUns getLe(Uchar *bytes, Uns len);
+static Void  putLe(Uchar *bytes, LgUns value, Uns len);
+
+/*
+ *  ======== WAV_alloc ========
+ */
+Bool WAV_alloc(WAV_Data *wav, Uns channels, LgUns rate, LgUns frames)
+{
+    wav->channels = channels;
+    wav->rate     = rate;
+    wav->frames   = frames;
+    wav->samples  = calloc(frames * channels + 1, sizeof(Short));
+
+    return (wav->samples != NULL);
+}
+
+/*
+ *  ======== WAV_free ========
+ */
+Void WAV_free(WAV_Data *wav)
+{
+    free(wav->samples);
+    wav->samples = NULL;
+}
+
+/*
+ *  ======== WAV_load ========
+ */
+Bool WAV_load(String name, WAV_Data *wav)
+{
+    FILE  *file;
+    Uchar  hdr[ 16 ];
+    LgUns  len;
+    LgUns  i;
+    Uns    channels = 0;
+    LgUns  rate     = 0;
+    Bool   rc       = FALSE;
+
+    if ((file = fopen(name, "rb")) == NULL) {
+        return (FALSE);
+    }
+
+    if (fread(hdr, 1, 12, file) != 12 || memcmp(hdr, "RIFF", 4) != 0 ||
+        memcmp(hdr + 8, "WAVE", 4) != 0) {
+        fclose(file);
+        return (FALSE);
+    }
+
+    /* walk the chunks until the samples */
+    while (fread(hdr, 1, 8, file) == 8) {
+        len = getLe(hdr + 4, 4);
+
+        if (memcmp(hdr, "fmt ", 4) == 0 && len >= 16) {
+            if (fread(hdr, 1, 16, file) != 16 ||
+                getLe(hdr, 2) != WAV_PCM || getLe(hdr + 14, 2) != WAV_BITS) {
+                break;
+            }
+            channels = (Uns)getLe(hdr + 2, 2);
+            rate     = getLe(hdr + 4, 4);
+            len     -= 16;
+        }
+        else if (memcmp(hdr, "data", 4) == 0 && channels != 0) {
+            if (!WAV_alloc(wav, channels, rate, len / (2 * channels))) {
+                break;
+            }
+            for (i = 0; i < wav->frames * channels; i++) {
+                if (fread(hdr, 1, 2, file) != 2) {
+                    break;
+                }
+                wav->samples[i] = (Short)getLe(hdr, 2);
+            }
+            rc = (i == wav->frames * channels);
+            if (!rc) {
+                WAV_free(wav);
+            }
+            break;
+        }
+
+        /* chunks are padded to an even length */
+        if (fseek(file, (long)(len + (len & 1)), SEEK_CUR) != 0) {
+            break;
+        }
+    }
+
+    fclose(file);
+
+    return (rc);
+}
+
+/*
+ *  ======== WAV_save ========
+ */
+Bool WAV_save(String name, WAV_Data *wav)
+{
+    FILE  *file;
+    Uchar  hdr[ WAV_HEADERLEN ];
+    Uchar  bytes[ 2 ];
+    LgUns  dataLen = wav->frames * wav->channels * 2;
+    LgUns  i;
+    Bool   rc;
+
+    if ((file = fopen(name, "wb")) == NULL) {
+        return (FALSE);
+    }
+
+    memcpy(hdr, "RIFF", 4);
+    putLe(hdr + 4, WAV_HEADERLEN - 8 + dataLen, 4);
+    memcpy(hdr + 8, "WAVEfmt ", 8);
+    putLe(hdr + 16, 16, 4);
+    putLe(hdr + 20, WAV_PCM, 2);
+    putLe(hdr + 22, wav->channels, 2);
+    putLe(hdr + 24, wav->rate, 4);
+    putLe(hdr + 28, wav->rate * wav->channels * 2, 4);
+    putLe(hdr + 32, wav->channels * 2, 2);
+    putLe(hdr + 34, WAV_BITS, 2);
+    memcpy(hdr + 36, "data", 4);
+    putLe(hdr + 40, dataLen, 4);
+
+    rc = (fwrite(hdr, 1, WAV_HEADERLEN, file) == WAV_HEADERLEN);
+
+    for (i = 0; rc && i < wav->frames * wav->channels; i++) {
+        putLe(bytes, (LgUns)(Uint16)wav->samples[i], 2);
+        rc = (fwrite(bytes, 1, 2, file) == 2);
+    }
+
+    if (fclose(file) != 0) {
+        rc = FALSE;
+    }
+
+    return (rc);
+}
+
+/*
+ *  ======== getLe ========
+ *  Read a little-endian unsigned field of len bytes.
+ */
+static LgUns getLe(Uchar *bytes, Uns len)
+{
+    LgUns value = 0;
+
+    while (len-- > 0) {
+        value = (value << 8) | bytes[len];
+    }
+
+    return (value);
+}
+
+/*
+ *  ======== putLe ========
+ *  Write a little-endian field of len bytes.
+ */
+static Void putLe(Uchar *bytes, LgUns value, Uns len)
+{
+    Uns i;
+
+    for (i = 0; i < len; i++) {
+        bytes[i] = (Uchar)(value >> (8 * i));
+    }
+}
@@ -0,0 +1,54 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== wav.h ========
+ *  Loading and saving of 16-bit PCM WAV files for rfbench. Samples are
+ *  held in memory, interleaved, in host byte order.
+ */
+#ifndef WAV_
+#define WAV_
+
+#include <std.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *  WAV_Data
+ *  --------
+ *  channels: number of interleaved channels.
+ *  rate: sampling rate in Hz.
+ *  frames: number of samples per channel.
+ *  samples: frames * channels samples, interleaved.
+ */
+typedef struct WAV_Data {
+    Uns         channels;
+    LgUns       rate;
+    LgUns       frames;
+    Short      *samples;
+} WAV_Data;
+
+/* Allocate the samples of a WAV_Data, cleared */
+extern Bool WAV_alloc(WAV_Data *wav, Uns channels, LgUns rate, LgUns frames);
+
+/* Free the samples of a WAV_Data */
+extern Void WAV_free(WAV_Data *wav);
+
+/* Load a WAV file; fails unless it is 16-bit PCM */
+extern Bool WAV_load(String name, WAV_Data *wav);
+
+/* Save as a 16-bit PCM WAV file */
+extern Bool WAV_save(String name, WAV_Data *wav);
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* WAV_ */
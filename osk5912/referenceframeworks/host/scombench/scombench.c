@@ -0,0 +1,238 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== scombench.c ========
+ *  Message rate benchmark of SCOM on the host, unbounded QUE-based queues
+ *  against ring queues, and of SCOM_open().
+ *
+ *  The host has a single thread, so the writer and the reader of a queue
+ *  take turns, as RxSplit and Process do when neither is ahead: the
+ *  writer puts a burst of ringSize messages and the reader gets them
+ *  back, msgs messages in all. Every message is checked to come out in
+ *  order; on the ring queue one more put must fail while it is full, and
+ *  a get with no wait must return NULL once it is empty. The message rate
+ *  of both kinds of queue is reported. On the target the ring also saves
+ *  the interrupt masking of QUE and the semaphore posts to a reader that
+ *  is not blocked, which the host shim does not show.
+ *
+ *  SCOM_open() is then timed on each of numQueues queues in turn.
+ *
+ *  usage: scombench [-n msgs] [-s ringSize] [-q numQueues]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <std.h>
+#include <clk.h>
+#include <que.h>
+#include <sys.h>
+
+// RF module includes
+#include <scom.h>
+
+#define DEFNUMMSGS      100000
+#define DEFRINGSIZE     2       // as SCOMRINGSIZE in RF5
+#define DEFNUMQUEUES    64
+#define MAXRINGSIZE     64
+#define MAXNAMELEN      16
+
+/*
+ *  A message, with the QUE_Elem that the QUE-based queues need.
+ */
+typedef struct Msg {
+    QUE_Elem    elem;
+    LgUns       seq;
+} Msg;
+
+static Bool runQueue(SCOM_Handle queue, Bool ring, LgUns msgCnt,
+                     Uns ringSize, LgUns *elapsed);
+static Bool runOpen(Uns numQueues, LgUns lookups, LgUns *elapsed);
+static Void usage(Void);
+
+/*
+ *  ======== main ========
+ */
+Int main(Int argc, Char *argv[])
+{
+    LgUns       msgCnt    = DEFNUMMSGS;
+    Uns         ringSize  = DEFRINGSIZE;
+    Uns         numQueues = DEFNUMQUEUES;
+    SCOM_Attrs  attrs     = SCOM_ATTRS;
+    SCOM_Handle que, ring;
+    LgUns       queTime, ringTime, openTime;
+    Int         i;
+
+    for (i = 1; i < argc; i++) {
+        if (strlen(argv[i]) != 2 || argv[i][0] != '-' || i + 1 >= argc) {
+            usage();
+        }
+        switch (argv[i][1]) {
+            case 'n': msgCnt    = strtoul(argv[++i], NULL, 0);  break;
+            case 's': ringSize  = (Uns)atoi(argv[++i]);         break;
+            case 'q': numQueues = (Uns)atoi(argv[++i]);         break;
+            default:  usage();
+        }
+    }
+    if (msgCnt == 0 || ringSize == 0 || ringSize > MAXRINGSIZE ||
+        numQueues == 0) {
+        usage();
+    }
+
+    SCOM_init();
+
+    attrs.ringSize = ringSize;
+    que  = SCOM_create("scomBenchQue", NULL);
+    ring = SCOM_create("scomBenchRing", &attrs);
+    if (que == NULL || ring == NULL) {
+        fprintf(stderr, "scombench: cannot create the SCOM queues\n");
+        return (1);
+    }
+
+    if (!runQueue(que, FALSE, msgCnt, ringSize, &queTime) ||
+        !runQueue(ring, TRUE, msgCnt, ringSize, &ringTime)) {
+        return (1);
+    }
+
+    SCOM_delete(que);
+    SCOM_delete(ring);
+
+    if (!runOpen(numQueues, msgCnt, &openTime)) {
+        return (1);
+    }
+
+    queTime  = queTime  ? queTime  : 1;
+    ringTime = ringTime ? ringTime : 1;
+    openTime = openTime ? openTime : 1;
+
+    printf("scombench: %lu messages in bursts of %u\n", msgCnt, ringSize);
+    printf("  QUE:        %lu msgs/s\n", msgCnt * 1000000000UL / queTime);
+    printf("  ring:       %lu msgs/s, %lu.%02lux the rate of QUE\n",
+        msgCnt * 1000000000UL / ringTime, queTime / ringTime,
+        queTime * 100 / ringTime % 100);
+    printf("  SCOM_open:  %lu lookups/s among %u queues\n",
+        msgCnt * 1000000000UL / openTime, numQueues);
+
+    SCOM_exit();
+
+    return (0);
+}
+
+/*
+ *  ======== runQueue ========
+ *  Put and get msgCnt messages on queue in bursts of ringSize, checking
+ *  their order, and time it. A ring queue must refuse a message while
+ *  full, and give none once empty.
+ */
+static Bool runQueue(SCOM_Handle queue, Bool ring, LgUns msgCnt,
+                     Uns ringSize, LgUns *elapsed)
+{
+    Msg     msgs[ MAXRINGSIZE + 1 ];
+    Msg     extra;
+    Msg    *msg;
+    LgUns   start;
+    LgUns   seq = 0;
+    Uns     burst;
+    Uns     i;
+
+    start = CLK_gethtime();
+    while (seq < msgCnt) {
+        burst = (msgCnt - seq < ringSize) ? (Uns)(msgCnt - seq) : ringSize;
+
+        for (i = 0; i < burst; i++) {
+            msgs[i].seq = seq + i;
+            if (SCOM_putMsg(queue, &msgs[i]) != TRUE) {
+                fprintf(stderr, "scombench: message %lu refused\n", seq + i);
+                return (FALSE);
+            }
+        }
+        if (ring && burst == ringSize && SCOM_putMsg(queue, &extra)) {
+            fprintf(stderr, "scombench: full ring took a message\n");
+            return (FALSE);
+        }
+
+        for (i = 0; i < burst; i++) {
+            msg = SCOM_getMsg(queue, SYS_FOREVER);
+            if (msg == NULL || msg->seq != seq + i) {
+                fprintf(stderr, "scombench: message %lu lost or out of "
+                    "order\n", seq + i);
+                return (FALSE);
+            }
+        }
+        if (ring && SCOM_getMsg(queue, 0) != NULL) {
+            fprintf(stderr, "scombench: empty ring gave a message\n");
+            return (FALSE);
+        }
+
+        seq += burst;
+    }
+    *elapsed = CLK_gethtime() - start;
+
+    return (TRUE);
+}
+
+/*
+ *  ======== runOpen ========
+ *  Create numQueues queues and time lookups SCOM_open() calls, going
+ *  round all of them, each of which must find its own queue.
+ */
+static Bool runOpen(Uns numQueues, LgUns lookups, LgUns *elapsed)
+{
+    SCOM_Handle *queues = malloc(numQueues * sizeof(SCOM_Handle));
+    Char       (*names)[ MAXNAMELEN ] = malloc(numQueues * MAXNAMELEN);
+    LgUns        start;
+    LgUns        j;
+    Uns          i;
+    Bool         ok = TRUE;
+
+    if (queues == NULL || names == NULL) {
+        fprintf(stderr, "scombench: out of memory\n");
+        return (FALSE);
+    }
+
+    for (i = 0; i < numQueues; i++) {
+        sprintf(names[i], "scomQueue%u", i);
+        queues[i] = SCOM_create(names[i], NULL);
+        if (queues[i] == NULL) {
+            fprintf(stderr, "scombench: cannot create %s\n", names[i]);
+            return (FALSE);
+        }
+    }
+
+    start = CLK_gethtime();
+    for (j = 0, i = 0; j < lookups; j++) {
+        if (SCOM_open(names[i]) != queues[i]) {
+            ok = FALSE;
+        }
+        i = (i + 1 == numQueues) ? 0 : i + 1;
+    }
+    *elapsed = CLK_gethtime() - start;
+
+    if (!ok) {
+        fprintf(stderr, "scombench: SCOM_open() found the wrong queue\n");
+    }
+
+    for (i = 0; i < numQueues; i++) {
+        SCOM_delete(queues[i]);
+    }
+    free(names);
+    free(queues);
+
+    return (ok);
+}
+
+/*
+ *  ======== usage ========
+ */
+static Void usage(Void)
+{
+    fprintf(stderr, "usage: scombench [-n msgs] [-s ringSize] "
+        "[-q numQueues]\n");
+    exit(1);
+}
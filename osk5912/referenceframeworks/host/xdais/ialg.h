@@ -0,0 +1,115 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== ialg.h ========
+ *  Host build: the XDAIS IALG interface, as specified by the TMS320
+ *  DSP Algorithm Standard (SPRU360). Only the host build uses this copy;
+ *  target builds take ialg.h from the XDAIS installation.
+ */
+#ifndef IALG_
+#define IALG_
+
+#include <std.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IALG_DEFMEMRECS 4       /* default number of memory records */
+#define IALG_OBJMEMREC  0       /* memory record index of instance object */
+#define IALG_SYSCMD     256     /* minimum "system" IALG_Cmd value */
+
+#define IALG_EOK        0       /* successful return status code */
+#define IALG_EFAIL      -1      /* unspecified error return status code */
+
+typedef enum IALG_MemAttrs {
+    IALG_SCRATCH,               /* scratch memory */
+    IALG_PERSIST,               /* persistent memory */
+    IALG_WRITEONCE              /* write-once persistent memory */
+} IALG_MemAttrs;
+
+#define IALG_MPROG  0x0008      /* program memory space bit */
+#define IALG_MXTRN  0x0010      /* external memory space bit */
+
+typedef enum IALG_MemSpace {
+    IALG_EPROG =                /* external program memory */
+        IALG_MPROG | IALG_MXTRN,
+
+    IALG_IPROG =                /* internal program memory */
+        IALG_MPROG,
+
+    IALG_ESDATA =               /* off-chip data memory (accessed serially) */
+        IALG_MXTRN + 0,
+
+    IALG_EXTERNAL =             /* off-chip data memory (accessed randomly) */
+        IALG_MXTRN + 1,
+
+    IALG_DARAM0 = 0,            /* dual access on-chip data memory */
+    IALG_DARAM1 = 1,            /* block 1, if independent blocks required */
+
+    IALG_SARAM  = 2,            /* single access on-chip data memory */
+    IALG_SARAM0 = 2,            /* block 0, equivalent to IALG_SARAM */
+    IALG_SARAM1 = 3,            /* block 1, if independent blocks required */
+
+    IALG_DARAM2 = 4,            /* block 2, if a 3rd independent block req'd */
+    IALG_SARAM2 = 5             /* block 2, if a 3rd independent block req'd */
+} IALG_MemSpace;
+
+#define IALG_isProg(s) (        \
+    (((int)(s)) & IALG_MPROG)   \
+)
+
+#define IALG_isOffChip(s) (     \
+    (((int)(s)) & IALG_MXTRN)   \
+)
+
+typedef struct IALG_MemRec {
+    Uns             size;       /* size in MAU of allocation */
+    Int             alignment;  /* alignment requirement (MAU) */
+    IALG_MemSpace   space;      /* allocation space */
+    IALG_MemAttrs   attrs;      /* memory attributes */
+    Void            *base;      /* base address of allocated buf */
+} IALG_MemRec;
+
+typedef struct IALG_Obj {
+    struct IALG_Fxns *fxns;
+} IALG_Obj;
+
+typedef struct IALG_Obj *IALG_Handle;
+
+typedef struct IALG_Params {
+    Int size;                   /* number of MAU in the structure */
+} IALG_Params;
+
+typedef struct IALG_Status {
+    Int size;                   /* number of MAU in the structure */
+} IALG_Status;
+
+typedef unsigned int IALG_Cmd;
+
+typedef struct IALG_Fxns {
+    Void    *implementationId;
+    Void    (*algActivate)(IALG_Handle);
+    Int     (*algAlloc)(const IALG_Params *, struct IALG_Fxns **,
+                        IALG_MemRec *);
+    Int     (*algControl)(IALG_Handle, IALG_Cmd, IALG_Status *);
+    Void    (*algDeactivate)(IALG_Handle);
+    Int     (*algFree)(IALG_Handle, IALG_MemRec *);
+    Int     (*algInit)(IALG_Handle, const IALG_MemRec *, IALG_Handle,
+                       const IALG_Params *);
+    Void    (*algMoved)(IALG_Handle, const IALG_MemRec *, IALG_Handle,
+                        const IALG_Params *);
+    Int     (*algNumAlloc)(Void);
+} IALG_Fxns;
+
+#ifdef __cplusplus
+}
+#endif /* extern "C" */
+
+#endif /* IALG_ */
@@ -0,0 +1,32 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== xdas.h ========
+ *  Host build: the XDAIS data types (SPRU360). Only the host build uses
+ *  this copy; target builds take xdas.h from the XDAIS installation.
+ */
+#ifndef XDAS_
+#define XDAS_
+
+#include <std.h>
+
+#define XDAS_TRUE       1
+#define XDAS_FALSE      0
+
+typedef Void            XDAS_Void;
+typedef Uint8           XDAS_Bool;
+
+typedef Int8            XDAS_Int8;      /* actual size chip dependent */
+typedef Uint8           XDAS_UInt8;     /* actual size chip dependent */
+typedef Int16           XDAS_Int16;     /* actual size of type is 16 bits */
+typedef Uint16          XDAS_UInt16;    /* actual size of type is 16 bits */
+typedef Int32           XDAS_Int32;     /* actual size of type is 32 bits */
+typedef Uint32          XDAS_UInt32;    /* actual size of type is 32 bits */
+
+#endif /* XDAS_ */
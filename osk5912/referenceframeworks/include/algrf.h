@@ -33,6 +33,20 @@ typedef struct ALGRF_Config {
 
 extern ALGRF_Config* ALGRF;  /* declared in algrf_setup.c */
 
+/* 
+ *  Counts kept by ALGRF_activateLazy() and ALGRF_deactivateLazy().
+ *  activated:   activations performed.
+ *  elided:      activations skipped because the algorithm was still active.
+ *  deactivated: deactivations performed.
+ */
+typedef struct ALGRF_LazyStats {
+    LgUns activated;
+    LgUns elided;
+    LgUns deactivated;
+} ALGRF_LazyStats;
+
+extern ALGRF_LazyStats ALGRF_lazyStats;  /* declared in algrf_lazy.c */
+
 /*
  *  ======== ALGRF_memSpace ========
  */
@@ -62,6 +76,9 @@ static inline Int ALGRF_memSpace(IALG_MemSpace space)
 /* Initialize scratch memory buffers before processing */
 extern Void ALGRF_activate(ALGRF_Handle alg);
 
+/* Activate unless alg is still active in the SSCR bucket's scratch */
+extern Void ALGRF_activateLazy(ALGRF_Handle alg, Uns scrBucketIndex);
+
 /* Algorithm specific control and status */ 
 extern Int ALGRF_control(ALGRF_Handle alg, IALG_Cmd cmd,
     IALG_Status *statusPtr);  
@@ -83,6 +100,9 @@ extern ALGRF_Handle ALGRF_createScratchSupport(IALG_Fxns *fxns,
 
 /* Save all persistent data to non-scratch memory */    
 extern Void ALGRF_deactivate(ALGRF_Handle alg);
+
+/* Deactivate alg now if ALGRF_activateLazy() left it active */
+extern Void ALGRF_deactivateLazy(ALGRF_Handle alg, Uns scrBucketIndex);
   
 /*
  *  Algorithm instance deletion API for applications not supporting
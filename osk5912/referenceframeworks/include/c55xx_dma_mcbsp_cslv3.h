@@ -47,8 +47,52 @@ typedef struct C55XX_DMA_MCBSP_CSLV3_DevParams {
 typedef struct C55XX_DMA_MCBSP_CSLV3_ChanParams {
     CSL_DmaObj                  *dmaObj;
     CSL_DmaHwSetup              *dmaCfg;    
+    Uns                         sortChans;  /* 0 => contiguous transfer */
+    Bool                        continuous; /* TRUE => never stop the port */
 } C55XX_DMA_MCBSP_CSLV3_ChanParams;
 
+/*
+ *  Continuous streaming: when continuous is TRUE the driver keeps a block
+ *  of its own (C55XX_DMA_MCBSP_CSLV3_FILLSIZE words) programmed behind the
+ *  application's packets. If the application is late, the DMA runs into
+ *  this block instead of stopping: an output channel sends silence and an
+ *  input channel discards the samples, and the next submitted packet is
+ *  picked up at the following block boundary. The McBSP never under- or
+ *  overruns, and the fill blocks are counted in the channel statistics.
+ */
+#define C55XX_DMA_MCBSP_CSLV3_FILLSIZE      32
+
+/* mdControlChan() commands, passed through SIO_ctrl() */
+#define C55XX_DMA_MCBSP_CSLV3_CMD_GETSTATS      (IOM_USER + 0)
+#define C55XX_DMA_MCBSP_CSLV3_CMD_RESETSTATS    (IOM_USER + 1)
+
+/* Channel statistics returned by C55XX_DMA_MCBSP_CSLV3_CMD_GETSTATS */
+typedef struct C55XX_DMA_MCBSP_CSLV3_Stats {
+    Uns         blockCnt;   /* blocks completed by the DMA */
+    Uns         underruns;  /* output blocks of silence sent */
+    Uns         overruns;   /* input blocks discarded */
+    Uns         minSlack;   /* fewest packets in hand at a block boundary */
+} C55XX_DMA_MCBSP_CSLV3_Stats;
+
+/*
+ *  Channel sorting: when sortChans is 2 or more, the DMA moves each block
+ *  of sortChans interleaved channels with one DMA frame per sample period
+ *  and one element per channel, using double-indexed addressing on the
+ *  memory side so that channel c lands in (or is read from) the contiguous
+ *  run starting at addr + c * (size / sortChans). The macros below give
+ *  the element and frame indexes, in bytes, for 16-bit samples and 'len'
+ *  samples per channel. The element index skips to the next channel's run;
+ *  the frame index returns from the last run to the next sample of the
+ *  first one.
+ */
+#define C55XX_DMA_MCBSP_CSLV3_SORTELMINDEX(chans, len) \
+    ((Int16)(2 * (len)))
+#define C55XX_DMA_MCBSP_CSLV3_SORTFRMINDEX(chans, len) \
+    ((Int16)(2 - 2 * ((chans) - 1) * (len)))
+
+/* Largest sorted block, in words, the 16-bit index registers can span */
+#define C55XX_DMA_MCBSP_CSLV3_SORTSIZEMAX   0x4000
+
 /* Mini-driver init function -- initializes driver variables, if any */
 extern Void C55XX_DMA_MCBSP_CSLV3_init( Void );
 
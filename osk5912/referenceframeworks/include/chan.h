@@ -43,6 +43,9 @@
  *   @ = must have created a channel before you can delete it. Create/delete
  *       are not required if channel statically defined.
  *
+ *  A channel whose cells, ICCs and algorithm memory are statically defined
+ *  (e.g. generated by the RF6 gengraph pre-program) skips CHAN_setup's heaps
+ *  and CHAN_regCell: it is opened with CHAN_openStatic() and never closed.
  */
 #ifndef CHAN_
 #define CHAN_
@@ -51,6 +54,7 @@
 
 #include <icell.h>
 #include <icc.h>
+#include <prf.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -71,12 +75,18 @@ typedef struct CHAN_Obj *CHAN_Handle;
  *  cellCnt: number of cells in the cellSet. Must be at least 1.
  *  state: state of the channel.
  *  chanControlCB: Callback called within CHAN_execute. Can be NULL.
+ *  blockSize: MAUs streamed through the cells at a time, 0 for whole frames.
+ *  prf: profiler timing the cells, NULL if the channel is not profiled.
+ *  prfCell: profiler cell slot of the first cell.
  */
 typedef struct CHAN_Obj {
     ICELL_Obj  *cellSet;
     Uns         cellCnt;    
     CHAN_State  state;
     Bool        (*chanControlCB)(CHAN_Handle chanHandle);
+    Uns         blockSize;
+    PRF_Handle  prf;
+    Uns         prfCell;
 } CHAN_Obj;
 
 /* 
@@ -84,14 +94,39 @@ typedef struct CHAN_Obj {
  *  ----------
  *  state: state of the channel.
  *  chanControlCB: Callback called within CHAN_execute. Can be NULL.
+ *  blockSize: If not 0, CHAN_execute streams each frame through the cells
+ *             blockSize MAUs at a time, so the intermediate ICC buffers
+ *             only need to hold blockSize MAUs instead of a frame. Every
+ *             cell must then supply cellExecuteBlock(), have one input
+ *             and one output ICC, and write the ICC the next cell reads.
+ *             Only read by CHAN_open.
+ *  prf: If not NULL, CHAN_execute times cell i of the channel in the
+ *       profiler's cell slot prfCell + i (see prf.h).
+ *  prfCell: Profiler cell slot of the channel's first cell.
  */
 typedef struct CHAN_Attrs {    
     CHAN_State  state;
     Bool       (*chanControlCB)(CHAN_Handle chanHandle);
+    Uns         blockSize;
+    PRF_Handle  prf;
+    Uns         prfCell;
 } CHAN_Attrs;
 
 extern CHAN_Attrs CHAN_ATTRS;     /* default attributes, defined in chan.c */
 
+/*
+ *  CHAN_CellMem
+ *  ------------
+ *  Static memory of one cell's algorithm, for CHAN_openStatic().
+ *  bufs: base of each of the algorithm's memTab records, in algAlloc() 
+ *        order, each with the size and alignment the record asks for.
+ *  bufCnt: number of records.
+ */
+typedef struct CHAN_CellMem {
+    Char      **bufs;
+    Uns         bufCnt;
+} CHAN_CellMem;
+
 /* Release the resources owned by the channel.  Does not free the channel. */
 extern Bool CHAN_close(CHAN_Handle chanHandle);
 
@@ -117,6 +152,11 @@ extern Void CHAN_init(Void);
 extern Bool CHAN_open(CHAN_Handle chanHandle, ICELL_Obj cellSet[], 
                       Uns cellCnt, CHAN_Attrs *chanAttrs);
 
+/* Create the algorithms in static memory, cellMem[i] for cellSet[i] */
+extern Bool CHAN_openStatic(CHAN_Handle chanHandle, ICELL_Obj cellSet[], 
+                            Uns cellCnt, CHAN_Attrs *chanAttrs, 
+                            CHAN_CellMem cellMem[]);
+
 /* Determine worst-case scratch requirements and assign ICCs */
 extern Bool CHAN_regCell(ICELL_Handle cellHandle,
                          ICC_Handle iccIn[], Uns iccInCnt,
@@ -25,6 +25,13 @@ typedef struct
    ICC_Obj  obj;   
 } ICC_LinearObj, *ICC_LinearHandle;
 
+/* 
+ *  Initializer for a statically defined linear ICC object, e.g. 
+ *  ICC_LinearObj icc = ICC_LINEARSTATIC(buf, sizeof(buf)); 
+ *  Such objects must not be passed to ICC_linearDelete().
+ */
+#define ICC_LINEARSTATIC(buffer, nmaus) {{(Ptr)(buffer), (nmaus), ICC_LINEAROBJ}}
+
 /* Creation function */
 extern ICC_LinearHandle ICC_linearCreate(Ptr buffer, Uns nmaus);
 
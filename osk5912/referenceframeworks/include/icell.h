@@ -42,6 +42,15 @@ typedef struct ICELL_Obj *ICELL_Handle;
  *      cellExecute() - Used to call the runtime execution functions of the
  *                      algorithm. This is an required function.
  *
+ *      cellExecuteBlock() - Used to run the algorithm on part of a frame:
+ *                      nmaus are read from in and the result written to
+ *                      out, in place of the cell's ICC buffers. Successive
+ *                      calls covering a frame give the same result as one
+ *                      cellExecute(). The algorithm is not activated, so
+ *                      it must work on its persistent state. This is an
+ *                      optional function, needed only for channels opened
+ *                      with a blockSize (see chan.h).
+ *
  *      cellOpen()    - Used to initialize or allocate resources used by
  *                      the cell (e.g. DMA resources, statistics, etc.). 
  *                      This function does not allocate the algorithm. This 
@@ -53,6 +62,8 @@ typedef struct ICELL_Fxns {
    Int  (*cellControl)(ICELL_Handle handle, IALG_Cmd cmd, IALG_Status *status);
    Bool (*cellExecute)(ICELL_Handle handle, Arg arg);
    Bool (*cellOpen   )(ICELL_Handle handle);
+   Bool (*cellExecuteBlock)(ICELL_Handle handle, Arg arg, Ptr in, Ptr out,
+                            Uns nmaus);
 } ICELL_Fxns;
 
 
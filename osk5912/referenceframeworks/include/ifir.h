@@ -37,31 +37,99 @@ typedef struct IFIR_Obj {
  *  ======== IFIR_Status ========
  *  Status structure defines the parameters that can be changed or read
  *  during real-time operation of the alogrithm.
+ *
+ *  crossfade and staged were added after coeffPtr; implementations only
+ *  read or write them when size shows that the caller's structure has 
+ *  them.
  */
 typedef struct IFIR_Status {
     Int size;        /* must be first field of all status structures */
     Short *coeffPtr; /* READ/WRITE */
+    Bool crossfade;  /* WRITE: IFIR_STAGECOEFF fades over one frame */
+    Bool staged;     /* READ: staged coefficients yet to take effect */
     
 } IFIR_Status;
 /*
  *  ======== IFIR_Cmd ========
  *  The Cmd enumeration defines the control commands for the FIR
  *  control method.
+ *
+ *  IFIR_SETSTATUS replaces the coefficients at once, and drops any that 
+ *  are staged. IFIR_STAGECOEFF stages coeffPtr instead: the filter keeps
+ *  the current coefficients until the end of the frame, and takes the 
+ *  new ones from the start of the next, without its history being reset.
+ *  With crossfade, the output of that next frame fades linearly from the
+ *  old coefficients to the new ones, so that the change makes no step.
+ *  Any work the new coefficients need is done by the control call, not
+ *  by the frame that takes them. Staging again before that frame replaces
+ *  the staged coefficients. Like coeffPtr after IFIR_SETSTATUS, staged
+ *  coefficients must stay valid for as long as they are in use.
  */
 typedef enum IFIR_Cmd {
     IFIR_GETSTATUS,
-    IFIR_SETSTATUS
+    IFIR_SETSTATUS,
+    IFIR_STAGECOEFF
 } IFIR_Cmd;
 
+/*
+ *  ======== IFIR_Accum ========
+ *  How the products of the filter are accumulated.
+ *
+ *  IFIR_ACCUM32: in 32 bits, the result truncated to 16 bits. Sums that
+ *  do not fit wrap around, so the coefficients must be scaled for the
+ *  worst-case input.
+ *  IFIR_ACCUMWIDE: in the widest accumulator of the target (40 bits on
+ *  the C55x and C6000, 64 bits on a host), the result saturated to 16 
+ *  bits. Nothing wraps around, at the cost of wider arithmetic, unless
+ *  more than 511 full-scale products add up in 40 bits. The C54x has no
+ *  accumulator wider than 32 bits, and its instances cannot be created 
+ *  with IFIR_ACCUMWIDE.
+ *  IFIR_ACCUMBLOCK: block floating point. Each frame is scaled down by a
+ *  block exponent, chosen from its peak and from the gain of the 
+ *  coefficients, just enough for the sum to fit in 32 bits, and the 
+ *  result is saturated to 16 bits. Quiet frames keep full precision, hot
+ *  ones lose the low bits of the input instead of wrapping around.
+ */
+typedef enum IFIR_Accum {
+    IFIR_ACCUM32 = 0,
+    IFIR_ACCUMWIDE,
+    IFIR_ACCUMBLOCK
+} IFIR_Accum;
+
+/*
+ *  ======== IFIR_FFTOFF, IFIR_FFTAUTO ========
+ *  Special values of the fftLen creation parameter.
+ *
+ *  fftLen selects fast convolution: filter() computes each frame by 
+ *  overlap-save with FFTs of fftLen points, a power of two of at least
+ *  filterLen, instead of in direct form. This is cheaper for long filters
+ *  and long frames. The result is that of IFIR_ACCUMWIDE to within the 
+ *  rounding of the transforms, whatever accum is, so the output no longer
+ *  depends on accum bit for bit. filterMulti() and filterBlock() always
+ *  filter in direct form.
+ *
+ *  IFIR_FFTOFF: direct form.
+ *  IFIR_FFTAUTO: the implementation chooses fftLen from filterLen and 
+ *  frameLen, or direct form when it is cheaper.
+ */
+#define IFIR_FFTOFF     0
+#define IFIR_FFTAUTO    (-1)
+
 /*
  *  ======== IFIR_Params ========
  *  This structure defines the creation parameters for all FIR objects
+ *
+ *  accum and fftLen were added after the other fields; implementations use
+ *  IFIR_ACCUM32 and IFIR_FFTOFF when size shows that the caller's 
+ *  structure predates them.
  */
 typedef struct IFIR_Params {
     Int size;   /* must be first field of all params structures */
     Short *coeffPtr;
     Int filterLen;
     Int frameLen;
+    IFIR_Accum accum;
+    Int fftLen;
 } IFIR_Params;
 
 /*
@@ -73,10 +141,28 @@ extern IFIR_Params IFIR_PARAMS;
 /*
  *  ======== IFIR_Fxns ========
  *  This structure defines all of the operations on FIR objects
+ *
+ *  filterMulti() is optional and may be NULL. It filters one frame on each
+ *  of numChans instances in a single call, producing the same output as
+ *  calling filter() on each instance in turn. The instances must not be
+ *  active when it is called; it operates on their persistent state.
+ *
+ *  filterBlock() is optional and may be NULL. It filters n samples, and
+ *  successive calls covering a frame produce the same output as one call
+ *  to filter(). Like filterMulti(), it must be called on an instance that
+ *  is not active.
+ *
+ *  filter() may be called with out equal to in, filtering the frame in 
+ *  place. filterMulti() and filterBlock() have no scratch memory to copy
+ *  the input to, so the input and output arrays they are given must not
+ *  overlap.
  */
 typedef struct IFIR_Fxns {
     IALG_Fxns   ialg;    /* IFIR extends IALG */
     Void  (*filter)(IFIR_Handle handle, Short in[], Short out[]);
+    Void  (*filterMulti)(IFIR_Handle handles[], Short *in[], Short *out[],
+                         Int numChans);
+    Void  (*filterBlock)(IFIR_Handle handle, Short in[], Short out[], Int n);
 
 } IFIR_Fxns;
 
@@ -0,0 +1,48 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== ilv.h ========
+ *  InterLeaVe module header file
+ *
+ *  Splits a frame of interleaved device samples into one buffer per 
+ *  channel, and joins channel buffers back into an interleaved frame,
+ *  as done by the split/join (RF5) and pre/post process (RF6) threads.
+ *  Stereo frames are split and joined in a single pass over the frame;
+ *  other channel counts walk the frame with a stride per channel.
+ */ 
+#ifndef ILV_
+#define ILV_
+
+#ifdef __cplusplus
+extern "C" {
+#endif    
+
+/*
+ *  ======== ILV_split ========
+ *  Deinterleave frameLen samples of each of the srcChans channels in src
+ *  into dstCnt buffers. dst[c] receives source channel (c % srcChans), so
+ *  a mono frame can feed several channels.
+ */
+extern Void ILV_split(Short *src, Uns srcChans, Short *dst[], Uns dstCnt, 
+                      Uns frameLen);
+
+/*
+ *  ======== ILV_join ========
+ *  Interleave frameLen samples of dstChans channels into dst. Channel d 
+ *  of dst is taken from src[d % srcCnt], so one buffer can feed several
+ *  device channels.
+ */
+extern Void ILV_join(Short *src[], Uns srcCnt, Short *dst, Uns dstChans, 
+                     Uns frameLen);
+
+#ifdef __cplusplus
+}
+#endif // extern "C" 
+
+#endif // ILV_
@@ -34,14 +34,29 @@ typedef struct IVOL_Obj {
     struct IVOL_Fxns *fxns;
 } IVOL_Obj;
 
+/*
+ *  ======== IVOL_RampMode ========
+ *  How the gain moves to a new gainPercentage set with IVOL_SETSTATUS.
+ */
+typedef enum IVOL_RampMode {
+    IVOL_RAMPNONE,      /* jump to the new gain at the next frame */
+    IVOL_RAMPLINEAR,    /* move linearly to the new gain over one frame */
+    IVOL_RAMPEXP        /* approach the new gain exponentially */
+} IVOL_RampMode;
+
 /*
  *  ======== IVOL_Status ========
  *  Status structure defines the parameters that can be changed or read
  *  during real-time operation of the alogrithm.
+ *
+ *  rampMode was added after gainPercentage; implementations only read or
+ *  write it when size shows that the caller's structure has it, and 
+ *  otherwise keep the instance's ramp mode.
  */
 typedef struct IVOL_Status {
     Int size;   /* must be first field of all status structures */
     Int gainPercentage;
+    Int rampMode;       /* IVOL_RampMode */
 } IVOL_Status;
 
 /*
@@ -57,11 +72,16 @@ typedef enum IVOL_Cmd {
 /*
  *  ======== IVOL_Params ========
  *  This structure defines the creation parameters for all VOL objects
+ *
+ *  rampMode was added after the other fields; implementations use
+ *  IVOL_RAMPNONE, the original behaviour, when size shows that the
+ *  caller's structure predates it.
  */
 typedef struct IVOL_Params {
     Int size;   /* must be first field of all params structures */
     Int frameSize;
     Int gainPercentage;
+    Int rampMode;       /* IVOL_RampMode */
 } IVOL_Params;
 
 /*
@@ -73,11 +93,17 @@ extern IVOL_Params IVOL_PARAMS;
 /*
  *  ======== IVOL_Fxns ========
  *  This structure defines all of the operations on VOL objects
+ *
+ *  amplifyBlock() is optional and may be NULL. It scales nWords samples,
+ *  and successive calls covering a frame produce the same output as one
+ *  call to amplify(). The instance need not be active when it is called.
  */
 typedef struct IVOL_Fxns {
     IALG_Fxns   ialg;    /* IVOL extends IALG */
     Void  (*amplify)(IVOL_Handle handle, XDAS_Int16 *in, XDAS_Int16 *out);
     Int  (*control)(IVOL_Handle handle, IVOL_Cmd cmd, IVOL_Status *status);
+    Void  (*amplifyBlock)(IVOL_Handle handle, XDAS_Int16 *in, 
+                          XDAS_Int16 *out, Int nWords);
 } IVOL_Fxns;
 
 #ifdef __cplusplus
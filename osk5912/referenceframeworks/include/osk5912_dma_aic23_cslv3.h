@@ -66,6 +66,26 @@ typedef struct OSK5912_DMA_AIC23_CSLV3_DevParams {
     }                                                   \
 }
 
+/*
+ *  Channel parameters (optional, NULL => defaults). Setting sortChans to
+ *  OSK5912_DMA_AIC23_CSLV3_SORTCHANS_STEREO makes the DMA sort each block
+ *  so the left samples fill the first half of the buffer and the right
+ *  samples the second half. With continuous set, a late application gets
+ *  silence (output) or dropped samples (input) instead of a stopped port.
+ *  See c55xx_dma_mcbsp_cslv3.h for both modes and the channel statistics.
+ */
+typedef struct OSK5912_DMA_AIC23_CSLV3_ChanParams {
+    Uns                  sortChans;        /* 0 => interleaved transfer */
+    Bool                 continuous;       /* TRUE => never stop the port */
+} OSK5912_DMA_AIC23_CSLV3_ChanParams;
+
+#define OSK5912_DMA_AIC23_CSLV3_SORTCHANS_STEREO 2
+
+#define OSK5912_DMA_AIC23_CSLV3_CHANPARAMS_DEFAULT {    \
+    0,                                                  \
+    TRUE                                                \
+}
+
 /* Controller init function -- initializes driver variables, if any */
 extern Void OSK5912_DMA_AIC23_CSLV3_init( Void );
 
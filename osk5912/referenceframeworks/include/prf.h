@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== prf.h ========
+ *  PRoFiler module header file
+ *
+ *  Measures how much of its frame deadline a thread uses, and how that
+ *  time is spread over its cells. The thread brackets the processing of
+ *  each frame with PRF_frameStart() and PRF_frameEnd(); CHAN_execute()
+ *  brackets each cell with PRF_cellStart() and PRF_cellStop() when the
+ *  channel was given a profiler in its attributes. All times are in 
+ *  CLK_gethtime() units and are elapsed times, so they include any time 
+ *  the thread was preempted: that is what counts against the deadline.
+ *
+ *  Unlike the UTL_sts* functions, the profiler is not tied to the debug
+ *  level and can be left enabled in release builds. Its cost is a few
+ *  CLK_gethtime() calls per cell and per frame.
+ *
+ *  Usage example:
+ *
+ *      PRF_Cell cells[ NUMCELLS ];
+ *      PRF_Obj  prf;
+ *
+ *      PRF_new( &prf, PRF_deadline( FRAMELEN, SAMPLERATE ), cells, 
+ *          NUMCELLS );
+ *      chanAttrs.prf = &prf;               // cell i of the channel is
+ *      chanAttrs.prfCell = 0;              // counted in cells[ 0 + i ]
+ *      CHAN_open( &chan, cellList, NUMCELLS, &chanAttrs );
+ *
+ *      while (TRUE) {
+ *          <wait for a frame>
+ *          PRF_frameStart( &prf );
+ *          CHAN_execute( &chan, NULL );
+ *          PRF_frameEnd( &prf );
+ *      }
+ */
+#ifndef PRF_
+#define PRF_
+
+#ifdef __cplusplus
+extern "C" {
+#endif    
+
+/*
+ *  PRF_Cell
+ *  --------
+ *  Time spent in one cell slot. Channels whose cells do the same work may
+ *  share slots, e.g. every channel's VOL cell can be counted in one slot.
+ *  frameTime: time accumulated during the current frame.
+ *  lastTime: time spent in the last complete frame.
+ *  maxTime: worst-case time spent in one frame.
+ *  startTime: internal, time at the last PRF_cellStart().
+ */
+typedef struct PRF_Cell {
+    LgUns       frameTime;
+    LgUns       lastTime;
+    LgUns       maxTime;
+    LgUns       startTime;
+} PRF_Cell;
+
+/*
+ *  PRF_Obj
+ *  -------
+ *  deadline: time available for one frame, also the nominal frame period.
+ *  frameCnt: number of frames completed.
+ *  missCnt: number of frames that took longer than the deadline.
+ *  lastTime, maxTime: last and worst-case execution time of a frame.
+ *  maxJitter: worst difference between a frame period and the deadline.
+ *  load, maxLoad: last and worst-case execution time, in tenths of a 
+ *      percent of the deadline (1000 means the deadline was just met).
+ *  cells, cellCnt: the cell slots.
+ *  startTime, lastStart, loadUnit: internal.
+ */
+typedef struct PRF_Obj {
+    LgUns       deadline;
+    LgUns       frameCnt;
+    LgUns       missCnt;
+    LgUns       lastTime;
+    LgUns       maxTime;
+    LgUns       maxJitter;
+    Uns         load;
+    Uns         maxLoad;
+    PRF_Cell   *cells;
+    Uns         cellCnt;
+    LgUns       startTime;
+    LgUns       lastStart;
+    LgUns       loadUnit;
+} PRF_Obj, *PRF_Handle;
+
+/* Largest load reported, for frames that overrun the deadline badly */
+#define PRF_MAXLOAD     0x7FFF
+
+/* Start timing the cell slot */
+extern Void PRF_cellStart(PRF_Handle prf, Uns cell);
+
+/* Stop timing the cell slot, adding the time to the current frame */
+extern Void PRF_cellStop(PRF_Handle prf, Uns cell);
+
+/* Convert a frame of frameLen samples at sampleRate Hz to CLK_gethtime() */
+extern LgUns PRF_deadline(Uns frameLen, LgUns sampleRate);
+
+/* Mark the end of a frame and update the statistics */
+extern Void PRF_frameEnd(PRF_Handle prf);
+
+/* Mark the start of a frame */
+extern Void PRF_frameStart(PRF_Handle prf);
+
+/* Initialize a profiler with its deadline and cell slots */
+extern Void PRF_new(PRF_Handle prf, LgUns deadline, PRF_Cell cells[], 
+                    Uns cellCnt);
+
+/* Clear the statistics, keeping the deadline and cell slots */
+extern Void PRF_reset(PRF_Handle prf);
+
+#ifdef __cplusplus
+}
+#endif // extern "C" 
+
+#endif // PRF_
@@ -67,7 +67,8 @@
  *       :...........:   :......:
  *   
  *  5. A sends the message to B by doing SCOM_putMsg( queueB, msg );
- *     There can be an unlimited number of messages waiting on an SCOM queue.
+ *     There can be an unlimited number of messages waiting on an SCOM queue,
+ *     unless it is a ring queue (see 8.)
  *  
  *              [p ]<--.
  *                     |
@@ -92,6 +93,16 @@
  *  7. If B wants to write something into the message buffer and send it back
  *     to A (i.e. if they want a two-way communication), we need an additional 
  *     queue for A, symetrical to the one for B. 
+ *  
+ *  8. If only one task ever puts messages on the queue and only one task 
+ *     gets them, B can create it as a ring queue with a fixed capacity:
+ *     SCOM_Attrs attrs = SCOM_ATTRS;
+ *     attrs.ringSize = 2;
+ *     SCOM_Handle queueB = SCOM_create( "queueForB", &attrs );
+ *     Messages on a ring queue don't need the QUE_Elem first field, putting
+ *     and getting them doesn't mask interrupts, and A only posts B's 
+ *     semaphore when B is blocked waiting for a message. SCOM_putMsg()
+ *     returns FALSE if the ring is full.
  */
 
 #ifndef SCOM_
@@ -106,7 +117,7 @@ typedef struct SCOM_Obj SCOM_Obj, *SCOM_Handle;
 
 /* SCOM object creation attributes */
 typedef struct SCOM_Attrs {    
-    Char    dummy;      /* no attributes at present */
+    Uns     ringSize;   /* messages held by a ring queue; 0: unbounded QUE */
 } SCOM_Attrs;
 
 /* default SCOM creation attributes */
@@ -133,7 +144,7 @@ Void SCOM_exit( Void );
  */
 SCOM_Handle SCOM_create(
     String       queueName,  /* ID (name) of the SCOM queue to be created */
-    SCOM_Attrs * attrs       /* SCOM object attributes; only NULL supported */
+    SCOM_Attrs * attrs       /* SCOM object attributes; NULL for defaults */
     );
 
 /*
@@ -156,9 +167,9 @@ Bool SCOM_delete(
 /*
  *  ======== SCOM_putMsg ========
  *  
- *  Place the message on a synchronized queue
+ *  Place the message on a synchronized queue; FALSE if a ring queue is full
  */
-Void SCOM_putMsg(
+Bool SCOM_putMsg(
     SCOM_Handle  scomQueue,   /* SCOM queue to which message should be put */
     Ptr          msg          /* message to be sent */
     );
@@ -12,8 +12,9 @@
  *  XDAIS algorithms.  It uses the idea of buckets.  Each bucket 
  *  holds one buffer pointer, the size of the buffer and the number
  *  of current users of the buffer.  The number of buckets is determine
- *  by the user via SSCR_setup().  SSCR does not provide any protection
- *  of the scratch buffer.
+ *  by the user via SSCR_setup().  SSCR_plan() lets the buckets of threads
+ *  that run at the same priority share one buffer.  SSCR does not provide
+ *  any protection of the scratch buffer.
  *
  *  The following is the calling sequence of the SSCR APIs:
  *
@@ -24,12 +25,19 @@
  *  | SSCR_init  | --> | SSCR_setup | --> | SSCR_prime   |---
  *  --------------     --------------     ----------------
  *                                                |
+ *                                                v
+ *                                        ----------------
+ *                                        | SSCR_plan*   |
+ *                                        ----------------
+ *                                                |
  *                                                |  ----------
  *                                                |  |        |
  *                                                v  v        |
  *                                        ------------------   |
  *                                        | SSCR_createBuf@|----
  *                                        | SSCR_getBuf    |
+ *                                        | SSCR_getOwner  |
+ *                                        | SSCR_setOwner  |
  *                                        | SSCR_deleteBuf@|
  *                                        ----------------   
  *                                                |  
@@ -40,6 +48,7 @@
  *                                        ----------------   
  * Additional notes
  *   @ = must have created a scratch buffer before you can delete it. 
+ *   * = optional, called once after all the algorithms have been primed.
  */
 
 #ifndef SSCR_
@@ -72,13 +81,39 @@ extern "C" {
  *  count:  Number of users of this bucket. This is used to determine
  *          when to free the scratch buffer in a dynamic system.  It 
  *          can also aid in debugging a static system.
+ *  owner:  Algorithm left active in the scratch buffer by 
+ *          ALGRF_activateLazy(), or NULL.
+ *  align:  Largest alignment of the scratch memTabs primed into the bucket;
+ *          the buffer is allocated with this alignment.
+ *  summed: Size the bucket would need if the size and alignment of each 
+ *          scratch memTab were simply summed. Only used for reporting.
+ *  share:  Index of the bucket whose buffer this bucket uses. It is the
+ *          bucket's own index unless SSCR_plan() overlaid it with another.
  */ 
 typedef struct SSCR_Bucket {    
-    Ptr   buffer;   
-    Uns   size;     
-    Uns   count;    
+    Ptr          buffer;   
+    Uns          size;     
+    Uns          count;    
+    IALG_Handle  owner;
+    Uns          align;
+    Uns          summed;
+    Uns          share;
 } SSCR_Bucket;
 
+/* 
+ *  On-chip scratch memory report filled in by SSCR_plan(), in MAUs.
+ *  summedSize:  Needed with one buffer per bucket, each the sum of the size
+ *               and alignment of the scratch memTabs.
+ *  plannedSize: Needed with the buckets of the same priority overlaid and
+ *               the scratch memTabs laid out at their alignment.
+ *  sharedCnt:   Number of buckets that use the buffer of another bucket.
+ */
+typedef struct SSCR_PlanReport {
+    Uns          summedSize;
+    Uns          plannedSize;
+    Uns          sharedCnt;
+} SSCR_PlanReport;
+
 /* Private global variables for the SSCR module. */
 extern Int _SSCR_heapId;
 extern Int _SSCR_bucketCnt;
@@ -96,14 +131,23 @@ extern Void SSCR_exit(Void);
 /* Get the size of and pointer to the scratch buffer. */
 extern Ptr  SSCR_getBuf(Uns scrBucketIndex, Uns *scrSize);
 
+/* Get the algorithm whose state is held in the scratch buffer. */
+extern IALG_Handle SSCR_getOwner(Uns scrBucketIndex);
+
 /* Init the SSCR module. */
 extern Void SSCR_init(Void);
 
+/* Overlay the buckets of threads that run at the same priority. */
+extern Bool SSCR_plan(Int bucketPri[], SSCR_PlanReport *report);
+
 /* Determine worst-case scratch usage for an algorithm instance */
 extern Bool SSCR_prime(Uns          scrBucketIndex,
                        IALG_Fxns   *fxns,
                        IALG_Params *params);
 
+/* Record the algorithm whose state is held in the scratch buffer. */
+extern Void SSCR_setOwner(Uns scrBucketIndex, IALG_Handle alg);
+
 /* Set-up the SSCR module. */
 extern Bool SSCR_setup(Int heapId, Uns bucketCnt, 
                        Ptr bucketBuf[], Uns bucketSize[]);
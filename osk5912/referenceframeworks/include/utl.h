@@ -467,6 +467,8 @@ extern "C" {
         #define UTL_STOPWORD asm(" .if (.MNEMONIC)\n ESTOP_1\n .else\n ESTOP_1()\n .endif\n NOP")
     #elif defined( _6x_ ) 
         #define UTL_STOPWORD asm( "    NOP\n    .word 0x10000000" )
+    #elif defined( _HOST_ )
+        #define UTL_ASSERTCCS 1  /* host build => report via UTL_error() */
     #else
         #define UTL_ASSERTCCS 0  /* unknown platform => no CCS breakpoint */
     #endif
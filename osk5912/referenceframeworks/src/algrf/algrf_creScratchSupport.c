@@ -38,8 +38,9 @@ static Bool memAllocScratchSupport(IALG_MemRec memTab[], Int numRecs,
  *  ======== ALGRF_createScratchSupport ========
  *  Create an instance of an algorithm.  This API should be used by 
  *  applications that support shared scratch buffers. The address of the 
- *  scratch buffer must be supplied by the application. Its size must be
- *  >= sum of (sizes + alignments) of scratch bufs of the 'largest' algorithm
+ *  scratch buffer must be supplied by the application. Its size must fit
+ *  the scratch bufs of the 'largest' algorithm, each placed at the next
+ *  address with its alignment; the sum of (sizes + alignments) always does.
  */
 ALGRF_Handle ALGRF_createScratchSupport(IALG_Fxns *fxns, IALG_Handle parent,
     IALG_Params *params, Void *scratchBuf, Uns scratchSize)
@@ -122,27 +123,31 @@ static Bool memAllocScratchSupport(IALG_MemRec memTab[], Int numRecs,
         if ( (memTab[i].attrs == IALG_SCRATCH) && 
         (!(IALG_isOffChip(memTab[i].space))) ) {        
                             
-            Uns curScratchReq = memTab[i].size + memTab[i].alignment;       
-            Int tmpOffset;
-            Uns scratchOffset;
+            Uns curScratchReq;
+            Uns tmpAlign;
+            Uns padding;
 
-            /* Fail if current scratch req is greater than remaining scratch */
-            if (curScratchReq > scratchSize) {
-                return (FALSE);    
-            }
-                                                                    
             /*  
              *  An algorithm is permitted to request multiple scratch
              *  buffers.  For each request, set the base of the scratch memory
              *  request equal to the current pointer to the scratch buffer
-             *  plus an offset to create the correct alignment.
+             *  plus the padding up to the next aligned address.
              *  (Creates correct alignment if alignment is a power of 2.) 
-             *  tmpOffset handles an align == 0, since mustnt do ~ on -ve val.
+             *  tmpAlign handles an align == 0, since mustnt do ~ on -ve val.
+             *  SSCR_prime() sizes the shared buffers with the same layout.
              */
-            tmpOffset = (memTab[i].alignment == 0) ? 1 : memTab[i].alignment; 
-            scratchOffset = PtrAddrAsUns(scratchPtr) + memTab[i].alignment;
+            tmpAlign = (memTab[i].alignment == 0) ? 1 : memTab[i].alignment; 
+            padding  = (tmpAlign - (PtrAddrAsUns(scratchPtr) & 
+                (tmpAlign - 1))) & (tmpAlign - 1);
+            curScratchReq = padding + memTab[i].size;
+
+            /* Fail if current scratch req is greater than remaining scratch */
+            if ((memTab[i].size > scratchSize) || 
+                (curScratchReq > scratchSize)) {
+                return (FALSE);    
+            }
                         
-            memTab[i].base = (Void *)(scratchOffset & (~(tmpOffset - 1)));
+            memTab[i].base = (Void *)(scratchPtr + padding);
             
             /* advance pointer to the scratch buf and adjust buffer size */
             scratchPtr += curScratchReq;
@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== algrf_lazy.c ========
+ */
+
+#pragma CODE_SECTION(ALGRF_activateLazy, ".text:activate")
+#pragma CODE_SECTION(ALGRF_deactivateLazy, ".text:deactivate")
+
+#include <std.h>
+#include <tsk.h>
+
+#include <algrf.h>
+#include <sscr.h>
+
+/*
+ *  Activations performed and elided by ALGRF_activateLazy(). The counts
+ *  are shared by the threads of all priorities, so each update is done
+ *  with the task scheduler disabled.
+ */
+ALGRF_LazyStats ALGRF_lazyStats = {
+        0,  /* activated */
+        0,  /* elided */
+        0,  /* deactivated */
+};
+
+/*
+ *  ======== ALGRF_activateLazy ========
+ *  Activate an algorithm that shares the scratch buffer of a SSCR bucket.
+ *  The algorithm is left active afterwards: it is only deactivated when
+ *  another algorithm is activated in the same bucket, or when
+ *  ALGRF_deactivateLazy() is called. If the algorithm is still active 
+ *  from its last run, nothing needs to be restored.
+ */
+Void ALGRF_activateLazy(ALGRF_Handle alg, Uns scrBucketIndex)
+{
+    ALGRF_Handle owner = SSCR_getOwner(scrBucketIndex);
+
+    if (owner == alg) {
+        TSK_disable();
+        ALGRF_lazyStats.elided++;
+        TSK_enable();
+        return;
+    }
+
+    /* Save the state another algorithm left in the scratch buffer */
+    if (owner != NULL) {
+        ALGRF_deactivate(owner);
+        TSK_disable();
+        ALGRF_lazyStats.deactivated++;
+        TSK_enable();
+    }
+
+    ALGRF_activate(alg);
+    TSK_disable();
+    ALGRF_lazyStats.activated++;
+    TSK_enable();
+
+    SSCR_setOwner(scrBucketIndex, alg);
+}
+
+/*
+ *  ======== ALGRF_deactivateLazy ========
+ *  Deactivate an algorithm now if ALGRF_activateLazy() left it active in
+ *  the SSCR bucket. Must be called before the algorithm's persistent state
+ *  is used outside an activation, and before the algorithm is deleted.
+ */
+Void ALGRF_deactivateLazy(ALGRF_Handle alg, Uns scrBucketIndex)
+{
+    if (SSCR_getOwner(scrBucketIndex) == alg) {
+        ALGRF_deactivate(alg);
+        TSK_disable();
+        ALGRF_lazyStats.deactivated++;
+        TSK_enable();
+        SSCR_setOwner(scrBucketIndex, NULL);
+    }
+}
+
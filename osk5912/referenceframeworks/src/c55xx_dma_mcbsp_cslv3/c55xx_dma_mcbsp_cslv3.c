@@ -44,6 +44,8 @@ typedef struct ChanObj {
     void        *devp;          /* needed for McBSP access */
 
     CSL_DmaHandle hDma;         /* DMA handle */
+
+    Uns         sortChans;      /* channels sorted per block, 0 => off */
     
     IOM_Packet  *dataPacket;    /* current active I/O packet */
 
@@ -52,6 +54,13 @@ typedef struct ChanObj {
 
     IOM_TiomCallback cbFxn;     /* used to notify client when I/O complete */
     Ptr         cbArg;
+
+    Bool        continuous;     /* TRUE => fill block keeps port running */
+    Uns         pendCnt;        /* number of packets on pendList */
+    IOM_Packet  fillPacket;     /* describes fillBuf to configDma() */
+    Int         fillBuf[C55XX_DMA_MCBSP_CSLV3_FILLSIZE]; /* silence/overflow */
+
+    C55XX_DMA_MCBSP_CSLV3_Stats stats;
 } ChanObj, *ChanHandle;
 
 #define CHANOBJINIT { \
@@ -59,11 +68,17 @@ typedef struct ChanObj {
     0,                  /* dmaId */             \
     NULL,               /* devp */              \
     NULL,               /* hDma */              \
+    0,                  /* sortChans */         \
     NULL,               /* dataPacket */        \
     NULL,               /* nextPacket */        \
     { NULL, NULL },     /* pendList */          \
     NULL,               /* cbFxn */             \
-    NULL                /* cbArg */             \
+    NULL,               /* cbArg */             \
+    FALSE,              /* continuous */        \
+    0,                  /* pendCnt */           \
+    { 0 },              /* fillPacket */        \
+    { 0 },              /* fillBuf */           \
+    { 0 }               /* stats */             \
 }
 
 /* Device Object -- intialized by mdBindDev() */
@@ -82,13 +97,13 @@ typedef struct PortObj {
         CHANOBJINIT,                            \
         CHANOBJINIT                             \
     },                                          \
-    {                                           \
-        NULL,                                   \
-        NULL                                    \
+    {                   /* rxIerMask */         \
+        0,                                      \
+        0                                       \
     },                                          \
-    {                                           \
-        NULL,                                   \
-        NULL                                    \
+    {                   /* txIerMask */         \
+        0,                                      \
+        0                                       \
     }                                           \
 }
 
@@ -136,6 +151,7 @@ IOM_Fxns C55XX_DMA_MCBSP_CSLV3_FXNS = {
 static Void configDma(ChanHandle chan, IOM_Packet *packet);
 static Void dmaIsr(ChanHandle chan);
 static Void abortio(ChanHandle chan);
+static Void resetStats(ChanHandle chan);
 
 /*
  *  ======== mdBindDev ========
@@ -199,6 +215,9 @@ static Int mdBindDev(Ptr *devp, Int devid, Ptr devParams)
  */
 static Int mdControlChan(Ptr chanp, Uns cmd, Ptr args)
 {
+    ChanHandle  chan = (ChanHandle)chanp;
+    Uns         imask;
+
     /*
      * If a channel timeouts(in IOM class driver) a calldown is made to
      * mdControlChan w/ cmd = IOM_CHAN_TIMED out. Timeout processing is
@@ -212,6 +231,19 @@ static Int mdControlChan(Ptr chanp, Uns cmd, Ptr args)
     if (cmd == IOM_CHAN_TIMEDOUT) {
         abortio(chanp);
     }
+    else if (cmd == C55XX_DMA_MCBSP_CSLV3_CMD_GETSTATS) {
+        if (args == NULL) {
+            return (IOM_EBADARGS);
+        }
+        imask = HWI_disable();
+        *(C55XX_DMA_MCBSP_CSLV3_Stats *)args = chan->stats;
+        HWI_restore(imask);
+    }
+    else if (cmd == C55XX_DMA_MCBSP_CSLV3_CMD_RESETSTATS) {
+        imask = HWI_disable();
+        resetStats(chan);
+        HWI_restore(imask);
+    }
     else {
         return (IOM_ENOTIMPL); /* return IOM_ENOTIMPL for codes not handled */
     }
@@ -235,6 +267,7 @@ static Int mdCreateChan(Ptr *chanp, Ptr devp, String name, Int mode,
     CSL_IntcHandle              hIntc;
     CSL_IntcEventId             dmaEventId;
     CSL_Status                  status;                 
+    Uns                         i;
 
     chan = (mode == IOM_INPUT) ? &port->chans[INPUT] : &port->chans[OUTPUT];
 
@@ -261,6 +294,27 @@ static Int mdCreateChan(Ptr *chanp, Ptr devp, String name, Int mode,
     chan->cbFxn = cbFxn;
     chan->cbArg = cbArg;
 
+    chan->sortChans = (params->sortChans > 1) ? params->sortChans : 0;
+
+    /*
+     *  The fill block is zeroed so that an output channel sends silence;
+     *  its length keeps whole sample periods when the channel is sorted.
+     */
+    chan->continuous = params->continuous;
+    chan->pendCnt = 0;
+    for (i = 0; i < C55XX_DMA_MCBSP_CSLV3_FILLSIZE; i++) {
+        chan->fillBuf[i] = 0;
+    }
+    chan->fillPacket.addr = chan->fillBuf;
+    chan->fillPacket.size = C55XX_DMA_MCBSP_CSLV3_FILLSIZE;
+    if (chan->sortChans != 0) {
+        chan->fillPacket.size -= C55XX_DMA_MCBSP_CSLV3_FILLSIZE % 
+            chan->sortChans;
+    }
+    chan->fillPacket.cmd = (mode == IOM_INPUT) ? IOM_READ : IOM_WRITE;
+
+    resetStats(chan);
+
     /*
      *  open and configure DMA. 
      *  '0' for dmaNum does *not* indicate Channel Num. It merely
@@ -273,6 +327,24 @@ static Int mdCreateChan(Ptr *chanp, Ptr devp, String name, Int mode,
         return (IOM_EBADIO);
     }
 
+    /*
+     *  Channel sorting walks the memory side with double-indexed
+     *  addressing, one DMA frame per sample period, so the completion
+     *  interrupt moves from the frame to the end of the block.
+     */
+    if (chan->sortChans != 0) {
+        if (mode == IOM_INPUT) {
+            CSL_FINS(chan->hDma->regs->CCR, DMA_CCR_DSTAMODE, 
+                CSL_DMA_AMODE_DBLIND);
+        }
+        else {
+            CSL_FINS(chan->hDma->regs->CCR, DMA_CCR_SRCAMODE, 
+                CSL_DMA_AMODE_DBLIND);
+        }
+        CSL_FINS(chan->hDma->regs->CICR, DMA_CICR_FRAMEIE, 0);
+        CSL_FINS(chan->hDma->regs->CICR, DMA_CICR_BLOCKIE, 1);
+    }
+
     /* plug interrupt vector */
     attrs.ier0mask = (mode == IOM_INPUT) ? port->rxIerMask[0] : port->txIerMask[0];
     attrs.ier1mask = (mode == IOM_INPUT) ? port->rxIerMask[1] : port->txIerMask[1];
@@ -344,6 +416,12 @@ static Int mdSubmitChan(Ptr chanp, IOM_Packet *packet)
         return (IOM_COMPLETED);
     }
 
+    /* a sorted block must hold whole sample periods the indexes can span */
+    if (chan->sortChans != 0 && (packet->size % chan->sortChans != 0 ||
+        packet->size > C55XX_DMA_MCBSP_CSLV3_SORTSIZEMAX)) {
+        return (IOM_EBADARGS);
+    }
+
     imask = HWI_disable();    /* Begin critical section */
 
     if (chan->dataPacket == NULL) {
@@ -371,10 +449,18 @@ static Int mdSubmitChan(Ptr chanp, IOM_Packet *packet)
             CSL_mcbspHwControl(port->hMcbsp, CSL_MCBSP_CMD_RESET_CONTROL, 
                 &resetCntl);
         }
-    } else if (chan->nextPacket == NULL) {
+
+        /* line up the fill block in case the next packet is late */
+        if (chan->continuous) {
+            chan->nextPacket = &chan->fillPacket;
+            configDma(chan, &chan->fillPacket);
+        }
+    } else if (chan->nextPacket == NULL || 
+               chan->nextPacket == &chan->fillPacket) {
         /*
          *  Standard runtime scenario. Set up addresses, sizes for the 
-         *  next DMA Rx or Tx job
+         *  next DMA Rx or Tx job, replacing the fill block if it was
+         *  lined up.
          */ 
         chan->nextPacket = packet;
         configDma(chan, packet); 
@@ -386,6 +472,7 @@ static Int mdSubmitChan(Ptr chanp, IOM_Packet *packet)
          *  interrupts are disabled
          */
          QUE_enqueue(&chan->pendList, packet);
+         chan->pendCnt++;
     }
 
     HWI_restore(imask);    /* End critical section */
@@ -411,6 +498,10 @@ Void C55XX_DMA_MCBSP_CSLV3_init(Void)
  */
 static Void configDma(ChanHandle chan, IOM_Packet *packet)
 {   
+    Uns     frmCnt;
+    Int16   elmIndex;
+    Int16   frmIndex;
+
     /*
      *  Set the address and packet size for the appropriate DMA channel
      *  and start transfer.
@@ -419,27 +510,43 @@ static Void configDma(ChanHandle chan, IOM_Packet *packet)
 
         /* Change the packet address */
         CSL_dmaHwControl(chan->hDma, CSL_DMA_CMD_CHNG_DST, &packet->addr);
-        
-        /* Modify size of packet */
-        CSL_dmaHwControl(chan->hDma, CSL_DMA_CMD_CHNG_ELEMENT_COUNT, 
-            &packet->size);
-
-        /* Set ENDPROG to indicate the end of register programming */
-        CSL_FINS(chan->hDma->regs->CCR, DMA_CCR_ENDPROG, 1);
-
     }
     else {     /* IOM_WRITE command */
 
         /* Change the packet address */
         CSL_dmaHwControl(chan->hDma, CSL_DMA_CMD_CHNG_SRC, &packet->addr);
-          
+    }
+
+    if (chan->sortChans == 0) {
+
         /* Modify size of packet */
         CSL_dmaHwControl(chan->hDma, CSL_DMA_CMD_CHNG_ELEMENT_COUNT, 
             &packet->size);
+    }
+    else {
 
-        /* Set ENDPROG to indicate the end of register programming */
-        CSL_FINS(chan->hDma->regs->CCR, DMA_CCR_ENDPROG, 1);
+        /* one element per channel, one frame per sample period */
+        frmCnt = packet->size / chan->sortChans;
+        elmIndex = C55XX_DMA_MCBSP_CSLV3_SORTELMINDEX(chan->sortChans, frmCnt);
+        frmIndex = C55XX_DMA_MCBSP_CSLV3_SORTFRMINDEX(chan->sortChans, frmCnt);
+
+        CSL_dmaHwControl(chan->hDma, CSL_DMA_CMD_CHNG_ELEMENT_COUNT, 
+            &chan->sortChans);
+        CSL_dmaHwControl(chan->hDma, CSL_DMA_CMD_CHNG_FRAME_COUNT, &frmCnt);
+
+        /*
+         *  Load both index pairs: the McBSP side is in constant mode and
+         *  ignores them, and this covers both settings of the global
+         *  index mode (shared or separate source/destination indexes).
+         */
+        chan->hDma->regs->CSEI = elmIndex;
+        chan->hDma->regs->CSFI = frmIndex;
+        chan->hDma->regs->CDEI = elmIndex;
+        chan->hDma->regs->CDFI = frmIndex;
     }
+
+    /* Set ENDPROG to indicate the end of register programming */
+    CSL_FINS(chan->hDma->regs->CCR, DMA_CCR_ENDPROG, 1);
 }
 
 
@@ -450,6 +557,7 @@ Void dmaIsr(ChanHandle chan)
 {    
     IOM_Packet *packet = chan->dataPacket; // Hold on to packet for callback
     volatile Uint16 temp;                  // To read DMA CSR for new interrupts
+    Uns        slack;                      // Application packets in hand
    
     /* 
      *  Need to clear the C55 DMA channel's CSR bits to ensure we continue
@@ -463,7 +571,7 @@ Void dmaIsr(ChanHandle chan)
         /*  return if spurious interrupt */
         return;
     }
-    packet->status = IOM_COMPLETED;
+    chan->stats.blockCnt++;
 
     /*
      *  Done with current packet. Prepare for next job by 
@@ -476,12 +584,47 @@ Void dmaIsr(ChanHandle chan)
     /*  Check to see if the QUE is empty */
     if (chan->nextPacket == (IOM_Packet *)&chan->pendList) {
         chan->nextPacket = NULL;
+
+        /*  Keep the port running on the fill block if nothing is queued */
+        if (chan->continuous) {
+            chan->nextPacket = &chan->fillPacket;
+            configDma(chan, &chan->fillPacket);
+        }
     }
     else {
+        chan->pendCnt--;
         configDma(chan, chan->nextPacket);
     }
-    
-    (*chan->cbFxn)(chan->cbArg, packet);
+
+    /*
+     *  The DMA has just moved on to dataPacket. Count a block that fell 
+     *  back to the fill block, and track how many application packets
+     *  the driver held at the boundary: 0 means the application was late.
+     */
+    slack = chan->pendCnt;
+    if (chan->dataPacket == &chan->fillPacket) {
+        if (chan->fillPacket.cmd == IOM_READ) {
+            chan->stats.overruns++;
+        }
+        else {
+            chan->stats.underruns++;
+        }
+    }
+    else if (chan->dataPacket != NULL) {
+        slack++;
+    }
+    if (chan->nextPacket != NULL && chan->nextPacket != &chan->fillPacket) {
+        slack++;
+    }
+    if (slack < chan->stats.minSlack) {
+        chan->stats.minSlack = slack;
+    }
+
+    /*  The fill block belongs to the driver, there is no one to notify */
+    if (packet != &chan->fillPacket) {
+        packet->status = IOM_COMPLETED;
+        (*chan->cbFxn)(chan->cbArg, packet);
+    }
 }
 
 /*
@@ -500,19 +643,19 @@ static Void abortio(ChanHandle chan)
      * since DMA has been stopped
      */
 
-    /*  Process the dataPacket if not null */
-    if (chan->dataPacket != NULL) {
+    /*  Process the dataPacket if not null (or the driver's fill block) */
+    if (chan->dataPacket != NULL && chan->dataPacket != &chan->fillPacket) {
         chan->dataPacket->status = IOM_ABORTED;
         (*chan->cbFxn)(chan->cbArg, chan->dataPacket);
-        chan->dataPacket = NULL;
     }
+    chan->dataPacket = NULL;
 
-    /* process the nextPacket if not null */
-    if (chan->nextPacket != NULL) {
+    /* process the nextPacket if not null (or the driver's fill block) */
+    if (chan->nextPacket != NULL && chan->nextPacket != &chan->fillPacket) {
         chan->nextPacket->status = IOM_ABORTED;
         (*chan->cbFxn)(chan->cbArg, chan->nextPacket);
-        chan->nextPacket = NULL;
     }
+    chan->nextPacket = NULL;
 
     /*  Process all the remaining packets on the channel's pendList */
     tmpPacket = QUE_get(&chan->pendList);
@@ -522,6 +665,20 @@ static Void abortio(ChanHandle chan)
 
         tmpPacket = QUE_get(&chan->pendList);
     }
+    chan->pendCnt = 0;
+}
+
+/*
+ *  ======== resetStats ========
+ *  Clears the channel statistics. Called with interrupts disabled, or
+ *  before the channel's DMA interrupt is enabled.
+ */
+static Void resetStats(ChanHandle chan)
+{
+    chan->stats.blockCnt = 0;
+    chan->stats.underruns = 0;
+    chan->stats.overruns = 0;
+    chan->stats.minSlack = (Uns)-1;
 }
 
 
@@ -17,5 +17,8 @@
 
 /* Default channel attributes */
 CHAN_Attrs CHAN_ATTRS = {CHAN_ACTIVE,  // state
-                         NULL};        // chanControlCB
+                         NULL,         // chanControlCB
+                         0,            // blockSize
+                         NULL,         // prf
+                         0};           // prfCell
 
@@ -33,6 +33,8 @@ Void CHAN_setAttrs(CHAN_Handle chanHandle, CHAN_Attrs *chanAttrs)
     /* Update the read/write fields of the channel. */
     chanHandle->state         = chanAttrs->state;
     chanHandle->chanControlCB = chanAttrs->chanControlCB;
+    chanHandle->prf           = chanAttrs->prf;
+    chanHandle->prfCell       = chanAttrs->prfCell;
 }
 
 /*
@@ -48,6 +50,9 @@ Void CHAN_getAttrs(CHAN_Handle chanHandle, CHAN_Attrs *chanAttrs)
     
     chanAttrs->state         = chanHandle->state;
     chanAttrs->chanControlCB = chanHandle->chanControlCB;
+    chanAttrs->blockSize     = chanHandle->blockSize;
+    chanAttrs->prf           = chanHandle->prf;
+    chanAttrs->prfCell       = chanHandle->prfCell;
 }
 
 
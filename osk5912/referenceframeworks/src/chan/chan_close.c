@@ -26,7 +26,8 @@
  *  This function closes a channel. Closing a channel means doing the
  *  following for each cell in the channel.
  *  1. Call the cellClose() function to close the cell's resources.
- *  2. Call ALGRF_deleteScratchSupport() to free the algorithm's memory. 
+ *  2. Call ALGRF_deactivateLazy() in case the cell left the algorithm 
+ *     active, then ALGRF_deleteScratchSupport() to free its memory. 
  *  3. Call SSCR_deleteBuf() to free the overlaid scratch memory.  Note:
  *     this may not actually free the memory if other algorithms are still
  *     using the memory.
@@ -56,11 +57,16 @@ Bool CHAN_close(CHAN_Handle chanHandle)
         }
         
         if (cellHandle->algHandle != NULL) {
+
+            /* The bucket must not keep a deleted algorithm as its owner */
+            ALGRF_deactivateLazy(cellHandle->algHandle, 
+                                 cellHandle->scrBucketIndex);
             
             /* Delete the algorithm. */         
             if (ALGRF_deleteScratchSupport(cellHandle->algHandle) == FALSE) {
                 return (FALSE);
             }       
+            cellHandle->algHandle = NULL;
             
             /* Release the scratch buffers */
             if (SSCR_deleteBuf(cellHandle->scrBucketIndex) == FALSE) {
@@ -12,23 +12,90 @@
  */
 
 #pragma CODE_SECTION(CHAN_execute, ".text:CHAN_execute")
+#pragma CODE_SECTION(executeBlocks, ".text:CHAN_execute")
 
 #include <std.h>
 
 #include <icell.h>
 #include <chan.h>
+#include <prf.h>
 #include <utl.h>
 
+/*
+ *  ======== executeBlocks ========
+ *  Streams the frame in the first cell's input ICC through the cells 
+ *  blockSize MAUs at a time. Each block goes through the whole chain
+ *  while it is still in cache, and the intermediate ICC buffers hold 
+ *  one block only. The last cell writes to its output ICC at the same
+ *  offset the block was read from. A profiled cell's slot accumulates
+ *  the time of all the blocks.
+ */
+static Bool executeBlocks(CHAN_Handle chanHandle, Arg arg)
+{
+    Int i;
+    Uns offset;
+    Uns count;
+    Uns frameSize;
+    Char *in;
+    Char *out;
+    Bool rc;
+    ICELL_Handle cellHandle;
+    ICELL_Handle firstCell = &(chanHandle->cellSet[0]);
+    ICELL_Handle lastCell = &(chanHandle->cellSet[chanHandle->cellCnt - 1]);
+
+    frameSize = firstCell->inputIcc[0]->nmaus;
+
+    for (offset = 0; offset < frameSize; offset += count) {
+
+        count = frameSize - offset;
+        if (count > chanHandle->blockSize) {
+            count = chanHandle->blockSize;
+        }
+
+        in = (Char *)firstCell->inputIcc[0]->buffer + offset;
+
+        for (i = 0; i < chanHandle->cellCnt; i++) {
+
+            cellHandle = &(chanHandle->cellSet[i]);
+
+            if (cellHandle == lastCell) {
+                out = (Char *)cellHandle->outputIcc[0]->buffer + offset;
+            }
+            else {
+                out = (Char *)cellHandle->outputIcc[0]->buffer;
+            }
+
+            if (chanHandle->prf != NULL) {
+                PRF_cellStart(chanHandle->prf, chanHandle->prfCell + i);
+            }
+            rc = cellHandle->cellFxns->cellExecuteBlock(cellHandle, arg, 
+                in, out, count);
+            if (chanHandle->prf != NULL) {
+                PRF_cellStop(chanHandle->prf, chanHandle->prfCell + i);
+            }
+            if (rc == FALSE) {
+                return (FALSE);
+            }
+            in = out;
+        }
+    }
+
+    return (TRUE);
+}
+
 /*
  *  ======== CHAN_execute ========
  *  CHAN module's execution function.  This function executes each cell 
  *  in the channel. The cellExecute() will call the algorithm's runtime
- *  functions.
+ *  functions. A channel opened with a blockSize runs the cells on one
+ *  block of the frame at a time instead. A channel opened with a profiler
+ *  has each cell timed in its profiler cell slot.
  *  arg usage is left to the discretion of the user of this module.
  */
 Bool CHAN_execute(CHAN_Handle  chanHandle, Arg arg) 
 {
     Int i;        
+    Bool rc;
     ICELL_Handle cellHandle;
 
     /* Make sure parameters are valid */
@@ -46,6 +113,10 @@ Bool CHAN_execute(CHAN_Handle  chanHandle, Arg arg)
         }
     }
     
+    if (chanHandle->blockSize != 0) {
+        return (executeBlocks(chanHandle, arg));
+    }
+
     /*
      *  Loops through each cell in the channel and calls the 
      *  cell's execute function.
@@ -54,8 +125,15 @@ Bool CHAN_execute(CHAN_Handle  chanHandle, Arg arg)
         
         cellHandle = &(chanHandle->cellSet[i]);
         
-         /* Execute the cell */
-        if (cellHandle->cellFxns->cellExecute(cellHandle, arg) == FALSE) {
+        /* Execute the cell, timing it if the channel is profiled */
+        if (chanHandle->prf != NULL) {
+            PRF_cellStart(chanHandle->prf, chanHandle->prfCell + i);
+        }
+        rc = cellHandle->cellFxns->cellExecute(cellHandle, arg);
+        if (chanHandle->prf != NULL) {
+            PRF_cellStop(chanHandle->prf, chanHandle->prfCell + i);
+        }
+        if (rc == FALSE) {
             return (FALSE);
         }
     }    
@@ -30,6 +30,10 @@
  *  2. The algorithm is created via ALGRF_createScratchSupport().
  *  3. The cell's open function is called to initialize an cell resources.
  *  If any of these steps fail, the function returns FALSE.  
+ *  Steps 1 and 2 are skipped for cells whose algorithm already exists,
+ *  i.e. was created in static memory by CHAN_openStatic().
+ *  If a blockSize is given, the function also returns FALSE when the
+ *  cells cannot be streamed a block at a time.
  *
  *  Note: The parent instance technique is not supported by the CHAN module.
  */
@@ -54,8 +58,32 @@ Bool CHAN_open(CHAN_Handle chanHandle, ICELL_Obj cellSet[],
     chanHandle->cellCnt       = cellCnt;
     chanHandle->state         = chanAttrs->state;
     chanHandle->chanControlCB = chanAttrs->chanControlCB;
+    chanHandle->blockSize     = chanAttrs->blockSize;
+    chanHandle->prf           = chanAttrs->prf;
+    chanHandle->prfCell       = chanAttrs->prfCell;
     
 
+    /* 
+     *  Streaming needs a chain of cells that can run on part of a frame, 
+     *  each writing the only ICC the next one reads, and intermediate 
+     *  buffers that hold a block. Check before creating any algorithm.
+     */
+    for (i = 0; i < cellCnt && chanHandle->blockSize != 0; i++) {
+
+        cellHandle = &(cellSet[i]);
+
+        if (cellHandle->cellFxns->cellExecuteBlock == NULL ||
+            cellHandle->inputIccCnt != 1 || 
+            cellHandle->outputIccCnt != 1) {
+            return (FALSE);
+        }
+        if (i + 1 < cellCnt && 
+            (cellSet[i + 1].inputIcc[0] != cellHandle->outputIcc[0] ||
+             cellHandle->outputIcc[0]->nmaus < chanHandle->blockSize)) {
+            return (FALSE);
+        }
+    }
+
     /* Loop through each cell in the channel. */
     for (i = 0; i < cellCnt; i++) {
             
@@ -65,7 +93,7 @@ Bool CHAN_open(CHAN_Handle chanHandle, ICELL_Obj cellSet[],
          *  If the algFxns is NULL, then this cell does not contain an 
          *  algorithm.  This is not an error condition.
          */ 
-        if (cellHandle->algFxns != NULL ) {
+        if (cellHandle->algFxns != NULL && cellHandle->algHandle == NULL) {
             /*
              *  Get the scratch buffer and size of the buffer.  This call will
              *  return NULL for the buffer and zero for the size if there are
@@ -0,0 +1,70 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== chan_openstatic.c ========
+ *  Function for opening a channel whose algorithm memory is static.
+ */
+
+#pragma CODE_SECTION(CHAN_openStatic, ".text:CHAN_openStatic")
+
+#include <std.h>
+
+#include <algmin.h>
+#include <chan.h>
+#include <icell.h>
+#include <utl.h>
+
+/*
+ *  ======== CHAN_openStatic ========
+ *  Creates the algorithm of each cell in the memory described by 
+ *  cellMem[i] with ALGMIN_new(), which neither queries the algorithm nor
+ *  touches a heap, then lets CHAN_open() finish opening the channel. 
+ *  The cells' scratch records are expected to overlay the static scratch
+ *  buffer of their bucket, so scratch is still shared as with SSCR.
+ *  If an algorithm cannot be created, the function returns FALSE.
+ *
+ *  Note: a channel opened this way must not be closed, since CHAN_close()
+ *  would free the static memory to the ALGRF heaps.
+ */
+Bool CHAN_openStatic(CHAN_Handle chanHandle, ICELL_Obj cellSet[], 
+                     Uns cellCnt, CHAN_Attrs *chanAttrs, 
+                     CHAN_CellMem cellMem[])
+{
+    Int i;
+    ICELL_Handle cellHandle;
+
+    /* Make sure parameters are valid */
+    UTL_assert(cellSet != NULL);
+    UTL_assert(cellMem != NULL);
+
+    for (i = 0; i < cellCnt; i++) {
+
+        cellHandle = &(cellSet[i]);
+
+        if (cellHandle->algFxns != NULL && cellHandle->algHandle == NULL) {
+
+            if (cellMem[i].bufCnt == 0 || 
+                cellMem[i].bufCnt > ALGMIN_MAXMEMRECS) {
+                return (FALSE);
+            }
+
+            cellHandle->algHandle = ALGMIN_new(cellHandle->algFxns,
+                                               cellHandle->algParams,
+                                               cellMem[i].bufs,
+                                               (SmUns)cellMem[i].bufCnt);
+            if (cellHandle->algHandle == NULL) {
+                return (FALSE);
+            }
+        }
+    }
+
+    /* The algorithms exist now, so CHAN_open() only opens the cells */
+    return (CHAN_open(chanHandle, cellSet, cellCnt, chanAttrs));
+}
+
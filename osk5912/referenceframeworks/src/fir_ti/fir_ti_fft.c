@@ -0,0 +1,382 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== fir_ti_fft.c ========
+ *  Fast convolution for long filters: overlap-save with a radix-2 FFT in
+ *  fixed point, with a block exponent per transform.
+ *
+ *  Each FFT filters two blocks of fftLen - filterLen + 1 outputs at once:
+ *  the input window of the first block is loaded as the real part, that of
+ *  the second as the imaginary part. Since the coefficients are real, the
+ *  outputs of the two blocks come back apart in the real and imaginary
+ *  parts of the inverse transform.
+ */
+
+#pragma     CODE_SECTION(FIR_TI_fftLen,         ".text:algAlloc")
+#pragma     CODE_SECTION(FIR_TI_fftTwiddle,     ".text:algInit")
+#pragma     CODE_SECTION(FIR_TI_fftCoeff,       ".text:algControl")
+#pragma     CODE_SECTION(FIR_TI_filterFft,      ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_fft,            ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_fftLoad,        ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_fftSat,         ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_log2,           ".text:filter")
+
+#include    <std.h>
+#include    <math.h>
+#include    <xdas.h>
+
+#include    "ifir.h"
+#include    "fir_ti.h"
+#include    "fir_ti_priv.h"
+
+/* longest transform; fftLen * 2 must fit in an Int on every target */
+#define     MAXFFT      8192
+
+/* values are kept below 2^29 before each stage, and before multiplying */
+#define     LIMIT       0x20000000UL
+
+/* inputs and coefficients are loaded as Q15 values shifted up by INSHIFT */
+#define     INSHIFT     13
+
+/*
+ * Cost per FFT point of a stage and of the spectral multiply, relative to
+ * a multiply-accumulate of the direct form, for the choice of 
+ * IFIR_FFTAUTO. Their products are 32 x 16 bits, done in two halves.
+ * These put the crossover where host/firbench measures it.
+ */
+#define     BFLYCOST    10
+#define     MULCOST     16
+
+/* product of a value below 2^30 and a Q15 factor, rounded down */
+#define     MULQ15(a, w)    ((((a) >> 16) * (w) * 2) + ((((a) & 0xFFFFL) * (w)) >> 15))
+
+/* magnitude of a value above -2^31 */
+#define     MAG(a)          ((XDAS_UInt32)(((a) < 0) ? -(a) : (a)))
+
+
+/*
+ *======== FIR_TI_fftLoad ========
+ *
+ * buf = n complex values; one of the parts is loaded
+ * hist = saved history (nHist samples, oldest first)
+ * in = input array (nIn samples)
+ * first = index in "in" of the first sample, negative within the history
+ *
+ * Loads n samples, shifted up by INSHIFT, into every other value from buf.
+ * The samples past the end of the input are zero.
+ */
+static Void FIR_TI_fftLoad(XDAS_Int32 *buf, Short hist[], Short in[], Int nHist, Int nIn, Int first, Int n)
+{
+    Int i = 0;
+
+    for (; (i < n) && (first + i < 0); i++)
+        buf[2 * i] = (XDAS_Int32)hist[nHist + first + i] * (1L << INSHIFT);
+    for (; (i < n) && (first + i < nIn); i++)
+        buf[2 * i] = (XDAS_Int32)in[first + i] * (1L << INSHIFT);
+    for (; i < n; i++)
+        buf[2 * i] = 0;
+}
+
+
+/*
+ *======== FIR_TI_fftSat ========
+ *
+ * Converts a value of the inverse transform to a sample, multiplying it
+ * by 2^exp, rounded down and saturated to 16 bits.
+ */
+static XDAS_Int16 FIR_TI_fftSat(XDAS_Int32 value, Int exp)
+{
+    if (exp < 0)
+    {
+        value = (exp > -32) ? (value >> -exp) : ((value < 0) ? -1 : 0);
+    }
+    else if (exp > 0)
+    {
+        if (exp > 15)
+            exp = 15;
+        if (value > (32767L >> exp))
+            return (32767);
+        if (value < (-32768L >> exp))
+            return (-32768);
+        return ((XDAS_Int16)(value * (1L << exp)));
+    }
+
+    if (value > 32767)
+        return (32767);
+    if (value < -32768)
+        return (-32768);
+
+    return ((XDAS_Int16)value);
+}
+
+
+/*
+ *======== FIR_TI_log2 ========
+ *
+ * Returns log2(n) for a power of two n.
+ */
+static Int FIR_TI_log2(Int n)
+{
+    Int bits = 0;
+
+    while ((1 << bits) < n)
+        bits++;
+
+    return (bits);
+}
+
+
+/*
+ *  ======== FIR_TI_fftLen ========
+ *  Returns the FFT length for params, 0 for the direct form, or IALG_EFAIL
+ *  if fftLen is neither a special value nor a power of two from filterLen
+ *  to MAXFFT. IFIR_FFTAUTO takes the length with the lowest estimated cost
+ *  per frame, if that is below the cost of the direct form.
+ */
+Int FIR_TI_fftLen(const IFIR_Params *params)
+{
+    Int fftLen = FIR_TI_HASPARAM(params, fftLen) ? params->fftLen : IFIR_FFTOFF;
+    Int filterLen = params->filterLen;
+    Int frameLen = params->frameLen;
+    Int n, blkLen, best;
+    LgUns cost, ffts, bestCost;
+
+    if (fftLen == IFIR_FFTOFF)
+    {
+        return (0);
+    }
+
+    if (fftLen != IFIR_FFTAUTO)
+    {
+        if ((fftLen < filterLen) || (fftLen > MAXFFT) || ((fftLen & (fftLen - 1)) != 0))
+        {
+            return (IALG_EFAIL);
+        }
+        return (fftLen);
+    }
+
+    best = 0;
+    bestCost = (LgUns)filterLen * (LgUns)frameLen;
+
+    for (n = 2; n <= MAXFFT; n <<= 1)
+    {
+        if (n < filterLen)
+        {
+            continue;
+        }
+
+        /* a forward and an inverse transform per two blocks */
+        blkLen = n - filterLen + 1;
+        ffts = ((LgUns)frameLen + 2 * blkLen - 1) / (2 * blkLen);
+        cost = (LgUns)n * (FIR_TI_log2(n) * BFLYCOST + MULCOST);
+
+        if (ffts <= bestCost / cost && ffts * cost < bestCost)
+        {
+            best = n;
+            bestCost = ffts * cost;
+        }
+    }
+
+    return (best);
+}
+
+
+/*
+ *  ======== FIR_TI_fftTwiddle ========
+ *  Fills in the n / 2 twiddle factors of an FFT of n points, cos and -sin
+ *  of 2 * pi * k / n in Q15, interleaved.
+ */
+Void FIR_TI_fftTwiddle(XDAS_Int16 *twiddle, Int n)
+{
+    Int k;
+    double w;
+
+    for (k = 0; k < n / 2; k++)
+    {
+        w = floor(cos(2 * 3.14159265358979 * k / n) * 32768.0 + 0.5);
+        twiddle[2 * k] = (XDAS_Int16)((w > 32767.0) ? 32767.0 : w);
+        w = floor(-sin(2 * 3.14159265358979 * k / n) * 32768.0 + 0.5);
+        twiddle[2 * k + 1] = (XDAS_Int16)((w < -32768.0) ? -32768.0 : w);
+    }
+}
+
+
+/*
+ *======== FIR_TI_fft ========
+ *
+ * buf = n complex values, real and imaginary parts interleaved
+ * twiddle = twiddle factors (FIR_TI_fftTwiddle)
+ * n = number of points, a power of two
+ * peak = in: bound on the magnitude of the parts in buf
+ *        out: the same after the transform
+ *
+ * Transforms buf in place by decimation in time, and returns the number
+ * of bits by which the values were scaled down: the transform of buf is
+ * buf * 2^returned. Before each stage the values are scaled down by the
+ * fewest bits that bring them below LIMIT, which keeps the stage within
+ * 32 bits; quiet input is not scaled at all. The peaks are tracked as the
+ * OR of the magnitudes, within a factor of two of the true peak.
+ */
+static Int FIR_TI_fft(XDAS_Int32 *buf, XDAS_Int16 *twiddle, Int n, XDAS_UInt32 *peak)
+{
+    Int i, j, k, half, step, shift;
+    Int scale = 0;
+    XDAS_Int32 ar, ai, br, bi, tr, ti;
+    XDAS_Int16 wr, wi;
+    XDAS_UInt32 bound = *peak;
+    XDAS_UInt32 next;
+
+    /* bit-reversed order */
+    for (i = 0, j = 0; i < n; i++)
+    {
+        if (i < j)
+        {
+            tr = buf[2 * i];
+            ti = buf[2 * i + 1];
+            buf[2 * i] = buf[2 * j];
+            buf[2 * i + 1] = buf[2 * j + 1];
+            buf[2 * j] = tr;
+            buf[2 * j + 1] = ti;
+        }
+        for (k = n >> 1; (k & j) != 0; k >>= 1)
+            j ^= k;
+        j |= k;
+    }
+
+    for (half = 1, step = n >> 1; half < n; half <<= 1, step >>= 1)
+    {
+        for (shift = 0; (bound >> shift) >= LIMIT; shift++)
+            ;
+        scale += shift;
+
+        next = 0;
+        for (j = 0; j < half; j++)
+        {
+            wr = twiddle[2 * j * step];
+            wi = twiddle[2 * j * step + 1];
+            for (i = j; i < n; i += 2 * half)
+            {
+                k = i + half;
+                ar = buf[2 * i] >> shift;
+                ai = buf[2 * i + 1] >> shift;
+                br = buf[2 * k] >> shift;
+                bi = buf[2 * k + 1] >> shift;
+                tr = MULQ15(br, wr) - MULQ15(bi, wi);
+                ti = MULQ15(br, wi) + MULQ15(bi, wr);
+                buf[2 * i] = ar + tr;
+                buf[2 * i + 1] = ai + ti;
+                buf[2 * k] = ar - tr;
+                buf[2 * k + 1] = ai - ti;
+                next |= MAG(ar + tr) | MAG(ai + ti) | MAG(ar - tr) | MAG(ai - ti);
+            }
+        }
+        bound = next;
+    }
+
+    *peak = bound;
+
+    return (scale);
+}
+
+
+/*
+ *  ======== FIR_TI_fftCoeff ========
+ *  Computes the spectrum of a bank's coefficients, in reverse order 
+ *  since the direct form multiplies the oldest sample of its window by 
+ *  coeff[0]. The spectrum is scaled to below 2^15, so that the spectral
+ *  multiply needs 32 x 16-bit products only, and its exponent is kept in
+ *  specExp. Only persistent memory is used, so the instance need not be
+ *  active; IFIR_STAGECOEFF computes the spectrum of the staged bank 
+ *  before the frame that takes it, not in it.
+ */
+Void FIR_TI_fftCoeff(FIR_TI_Obj *fir, FIR_TI_Bank *bank)
+{
+    XDAS_Int32 *buf = bank->spectrum;
+    Int n = fir->fftLen;
+    Int nHist = fir->filterLenM1;
+    Int i, shift;
+    XDAS_UInt32 peak = (XDAS_UInt32)1 << (15 + INSHIFT);
+
+    for (i = 0; i < n; i++)
+    {
+        buf[2 * i] = ((bank->coeff != NULL) && (i <= nHist)) ? (XDAS_Int32)bank->coeff[nHist - i] * (1L << INSHIFT) : 0;
+        buf[2 * i + 1] = 0;
+    }
+
+    bank->specExp = FIR_TI_fft(buf, fir->twiddle, n, &peak) - INSHIFT;
+
+    /* normalize: peak to just below 2^15, shifting up only if it is below */
+    for (shift = 0; (peak >> shift) >= 0x8000; shift++)
+        ;
+    for (; (peak != 0) && (shift <= 0) && ((peak << (1 - shift)) < 0x8000); shift--)
+        ;
+
+    for (i = 0; i < 2 * n; i++)
+    {
+        buf[i] = (shift >= 0) ? (buf[i] >> shift) : (buf[i] * (1L << -shift));
+    }
+
+    bank->specExp += shift;
+}
+
+
+/*
+ *  ======== FIR_TI_filterFft ========
+ *  Filters n samples with the coefficients of bank, from the nHist samples
+ *  of history at hist and the new samples at in, two blocks per pair of 
+ *  transforms. The inverse transform
+ *  is the forward one applied with the real and imaginary parts swapped,
+ *  on input and on output.
+ */
+Void FIR_TI_filterFft(FIR_TI_Obj *fir, FIR_TI_Bank *bank, Short hist[], Short in[], Short out[], Int n)
+{
+    XDAS_Int32 *buf = fir->fftBuf;
+    XDAS_Int32 *spec = bank->spectrum;
+    Int len = fir->fftLen;
+    Int nHist = fir->filterLenM1;
+    Int blkLen = len - nHist;
+    Int bits = FIR_TI_log2(len);
+    Int start, i, nout, shift, exp;
+    XDAS_Int32 xr, xi;
+    XDAS_UInt32 peak;
+
+    for (start = 0; start < n; start += 2 * blkLen)
+    {
+        /* the windows of the two blocks, as the real and imaginary parts */
+        FIR_TI_fftLoad(buf, hist, in, nHist, n, start - nHist, len);
+        FIR_TI_fftLoad(buf + 1, hist, in, nHist, n, start + blkLen - nHist, len);
+        peak = (XDAS_UInt32)1 << (15 + INSHIFT);
+        exp = FIR_TI_fft(buf, fir->twiddle, len, &peak);
+
+        /* multiply by the spectrum of the coefficients, swapping the parts */
+        for (shift = 0; (peak >> shift) >= LIMIT; shift++)
+            ;
+        exp += shift;
+        peak = 0;
+        for (i = 0; i < len; i++)
+        {
+            xr = buf[2 * i] >> shift;
+            xi = buf[2 * i + 1] >> shift;
+            buf[2 * i] = MULQ15(xr, spec[2 * i + 1]) + MULQ15(xi, spec[2 * i]);
+            buf[2 * i + 1] = MULQ15(xr, spec[2 * i]) - MULQ15(xi, spec[2 * i + 1]);
+            peak |= MAG(buf[2 * i]) | MAG(buf[2 * i + 1]);
+        }
+
+        exp += FIR_TI_fft(buf, fir->twiddle, len, &peak);
+        exp += bank->specExp - INSHIFT - bits;
+
+        /* the outputs of the circular convolution that did not wrap around */
+        nout = (n - start < blkLen) ? n - start : blkLen;
+        for (i = 0; i < nout; i++)
+            out[start + i] = FIR_TI_fftSat(buf[2 * (nHist + i) + 1], exp);
+        nout = (n - start - blkLen < blkLen) ? n - start - blkLen : blkLen;
+        for (i = 0; i < nout; i++)
+            out[start + blkLen + i] = FIR_TI_fftSat(buf[2 * (nHist + i)], exp);
+    }
+}
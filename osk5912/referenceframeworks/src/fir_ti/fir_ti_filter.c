@@ -12,7 +12,27 @@
  */
 
 #pragma     CODE_SECTION(FIR_TI_filter,         ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_genHist,        ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_genBlk,         ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_genSym,         ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_genHistWide,    ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_genBlkWide,     ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_dotBfp,         ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_genHistBfp,     ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_genBlkBfp,      ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_exponent,       ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_sat,            ".text:filter")
 #pragma     CODE_SECTION(FIR_TI_gen,            ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_mix,            ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_genFade,        ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_fade,           ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_swap,           ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_update,         ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_filterMulti,    ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_filterBlock,    ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_filterBatch,    ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_genMulti,       ".text:filter")
+#pragma     CODE_SECTION(FIR_TI_save,           ".text:filter")
  
 #include    <std.h>
 #include    <string.h>
@@ -22,58 +42,868 @@
 #include    "fir_ti.h"
 #include    "fir_ti_priv.h"
 
+/* the host build filters IFIR_ACCUMBLOCK frames with SSE2 when it can */
+#if defined(_HOST_) && defined(__SSE2__)
+#include    <emmintrin.h>
+#define     FIR_TI_SSE2
+#endif
+
+/* number of outputs computed per pass over the coefficients */
+#define     BLOCK       4
+
+/* maximum number of channels filtered together by FIR_TI_filterMulti */
+#define     MAXBATCH    8
+
 
 /*
- *======== FIR_TI_gen ========
+ *======== FIR_TI_genHist ========
+ *
+ * hist = saved history (nHist samples, oldest first)
+ * in = input array
+ * coeff = coefficient array (nHist + 1 coefficients)
+ * out = output array
+ * nHist = number of coefficients - 1
+ * nout = number of output samples (nout <= nHist)
+ *
+ * Computes the first outputs of a frame, whose input window spans the
+ * history saved from the previous frame and the start of the new frame.
+ * The products are summed in the same order as a direct-form filter run
+ * over the history followed by the frame, so the results are identical.
+ */
+static Void FIR_TI_genHist(XDAS_Int16 *hist, XDAS_Int16 *in, XDAS_Int16 *coeff, XDAS_Int16 *out, XDAS_Int16 nHist, XDAS_Int16 nout)
+{
+    XDAS_Int16  i, j;
+    XDAS_Int32  sum;
+
+    for (j = 0; j < nout; j++) 
+    {
+        sum = 0;
+        for (i = 0; i < nHist - j; i++)
+            sum += (XDAS_Int32)(hist[i + j]) * (XDAS_Int32)(coeff[i]);
+        for (; i <= nHist; i++)
+            sum += (XDAS_Int32)(in[i + j - nHist]) * (XDAS_Int32)(coeff[i]);
+        out[j] = sum >> 15;
+    }
+}
+
+
+/*
+ *======== FIR_TI_genBlk ========
  *
  * in = input array
  * coeff = coefficient array
  * out = output array
- * nCoeff = number of coefficients (nCoeff >= 5)
+ * nCoeff = number of coefficients
  * nout = number of output samples (nout >= 1)
  *
  * Computes a real FIR filter (direct-form) using coefficients stored
- * in vector coeff. The real data input is stored in vector in. The filter 
- * output result is stored in vector out. This routine has no memory
- * hits regardless of where in, coeff, and out arrays are located in
- * memory. The filter is nout output samples and nCoeff coefficients.
+ * in vector coeff, BLOCK outputs at a time. Each coefficient and each new
+ * input sample is loaded once per block and feeds BLOCK accumulators; the
+ * inputs shared by neighbouring outputs are kept in registers. The
+ * products of each output are summed in the same order as FIR_TI_gen
+ * did, so the results are identical.
+ */
+static Void FIR_TI_genBlk(XDAS_Int16 *in, XDAS_Int16 *coeff, XDAS_Int16 *out, XDAS_Int16 nCoeff, XDAS_Int16 nout)
+{
+    XDAS_Int16  i, j;
+    XDAS_Int32  sum0, sum1, sum2, sum3;
+    XDAS_Int32  x0, x1, x2, x3, c;
+    XDAS_Int16  *x;
+
+    for (j = 0; j + BLOCK <= nout; j += BLOCK) 
+    {
+        x = in + j;
+        sum0 = sum1 = sum2 = sum3 = 0;
+        x0 = x[0];
+        x1 = x[1];
+        x2 = x[2];
+        for (i = 0; i < nCoeff; i++) 
+        {
+            c = coeff[i];
+            x3 = x[i + 3];
+            sum0 += x0 * c;
+            sum1 += x1 * c;
+            sum2 += x2 * c;
+            sum3 += x3 * c;
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+        }
+        out[j]     = sum0 >> 15;
+        out[j + 1] = sum1 >> 15;
+        out[j + 2] = sum2 >> 15;
+        out[j + 3] = sum3 >> 15;
+    }
+
+    /* remaining outputs */
+    for (; j < nout; j++) 
+    {
+        sum0 = 0;
+        for (i = 0; i < nCoeff; i++)
+            sum0 += (XDAS_Int32)(in[i + j]) * (XDAS_Int32)(coeff[i]);
+        out[j] = sum0 >> 15;
+    }
+}
+
+
+/*
+ *======== FIR_TI_genSym ========
  *
- * No memory bank hits under any conditions.
+ * in = input array
+ * coeff = coefficient array, symmetric around its centre
+ * out = output array
+ * nCoeff = number of coefficients
+ * nout = number of output samples (nout >= 1)
  *
+ * Computes the same filter as FIR_TI_genBlk for symmetric coefficients,
+ * adding the two inputs that share a coefficient before multiplying, which
+ * halves the number of multiplies. The sums are exact in 32-bit two's
+ * complement arithmetic, so the results are identical to FIR_TI_genBlk.
  */
-static Void FIR_TI_gen(XDAS_Int16 *in, XDAS_Int16 *coeff, XDAS_Int16 *out, XDAS_Int16 nCoeff, XDAS_Int16 nout)
+static Void FIR_TI_genSym(XDAS_Int16 *in, XDAS_Int16 *coeff, XDAS_Int16 *out, XDAS_Int16 nCoeff, XDAS_Int16 nout)
 {
     XDAS_Int16  i, j;
-    XDAS_Int32  sum;  
-    
+    XDAS_Int16  nHalf = nCoeff >> 1;
+    XDAS_Int32  sum;
+    XDAS_Int16  *x;
+
     for (j = 0; j < nout; j++) 
     {
+        x = in + j;
         sum = 0;
-        for (i = 0; i < nCoeff; i++)
-            sum += (XDAS_Int32)(in[i + j]) * (XDAS_Int32)(coeff[i]);
+        for (i = 0; i < nHalf; i++)
+            sum += ((XDAS_Int32)(x[i]) + (XDAS_Int32)(x[nCoeff - 1 - i])) * (XDAS_Int32)(coeff[i]);
+        if (nCoeff & 1)
+            sum += (XDAS_Int32)(x[nHalf]) * (XDAS_Int32)(coeff[nHalf]);
         out[j] = sum >> 15;
     }
 }
+
+
+/*
+ *======== FIR_TI_sat ========
+ *
+ * Converts a sum of products of Q15 coefficients with input scaled down
+ * by shift bits back to a sample, saturated to 16 bits.
+ */
+static XDAS_Int16 FIR_TI_sat(FIR_TI_Accum sum, XDAS_Int16 shift)
+{
+    sum >>= 15 - shift;
+
+    if (sum > 32767)
+        return (32767);
+    if (sum < -32768)
+        return (-32768);
+
+    return ((XDAS_Int16)sum);
+}
+
+
+/*
+ *======== FIR_TI_genHistWide ========
+ *
+ * Computes the same outputs as FIR_TI_genHist for IFIR_ACCUMWIDE, summing
+ * the products in a FIR_TI_Accum and saturating the results.
+ */
+static Void FIR_TI_genHistWide(XDAS_Int16 *hist, XDAS_Int16 *in, XDAS_Int16 *coeff, XDAS_Int16 *out, XDAS_Int16 nHist, XDAS_Int16 nout)
+{
+    XDAS_Int16  i, j;
+    FIR_TI_Accum sum;
+
+    for (j = 0; j < nout; j++) 
+    {
+        sum = 0;
+        for (i = 0; i < nHist - j; i++)
+            sum += (XDAS_Int32)(hist[i + j]) * (XDAS_Int32)(coeff[i]);
+        for (; i <= nHist; i++)
+            sum += (XDAS_Int32)(in[i + j - nHist]) * (XDAS_Int32)(coeff[i]);
+        out[j] = FIR_TI_sat(sum, 0);
+    }
+}
+
+
+/*
+ *======== FIR_TI_genBlkWide ========
+ *
+ * Computes the same outputs as FIR_TI_genBlk for IFIR_ACCUMWIDE, BLOCK
+ * outputs at a time. Each product fits in 32 bits; only the sums are
+ * wide, so the multiplies stay 16 x 16 bits.
+ */
+static Void FIR_TI_genBlkWide(XDAS_Int16 *in, XDAS_Int16 *coeff, XDAS_Int16 *out, XDAS_Int16 nCoeff, XDAS_Int16 nout)
+{
+    XDAS_Int16  i, j;
+    FIR_TI_Accum sum0, sum1, sum2, sum3;
+    XDAS_Int32  x0, x1, x2, x3, c;
+    XDAS_Int16  *x;
+
+    for (j = 0; j + BLOCK <= nout; j += BLOCK) 
+    {
+        x = in + j;
+        sum0 = sum1 = sum2 = sum3 = 0;
+        x0 = x[0];
+        x1 = x[1];
+        x2 = x[2];
+        for (i = 0; i < nCoeff; i++) 
+        {
+            c = coeff[i];
+            x3 = x[i + 3];
+            sum0 += x0 * c;
+            sum1 += x1 * c;
+            sum2 += x2 * c;
+            sum3 += x3 * c;
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+        }
+        out[j]     = FIR_TI_sat(sum0, 0);
+        out[j + 1] = FIR_TI_sat(sum1, 0);
+        out[j + 2] = FIR_TI_sat(sum2, 0);
+        out[j + 3] = FIR_TI_sat(sum3, 0);
+    }
+
+    /* remaining outputs */
+    for (; j < nout; j++) 
+    {
+        sum0 = 0;
+        for (i = 0; i < nCoeff; i++)
+            sum0 += (XDAS_Int32)(in[i + j]) * (XDAS_Int32)(coeff[i]);
+        out[j] = FIR_TI_sat(sum0, 0);
+    }
+}
+
+
+/*
+ *======== FIR_TI_exponent ========
+ *
+ * hist = saved history
+ * in = input array
+ * nHist = number of history samples
+ * n = number of input samples
+ * gain = sum of the magnitudes of the coefficients
+ *
+ * Returns the block exponent of IFIR_ACCUMBLOCK: the smallest right shift
+ * of the input for which no sum of products, partial or complete, can
+ * exceed 32 bits. The peak input times the gain bounds them all.
+ */
+static XDAS_Int16 FIR_TI_exponent(XDAS_Int16 *hist, XDAS_Int16 *in, XDAS_Int16 nHist, XDAS_Int16 n, LgUns gain)
+{
+    XDAS_Int16  i, shift;
+    LgUns       peak = 0;
+    LgUns       mag;
+
+    for (i = 0; i < nHist; i++) 
+    {
+        mag = (hist[i] < 0) ? -(LgInt)hist[i] : hist[i];
+        if (mag > peak)
+            peak = mag;
+    }
+    for (i = 0; i < n; i++) 
+    {
+        mag = (in[i] < 0) ? -(LgInt)in[i] : in[i];
+        if (mag > peak)
+            peak = mag;
+    }
+
+    /* a shifted sample is at most the peak divided by 2^shift, rounded up */
+    for (shift = 0; (shift < 15) && (gain != 0); shift++) 
+    {
+        if (((peak + ((LgUns)1 << shift) - 1) >> shift) <= 0x7FFFFFFFUL / gain)
+            break;
+    }
+
+    return (shift);
+}
+
+
+#ifdef FIR_TI_SSE2
+
+/*
+ *======== FIR_TI_dotBfp ========
+ *
+ * Returns the sum of the products of n inputs, scaled down by shift bits,
+ * with n coefficients. Host SSE2 version: each pmaddwd multiplies 8
+ * inputs by 8 coefficients and sums them in pairs into 4 32-bit lanes.
+ * The block exponent keeps every partial sum within 32 bits, so the
+ * result is identical to the portable version below.
+ */
+static XDAS_Int32 FIR_TI_dotBfp(XDAS_Int16 *x, XDAS_Int16 *coeff, XDAS_Int16 n, XDAS_Int16 shift)
+{
+    XDAS_Int16  i;
+    __m128i     count = _mm_cvtsi32_si128(shift);
+    __m128i     acc = _mm_setzero_si128();
+    XDAS_Int32  sum;
+
+    for (i = 0; i + 8 <= n; i += 8) 
+    {
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_sra_epi16(_mm_loadu_si128((__m128i *)(x + i)), count), _mm_loadu_si128((__m128i *)(coeff + i))));
+    }
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0x4E));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0xB1));
+    sum = _mm_cvtsi128_si32(acc);
+
+    for (; i < n; i++)
+        sum += (XDAS_Int32)(x[i] >> shift) * (XDAS_Int32)(coeff[i]);
+
+    return (sum);
+}
+
+/*
+ *======== FIR_TI_genBlkBfp ========
+ *
+ * in = input array
+ * coeff = coefficient array
+ * out = output array
+ * nCoeff = number of coefficients
+ * nout = number of output samples (nout >= 1)
+ * shift = block exponent
+ *
+ * Host SSE2 version: each pmaddwd multiplies 8 scaled inputs by 8
+ * coefficients and sums them in pairs into 4 32-bit lanes, for BLOCK
+ * outputs that share each coefficient load. The block exponent keeps
+ * every partial sum within 32 bits, so the results are identical to the
+ * portable version below.
+ */
+static Void FIR_TI_genBlkBfp(XDAS_Int16 *in, XDAS_Int16 *coeff, XDAS_Int16 *out, XDAS_Int16 nCoeff, XDAS_Int16 nout, XDAS_Int16 shift)
+{
+    XDAS_Int16  i, j, k;
+    XDAS_Int32  sum[BLOCK];
+    __m128i     count = _mm_cvtsi32_si128(shift);
+    __m128i     acc0, acc1, acc2, acc3, c, lo, hi;
+    XDAS_Int16  *x;
+
+    for (j = 0; j + BLOCK <= nout; j += BLOCK) 
+    {
+        x = in + j;
+        acc0 = acc1 = acc2 = acc3 = _mm_setzero_si128();
+        for (i = 0; i + 8 <= nCoeff; i += 8) 
+        {
+            c = _mm_loadu_si128((__m128i *)(coeff + i));
+            acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_sra_epi16(_mm_loadu_si128((__m128i *)(x + i)), count), c));
+            acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_sra_epi16(_mm_loadu_si128((__m128i *)(x + i + 1)), count), c));
+            acc2 = _mm_add_epi32(acc2, _mm_madd_epi16(_mm_sra_epi16(_mm_loadu_si128((__m128i *)(x + i + 2)), count), c));
+            acc3 = _mm_add_epi32(acc3, _mm_madd_epi16(_mm_sra_epi16(_mm_loadu_si128((__m128i *)(x + i + 3)), count), c));
+        }
+
+        /* add the lanes of each accumulator: sum[k] gets those of acck */
+        lo = _mm_unpacklo_epi32(acc0, acc1);
+        hi = _mm_unpackhi_epi32(acc0, acc1);
+        acc0 = _mm_add_epi32(lo, hi);
+        lo = _mm_unpacklo_epi32(acc2, acc3);
+        hi = _mm_unpackhi_epi32(acc2, acc3);
+        acc2 = _mm_add_epi32(lo, hi);
+        acc0 = _mm_add_epi32(_mm_unpacklo_epi64(acc0, acc2), _mm_unpackhi_epi64(acc0, acc2));
+        _mm_storeu_si128((__m128i *)sum, acc0);
+
+        /* the coefficients left over from the groups of 8 */
+        for (; i < nCoeff; i++) 
+        {
+            for (k = 0; k < BLOCK; k++)
+                sum[k] += (XDAS_Int32)(x[i + k] >> shift) * (XDAS_Int32)(coeff[i]);
+        }
+        for (k = 0; k < BLOCK; k++)
+            out[j + k] = FIR_TI_sat(sum[k], shift);
+    }
+
+    /* remaining outputs */
+    for (; j < nout; j++) 
+        out[j] = FIR_TI_sat(FIR_TI_dotBfp(in + j, coeff, nCoeff, shift), shift);
+}
+
+#else
+
+/*
+ *======== FIR_TI_dotBfp ========
+ *
+ * Returns the sum of the products of n inputs, scaled down by shift bits,
+ * with n coefficients.
+ */
+static XDAS_Int32 FIR_TI_dotBfp(XDAS_Int16 *x, XDAS_Int16 *coeff, XDAS_Int16 n, XDAS_Int16 shift)
+{
+    XDAS_Int16  i;
+    XDAS_Int32  sum = 0;
+
+    for (i = 0; i < n; i++)
+        sum += (XDAS_Int32)(x[i] >> shift) * (XDAS_Int32)(coeff[i]);
+
+    return (sum);
+}
+
+/*
+ *======== FIR_TI_genBlkBfp ========
+ *
+ * in = input array
+ * coeff = coefficient array
+ * out = output array
+ * nCoeff = number of coefficients
+ * nout = number of output samples (nout >= 1)
+ * shift = block exponent
+ *
+ * Computes the same outputs as FIR_TI_genBlk for IFIR_ACCUMBLOCK, BLOCK
+ * outputs at a time, on the input scaled down by shift bits. Each new
+ * input sample is scaled once, as it is loaded into the registers.
+ */
+static Void FIR_TI_genBlkBfp(XDAS_Int16 *in, XDAS_Int16 *coeff, XDAS_Int16 *out, XDAS_Int16 nCoeff, XDAS_Int16 nout, XDAS_Int16 shift)
+{
+    XDAS_Int16  i, j;
+    XDAS_Int32  sum0, sum1, sum2, sum3;
+    XDAS_Int32  x0, x1, x2, x3, c;
+    XDAS_Int16  *x;
+
+    for (j = 0; j + BLOCK <= nout; j += BLOCK) 
+    {
+        x = in + j;
+        sum0 = sum1 = sum2 = sum3 = 0;
+        x0 = x[0] >> shift;
+        x1 = x[1] >> shift;
+        x2 = x[2] >> shift;
+        for (i = 0; i < nCoeff; i++) 
+        {
+            c = coeff[i];
+            x3 = x[i + 3] >> shift;
+            sum0 += x0 * c;
+            sum1 += x1 * c;
+            sum2 += x2 * c;
+            sum3 += x3 * c;
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+        }
+        out[j]     = FIR_TI_sat(sum0, shift);
+        out[j + 1] = FIR_TI_sat(sum1, shift);
+        out[j + 2] = FIR_TI_sat(sum2, shift);
+        out[j + 3] = FIR_TI_sat(sum3, shift);
+    }
+
+    /* remaining outputs */
+    for (; j < nout; j++) 
+        out[j] = FIR_TI_sat(FIR_TI_dotBfp(in + j, coeff, nCoeff, shift), shift);
+}
+
+#endif /* FIR_TI_SSE2 */
+
+
+/*
+ *======== FIR_TI_genHistBfp ========
+ *
+ * Computes the same outputs as FIR_TI_genHist for IFIR_ACCUMBLOCK, on the
+ * input scaled down by shift bits, and saturates the results. The window
+ * of each output is split into its history part and its new part.
+ */
+static Void FIR_TI_genHistBfp(XDAS_Int16 *hist, XDAS_Int16 *in, XDAS_Int16 *coeff, XDAS_Int16 *out, XDAS_Int16 nHist, XDAS_Int16 nout, XDAS_Int16 shift)
+{
+    XDAS_Int16  j;
+    XDAS_Int32  sum;
+
+    for (j = 0; j < nout; j++) 
+    {
+        sum = FIR_TI_dotBfp(hist + j, coeff, nHist - j, shift);
+        sum += FIR_TI_dotBfp(in, coeff + nHist - j, j + 1, shift);
+        out[j] = FIR_TI_sat(sum, shift);
+    }
+}
+
+
+/*
+ *======== FIR_TI_mix ========
+ *
+ * Returns the output of a crossfade at step k of len: the linear mix of
+ * the sample faded out, from, and of the sample faded in, to. At step
+ * len the result is to.
+ */
+static XDAS_Int16 FIR_TI_mix(XDAS_Int16 from, XDAS_Int16 to, XDAS_Int16 k, XDAS_Int16 len)
+{
+    return ((XDAS_Int16)(from + ((XDAS_Int32)to - from) * k / len));
+}
+
+
+/*
+ *======== FIR_TI_genFade ========
+ *
+ * hist = saved history (nHist samples, oldest first)
+ * in = input array
+ * from = coefficient array faded out
+ * coeff = coefficient array faded in
+ * out = output array
+ * nHist = number of coefficients - 1
+ * nout = number of output samples
+ * pos = number of samples of the crossfade already output
+ * len = length of the crossfade
+ *
+ * Computes the outputs of a crossfade with both coefficient arrays, 
+ * summing each in a FIR_TI_Accum over the window that FIR_TI_genHist 
+ * walks, which holds for outputs past the history too. The two results
+ * are saturated and mixed, so the crossfade costs two filters but needs
+ * no buffer.
+ */
+static Void FIR_TI_genFade(XDAS_Int16 *hist, XDAS_Int16 *in, XDAS_Int16 *from, XDAS_Int16 *coeff, XDAS_Int16 *out, XDAS_Int16 nHist, XDAS_Int16 nout, XDAS_Int16 pos, XDAS_Int16 len)
+{
+    XDAS_Int16  i, j;
+    FIR_TI_Accum sumFrom, sum;
+    XDAS_Int32  x;
+
+    for (j = 0; j < nout; j++) 
+    {
+        sumFrom = sum = 0;
+        for (i = 0; i < nHist - j; i++) 
+        {
+            x = hist[i + j];
+            sumFrom += x * (XDAS_Int32)(from[i]);
+            sum += x * (XDAS_Int32)(coeff[i]);
+        }
+        for (; i <= nHist; i++) 
+        {
+            x = in[i + j - nHist];
+            sumFrom += x * (XDAS_Int32)(from[i]);
+            sum += x * (XDAS_Int32)(coeff[i]);
+        }
+        out[j] = FIR_TI_mix(FIR_TI_sat(sumFrom, 0), FIR_TI_sat(sum, 0), pos + j + 1, len);
+    }
+}
+
+
+/*
+ *======== FIR_TI_genMulti ========
+ *
+ * in = array of numChans input arrays
+ * coeff = coefficient array shared by all channels
+ * out = array of numChans output arrays
+ * nCoeff = number of coefficients
+ * nout = number of output samples per channel (nout >= 1)
+ * numChans = number of channels (numChans <= MAXBATCH)
+ *
+ * Computes the same direct-form filter as FIR_TI_genBlk on several
+ * channels at once. The channels are interleaved in the inner loop, so
+ * each coefficient is loaded once and used for every channel. The products
+ * of each output are summed in the same order as on a single channel.
+ */
+static Void FIR_TI_genMulti(Short *in[], Short *coeff, Short *out[], XDAS_Int16 nCoeff, XDAS_Int16 nout, XDAS_Int16 numChans)
+{
+    XDAS_Int16  i, j, k;
+    XDAS_Int32  sum[MAXBATCH];
+    XDAS_Int32  c;
+
+    for (j = 0; j < nout; j++) 
+    {
+        for (k = 0; k < numChans; k++)
+            sum[k] = 0;
+        for (i = 0; i < nCoeff; i++) 
+        {
+            c = coeff[i];
+            for (k = 0; k < numChans; k++)
+                sum[k] += (XDAS_Int32)(in[k][i + j]) * c;
+        }
+        for (k = 0; k < numChans; k++)
+            out[k][j] = sum[k] >> 15;
+    }
+}
+
+
+/*
+ *======== FIR_TI_save ========
+ *
+ * Appends the end of n new input samples to the persistent history of an
+ * instance that is not active.
+ */
+static Void FIR_TI_save(FIR_TI_Obj *fir, Short in[], Int n)
+{
+    Short   *history = fir->history;
+    Int     nHist = fir->filterLenM1;
+
+    if (n >= nHist) 
+    {
+        memcpy((Void *)history, (Void *)(in + n - nHist), nHist * sizeof (Short));
+    }
+    else 
+    {
+        memmove((Void *)history, (Void *)(history + n), (nHist - n) * sizeof (Short));
+        memcpy((Void *)(history + nHist - n), (Void *)in, n * sizeof (Short));
+    }
+}
+
+
+/*
+ *======== FIR_TI_update ========
+ *
+ * Appends the end of the new frame to the delay line. The delay line holds
+ * every sample twice, filterLenM1 samples apart, so the history always
+ * starts at workBuf + histIndex and is contiguous without ever being moved.
+ */
+static Void FIR_TI_update(FIR_TI_Obj *fir, Short in[])
+{
+    Short   *delay = fir->workBuf;
+    Int     nHist = fir->filterLenM1;
+    Int     n = fir->frameLen;
+    Int     idx = fir->histIndex;
+    Int     i;
+
+    if (n >= nHist) 
+    {
+        /* the frame replaces the whole history */
+        memcpy((Void *)delay, (Void *)(in + n - nHist), nHist * sizeof (Short));
+        memcpy((Void *)(delay + nHist), (Void *)delay, nHist * sizeof (Short));
+        idx = 0;
+    }
+    else 
+    {
+        for (i = 0; i < n; i++) 
+        {
+            delay[idx] = in[i];
+            delay[idx + nHist] = in[i];
+            if (++idx == nHist)
+                idx = 0;
+        }
+    }
+
+    fir->histIndex = idx;
+}
         
     
+/*
+ *======== FIR_TI_gen ========
+ *
+ * Computes n outputs from the nHist samples of history at hist (oldest
+ * first) and the n new samples at in, accumulating as the instance was
+ * created to. The symmetric fold is only used by IFIR_ACCUM32.
+ */
+static Void FIR_TI_gen(FIR_TI_Obj *fir, Short hist[], Short in[], Short out[], Int n)
+{
+    Int nHist = fir->filterLenM1;
+    Int nFirst = (n < nHist) ? n : nHist;
+    XDAS_Int16 shift;
+
+    switch (fir->accum) 
+    {
+        case IFIR_ACCUMWIDE:
+            FIR_TI_genHistWide(hist, in, fir->bank.coeff, out, nHist, nFirst);
+            if (n > nHist)
+                FIR_TI_genBlkWide(in, fir->bank.coeff, out + nHist, nHist + 1, n - nHist);
+            break;
+
+        case IFIR_ACCUMBLOCK:
+            shift = FIR_TI_exponent(hist, in, nHist, n, fir->bank.gain);
+            FIR_TI_genHistBfp(hist, in, fir->bank.coeff, out, nHist, nFirst, shift);
+            if (n > nHist)
+                FIR_TI_genBlkBfp(in, fir->bank.coeff, out + nHist, nHist + 1, n - nHist, shift);
+            break;
+
+        default:
+            /* outputs whose input window starts in the saved history */
+            FIR_TI_genHist(hist, in, fir->bank.coeff, out, nHist, nFirst);
+
+            /* outputs whose input window lies within the new frame */
+            if (n > nHist) 
+            {
+                if (fir->bank.symmetric)
+                    FIR_TI_genSym(in, fir->bank.coeff, out + nHist, nHist + 1, n - nHist);
+                else
+                    FIR_TI_genBlk(in, fir->bank.coeff, out + nHist, nHist + 1, n - nHist);
+            }
+            break;
+    }
+}
+
+
+/*
+ *======== FIR_TI_swap ========
+ *
+ * At a frame boundary, makes the staged coefficients current, and starts
+ * the crossfade to them if one was asked for. Only the banks are swapped:
+ * everything the filter needs was derived when they were staged.
+ */
+static Void FIR_TI_swap(FIR_TI_Obj *fir)
+{
+    FIR_TI_Bank bank;
+
+    if (fir->staged && (fir->framePos == 0)) 
+    {
+        bank = fir->bank;
+        fir->bank = fir->other;
+        fir->other = bank;
+        fir->staged = FALSE;
+        fir->fadePos = (fir->fade && (fir->other.coeff != NULL)) ? 0 : fir->frameLen;
+    }
+}
+
+
+/*
+ *======== FIR_TI_fade ========
+ *
+ * Computes n outputs of the crossfade from the coefficients in other to
+ * those in bank. When the instance is active, fast convolution filters
+ * with each bank in turn, the output being faded out going to the 
+ * scratch fadeBuf; otherwise both are computed in direct form.
+ */
+static Void FIR_TI_fade(FIR_TI_Obj *fir, Short hist[], Short in[], Short out[], Int n, Bool active)
+{
+    Int j;
+
+    if (active && (fir->fftLen != 0)) 
+    {
+        FIR_TI_filterFft(fir, &fir->other, hist, in, fir->fadeBuf, n);
+        FIR_TI_filterFft(fir, &fir->bank, hist, in, out, n);
+        for (j = 0; j < n; j++)
+            out[j] = FIR_TI_mix(fir->fadeBuf[j], out[j], fir->fadePos + j + 1, fir->frameLen);
+    }
+    else 
+    {
+        FIR_TI_genFade(hist, in, fir->other.coeff, fir->bank.coeff, out, fir->filterLenM1, n, fir->fadePos, fir->frameLen);
+    }
+
+    fir->fadePos += n;
+}
+
+
 /*
  *  ======== FIR_TI_filter ========
- *  TI's implementation of the filter operation.
+ *  TI's implementation of the filter operation. Instances created with an
+ *  FFT length filter by fast convolution, in the scratch transform buffer.
+ *  Staged coefficients take effect here, at the start of the frame.
+ *  The kernels write outputs before they have read all of the frame, so a
+ *  frame filtered in place is first copied to the end of the working 
+ *  buffer.
  */    
 Void FIR_TI_filter(IFIR_Handle handle, Short in[], Short out[])
 {
     FIR_TI_Obj *fir = (Void *)handle;
-    Short *src = fir->workBuf;
-    Short *dst = out;
+    Short *hist = fir->workBuf + fir->histIndex;
+    Short *copy = fir->workBuf + 2 * fir->filterLenM1;
+    
+    if ((in < out + fir->frameLen) && (out < in + fir->frameLen)) 
+    {
+        memcpy((Void *)copy, (Void *)in, fir->frameLen * sizeof (Short));
+        in = copy;
+    }
+
+    FIR_TI_swap(fir);
+
+    if (fir->fadePos < fir->frameLen) 
+    {
+        FIR_TI_fade(fir, hist, in, out, fir->frameLen, TRUE);
+    }
+    else if (fir->fftLen != 0) 
+    {
+        FIR_TI_filterFft(fir, &fir->bank, hist, in, out, fir->frameLen);
+    }
+    else 
+    {
+        FIR_TI_gen(fir, hist, in, out, fir->frameLen);
+    }
+
+    /* save the end of the frame as history for the next frame */
+    FIR_TI_update(fir, in);
+}
+
+
+/*
+ *  ======== FIR_TI_filterBlock ========
+ *  TI's implementation of the filter operation on part of a frame. Filters
+ *  n samples on an inactive instance, working on its persistent history.
+ *  There is no transform buffer outside activation, so this is always the
+ *  direct form, as is FIR_TI_filterMulti. Staged coefficients take effect
+ *  at the first block of a frame, and a crossfade spans the frame's 
+ *  blocks; a block must not straddle two frames.
+ */    
+Void FIR_TI_filterBlock(IFIR_Handle handle, Short in[], Short out[], Int n)
+{
+    FIR_TI_Obj *fir = (Void *)handle;
     
-    /* copy input buffer into working buffer */
-    memcpy((Void *)(fir->workBuf + fir->filterLenM1), (Void *)in, fir->frameLen * sizeof (Short));
+    FIR_TI_swap(fir);
+
+    if (fir->fadePos < fir->frameLen) 
+    {
+        FIR_TI_fade(fir, fir->history, in, out, n, FALSE);
+    }
+    else 
+    {
+        FIR_TI_gen(fir, fir->history, in, out, n);
+    }
+
+    /* save the end of the block as history for the next one */
+    FIR_TI_save(fir, in, n);
+
+    fir->framePos += n;
+    if (fir->framePos >= fir->frameLen) 
+    {
+        fir->framePos = 0;
+    }
+}
+
+
+/*
+ *  ======== FIR_TI_filterBatch ========
+ *  Filters one frame on each of numChans inactive instances that share
+ *  their coefficients, filter length, frame length and accumulation. Only
+ *  IFIR_ACCUM32 has a multi-channel kernel; the other modes, and an
+ *  instance in a crossfade, filter each channel in turn.
+ */
+static Void FIR_TI_filterBatch(IFIR_Handle handles[], Short *in[], Short *out[], Int numChans)
+{
+    FIR_TI_Obj *fir = (Void *)handles[0];
+    Short *outMain[MAXBATCH];
+    Int nHist = fir->filterLenM1;
+    Int nout = fir->frameLen;
+    Int k;
 
-    /* call fir_gen to filter data */
-    FIR_TI_gen(src, fir->coeff, dst, fir->filterLenM1 + 1, fir->frameLen);
+    if ((fir->accum != IFIR_ACCUM32) || (fir->fadePos < nout)) 
+    {
+        for (k = 0; k < numChans; k++)
+            FIR_TI_filterBlock(handles[k], in[k], out[k], nout);
+        return;
+    }
 
-    /* shift filter history to beginning of working buffer for next frame */
-    memcpy((Void *)fir->workBuf, (Void *)(fir->workBuf + fir->frameLen), fir->filterLenM1 * sizeof (Short));
+    /* outputs whose input window starts in the saved history */
+    for (k = 0; k < numChans; k++) 
+    {
+        fir = (Void *)handles[k];
+        FIR_TI_genHist(fir->history, in[k], fir->bank.coeff, out[k], nHist, (nout < nHist) ? nout : nHist);
+        outMain[k] = out[k] + nHist;
+    }
+
+    /* outputs whose input window lies within the new frame */
+    if (nout > nHist) 
+    {
+        FIR_TI_genMulti(in, fir->bank.coeff, outMain, nHist + 1, nout - nHist, numChans);
+    }
+
+    /* save the end of each frame as history for the next frame */
+    for (k = 0; k < numChans; k++) 
+    {
+        FIR_TI_save((Void *)handles[k], in[k], nout);
+    }
+}
+
+
+/*
+ *  ======== FIR_TI_filterMulti ========
+ *  TI's implementation of the multi-channel filter operation. Consecutive
+ *  instances that share their coefficients and sizes are filtered
+ *  together, up to MAXBATCH at a time.
+ */
+Void FIR_TI_filterMulti(IFIR_Handle handles[], Short *in[], Short *out[], Int numChans)
+{
+    FIR_TI_Obj *first;
+    FIR_TI_Obj *fir;
+    Int start, n;
+
+    /* a new frame for every instance: staged coefficients take effect */
+    for (start = 0; start < numChans; start++) 
+    {
+        FIR_TI_swap((Void *)handles[start]);
+    }
+
+    for (start = 0; start < numChans; start += n) 
+    {
+        first = (Void *)handles[start];
+        for (n = 1; (n < MAXBATCH) && (start + n < numChans); n++) 
+        {
+            fir = (Void *)handles[start + n];
+            if ((fir->bank.coeff != first->bank.coeff) || (fir->filterLenM1 != first->filterLenM1) || (fir->frameLen != first->frameLen) || (fir->accum != first->accum) || (fir->fadePos < fir->frameLen) || (first->fadePos < first->frameLen))
+            {
+                break;
+            }
+        }
+        FIR_TI_filterBatch(&handles[start], &in[start], &out[start], n);
+    }
 }
 
 
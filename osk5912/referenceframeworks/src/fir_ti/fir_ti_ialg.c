@@ -30,7 +30,15 @@
 #define     OBJECT      0
 #define     HISTORY     1
 #define     WORKBUF     2
-#define     NUMBUFS     3
+#define     SPECTRUM    3
+#define     TWIDDLE     4
+#define     FFTBUF      5
+#define     NUMBUFS     3           /* direct form */
+#define     NUMFFTBUFS  6           /* fast convolution */
+
+static Bool FIR_TI_isSymmetric(Short *coeff, Int filterLen);
+static LgUns FIR_TI_gain(Short *coeff, Int filterLen);
+static Void FIR_TI_setBank(FIR_TI_Obj *fir, FIR_TI_Bank *bank, Short *coeff);
 
 
 /*
@@ -42,8 +50,10 @@ Void FIR_TI_activate(IALG_Handle handle)
 {
     FIR_TI_Obj *fir = (Void *)handle;
     
-    /* copy saved history to working buffer */
+    /* copy saved history to both halves of the working buffer */
     memcpy((Void *)fir->workBuf, (Void *)fir->history, fir->filterLenM1 * sizeof(Short));
+    memcpy((Void *)(fir->workBuf + fir->filterLenM1), (Void *)fir->history, fir->filterLenM1 * sizeof(Short));
+    fir->histIndex = 0;
 }
 
 /*
@@ -54,6 +64,7 @@ Void FIR_TI_activate(IALG_Handle handle)
 Int FIR_TI_alloc(const IALG_Params *firParams, IALG_Fxns **fxns, IALG_MemRec memTab[])
 {
     const IFIR_Params *params = (Void *)firParams;
+    Int fftLen;
     
     if (params == NULL) 
     {
@@ -80,13 +91,46 @@ Int FIR_TI_alloc(const IALG_Params *firParams, IALG_Fxns **fxns, IALG_MemRec mem
     memTab[HISTORY].space       = IALG_EXTERNAL;
     memTab[HISTORY].attrs       = IALG_PERSIST;
 
-    /* Request memory for shared working buffer */
-    memTab[WORKBUF].size        =  (params->filterLen - 1 + params->frameLen) * sizeof(Short);
+    /*
+     *  Request memory for shared working buffer; the history is kept
+     *  twice so that it can be used as a circular delay line without
+     *  ever being moved, followed by room for a frame filtered in place.
+     */
+    memTab[WORKBUF].size        =  (2 * (params->filterLen - 1) + params->frameLen) * sizeof(Short);
     memTab[WORKBUF].alignment   = 2;
     memTab[WORKBUF].space       = IALG_DARAM0;
     memTab[WORKBUF].attrs       = IALG_SCRATCH;
+
+    /*
+     *  Request memory for fast convolution: the spectra of both banks of
+     *  coefficients and the twiddle factors persist, the transform 
+     *  buffer and the output of a crossfade are only used within a 
+     *  frame. The records are filled in for FIR_TI_free even when the 
+     *  direct form leaves them out; an invalid fftLen is reported by 
+     *  FIR_TI_initObj.
+     */
+    fftLen = FIR_TI_fftLen(params);
+    if (fftLen < 0) 
+    {
+        fftLen = 0;
+    }
+
+    memTab[SPECTRUM].size       = 4 * fftLen * sizeof(XDAS_Int32);
+    memTab[SPECTRUM].alignment  = 4;
+    memTab[SPECTRUM].space      = IALG_EXTERNAL;
+    memTab[SPECTRUM].attrs      = IALG_PERSIST;
+
+    memTab[TWIDDLE].size        = fftLen * sizeof(XDAS_Int16);
+    memTab[TWIDDLE].alignment   = 4;
+    memTab[TWIDDLE].space       = IALG_EXTERNAL;
+    memTab[TWIDDLE].attrs       = IALG_PERSIST;
+
+    memTab[FFTBUF].size         = 2 * fftLen * sizeof(XDAS_Int32) + params->frameLen * sizeof(Short);
+    memTab[FFTBUF].alignment    = 4;
+    memTab[FFTBUF].space        = IALG_DARAM0;
+    memTab[FFTBUF].attrs        = IALG_SCRATCH;
     
-    return (NUMBUFS);
+    return ((fftLen == 0) ? NUMBUFS : NUMFFTBUFS);
 }
 
 /*
@@ -98,11 +142,25 @@ Int FIR_TI_control(IFIR_Handle handle, IFIR_Cmd cmd, IFIR_Status *status)
 
     if (cmd == IFIR_SETSTATUS) 
     {
-        fir->coeff = status->coeffPtr;
+        FIR_TI_setBank(fir, &fir->bank, status->coeffPtr);
+        fir->staged = FALSE;
+        fir->fadePos = fir->frameLen;
+    }
+    else if (cmd == IFIR_STAGECOEFF) 
+    {
+        /* a crossfade still in progress needs other; it ends here */
+        fir->fadePos = fir->frameLen;
+        FIR_TI_setBank(fir, &fir->other, status->coeffPtr);
+        fir->fade = FIR_TI_HASSTATUS(status, crossfade) ? status->crossfade : FALSE;
+        fir->staged = TRUE;
     }
     else if (cmd == IFIR_GETSTATUS) 
     {
-        status->coeffPtr =  fir->coeff;
+        status->coeffPtr =  fir->bank.coeff;
+        if (FIR_TI_HASSTATUS(status, staged)) 
+        {
+            status->staged = fir->staged;
+        }
     }
     else {
         return (IALG_EFAIL);
@@ -121,7 +179,7 @@ Void FIR_TI_deactivate(IALG_Handle handle)
     FIR_TI_Obj *fir = (Void *)handle;
     
     /* copy history to external history buffer */
-    memcpy((Void *)fir->history, (Void *)fir->workBuf, fir->filterLenM1 * sizeof(Short));
+    memcpy((Void *)fir->history, (Void *)(fir->workBuf + fir->histIndex), fir->filterLenM1 * sizeof(Short));
 
 }
 
@@ -142,10 +200,25 @@ Int FIR_TI_free(IALG_Handle handle, IALG_MemRec memTab[])
     memTab[HISTORY].size        = fir->filterLenM1 * sizeof(Short);
     memTab[HISTORY].base        = fir->history;
 
-    memTab[WORKBUF].size        = (fir->filterLenM1 + fir->frameLen) * sizeof(Short);
+    memTab[WORKBUF].size        = (2 * fir->filterLenM1 + fir->frameLen) * sizeof(Short);
     memTab[WORKBUF].base        = fir->workBuf;
+
+    if (fir->fftLen == 0) 
+    {
+        return (NUMBUFS);
+    }
+
+    /* the banks swap spectra; the first one is at the base */
+    memTab[SPECTRUM].size       = 4 * fir->fftLen * sizeof(XDAS_Int32);
+    memTab[SPECTRUM].base       = (fir->bank.spectrum < fir->other.spectrum) ? fir->bank.spectrum : fir->other.spectrum;
+
+    memTab[TWIDDLE].size        = fir->fftLen * sizeof(XDAS_Int16);
+    memTab[TWIDDLE].base        = fir->twiddle;
+
+    memTab[FFTBUF].size         = 2 * fir->fftLen * sizeof(XDAS_Int32) + fir->frameLen * sizeof(Short);
+    memTab[FFTBUF].base         = fir->fftBuf;
     
-    return (NUMBUFS);
+    return (NUMFFTBUFS);
 }
 
 /*  ======== FIR_TI_initObj ========
@@ -163,9 +236,54 @@ Int FIR_TI_initObj(IALG_Handle handle, const IALG_MemRec memTab[], IALG_Handle p
 
     fir->workBuf        = memTab[WORKBUF].base;
     fir->history        = memTab[HISTORY].base;
-    fir->coeff          = params->coeffPtr;  
     fir->filterLenM1    = params->filterLen - 1;
     fir->frameLen       = params->frameLen;
+    fir->histIndex      = 0;
+    fir->staged         = FALSE;
+    fir->fade           = FALSE;
+    fir->fadePos        = fir->frameLen;
+    fir->framePos       = 0;
+
+    /* the filter starts from silence; only the object itself is cleared */
+    memset((Void *)fir->history, 0, fir->filterLenM1 * sizeof(Short));
+
+    /* callers built before accum existed pass a shorter structure */
+    if (FIR_TI_HASPARAM(params, accum)) 
+    {
+        fir->accum      = params->accum;
+    }
+    else 
+    {
+        fir->accum      = IFIR_ACCUM32;
+    }
+
+#if defined(_54_)
+    /* FIR_TI_Accum is only 32 bits wide here */
+    if (fir->accum == IFIR_ACCUMWIDE) 
+    {
+        return (IALG_EFAIL);
+    }
+#endif
+
+    fir->fftLen         = FIR_TI_fftLen(params);
+    if (fir->fftLen < 0) 
+    {
+        return (IALG_EFAIL);
+    }
+
+    /* FIR_TI_alloc only requested the fast convolution buffers if needed */
+    if (fir->fftLen != 0) 
+    {
+        fir->bank.spectrum  = memTab[SPECTRUM].base;
+        fir->other.spectrum = fir->bank.spectrum + 2 * fir->fftLen;
+        fir->twiddle        = memTab[TWIDDLE].base;
+        fir->fftBuf         = memTab[FFTBUF].base;
+        fir->fadeBuf        = (Short *)(fir->fftBuf + 2 * fir->fftLen);
+        FIR_TI_fftTwiddle(fir->twiddle, fir->fftLen);
+    }
+
+    FIR_TI_setBank(fir, &fir->bank, params->coeffPtr);
+    fir->other.coeff    = NULL;
     
     return (IALG_EOK);
 }
@@ -179,6 +297,23 @@ Void FIR_TI_moved(IALG_Handle handle, const IALG_MemRec memTab[], IALG_Handle p,
 
     fir->workBuf = memTab[WORKBUF].base;
     fir->history = memTab[HISTORY].base;
+
+    if (fir->fftLen != 0) 
+    {
+        if (fir->bank.spectrum < fir->other.spectrum) 
+        {
+            fir->bank.spectrum = memTab[SPECTRUM].base;
+            fir->other.spectrum = fir->bank.spectrum + 2 * fir->fftLen;
+        }
+        else 
+        {
+            fir->other.spectrum = memTab[SPECTRUM].base;
+            fir->bank.spectrum = fir->other.spectrum + 2 * fir->fftLen;
+        }
+        fir->twiddle = memTab[TWIDDLE].base;
+        fir->fftBuf = memTab[FFTBUF].base;
+        fir->fadeBuf = (Short *)(fir->fftBuf + 2 * fir->fftLen);
+    }
 }
 
 /*  ======== FIR_TI_numAlloc ========
@@ -186,7 +321,69 @@ Void FIR_TI_moved(IALG_Handle handle, const IALG_MemRec memTab[], IALG_Handle p,
  */
 Int FIR_TI_numAlloc()
 {
-    return(NUMBUFS);
+    return(NUMFFTBUFS);
+}
+
+/*  ======== FIR_TI_setBank ========
+ *  Makes coeff the coefficients of bank, and derives from them what the
+ *  filter needs; the spectrum, for fast convolution, is the costly part.
+ */
+static Void FIR_TI_setBank(FIR_TI_Obj *fir, FIR_TI_Bank *bank, Short *coeff)
+{
+    bank->coeff = coeff;
+    bank->symmetric = FIR_TI_isSymmetric(coeff, fir->filterLenM1 + 1);
+    bank->gain = FIR_TI_gain(coeff, fir->filterLenM1 + 1);
+
+    if (fir->fftLen != 0) 
+    {
+        FIR_TI_fftCoeff(fir, bank);
+    }
+}
+
+/*  ======== FIR_TI_isSymmetric ========
+ *  Returns TRUE if the coefficients are symmetric around their centre,
+ *  which lets the filter fold pairs of taps into a single multiply.
+ */
+static Bool FIR_TI_isSymmetric(Short *coeff, Int filterLen)
+{
+    Int i;
+
+    if (coeff == NULL) 
+    {
+        return (FALSE);
+    }
+
+    for (i = 0; i < filterLen / 2; i++) 
+    {
+        if (coeff[i] != coeff[filterLen - 1 - i]) 
+        {
+            return (FALSE);
+        }
+    }
+
+    return (TRUE);
 }
 
+/*  ======== FIR_TI_gain ========
+ *  Returns the sum of the magnitudes of the coefficients, the largest 
+ *  factor by which the filter can amplify its input, which sets the block
+ *  exponent of IFIR_ACCUMBLOCK.
+ */
+static LgUns FIR_TI_gain(Short *coeff, Int filterLen)
+{
+    LgUns gain = 0;
+    Int i;
+
+    if (coeff == NULL) 
+    {
+        return (0);
+    }
+
+    for (i = 0; i < filterLen; i++) 
+    {
+        gain += (coeff[i] < 0) ? -(LgInt)coeff[i] : coeff[i];
+    }
+
+    return (gain);
+}
 
@@ -22,6 +22,8 @@
 #define FIR_TI_PRIV_
  
 #include    <std.h>
+#include    <stddef.h>
+#include    <xdas.h>
 
 #include    "ifir.h"
 #include    "fir_ti.h"
@@ -30,18 +32,83 @@
 extern "C" {
 #endif
 
+/*
+ *  ======== FIR_TI_Accum ========
+ *  Accumulator of IFIR_ACCUMWIDE: the native 40-bit accumulator type of
+ *  the C55x and C6000 compilers, and 64 bits on a host. The C54x compiler
+ *  has no C type wider than 32 bits, so FIR_TI_initObj refuses
+ *  IFIR_ACCUMWIDE there; the crossfade still sums in it.
+ */
+#if defined(_6x_)
+typedef long FIR_TI_Accum;
+#elif defined(_55_)
+typedef long long FIR_TI_Accum;
+#elif defined(_54_)
+typedef long FIR_TI_Accum;
+#else
+typedef long long FIR_TI_Accum;
+#endif
+
+/*
+ *  ======== FIR_TI_HASPARAM, FIR_TI_HASSTATUS ========
+ *  TRUE if the caller's IFIR_Params or IFIR_Status, going by its size, 
+ *  includes field.
+ */
+#define FIR_TI_HASPARAM(params, field) \
+    ((params)->size >= (Int)(offsetof(IFIR_Params, field) + sizeof((params)->field)))
+#define FIR_TI_HASSTATUS(status, field) \
+    ((status)->size >= (Int)(offsetof(IFIR_Status, field) + sizeof((status)->field)))
+
+/*
+ *  ======== FIR_TI_Bank ========
+ *  A set of coefficients, and what the filter derives from them. An 
+ *  instance has two: the current one, and the one staged to replace it 
+ *  at the next frame boundary, or the one it replaced while it fades out.
+ */
+typedef struct FIR_TI_Bank {
+    Short       *coeff;         /* on-chip persistant coeff */
+    Bool        symmetric;      /* coeff is symmetric around its centre */
+    LgUns       gain;           /* sum of the magnitudes of coeff */
+    XDAS_Int32  *spectrum;      /* persistent spectrum of coeff */
+    Int         specExp;        /* exponent of spectrum */
+} FIR_TI_Bank;
+
 /*
  *  ======== FIR_TI_Obj ========
  */
 typedef struct FIR_TI_Obj {
     IALG_Obj    alg;            /* MUST be first field of all FIR objs */
-    Short       *workBuf;       /* on-chip scratch history */
+    Short       *workBuf;       /* on-chip scratch history, stored twice,
+                                   then a copy of a frame filtered in place */
     Short       *history;       /* off chip presistant history */
-    Short       *coeff;         /* on-chip persistant coeff */
+    FIR_TI_Bank bank;           /* current coefficients */
+    FIR_TI_Bank other;          /* staged or fading out coefficients */
+    Bool        staged;         /* other replaces bank at the next frame */
+    Bool        fade;           /* ... and is crossfaded to over a frame */
+    Int         fadePos;        /* samples of the crossfade done */
+    Int         framePos;       /* samples of the frame done, by blocks */
     Int         filterLenM1;    /* length of coefficient array - 1 */
     Int         frameLen;       /* length of input (output) buffer */
+    Int         histIndex;      /* start of the history in workBuf */
+    IFIR_Accum  accum;          /* how the products are accumulated */
+    Int         fftLen;         /* fast convolution length, 0 if direct */
+    XDAS_Int16  *twiddle;       /* persistent FFT twiddle factors */
+    XDAS_Int32  *fftBuf;        /* on-chip scratch transform buffer */
+    Short       *fadeBuf;       /* on-chip scratch, output fading out */
 } FIR_TI_Obj;
 
+/* FFT length for params: 0 for direct form, IALG_EFAIL if invalid */
+extern Int FIR_TI_fftLen(const IFIR_Params *params);
+
+/* Fill in the twiddle factors of an FFT of n points */
+extern Void FIR_TI_fftTwiddle(XDAS_Int16 *twiddle, Int n);
+
+/* Compute the spectrum of a bank's coefficients for fast convolution */
+extern Void FIR_TI_fftCoeff(FIR_TI_Obj *fir, FIR_TI_Bank *bank);
+
+/* Filter n samples by fast convolution; the instance must be active */
+extern Void FIR_TI_filterFft(FIR_TI_Obj *fir, FIR_TI_Bank *bank, Short hist[], Short in[], Short out[], Int n);
+
 #ifdef __cplusplus
 }
 #endif /* extern "C" */
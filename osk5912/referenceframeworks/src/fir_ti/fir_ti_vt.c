@@ -40,6 +40,8 @@ extern Int  FIR_TI_initObj(IALG_Handle, const IALG_MemRec *, IALG_Handle, const
 extern Void FIR_TI_moved(IALG_Handle, const IALG_MemRec *, IALG_Handle, const IALG_Params *);
 extern Int  FIR_TI_numAlloc(Void);
 extern Void FIR_TI_filter(IFIR_Handle handle, Short in[], Short out[]);
+extern Void FIR_TI_filterMulti(IFIR_Handle handles[], Short *in[], Short *out[], Int numChans);
+extern Void FIR_TI_filterBlock(IFIR_Handle handle, Short in[], Short out[], Int n);
 
 #define IALGFXNS                                                 \
     &FIR_TI_IALG,       /* module ID */                          \
@@ -60,6 +62,8 @@ extern Void FIR_TI_filter(IFIR_Handle handle, Short in[], Short out[]);
 IFIR_Fxns FIR_TI_IFIR = {   /* module_vendor_interface */
     IALGFXNS,
     FIR_TI_filter,
+    FIR_TI_filterMulti,
+    FIR_TI_filterBlock,
 };
 
 /*
@@ -68,7 +72,14 @@ IFIR_Fxns FIR_TI_IFIR = {   /* module_vendor_interface */
  *  for the FIR_TI module.
  */
 
+#ifdef _HOST_
+/* the host assembler has no .set; duplicate the structure, as below */
+IALG_Fxns FIR_TI_IALG = {
+    IALGFXNS
+};
+#else
 asm("_FIR_TI_IALG .set _FIR_TI_IFIR");
+#endif
 
 /*
  *  We could have also duplicate the structure here to allow this code to be 
@@ -0,0 +1,91 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== ilv_join.c ========
+ */
+
+#pragma CODE_SECTION(ILV_join, ".text:ILV_join")
+#pragma CODE_SECTION(joinStereo, ".text:ILV_join")
+#pragma CODE_SECTION(joinStride, ".text:ILV_join")
+
+#include <std.h>
+
+#include <string.h>
+
+#include <ilv.h>
+
+static Void joinStereo(Short *left, Short *right, Short *dst, Uns frameLen);
+static Void joinStride(Short *src, Short *dst, Uns stride, Uns frameLen);
+
+/*
+ *  ======== ILV_join ========
+ */
+Void ILV_join(Short *src[], Uns srcCnt, Short *dst, Uns dstChans, 
+              Uns frameLen)
+{
+    Uns d;
+
+    if (dstChans == 1) {
+        memcpy(dst, src[0], frameLen * sizeof(Short));
+    }
+    else if (dstChans == 2) {
+        joinStereo(src[0], src[1 % srcCnt], dst, frameLen);
+    }
+    else {
+        for (d = 0; d < dstChans; d++) {
+            joinStride(src[d % srcCnt], dst + d, dstChans, frameLen);
+        }
+    }
+}
+
+/*
+ *  ======== joinStereo ========
+ *  Single pass over a stereo frame, two sample pairs per iteration.
+ */
+static Void joinStereo(Short *left, Short *right, Short *dst, Uns frameLen)
+{
+    Uns i;
+
+    for (i = frameLen >> 1; i > 0; i--) {
+        *dst++ = *left++;
+        *dst++ = *right++;
+        *dst++ = *left++;
+        *dst++ = *right++;
+    }
+
+    if (frameLen & 1) {
+        *dst++ = *left;
+        *dst   = *right;
+    }
+}
+
+/*
+ *  ======== joinStride ========
+ *  Writes src to every stride-th sample of dst, four samples per iteration.
+ */
+static Void joinStride(Short *src, Short *dst, Uns stride, Uns frameLen)
+{
+    Uns i;
+
+    for (i = frameLen >> 2; i > 0; i--) {
+        *dst = *src++;
+        dst += stride;
+        *dst = *src++;
+        dst += stride;
+        *dst = *src++;
+        dst += stride;
+        *dst = *src++;
+        dst += stride;
+    }
+
+    for (i = frameLen & 3; i > 0; i--) {
+        *dst = *src++;
+        dst += stride;
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== ilv_split.c ========
+ */
+
+#pragma CODE_SECTION(ILV_split, ".text:ILV_split")
+#pragma CODE_SECTION(splitStereo, ".text:ILV_split")
+#pragma CODE_SECTION(splitStride, ".text:ILV_split")
+
+#include <std.h>
+
+#include <string.h>
+
+#include <ilv.h>
+
+static Void splitStereo(Short *src, Short *left, Short *right, Uns frameLen);
+static Void splitStride(Short *src, Uns stride, Short *dst, Uns frameLen);
+
+/*
+ *  ======== ILV_split ========
+ *  Channels that come straight from the frame are deinterleaved first;
+ *  channels beyond srcChans repeat an earlier one, so they are copied 
+ *  from its contiguous buffer instead of walking the frame again.
+ */
+Void ILV_split(Short *src, Uns srcChans, Short *dst[], Uns dstCnt, 
+               Uns frameLen)
+{
+    Uns c;
+    Uns splitCnt = (dstCnt < srcChans) ? dstCnt : srcChans;
+
+    if (srcChans == 1) {
+        memcpy(dst[0], src, frameLen * sizeof(Short));
+    }
+    else if (splitCnt == 2 && srcChans == 2) {
+        splitStereo(src, dst[0], dst[1], frameLen);
+    }
+    else {
+        for (c = 0; c < splitCnt; c++) {
+            splitStride(src + c, srcChans, dst[c], frameLen);
+        }
+    }
+
+    for (c = splitCnt; c < dstCnt; c++) {
+        memcpy(dst[c], dst[c - srcChans], frameLen * sizeof(Short));
+    }
+}
+
+/*
+ *  ======== splitStereo ========
+ *  Single pass over a stereo frame, two sample pairs per iteration.
+ */
+static Void splitStereo(Short *src, Short *left, Short *right, Uns frameLen)
+{
+    Uns i;
+
+    for (i = frameLen >> 1; i > 0; i--) {
+        *left++  = *src++;
+        *right++ = *src++;
+        *left++  = *src++;
+        *right++ = *src++;
+    }
+
+    if (frameLen & 1) {
+        *left  = *src++;
+        *right = *src;
+    }
+}
+
+/*
+ *  ======== splitStride ========
+ *  Copies every stride-th sample of src, four samples per iteration.
+ */
+static Void splitStride(Short *src, Uns stride, Short *dst, Uns frameLen)
+{
+    Uns i;
+
+    for (i = frameLen >> 2; i > 0; i--) {
+        *dst++ = *src;
+        src += stride;
+        *dst++ = *src;
+        src += stride;
+        *dst++ = *src;
+        src += stride;
+        *dst++ = *src;
+        src += stride;
+    }
+
+    for (i = frameLen & 3; i > 0; i--) {
+        *dst++ = *src;
+        src += stride;
+    }
+}
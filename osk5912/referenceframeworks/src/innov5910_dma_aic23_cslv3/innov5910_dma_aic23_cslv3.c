@@ -305,6 +305,13 @@ static Int mdCreateChan(Ptr *chanp, Ptr devp, String name, Int mode,
         return (IOM_EBADMODE);
     }
 
+    /* 
+     *  Frames are transferred interleaved, as the codec delivers them, and
+     *  the port keeps running on silence if the application is late.
+     */
+    genericChanParams.sortChans = 0;
+    genericChanParams.continuous = TRUE;
+
     return (C55XX_DMA_MCBSP_CSLV3_FXNS.mdCreateChan(chanp, devp, name, mode,
         &genericChanParams, cbFxn, cbArg));
 }
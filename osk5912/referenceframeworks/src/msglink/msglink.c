@@ -9,6 +9,16 @@
 /*
  *  ======== msglink.c ========
  *  Messaging on top of Link's channels.
+ *
+ *  A copying link copies each fixed-size message into or out of one of
+ *  its transfer buffers and moves one message per channel transfer.
+ *
+ *  A zero-copy link hands out space in its transfer buffers instead: the
+ *  sender builds its messages in place and the receiver reads them in 
+ *  place. The messages are packed one after the other in the buffer, each
+ *  behind a header giving its size and aligned on MSGLINK_ALIGN, and the
+ *  whole buffer goes in one channel transfer. A header with size 0 ends
+ *  the messages when the buffer is not full.
  */
 
 /* separate section placement of MSGLINK functions */
@@ -18,9 +28,14 @@
 #pragma CODE_SECTION( MSGLINK_delete,   ".text:delete"       )
 #pragma CODE_SECTION( MSGLINK_send,     ".text:MSGLINK_send" )
 #pragma CODE_SECTION( MSGLINK_recv,     ".text:MSGLINK_recv" )
+#pragma CODE_SECTION( MSGLINK_alloc,    ".text:MSGLINK_alloc" )
+#pragma CODE_SECTION( MSGLINK_put,      ".text:MSGLINK_put"  )
+#pragma CODE_SECTION( MSGLINK_flush,    ".text:MSGLINK_flush" )
+#pragma CODE_SECTION( MSGLINK_get,      ".text:MSGLINK_get"  )
 
 
 #include <std.h>
+#include <string.h>
 
 /* BIOS Header files */
 #include <mem.h>
@@ -34,11 +49,22 @@
 #define INPUTDEVNAME  "/dio_dsplink14"
 #define OUTPUTDEVNAME "/dio_dsplink15"
 
+/* Round n up to the message alignment */
+#define ALIGN( n )  (((n) + MSGLINK_ALIGN - 1) & ~(MSGLINK_ALIGN - 1))
+
+/* Size of the header in front of each message of a zero-copy link */
+#define HDRSIZE     ALIGN( sizeof( MdUns ) )
+
 /*
  *  Structure that stores the state information for the channels
  *  that are being used for messaging.
  *  Note the actual messages buffers are in this structure.  Currently
  *  doing this for simplicity.
+ *
+ *  On a zero-copy link, curBuf is the transfer buffer being filled 
+ *  (output) or read (input), NULL if none; curPos is the offset of the 
+ *  next message header in it and curLen the size of its contents. 
+ *  allocMsg is the message allocated but not yet put.
  */
 typedef struct ChanObj {
     Bool            inUse;
@@ -46,8 +72,19 @@ typedef struct ChanObj {
     Uns             primedBufs;
     MdUns           bufSize;
     Ptr             bufs[MSGLINK_NUMBUFS];
+    MSGLINK_Attrs   attrs;
+    Char           *curBuf;
+    MdUns           curPos;
+    MdUns           curLen;
+    Ptr             allocMsg;
 } ChanObj, *ChanHandle;
 
+/* Default link attributes */
+MSGLINK_Attrs MSGLINK_ATTRS = {
+    FALSE,      /* zeroCopy: copy one fixed-size message per transfer */
+    0           /* segid: default BIOS segment */
+};
+
 /*
  *  Currently only supporting 1 input and 1 output message channel 
  *  for simplicity.  
@@ -55,6 +92,7 @@ typedef struct ChanObj {
 static ChanObj chanInput;
 static ChanObj chanOutput;
 
+static Int issueOutput( Void );
 
 /*
  *  ======== MSGLINK_init ========
@@ -81,9 +119,10 @@ Void MSGLINK_exit( Void )
  *  This function should only be called once for each
  *  mode.
  */
-Int MSGLINK_create( MSGLINK_Mode msglinkMode, MdUns msgSize, Uns timeout )
+Int MSGLINK_create( MSGLINK_Mode msglinkMode, MdUns msgSize, Uns timeout,
+                    MSGLINK_Attrs *attrs )
 {
-    SIO_Attrs  attrs;
+    SIO_Attrs  sioAttrs;
     ChanHandle chan;
     Char      *devName;
     Int        success = MSGLINK_SUCCESS;
@@ -94,6 +133,14 @@ Int MSGLINK_create( MSGLINK_Mode msglinkMode, MdUns msgSize, Uns timeout )
     UTL_assert( (msglinkMode == MSGLINK_INPUT) || 
                 (msglinkMode == MSGLINK_OUTPUT) );
 
+    if ( attrs == NULL ) {
+        attrs = &MSGLINK_ATTRS;
+    }
+
+    /* A zero-copy transfer buffer must hold a message and its header */
+    UTL_assert( !attrs->zeroCopy || 
+                (msgSize >= HDRSIZE + MSGLINK_ALIGN) );
+
     /*
      *  Set-up local variables accordingly depending whether it is
      *  input or output message link.
@@ -113,16 +160,16 @@ Int MSGLINK_create( MSGLINK_Mode msglinkMode, MdUns msgSize, Uns timeout )
     UTL_assert( chan->inUse == FALSE );
 
     /* Attributes for the stream creation */
-    attrs         = SIO_ATTRS;
-    attrs.nbufs   = MSGLINK_NUMBUFS;
-    attrs.segid   = 0;
-    attrs.align   = 0;
-    attrs.flush   = FALSE; // Allow pending messages to be sent.
-    attrs.model   = SIO_ISSUERECLAIM;
-    attrs.timeout = timeout;
+    sioAttrs         = SIO_ATTRS;
+    sioAttrs.nbufs   = MSGLINK_NUMBUFS;
+    sioAttrs.segid   = attrs->segid;
+    sioAttrs.align   = 0;
+    sioAttrs.flush   = FALSE; // Allow pending messages to be sent.
+    sioAttrs.model   = SIO_ISSUERECLAIM;
+    sioAttrs.timeout = timeout;
 
     /* Creating stream */
-    chan->hStream = SIO_create( devName, mode, msgSize, &attrs );
+    chan->hStream = SIO_create( devName, mode, msgSize, &sioAttrs );
     if ( chan->hStream == NULL ) {
         return( MSGLINK_FAILURE );
     }
@@ -134,12 +181,15 @@ Int MSGLINK_create( MSGLINK_Mode msglinkMode, MdUns msgSize, Uns timeout )
     chan->inUse      = TRUE;
     chan->primedBufs = 0;
     chan->bufSize    = msgSize;
+    chan->attrs      = *attrs;
+    chan->curBuf     = NULL;
+    chan->allocMsg   = NULL;
     for ( i = 0; i < MSGLINK_NUMBUFS; i++ ) {
         /*
-         *  Use the default BIOS segment id.  
-         *  No alignment needed 
+         *  Messages of a zero-copy link are aligned in the buffers 
          */
-        chan->bufs[i] = MEM_alloc( 0, chan->bufSize, 0 );
+        chan->bufs[i] = MEM_alloc( attrs->segid, chan->bufSize, 
+                                   attrs->zeroCopy ? MSGLINK_ALIGN : 0 );
         if ( chan->bufs[i] == MEM_ILLEGAL ) {
             success = MSGLINK_FAILURE;
         }
@@ -206,10 +256,16 @@ Int MSGLINK_delete( MSGLINK_Mode msglinkMode )
     /* Make sure this channel was already created. */
     UTL_assert( chan->inUse == TRUE );
 
+    /* Send the messages still in the output transfer buffer */
+    if ( (msglinkMode == MSGLINK_OUTPUT) && (chan->curBuf != NULL) &&
+         (chan->curPos > 0) ) {
+        issueOutput();
+    }
+
     /* Free the buffers allocated in the MSGLINK_create */
     for ( i = 0; i < MSGLINK_NUMBUFS; i++ ) {
         if ( chan->bufs[i] != MEM_ILLEGAL ) {
-            MEM_free( 0, chan->bufs[i], chan->bufSize );
+            MEM_free( chan->attrs.segid, chan->bufs[i], chan->bufSize );
         }
     }
 
@@ -241,8 +297,9 @@ Int MSGLINK_send( Ptr msg )
     Int nmadus;
     Ptr msgBuf;
 
-    /* Make sure the channel has been created. */
+    /* Make sure the channel has been created, as a copying link. */
     UTL_assert( chanOutput.inUse == TRUE );
+    UTL_assert( chanOutput.attrs.zeroCopy == FALSE );
 
     /* Validate parameter. */
     UTL_assert( msg != NULL );
@@ -289,8 +346,9 @@ Int MSGLINK_recv( Ptr msg )
     Int nmadus;
     Ptr msgBuf;
 
-    /* Make sure the channel has been created. */
+    /* Make sure the channel has been created, as a copying link. */
     UTL_assert( chanInput.inUse == TRUE );
+    UTL_assert( chanInput.attrs.zeroCopy == FALSE );
 
     /* Validate parameter. */
     UTL_assert( msg != NULL );
@@ -317,3 +375,211 @@ Int MSGLINK_recv( Ptr msg )
     return( MSGLINK_SUCCESS );
 }
 
+/*
+ *  ======== MSGLINK_alloc ========
+ *  Allocate a message in the output link's current transfer buffer.
+ *  When the message does not fit in what is left of the buffer, the 
+ *  buffer is sent first; a new buffer is reclaimed from the stream once
+ *  all have been issued, which blocks according to the timeout.
+ *  This function is not thread-safe.  Only one thread should be sending
+ *  at once.
+ */
+Ptr MSGLINK_alloc( MdUns size )
+{
+    Int nmadus;
+
+    /* Make sure the channel has been created, as a zero-copy link. */
+    UTL_assert( chanOutput.inUse == TRUE );
+    UTL_assert( chanOutput.attrs.zeroCopy == TRUE );
+
+    /* Only one message can be allocated at a time. */
+    UTL_assert( chanOutput.allocMsg == NULL );
+
+    /* Validate parameter: a size 0 header ends the messages. */
+    if ( (size == 0) || (HDRSIZE + ALIGN( size ) > chanOutput.bufSize) ) {
+        return( NULL );
+    }
+
+    /* Send the current buffer if the message does not fit in it */
+    if ( (chanOutput.curBuf != NULL) && 
+         (chanOutput.curPos + HDRSIZE + ALIGN( size ) > chanOutput.bufSize) ) {
+        if ( issueOutput() != MSGLINK_SUCCESS ) {
+            return( NULL );
+        }
+    }
+
+    if ( chanOutput.curBuf == NULL ) {
+
+        /* Use up all the un-issued buffers first */
+        if ( chanOutput.primedBufs < MSGLINK_NUMBUFS ) {
+            chanOutput.curBuf = chanOutput.bufs[chanOutput.primedBufs];
+            chanOutput.primedBufs++;
+        }
+        else {
+            /* Reclaim an empty buffer from output stream */
+            nmadus = SIO_reclaim( chanOutput.hStream, 
+                                  (Ptr *) &chanOutput.curBuf, NULL );
+            if ( nmadus < 0 ) {
+                chanOutput.curBuf = NULL;
+                return( NULL );
+            }
+        }
+        chanOutput.curPos = 0;
+    }
+
+    /* Write the header; the message follows it */
+    *(MdUns *)(chanOutput.curBuf + chanOutput.curPos) = size;
+    chanOutput.allocMsg = chanOutput.curBuf + chanOutput.curPos + HDRSIZE;
+
+    return( chanOutput.allocMsg );
+}
+
+/*
+ *  ======== MSGLINK_put ========
+ *  Hand over the message allocated by MSGLINK_alloc(). The transfer
+ *  buffer is sent as soon as it cannot take another message, otherwise
+ *  on MSGLINK_flush() or when a later message does not fit.
+ */
+Int MSGLINK_put( Ptr msg )
+{
+    MdUns size;
+
+    /* Make sure the channel has been created, as a zero-copy link. */
+    UTL_assert( chanOutput.inUse == TRUE );
+    UTL_assert( chanOutput.attrs.zeroCopy == TRUE );
+
+    /* Validate parameter. */
+    UTL_assert( (msg != NULL) && (msg == chanOutput.allocMsg) );
+
+    /* Move past the message */
+    size = *(MdUns *)(chanOutput.curBuf + chanOutput.curPos);
+    chanOutput.curPos += HDRSIZE + ALIGN( size );
+    chanOutput.allocMsg = NULL;
+
+    if ( chanOutput.curPos + HDRSIZE + MSGLINK_ALIGN > chanOutput.bufSize ) {
+        return( issueOutput() );
+    }
+
+    return( MSGLINK_SUCCESS );
+}
+
+/*
+ *  ======== MSGLINK_flush ========
+ *  Send the messages put in the current transfer buffer, if any.
+ */
+Int MSGLINK_flush( Void )
+{
+    /* Make sure the channel has been created, as a zero-copy link. */
+    UTL_assert( chanOutput.inUse == TRUE );
+    UTL_assert( chanOutput.attrs.zeroCopy == TRUE );
+
+    /* A message allocated but not put cannot be sent yet. */
+    UTL_assert( chanOutput.allocMsg == NULL );
+
+    if ( (chanOutput.curBuf == NULL) || (chanOutput.curPos == 0) ) {
+        return( MSGLINK_SUCCESS );
+    }
+
+    return( issueOutput() );
+}
+
+/*
+ *  ======== MSGLINK_get ========
+ *  Get the next message from the input link, in place in its transfer
+ *  buffer. Once all the messages of a buffer have been read, the buffer
+ *  is returned to the input stream and the next one is reclaimed, which
+ *  blocks according to the timeout. The message returned therefore stays
+ *  valid until the next call. A header that claims more than the rest of
+ *  the received data is corrupt: the rest of the buffer is dropped and
+ *  NULL is returned.
+ *  This function is not thread-safe.  Only one thread should be calling
+ *  this at once.
+ */
+Ptr MSGLINK_get( MdUns *size )
+{
+    Int   nmadus;
+    Int   status;
+    MdUns msgSize = 0;
+    Ptr   msg;
+
+    /* Make sure the channel has been created, as a zero-copy link. */
+    UTL_assert( chanInput.inUse == TRUE );
+    UTL_assert( chanInput.attrs.zeroCopy == TRUE );
+
+    /* Find the next header, moving on to the next buffer if needed */
+    while ( (chanInput.curBuf == NULL) ||
+            (chanInput.curPos + HDRSIZE > chanInput.curLen) ||
+            ((msgSize = *(MdUns *)(chanInput.curBuf + chanInput.curPos)) 
+             == 0) ) {
+
+        if ( chanInput.curBuf != NULL ) {
+
+            /* Return the empty buffer to the input stream */
+            status = SIO_issue( chanInput.hStream, chanInput.curBuf, 
+                                chanInput.bufSize, NULL );
+            chanInput.curBuf = NULL;
+            if ( status != SYS_OK ) {
+                return( NULL );
+            }
+        }
+
+        /*
+         *  Reclaim full buffer from input stream.  
+         *  Note the input stream was primed in the MSGLINK_create().
+         */
+        nmadus = SIO_reclaim( chanInput.hStream, 
+                              (Ptr *) &chanInput.curBuf, NULL );
+        if ( nmadus < 0 ) {
+            chanInput.curBuf = NULL;
+            return( NULL );
+        }
+        chanInput.curPos = 0;
+        chanInput.curLen = ((MdUns)nmadus < chanInput.bufSize) ? 
+                           (MdUns)nmadus : chanInput.bufSize;
+    }
+
+    /* 
+     *  The header comes from the GPP, so check at run time that the message
+     *  lies within what was received; the loop above leaves room for it.
+     */
+    if ( msgSize > chanInput.curLen - chanInput.curPos - HDRSIZE ) {
+        UTL_logError2( "MSGLINK_get(): message of %d MADUs at %d overruns "
+            "the buffer", msgSize, chanInput.curPos );
+        chanInput.curPos = chanInput.curLen;
+        return( NULL );
+    }
+
+    msg = chanInput.curBuf + chanInput.curPos + HDRSIZE;
+    chanInput.curPos += HDRSIZE + ALIGN( msgSize );
+
+    if ( size != NULL ) {
+        *size = msgSize;
+    }
+
+    return( msg );
+}
+
+/*
+ *  ======== issueOutput ========
+ *  Send the output link's current transfer buffer, ending its messages
+ *  with an empty header if there is room for one.
+ */
+static Int issueOutput( Void )
+{
+    Int   status;
+    MdUns len = chanOutput.curPos;
+
+    if ( len + HDRSIZE <= chanOutput.bufSize ) {
+        *(MdUns *)(chanOutput.curBuf + len) = 0;
+        len += HDRSIZE;
+    }
+
+    /* Issue the full buffer to the output stream. */
+    status = SIO_issue( chanOutput.hStream, chanOutput.curBuf, len, NULL );
+    chanOutput.curBuf = NULL;
+    if ( status != SYS_OK ) {
+        return( MSGLINK_FAILURE );
+    }
+
+    return( MSGLINK_SUCCESS );
+}
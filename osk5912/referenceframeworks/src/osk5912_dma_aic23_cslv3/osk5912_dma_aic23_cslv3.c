@@ -296,7 +296,16 @@ static Int mdBindDev(Ptr *devp, Int devid, Ptr devParams)
 static Int mdCreateChan(Ptr *chanp, Ptr devp, String name, Int mode,
                 Ptr chanParams, IOM_TiomCallback cbFxn, Ptr cbArg)
 {
+    OSK5912_DMA_AIC23_CSLV3_ChanParams *params =
+        (OSK5912_DMA_AIC23_CSLV3_ChanParams *)chanParams;
     C55XX_DMA_MCBSP_CSLV3_ChanParams genericChanParams;
+    OSK5912_DMA_AIC23_CSLV3_ChanParams defaultParams =
+                        OSK5912_DMA_AIC23_CSLV3_CHANPARAMS_DEFAULT;
+
+    /* use default parameters if none are given */
+    if (params == NULL) {
+        params = &defaultParams;
+    }
 
     if (mode == IOM_INPUT) {
         genericChanParams.dmaObj = &dmaRxObj;
@@ -310,6 +319,9 @@ static Int mdCreateChan(Ptr *chanp, Ptr devp, String name, Int mode,
         return (IOM_EBADMODE);
     }
 
+    genericChanParams.sortChans = params->sortChans;
+    genericChanParams.continuous = params->continuous;
+
     return (C55XX_DMA_MCBSP_CSLV3_FXNS.mdCreateChan(chanp, devp, name, mode,
         &genericChanParams, cbFxn, cbArg));
 }
@@ -0,0 +1,43 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== prf_cell.c ========
+ */
+
+#pragma CODE_SECTION(PRF_cellStart, ".text:PRF_cell")
+#pragma CODE_SECTION(PRF_cellStop, ".text:PRF_cell")
+
+#include <std.h>
+#include <clk.h>
+
+#include <prf.h>
+#include <utl.h>
+
+/*
+ *  ======== PRF_cellStart ========
+ */
+Void PRF_cellStart(PRF_Handle prf, Uns cell)
+{
+    UTL_assert(cell < prf->cellCnt);
+
+    prf->cells[cell].startTime = CLK_gethtime();
+}
+
+/*
+ *  ======== PRF_cellStop ========
+ *  A slot can be started and stopped several times per frame, e.g. once
+ *  per block when the channel streams blocks, or once per channel when 
+ *  channels share the slot; the times add up until PRF_frameEnd().
+ */
+Void PRF_cellStop(PRF_Handle prf, Uns cell)
+{
+    PRF_Cell *cellPrf = &prf->cells[cell];
+
+    cellPrf->frameTime += CLK_gethtime() - cellPrf->startTime;
+}
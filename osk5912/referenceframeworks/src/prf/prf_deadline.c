@@ -0,0 +1,30 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== prf_deadline.c ========
+ */
+
+#pragma CODE_SECTION(PRF_deadline, ".text:init")
+
+#include <std.h>
+#include <clk.h>
+
+#include <prf.h>
+
+/*
+ *  ======== PRF_deadline ========
+ *  CLK_countspms() gives CLK_gethtime() units per millisecond. The rate
+ *  is scaled to hundreds of Hz so that common rates (8000, 44100, 48000)
+ *  divide exactly and frameLen * counts * 10 stays within 32 bits for
+ *  frames of a few thousand samples.
+ */
+LgUns PRF_deadline(Uns frameLen, LgUns sampleRate)
+{
+    return ((LgUns)frameLen * CLK_countspms() * 10 / (sampleRate / 100));
+}
@@ -0,0 +1,78 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== prf_frame.c ========
+ */
+
+#pragma CODE_SECTION(PRF_frameStart, ".text:PRF_frame")
+#pragma CODE_SECTION(PRF_frameEnd, ".text:PRF_frame")
+
+#include <std.h>
+#include <clk.h>
+
+#include <prf.h>
+
+/*
+ *  ======== PRF_frameStart ========
+ *  Frames are expected one deadline apart; the jitter is how far the 
+ *  start of a frame strays from that.
+ */
+Void PRF_frameStart(PRF_Handle prf)
+{
+    LgUns now = CLK_gethtime();
+    LgUns period;
+    LgUns jitter;
+
+    if (prf->frameCnt != 0) {
+        period = now - prf->lastStart;
+        jitter = (period > prf->deadline) ? period - prf->deadline :
+                                            prf->deadline - period;
+        if (jitter > prf->maxJitter) {
+            prf->maxJitter = jitter;
+        }
+    }
+
+    prf->lastStart = now;
+    prf->startTime = now;
+}
+
+/*
+ *  ======== PRF_frameEnd ========
+ */
+Void PRF_frameEnd(PRF_Handle prf)
+{
+    LgUns elapsed = CLK_gethtime() - prf->startTime;
+    LgUns load;
+    Uns i;
+
+    prf->lastTime = elapsed;
+    if (elapsed > prf->maxTime) {
+        prf->maxTime = elapsed;
+    }
+    if (elapsed > prf->deadline) {
+        prf->missCnt++;
+    }
+
+    load = elapsed / prf->loadUnit;
+    prf->load = (load > PRF_MAXLOAD) ? PRF_MAXLOAD : (Uns)load;
+    if (prf->load > prf->maxLoad) {
+        prf->maxLoad = prf->load;
+    }
+
+    /* close the frame for every cell slot */
+    for (i = 0; i < prf->cellCnt; i++) {
+        prf->cells[i].lastTime = prf->cells[i].frameTime;
+        if (prf->cells[i].frameTime > prf->cells[i].maxTime) {
+            prf->cells[i].maxTime = prf->cells[i].frameTime;
+        }
+        prf->cells[i].frameTime = 0;
+    }
+
+    prf->frameCnt++;
+}
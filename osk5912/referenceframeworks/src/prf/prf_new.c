@@ -0,0 +1,37 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== prf_new.c ========
+ */
+
+#pragma CODE_SECTION(PRF_new, ".text:init")
+
+#include <std.h>
+
+#include <prf.h>
+
+/*
+ *  ======== PRF_new ========
+ *  The cell slots are owned by the caller; one slot is needed for each
+ *  distinct prfCell + cell index used by the channels that share prf.
+ */
+Void PRF_new(PRF_Handle prf, LgUns deadline, PRF_Cell cells[], Uns cellCnt)
+{
+    prf->deadline = deadline;
+    prf->cells    = cells;
+    prf->cellCnt  = cellCnt;
+
+    /* one tenth of a percent of the deadline, so load needs no multiply */
+    prf->loadUnit = deadline / 1000;
+    if (prf->loadUnit == 0) {
+        prf->loadUnit = 1;
+    }
+
+    PRF_reset(prf);
+}
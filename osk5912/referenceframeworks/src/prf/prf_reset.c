@@ -0,0 +1,45 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== prf_reset.c ========
+ */
+
+#pragma CODE_SECTION(PRF_reset, ".text:PRF_reset")
+
+#include <std.h>
+
+#include <prf.h>
+
+/*
+ *  ======== PRF_reset ========
+ *  Can be called at run time, e.g. once the application has settled, but
+ *  not while the profiled thread is between PRF_frameStart() and
+ *  PRF_frameEnd() unless that thread cannot run meanwhile.
+ */
+Void PRF_reset(PRF_Handle prf)
+{
+    Uns i;
+
+    prf->frameCnt  = 0;
+    prf->missCnt   = 0;
+    prf->lastTime  = 0;
+    prf->maxTime   = 0;
+    prf->maxJitter = 0;
+    prf->load      = 0;
+    prf->maxLoad   = 0;
+    prf->startTime = 0;
+    prf->lastStart = 0;
+
+    for (i = 0; i < prf->cellCnt; i++) {
+        prf->cells[i].frameTime = 0;
+        prf->cells[i].lastTime  = 0;
+        prf->cells[i].maxTime   = 0;
+        prf->cells[i].startTime = 0;
+    }
+}
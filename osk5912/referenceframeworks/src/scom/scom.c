@@ -22,9 +22,11 @@
 #pragma CODE_SECTION( SCOM_open,     ".text:SCOM_open"     )
 #pragma CODE_SECTION( SCOM_putMsg,   ".text:SCOM_putMsg"   )
 #pragma CODE_SECTION( SCOM_getMsg,   ".text:SCOM_getMsg"   )
+#pragma CODE_SECTION( hashName,      ".text:SCOM_open"     )
 
 #include <std.h>
 
+#include <hwi.h>
 #include <mem.h>
 #include <que.h>
 #include <sem.h>
@@ -34,30 +36,61 @@
 
 #include "scom.h"
 
+/* number of hash chains for SCOM queue names; must be a power of 2 */
+#define HASHSIZE    16
+
+/*
+ *  Order the slot accesses of a ring queue against its indexes: acquire
+ *  after reading the index that hands a slot over, release before
+ *  writing the one that hands it back. The slots and indexes are 
+ *  volatile, which keeps the compiler from moving one past the other;
+ *  that is enough on the single-core DSP. A host may run the writer and
+ *  the reader on two cores, so there the processor is fenced as well.
+ */
+#if defined(_HOST_)
+#define SCOM_acquire()  __atomic_thread_fence( __ATOMIC_ACQUIRE )
+#define SCOM_release()  __atomic_thread_fence( __ATOMIC_RELEASE )
+#else
+#define SCOM_acquire()
+#define SCOM_release()
+#endif
+
 /* default SCOM creation attributes */
 SCOM_Attrs SCOM_ATTRS = { 
-    0                      /* dummy */
+    0                      /* ringSize: unbounded QUE-based queue */
 };
 
 /* definition of an SCOM queue */
 struct SCOM_Obj {
-    QUE_Elem   elem;         /* mandatory first element */
-    String     name;         /* name of the queue */
-    QUE_Obj    que;          /* queue on which messages are placed */
-    SEM_Obj    sem;          /* semaphore for the queue */
+    SCOM_Handle  next;       /* next queue on the same hash chain */
+    String       name;       /* name of the queue */
+    Uns          hash;       /* hash of the name */
+    QUE_Obj      que;        /* queue on which messages are placed */
+    SEM_Obj      sem;        /* semaphore for the queue */
+    Ptr volatile *ring;      /* message slots of a ring queue, or NULL */
+    Uns          ringLen;    /* number of slots: ring size + 1 */
+    volatile Uns head;       /* next slot to read; written by reader only */
+    volatile Uns tail;       /* next slot to write; written by writer only */
+    volatile Bool waiting;   /* reader is about to block on sem */
 };
 
-/* internal list of SCOM queues */
-static QUE_Obj queScomQueues;
+/* internal table of SCOM queues, chained by the hash of their names */
+static SCOM_Handle scomQueues[ HASHSIZE ];
+
+static Uns hashName( String name );
 
 /*
  *  ======== SCOM_init ========
  *  
- *  Initializes the master queue.
+ *  Initializes the table of queues.
  */
 Void SCOM_init( Void )
 {
-    QUE_new( &queScomQueues );
+    Int i;
+
+    for (i = 0; i < HASHSIZE; i++) {
+        scomQueues[i] = NULL;
+    }
 }
 
 /*
@@ -70,7 +103,9 @@ Void SCOM_exit( Void )
 /*
  *  ======== SCOM_create ========
  *  
- *  Create a new SCOM queue under given name 
+ *  Create a new SCOM queue under given name. If attrs->ringSize is 
+ *  non-zero, the queue is a ring of that many messages for one writer
+ *  and one reader task, which needs no interrupt masking.
  */
 SCOM_Handle SCOM_create( 
     String       queueName,  /* ID (name) of the SCOM queue to be created */
@@ -78,23 +113,47 @@ SCOM_Handle SCOM_create(
     )
 {
     SCOM_Handle  scomQueue;
+    Uns          intrState;
 
     /* verify parameters */
     UTL_assert( queueName != NULL );
+
+    if (attrs == NULL) {
+        attrs = &SCOM_ATTRS;
+    }
     
     /* allocate the SCOM queue object */
     scomQueue = (SCOM_Handle)MEM_alloc( 0, sizeof( SCOM_Obj ), 0 );
     if (scomQueue == MEM_ILLEGAL) {
         return NULL;
     }
+
+    /* allocate the ring, with one spare slot to tell full from empty */
+    scomQueue->ring = NULL;
+    if (attrs->ringSize != 0) {
+        scomQueue->ringLen = attrs->ringSize + 1;
+        scomQueue->ring = (Ptr volatile *)MEM_alloc( 0, 
+            sizeof( Ptr ) * scomQueue->ringLen, 0 );
+        if (scomQueue->ring == MEM_ILLEGAL) {
+            MEM_free( 0, scomQueue, sizeof( SCOM_Obj ) );
+            return NULL;
+        }
+    }
     
     /* initialize the object */
     QUE_new( &scomQueue->que );
     SEM_new( &scomQueue->sem, 0 );
-    scomQueue->name = queueName;
+    scomQueue->name    = queueName;
+    scomQueue->hash    = hashName( queueName );
+    scomQueue->head    = 0;
+    scomQueue->tail    = 0;
+    scomQueue->waiting = FALSE;
 
-    /* and place it on the master list of SCOM queues */
-    QUE_put( &queScomQueues, scomQueue );
+    /* and place it on the hash chain for its name */
+    intrState = HWI_disable();
+    scomQueue->next = scomQueues[ scomQueue->hash & (HASHSIZE - 1) ];
+    scomQueues[ scomQueue->hash & (HASHSIZE - 1) ] = scomQueue;
+    HWI_restore( intrState );
     
     return scomQueue;
 }
@@ -102,24 +161,29 @@ SCOM_Handle SCOM_create(
 /*
  *  ======== SCOM_open ========
  *  
- *  Get a reference to an existing SCOM queue by its name
+ *  Get a reference to an existing SCOM queue by its name. Only the queues
+ *  whose names hash to the same chain are compared. The handle does not
+ *  change, so tasks should open the queue once and keep the handle.
  */
 SCOM_Handle SCOM_open(
     String       queueName    /* ID (name) of the SCOM queue to be found */
     )
 {
     SCOM_Handle  scomQueue;
+    Uns          hash;
     
     /* verify parameters */
     UTL_assert( queueName != NULL );
 
-    /* search the master list for a queue whose name is == queueName */
-    scomQueue = QUE_head( &queScomQueues );
-    while ((QUE_Obj *)scomQueue != &queScomQueues) {
-        if (!strcmp( scomQueue->name, queueName )) {
+    /* search the chain for a queue whose name is == queueName */
+    hash = hashName( queueName );
+    scomQueue = scomQueues[ hash & (HASHSIZE - 1) ];
+    while (scomQueue != NULL) {
+        if ((scomQueue->hash == hash) && 
+            !strcmp( scomQueue->name, queueName )) {
             return scomQueue;    
         }
-        scomQueue = QUE_next( scomQueue );
+        scomQueue = scomQueue->next;
     }
     
     /* not found */
@@ -135,10 +199,28 @@ Bool SCOM_delete(
     SCOM_Handle  scomQueue     /* handle of the SCOM queue to be deleted */
     )
 {
+    SCOM_Handle *link;
+    Uns          intrState;
+
     /* verify parameters */
     UTL_assert( scomQueue != NULL );
     
-    QUE_remove( scomQueue );
+    /* unlink the queue from its hash chain */
+    intrState = HWI_disable();
+    link = &scomQueues[ scomQueue->hash & (HASHSIZE - 1) ];
+    while (*link != NULL) {
+        if (*link == scomQueue) {
+            *link = scomQueue->next;
+            break;
+        }
+        link = &(*link)->next;
+    }
+    HWI_restore( intrState );
+
+    if (scomQueue->ring != NULL) {
+        MEM_free( 0, (Ptr)scomQueue->ring, 
+            sizeof( Ptr ) * scomQueue->ringLen );
+    }
     return MEM_free( 0, scomQueue, sizeof( SCOM_Obj ) );
 }
 
@@ -146,37 +228,116 @@ Bool SCOM_delete(
 /*
  *  ======== SCOM_putMsg ========
  *  
- *  Place the message on a synchronized queue
+ *  Place the message on a synchronized queue. A ring queue only posts
+ *  the semaphore when the reader is blocked on it, and returns FALSE 
+ *  without sending the message if the ring is full.
  */
-Void SCOM_putMsg(
+Bool SCOM_putMsg(
     SCOM_Handle  scomQueue,   /* SCOM queue to which message should be put */
     Ptr          msg          /* message to be sent */
     )
 {
+    Uns tail;
+    Uns next;
+
     /* verify parameters */
     UTL_assert( scomQueue != NULL );
-    QUE_put ( &scomQueue->que, (QUE_Elem *)msg);
-    SEM_post( &scomQueue->sem );
+
+    if (scomQueue->ring == NULL) {
+        QUE_put ( &scomQueue->que, (QUE_Elem *)msg);
+        SEM_post( &scomQueue->sem );
+        return TRUE;
+    }
+
+    tail = scomQueue->tail;
+    next = (tail + 1 == scomQueue->ringLen) ? 0 : tail + 1;
+    if (next == scomQueue->head) {
+        return FALSE;         // ring is full
+    }
+
+    /* fill the slot before the reader can see it */
+    SCOM_acquire();
+    scomQueue->ring[ tail ] = msg;
+    SCOM_release();
+    scomQueue->tail = next;
+
+    if (scomQueue->waiting) {
+        scomQueue->waiting = FALSE;
+        SEM_post( &scomQueue->sem );
+    }
+
+    return TRUE;
 }
 
 
 /*
  *  ======== SCOM_getMsg ========
  *  
- *  Receive a message from a synchronized queue
+ *  Receive a message from a synchronized queue. The reader of a ring
+ *  queue flags that it is about to block and looks at the ring once more
+ *  before pending, so a message put in between always wakes it up. A
+ *  wakeup it did not need is left on the semaphore and only costs an
+ *  extra pass around the loop.
  */
 Ptr SCOM_getMsg(
     SCOM_Handle  scomQueue,   /* SCOM queue from which to take a message */
     Uns          timeout      /* blocking timeout */
     )
 {
+    Uns head;
+    Ptr msg;
+
     /* verify parameters */
     UTL_assert( scomQueue != NULL );
     
-    if (SEM_pend( &scomQueue->sem, timeout ) == FALSE) {
-        return NULL;          // semaphore timed out
+    if (scomQueue->ring == NULL) {
+        if (SEM_pend( &scomQueue->sem, timeout ) == FALSE) {
+            return NULL;          // semaphore timed out
+        }
+
+        return ( QUE_get( &scomQueue->que ) );
     }
 
-    return ( QUE_get( &scomQueue->que ) );
+    while (TRUE) {
+        head = scomQueue->head;
+        if (head != scomQueue->tail) {
+            /* take the message before handing the slot back */
+            SCOM_acquire();
+            msg = scomQueue->ring[ head ];
+            SCOM_release();
+            scomQueue->head = (head + 1 == scomQueue->ringLen) ? 0 : head + 1;
+            return msg;
+        }
+
+        if (timeout == 0) {
+            return NULL;          // ring is empty; don't wait
+        }
+
+        scomQueue->waiting = TRUE;
+        if (head != scomQueue->tail) {
+            scomQueue->waiting = FALSE;
+            continue;
+        }
+
+        if (SEM_pend( &scomQueue->sem, timeout ) == FALSE) {
+            scomQueue->waiting = FALSE;
+            return NULL;          // semaphore timed out
+        }
+    }
 }
 
+/*
+ *  ======== hashName ========
+ *  
+ *  Hash of an SCOM queue name.
+ */
+static Uns hashName( String name )
+{
+    Uns hash = 0;
+
+    while (*name != '\0') {
+        hash = (hash << 5) + hash + (Uns)*name++;
+    }
+
+    return hash;
+}
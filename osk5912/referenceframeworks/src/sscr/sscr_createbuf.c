@@ -27,7 +27,8 @@
  *  Allocate a buffer based on the scrBucketIndex.  This function
  *  can be called multiple times, but only the first time does it 
  *  allocate a buffer per priority bucket.  Afterwards, it simply 
- *  returns the pointer (and size).
+ *  returns the pointer (and size).  A bucket overlaid by SSCR_plan()
+ *  returns the buffer of the bucket it shares.
  */
 Ptr SSCR_createBuf(Uns scrBucketIndex, Uns *scrSize)
 {        
@@ -45,8 +46,8 @@ Ptr SSCR_createBuf(Uns scrBucketIndex, Uns *scrSize)
      */
     *scrSize = 0;
     
-    /* Get the bucket */
-    bucketEntry = &(_SSCR_bucketList[scrBucketIndex]);    
+    /* Get the bucket that holds the buffer */
+    bucketEntry = &(_SSCR_bucketList[_SSCR_bucketList[scrBucketIndex].share]);
     
     /* 
      *  The size for this bucket is zero.  In other words, there is nothing
@@ -68,12 +69,12 @@ Ptr SSCR_createBuf(Uns scrBucketIndex, Uns *scrSize)
     /*
      *  If the count is zero (e.g. not allocated),
      *  then allocate the buffer (from the heap specified in 
-     *  SSCR_setup()).  Alignment has already been factored
-     *  in when determining the size in SSCR_prime().
+     *  SSCR_setup()).  The buffer starts at the largest alignment 
+     *  requested, which is what SSCR_prime() assumed in the size.
      */ 
     if (bucketEntry->count == 0) {                        
-        if ((tmpBuffer = MEM_alloc(_SSCR_heapId, bucketEntry->size, 0)) == 
-            MEM_ILLEGAL) {
+        if ((tmpBuffer = MEM_alloc(_SSCR_heapId, bucketEntry->size, 
+            bucketEntry->align)) == MEM_ILLEGAL) {
             /* Return NULL is the allocation failed */
             return (NULL);
         }
@@ -26,11 +26,14 @@
  *  ======== SSCR_deleteBuf ========
  *  This function frees the buffer for the specified bucket if the usage
  *  count goes to 0.  Note: if the user specified the bucket buffer, the buffer
- *  is not freed.
+ *  is not freed.  A bucket overlaid by SSCR_plan() releases the buffer of 
+ *  the bucket it shares.
  *
  *  When a buffer is freed,  
  *   - The buffer pointer in the bucket is set to NULL (not required,
  *     but aids in debugging). 
+ *   - The bucket no longer has an owner, since no algorithm is left 
+ *     to use it.
  *
  */
 Bool SSCR_deleteBuf(Uns scrBucketIndex)
@@ -43,7 +46,7 @@ Bool SSCR_deleteBuf(Uns scrBucketIndex)
     /* Make sure a valid parameter */
     UTL_assert(scrBucketIndex < _SSCR_bucketCnt);
         
-    bucketEntry = &(_SSCR_bucketList[scrBucketIndex]);    
+    bucketEntry = &(_SSCR_bucketList[_SSCR_bucketList[scrBucketIndex].share]);
 
     /* 
      *  Temporarily disable interrupts. This is to prevent a very unlikely race
@@ -84,6 +87,7 @@ Bool SSCR_deleteBuf(Uns scrBucketIndex)
 
         /* Reset the buffer. */
         bucketEntry->buffer = NULL;
+        bucketEntry->owner  = NULL;
 
         /* Restore interrupt state */
         HWI_restore( intrState );
@@ -24,12 +24,14 @@
 /*
  *  ======== SSCR_getBuf ========
  *  This function returns the pointer to and the size of the scratch buffer 
- *  for the specified bucket. It does not allocate memory.
+ *  for the specified bucket. It does not allocate memory. A bucket overlaid
+ *  by SSCR_plan() returns the buffer of the bucket it shares.
  */
 Ptr SSCR_getBuf(Uns scrBucketIndex, Uns *scrSize)
 {   
     Uns intrState;            // Used to disable interrupts
     Ptr tmpBuffer;
+    SSCR_Bucket *bucketEntry;
     
     /* Make sure valid parameters */
     UTL_assert(scrSize != NULL);
@@ -40,10 +42,12 @@ Ptr SSCR_getBuf(Uns scrBucketIndex, Uns *scrSize)
      *  condition, in which multiple SSCR_deleteBuf()'s, SSCR_createBuf()'s or
      *  SSCR_getBuf()'s are called.
      */
+    bucketEntry = &(_SSCR_bucketList[_SSCR_bucketList[scrBucketIndex].share]);
+
     intrState = HWI_disable();
 
-    *scrSize  = _SSCR_bucketList[scrBucketIndex].size;
-    tmpBuffer = _SSCR_bucketList[scrBucketIndex].buffer;
+    *scrSize  = bucketEntry->size;
+    tmpBuffer = bucketEntry->buffer;
 
     /* Restore interrupt state */
     HWI_restore( intrState );
@@ -0,0 +1,51 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== sscr_owner.c ========
+ *  SSCR's file for tracking which algorithm owns a scratch buffer.
+ */
+
+#pragma CODE_SECTION(SSCR_getOwner, ".text:sscr_owner")
+#pragma CODE_SECTION(SSCR_setOwner, ".text:sscr_owner")
+
+#include <std.h>
+
+#include <sscr.h>
+#include <utl.h>
+
+
+/*
+ *  ======== SSCR_getOwner ========
+ *  This function returns the algorithm whose state was last left in the
+ *  scratch buffer of the specified bucket, or NULL if there is none.
+ *  Buckets overlaid by SSCR_plan() share the owner with their buffer.
+ */
+IALG_Handle SSCR_getOwner(Uns scrBucketIndex)
+{
+    /* Make sure a valid parameter */
+    UTL_assert(scrBucketIndex < _SSCR_bucketCnt);
+
+    return (_SSCR_bucketList[_SSCR_bucketList[scrBucketIndex].share].owner);
+}
+
+/*
+ *  ======== SSCR_setOwner ========
+ *  This function records the algorithm whose state is now held in the 
+ *  scratch buffer of the specified bucket. Only threads that share the 
+ *  bucket use the owner, and they cannot preempt each other, so no 
+ *  interrupt protection is needed.
+ */
+Void SSCR_setOwner(Uns scrBucketIndex, IALG_Handle alg)
+{
+    /* Make sure a valid parameter */
+    UTL_assert(scrBucketIndex < _SSCR_bucketCnt);
+
+    _SSCR_bucketList[_SSCR_bucketList[scrBucketIndex].share].owner = alg;
+}
+
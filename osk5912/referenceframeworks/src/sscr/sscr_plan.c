@@ -0,0 +1,103 @@
+/*
+ *  Copyright 2003 by Texas Instruments Incorporated.
+ *  All rights reserved. Property of Texas Instruments Incorporated.
+ *  Restricted rights to use, duplicate or disclose this code are
+ *  granted through contract.
+ *  
+ */
+/* "@(#) ReferenceFrameworks 3.10.00.05 04-29-04 (swat-g05)" */
+/*
+ *  ======== sscr_plan.c ========
+ *  SSCR's file for overlaying the scratch buckets of threads that run at
+ *  the same priority.
+ */
+
+#pragma CODE_SECTION(SSCR_plan, ".text:SSCR_plan")
+
+#include <std.h>
+
+#include <sscr.h>
+#include <utl.h>
+
+
+/*
+ *  ======== SSCR_plan ========
+ *  This function is given the priority of the threads using each bucket,
+ *  bucketPri[ <bucket index> ]. Threads of the same priority cannot preempt
+ *  each other, so each bucket is overlaid with the first bucket of the same
+ *  priority: it uses that bucket's buffer, which is sized for the largest
+ *  of them. User defined buckets keep their own buffer.
+ *
+ *  The function must be called after all the algorithms have been primed 
+ *  and before any buffer is created, and only once. It does NOT allocate 
+ *  memory. If report is not NULL, it is filled in with the on-chip scratch
+ *  memory needed before and after planning.
+ */
+Bool SSCR_plan(Int bucketPri[], SSCR_PlanReport *report)
+{
+    Int i;
+    Int j;
+    SSCR_Bucket *bucketEntry;
+    SSCR_Bucket *shareEntry;
+
+    /* Check passed in parameters */
+    UTL_assert(bucketPri != NULL);
+
+    /* Fail if a buffer has been created or the buckets already planned */
+    for (i = 0; i < _SSCR_bucketCnt; i++) {
+        bucketEntry = &(_SSCR_bucketList[i]);
+        if ((bucketEntry->share != i) || 
+            ((bucketEntry->count != 0) && 
+             (bucketEntry->count != _SSCR_USERDEFINED))) {
+            return (FALSE);
+        }
+    }
+
+    for (i = 0; i < _SSCR_bucketCnt; i++) {
+        bucketEntry = &(_SSCR_bucketList[i]);
+        if (bucketEntry->count == _SSCR_USERDEFINED) {
+            continue;
+        }
+
+        /* 
+         *  Look for an earlier bucket of the same priority that holds
+         *  its own buffer, and grow that buffer to fit this bucket.
+         */
+        for (j = 0; j < i; j++) {
+            shareEntry = &(_SSCR_bucketList[j]);
+            if ((bucketPri[j] == bucketPri[i])               && 
+                (shareEntry->count != _SSCR_USERDEFINED)     && 
+                (shareEntry->share == j)) {
+
+                bucketEntry->share = j;
+                if (bucketEntry->size > shareEntry->size) {
+                    shareEntry->size = bucketEntry->size;
+                }
+                if (bucketEntry->align > shareEntry->align) {
+                    shareEntry->align = bucketEntry->align;
+                }
+                break;
+            }
+        }
+    }
+
+    if (report != NULL) {
+        report->summedSize  = 0;
+        report->plannedSize = 0;
+        report->sharedCnt   = 0;
+
+        for (i = 0; i < _SSCR_bucketCnt; i++) {
+            bucketEntry = &(_SSCR_bucketList[i]);
+            report->summedSize += bucketEntry->summed;
+            if (bucketEntry->share == i) {
+                report->plannedSize += bucketEntry->size;
+            }
+            else {
+                report->sharedCnt++;
+            }
+        }
+    }
+
+    return (TRUE);
+}
+
@@ -12,6 +12,7 @@
  */
 
 #pragma CODE_SECTION(SSCR_prime, ".text:SSCR_prime")
+#pragma CODE_SECTION(layoutSize, ".text:SSCR_prime")
 
 #include <std.h>
 
@@ -21,12 +22,29 @@
 #include <sscr.h>
 #include <utl.h>
 
+/*
+ *  This macro allows us to use the numeric value of the pointer address
+ *  for scratch buffer offset calculations, across all architectures
+ */
+#ifdef _55l_
+#define PtrAddrAsUns(A) ((Uns)((unsigned long)(A) & 0xffff))
+#else
+#define PtrAddrAsUns(A) ((Uns)(A))
+#endif
+
+static Uns layoutSize(IALG_MemRec memTab[], Int numRecs, Uns start);
 
 /*
  *  ======== SSCR_prime ========
  *  This function is called multiple times to determine the worst-case
  *  scratch requirements. The function queries the algorithm to determine
  *  it's scratch requirements. This function does NOT allocate memory.
+ *
+ *  The scratch memTabs are laid out the way ALGRF_createScratchSupport()
+ *  places them: each at the next address with its alignment. A buffer
+ *  allocated by SSCR_createBuf() starts at the bucket's largest alignment,
+ *  so the layout starts at offset 0. A user defined buffer is laid out
+ *  from its actual address.
  *  
  *  Note: The parent concept is not supported in SSCR.
  */ 
@@ -34,9 +52,13 @@ Bool SSCR_prime(Uns scrBucketIndex, IALG_Fxns *fxns, IALG_Params *params)
 {
     Int i;
     Int numRecs;    
-    Uns curScratchReq = 0;
+    Uns curScratchReq;
+    Uns curAlign = 0;
+    Uns curSummed = 0;
     Uns intrState;                        // Used to disable interrupts    
     IALG_MemRec memTab[_SSCR_MAXMEMRECS]; // Stack-based avoids frag.
+    SSCR_Bucket *bucketEntry;
+    SSCR_Bucket *shareEntry;
 
     /* Check passed in parameters */
     UTL_assert(scrBucketIndex < _SSCR_bucketCnt);
@@ -63,21 +85,27 @@ Bool SSCR_prime(Uns scrBucketIndex, IALG_Fxns *fxns, IALG_Params *params)
     
     /* 
      *  Loop through the memTab records to find on-chip scratch requests.
-     *  Sum the size and alignment of each on-chip scratch memory request to
-     *  determine worst-case requirements for the algorithm.
+     *  Keep the largest alignment, and the sum of the size and alignment
+     *  of each request for the report of SSCR_plan().
      */
-    
     for (i = 0; i < numRecs; i++) {               
         if ( (memTab[i].attrs == IALG_SCRATCH) && 
              (!(IALG_isOffChip(memTab[i].space))) ) {            
-            /* 
-             *  Add in this memTab record's on-chip memory request into
-             *  the running total.              
-             */
-            curScratchReq += memTab[i].size + memTab[i].alignment;
+            curSummed += memTab[i].size + memTab[i].alignment;
+            if (memTab[i].alignment > curAlign) {
+                curAlign = memTab[i].alignment;
+            }
         }          
     }
 
+    bucketEntry = &(_SSCR_bucketList[scrBucketIndex]);
+    shareEntry  = &(_SSCR_bucketList[bucketEntry->share]);
+
+    /* Lay the requests out from where the buffer starts */
+    curScratchReq = layoutSize(memTab, numRecs, 
+        (bucketEntry->count == _SSCR_USERDEFINED) ? 
+        PtrAddrAsUns(bucketEntry->buffer) : 0);
+
     /* 
      *  Temporarily disable interrupts. This is to prevent a very unlikely race 
      *  condition, in which two SSCR_primes are called from separate threads.
@@ -90,21 +118,36 @@ Bool SSCR_prime(Uns scrBucketIndex, IALG_Fxns *fxns, IALG_Params *params)
      *  If not user defined, check to see if this algorithm instance needs
      *  more than other algorithm instances using this bucket.
      */
-    if (curScratchReq > _SSCR_bucketList[scrBucketIndex].size) {
-        if (_SSCR_bucketList[scrBucketIndex].count == _SSCR_USERDEFINED) {
+    if (bucketEntry->count == _SSCR_USERDEFINED) {
+        if (curScratchReq > bucketEntry->size) {
             /* Restore interrupt state */
             HWI_restore( intrState );
             
             /* User did not define large enough buffer. */
             return(FALSE);
         }
-        else {
-            /* 
-             *  This request is larger than previous requests in this bucket.
-             *  Update table with the new larger size.
-             */ 
-            _SSCR_bucketList[scrBucketIndex].size = curScratchReq;    
-        }     
+    }
+    else {
+        /* 
+         *  Update the table with any larger size or alignment. If
+         *  SSCR_plan() overlaid this bucket with another, the buffer that
+         *  is shared must fit this request as well.
+         */ 
+        if (curScratchReq > bucketEntry->size) {
+            bucketEntry->size = curScratchReq;
+        }
+        if (curAlign > bucketEntry->align) {
+            bucketEntry->align = curAlign;
+        }
+        if (curSummed > bucketEntry->summed) {
+            bucketEntry->summed = curSummed;
+        }
+        if (curScratchReq > shareEntry->size) {
+            shareEntry->size = curScratchReq;
+        }
+        if (curAlign > shareEntry->align) {
+            shareEntry->align = curAlign;
+        }
     }
 
     /* Restore interrupt state */
@@ -113,3 +156,29 @@ Bool SSCR_prime(Uns scrBucketIndex, IALG_Fxns *fxns, IALG_Params *params)
     return (TRUE);
 }
 
+/*
+ *  ======== layoutSize ========
+ *  Returns the number of MAUs the on-chip scratch requests of memTab[]
+ *  take when each is placed, from address start onwards, at the next
+ *  address with its alignment. The padding is exactly what the alignment
+ *  needs, rather than the worst-case full alignment per request.
+ */
+static Uns layoutSize(IALG_MemRec memTab[], Int numRecs, Uns start)
+{
+    Int i;
+    Uns align;
+    Uns offset = start;
+
+    for (i = 0; i < numRecs; i++) {               
+        if ( (memTab[i].attrs == IALG_SCRATCH) && 
+             (!(IALG_isOffChip(memTab[i].space))) ) {            
+            /* alignment of 0 means no alignment; must be a power of 2 */
+            align = (memTab[i].alignment == 0) ? 1 : memTab[i].alignment;
+            offset = ((offset + (align - 1)) & (~(align - 1))) + 
+                memTab[i].size;
+        }
+    }
+
+    return (offset - start);
+}
+
@@ -71,11 +71,19 @@ Bool SSCR_setup(Int heapId, Uns bucketCnt, Ptr bucketBuf[], Uns bucketSize[])
             _SSCR_bucketList[i].buffer = bucketBuf[i];
             _SSCR_bucketList[i].size   = bucketSize[i];
             _SSCR_bucketList[i].count  = _SSCR_USERDEFINED;
+            _SSCR_bucketList[i].owner  = NULL;
+            _SSCR_bucketList[i].align  = 0;
+            _SSCR_bucketList[i].summed = bucketSize[i];
+            _SSCR_bucketList[i].share  = i;
         }
         else {
             _SSCR_bucketList[i].buffer = NULL;
             _SSCR_bucketList[i].size   = 0;
             _SSCR_bucketList[i].count  = 0;
+            _SSCR_bucketList[i].owner  = NULL;
+            _SSCR_bucketList[i].align  = 0;
+            _SSCR_bucketList[i].summed = 0;
+            _SSCR_bucketList[i].share  = i;
         }
     }
 
@@ -24,8 +24,7 @@
 #include "ivol.h"
 #include "vol_ti_priv.h"
 
-#define SCALEBUF 1
-#define NUMBUFS 2
+#define NUMBUFS 1
 
 /*
  *  ======== VOL_TI_alloc ========
@@ -46,12 +45,7 @@ Int VOL_TI_alloc(const IALG_Params *algParams,
     memTab[0].space = IALG_EXTERNAL;
     memTab[0].attrs = IALG_PERSIST;
 
-    /* Request memory for scaling buffer */
-    memTab[SCALEBUF].size = (params->frameSize) * sizeof(Int);
-    memTab[SCALEBUF].alignment = 0;    /* No alignment required */
-    memTab[SCALEBUF].space = IALG_DARAM0;
-    memTab[SCALEBUF].attrs = IALG_PERSIST;
-    
+    /* no scaling buffer: VOL_TI_amplify scales straight from in to out */
     return (NUMBUFS);
 }
 
@@ -61,15 +55,10 @@ Int VOL_TI_alloc(const IALG_Params *algParams,
  */
 Int VOL_TI_free(IALG_Handle handle, IALG_MemRec memTab[])
 {
-    VOL_TI_Obj *vol = (VOL_TI_Obj *)handle;
-
     VOL_TI_alloc(NULL, NULL, memTab);
 
     memTab[0].base = handle;
 
-    memTab[SCALEBUF].base = vol->scaleBuf;
-    memTab[SCALEBUF].size = vol->frameLen * sizeof(Int);
-
     return (NUMBUFS);
 }
 
@@ -88,25 +77,34 @@ Int VOL_TI_initObj(IALG_Handle handle,
         params = &IVOL_PARAMS;  /* Use interface default params */
     }
 
-    vol->scaleBuf = memTab[SCALEBUF].base;
-
     vol->frameLen = params->frameSize;
     vol->gainPercentage = params->gainPercentage;
 
+    /* callers built before rampMode existed pass a shorter structure */
+    if (VOL_TI_HASPARAM(params, rampMode)) {
+        vol->rampMode = params->rampMode;
+    }
+    else {
+        vol->rampMode = IVOL_RAMPNONE;
+    }
+
+    /* start at the initial gain rather than ramping up to it */
+    vol->gain = VOL_TI_GAIN(params->gainPercentage);
+    vol->rampStep = 0;
+    vol->rampEnd = vol->gain;
+    vol->framePos = 0;
+
     return (IALG_EOK);
 }
 
 /*
  *  ======== VOL_TI_moved ========
- *  Re-initialize buffer ptrs to new location.
+ *  The object holds no buffer pointers, so there is nothing to fix up.
  */
 Void VOL_TI_moved(IALG_Handle handle,
                 const IALG_MemRec memTab[], IALG_Handle p,
                 const IALG_Params *algParams)
 {
-    VOL_TI_Obj *vol = (VOL_TI_Obj *)handle;
-
-    vol->scaleBuf = memTab[SCALEBUF].base;
 }
 
 
@@ -14,30 +14,81 @@
  */
 
 #include <std.h>
-#include <string.h>
 #include <xdas.h>
 
 #include "ivol.h"
 #include "vol_ti_priv.h"
 
-/* data procesing part - scale buffer by gainPercentage */
-static Void scale(XDAS_Int16 *buf, Int nWords, Int gainPercentage);
+/* an exponential ramp closes 1/2^EXPSHIFT of the remaining gap per sample */
+#define EXPSHIFT        4
+
+/* saturate a Q8-scaled product back to a 16-bit sample */
+#define SATURATE(x)     ((x) > 0x7fffL ? (XDAS_Int16)0x7fff : \
+                         (x) < -0x8000L ? (XDAS_Int16)-0x8000L : (XDAS_Int16)(x))
+
+/* data procesing part - scale in into out by a constant or a moving gain */
+static Void scale(XDAS_Int16 *in, XDAS_Int16 *out, Int nWords,
+    XDAS_Int32 gain);
+static Void scaleLinear(XDAS_Int16 *in, XDAS_Int16 *out, Int nWords,
+    XDAS_Int32 gain, XDAS_Int32 step);
+static XDAS_Int32 scaleExp(XDAS_Int16 *in, XDAS_Int16 *out, Int nWords,
+    XDAS_Int32 gain, XDAS_Int32 target);
 
 /*
  *  ======== VOL_TI_amplify ========
+ *  Scales one frame from in straight into out.
  */
 Void VOL_TI_amplify(IVOL_Handle handle, XDAS_Int16 *in, XDAS_Int16 *out)
 {
     VOL_TI_Obj *vol = (VOL_TI_Obj *)handle;
-    
-    /* Use memcpy to copy input buffer into scaling buffer */
-    memcpy((void *)(vol->scaleBuf),(void *)in,(Uns)((vol->frameLen) * sizeof(XDAS_Int16)));
 
-    /* we process the scaling buffer */      
-    scale(vol->scaleBuf, vol->frameLen, vol->gainPercentage);
-    
-    /* done with processing the scaling buffer, now copy it to out */
-    memcpy((void *)(out),(void *)(vol->scaleBuf), (Uns)((vol->frameLen) * sizeof(XDAS_Int16)));
+    VOL_TI_amplifyBlock(handle, in, out, vol->frameLen);
+}
+
+/*
+ *  ======== VOL_TI_amplifyBlock ========
+ *  Scales nWords samples from in straight into out (which may be the same
+ *  buffer). Successive calls make up frames of frameLen samples, and a
+ *  gain change set through VOL_TI_control is ramped in as rampMode asks
+ *  for. A linear ramp is planned at the start of a frame and lands on its
+ *  target at the end of that frame.
+ */
+Void VOL_TI_amplifyBlock(IVOL_Handle handle, XDAS_Int16 *in, 
+    XDAS_Int16 *out, Int nWords)
+{
+    VOL_TI_Obj *vol = (VOL_TI_Obj *)handle;
+    XDAS_Int32 target = VOL_TI_GAIN(vol->gainPercentage);
+
+    if (vol->framePos == 0) {
+        vol->rampEnd = target;
+        vol->rampStep = 0;
+        if (vol->rampMode == IVOL_RAMPLINEAR && vol->frameLen != 0) {
+            vol->rampStep = (target - vol->gain) / vol->frameLen;
+        }
+    }
+
+    if (vol->rampMode == IVOL_RAMPLINEAR && vol->rampStep != 0) {
+        scaleLinear(in, out, nWords, vol->gain, vol->rampStep);
+        vol->gain += vol->rampStep * nWords;
+    }
+    else if (vol->rampMode == IVOL_RAMPEXP && vol->gain != target) {
+        vol->gain = scaleExp(in, out, nWords, vol->gain, target);
+    }
+    else {
+        /* a linear ramp waits for the next frame to pick up a new gain */
+        if (vol->rampMode != IVOL_RAMPLINEAR) {
+            vol->gain = target;
+        }
+        scale(in, out, nWords, vol->gain >> VOL_TI_GAINFRAC);
+    }
+
+    vol->framePos += nWords;
+    if (vol->framePos >= vol->frameLen) {
+        vol->framePos = 0;
+        if (vol->rampMode == IVOL_RAMPLINEAR) {
+            vol->gain = vol->rampEnd;
+        }
+    }
 }
 
 /*
@@ -50,9 +101,16 @@ Int VOL_TI_control(IVOL_Handle handle, IVOL_Cmd cmd, IVOL_Status *status)
     switch (cmd) {
         case IVOL_GETSTATUS:
             status->gainPercentage = vol->gainPercentage;
+            if (VOL_TI_HASSTATUS(status, rampMode)) {
+                status->rampMode = vol->rampMode;
+            }
             break;
         case IVOL_SETSTATUS:
+            /* the new gain is reached by the ramp in VOL_TI_amplify */
             vol->gainPercentage = status->gainPercentage;
+            if (VOL_TI_HASSTATUS(status, rampMode)) {
+                vol->rampMode = status->rampMode;
+            }
             break;
         default:
             return IALG_EFAIL;
@@ -63,16 +121,71 @@ Int VOL_TI_control(IVOL_Handle handle, IVOL_Cmd cmd, IVOL_Status *status)
 
 /*
  *  ======== scale ========
+ *  Constant gain in Q8, unrolled by four so the multiplies pipeline.
+ */
+static Void scale(XDAS_Int16 *in, XDAS_Int16 *out, Int nWords, 
+    XDAS_Int32 gain)
+{
+    Int i;
+    XDAS_Int32 y0, y1, y2, y3;
+    
+    for (i = 0; i + 4 <= nWords; i += 4) {
+        y0 = ((XDAS_Int32)in[i]     * gain) >> 8;
+        y1 = ((XDAS_Int32)in[i + 1] * gain) >> 8;
+        y2 = ((XDAS_Int32)in[i + 2] * gain) >> 8;
+        y3 = ((XDAS_Int32)in[i + 3] * gain) >> 8;
+        out[i]     = SATURATE(y0);
+        out[i + 1] = SATURATE(y1);
+        out[i + 2] = SATURATE(y2);
+        out[i + 3] = SATURATE(y3);
+    }
+    for (; i < nWords; i++) {
+        y0 = ((XDAS_Int32)in[i] * gain) >> 8;
+        out[i] = SATURATE(y0);
+    }
+}
+
+/*
+ *  ======== scaleLinear ========
+ *  Gain moves by step per sample, starting one step past gain.
  */
-static Void scale(XDAS_Int16 *buf, Int nWords, Int gainPercentage)
+static Void scaleLinear(XDAS_Int16 *in, XDAS_Int16 *out, Int nWords,
+    XDAS_Int32 gain, XDAS_Int32 step)
 {
-    XDAS_Int16 i;
-    /* convert gain percent from 1/100 to 1/256 so we can shift, not divide */
-    XDAS_Int32 gain = ( ((XDAS_Int32)gainPercentage << 8) / (XDAS_Int32)100 );
+    Int i;
+    XDAS_Int32 y;
     
-    for (i = 0; i < nWords; i++)
-    {
-        buf[i] = (XDAS_Int16) (((XDAS_Int32)buf[i] * gain) >> 8);
+    for (i = 0; i < nWords; i++) {
+        gain += step;
+        y = ((XDAS_Int32)in[i] * (gain >> VOL_TI_GAINFRAC)) >> 8;
+        out[i] = SATURATE(y);
     }
 }
 
+/*
+ *  ======== scaleExp ========
+ *  One-pole smoothing of the gain towards target; returns where it got to.
+ */
+static XDAS_Int32 scaleExp(XDAS_Int16 *in, XDAS_Int16 *out, Int nWords,
+    XDAS_Int32 gain, XDAS_Int32 target)
+{
+    Int i;
+    XDAS_Int32 y;
+    XDAS_Int32 delta;
+    
+    for (i = 0; i < nWords; i++) {
+        delta = target - gain;
+        
+        /* snap once the remaining gap is under one step of the Q8 gain */
+        if (delta < VOL_TI_GAINONE && delta > -VOL_TI_GAINONE) {
+            gain = target;
+        }
+        else {
+            gain += delta >> EXPSHIFT;
+        }
+        y = ((XDAS_Int32)in[i] * (gain >> VOL_TI_GAINFRAC)) >> 8;
+        out[i] = SATURATE(y);
+    }
+
+    return (gain);
+}
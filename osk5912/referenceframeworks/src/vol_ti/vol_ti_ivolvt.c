@@ -37,8 +37,16 @@ IVOL_Fxns VOL_TI_IVOL = {       /* module_vendor_interface */
     IALGFXNS,                   /* IALG functions */
     VOL_TI_amplify,             /* The vol fxn */
     VOL_TI_control,             /* Control function */
+    VOL_TI_amplifyBlock,        /* The vol fxn on part of a frame */
 };
 
 /* Overlay v-tables to save data space */
+#ifdef _HOST_
+/* the host assembler has no .set; duplicate the structure instead */
+IALG_Fxns VOL_TI_IALG = {
+    IALGFXNS
+};
+#else
 asm("_VOL_TI_IALG  .set _VOL_TI_IVOL");
+#endif
 
@@ -20,6 +20,7 @@
 #ifndef VOL_TI_PRIV_
 #define VOL_TI_PRIV_
 
+#include <stddef.h>
 #include <ialg.h>
 #include "ivol.h"
 
@@ -27,12 +28,28 @@
 extern "C" {
 #endif
 
+/* gain is kept in Q8 with VOL_TI_GAINFRAC more bits of fraction for ramps */
+#define VOL_TI_GAINFRAC     16
+#define VOL_TI_GAINONE      ((XDAS_Int32)1 << VOL_TI_GAINFRAC)
+#define VOL_TI_GAIN(pct)    \
+    ((((XDAS_Int32)(pct) << 8) / (XDAS_Int32)100) << VOL_TI_GAINFRAC)
+
+/* TRUE if the caller's IVOL_Params or IVOL_Status, going by its size, has field */
+#define VOL_TI_HASPARAM(params, field) \
+    ((params)->size >= (Int)(offsetof(IVOL_Params, field) + sizeof((params)->field)))
+#define VOL_TI_HASSTATUS(status, field) \
+    ((status)->size >= (Int)(offsetof(IVOL_Status, field) + sizeof((status)->field)))
+
 /* instance object */
 typedef struct VOL_TI_Obj {
     IALG_Obj    ialg;           /* MUST be first field of all XDAIS algs */
-    XDAS_Int16  *scaleBuf;      /* on-chip scaling buffer */
     Int         frameLen;       /* length of the frame scaled */     
     Int         gainPercentage; /* how much to amplify, 100 = no change */
+    Int         rampMode;       /* how gain changes are applied */
+    XDAS_Int32  gain;           /* gain applied now, Q8 << VOL_TI_GAINFRAC */
+    XDAS_Int32  rampStep;       /* linear ramp step per sample */
+    XDAS_Int32  rampEnd;        /* gain the linear ramp ends the frame at */
+    Int         framePos;       /* samples of the frame scaled so far */
 } VOL_TI_Obj;
 
 /*  IALG fxn declarations */
@@ -51,6 +68,8 @@ extern Void VOL_TI_moved(IALG_Handle handle,
 
 /*  IVOL fxn declarations */
 extern Void VOL_TI_amplify(IVOL_Handle handle, XDAS_Int16 *in, XDAS_Int16 *out);
+extern Void VOL_TI_amplifyBlock(IVOL_Handle handle, XDAS_Int16 *in,
+                                XDAS_Int16 *out, Int nWords);
 extern Int VOL_TI_control(IVOL_Handle handle, IVOL_Cmd cmd, IVOL_Status *status);
 
 #ifdef __cplusplus